@@ -25,6 +25,15 @@ extern "C" {
 
 
 
+/***********************************************************************************************************************
+ *      CONFIG DEFINE
+ **********************************************************************************************************************/
+#ifndef EFSS_BLOB_READERSLOT
+  #define EFSS_BLOB_READERSLOT                                                            ( ( uint32_t )         0x04u )
+#endif
+
+
+
 /***********************************************************************************************************************
  *      PUBLIC TYPEDEFS
  **********************************************************************************************************************/
@@ -45,7 +54,9 @@ typedef enum
     e_eFSS_BLOB_RES_OK_BKP_RCVRD,
     e_eFSS_BLOB_RES_BLOBNOTCHECKED,
     e_eFSS_BLOB_RES_WRITEONGOING,
-    e_eFSS_BLOB_RES_WRITENOSTARTED
+    e_eFSS_BLOB_RES_WRITENOSTARTED,
+    e_eFSS_BLOB_RES_READERNOTVALID,
+    e_eFSS_BLOB_RES_INPROGRESS
 }e_eFSS_BLOB_RES;
 
 typedef struct
@@ -55,9 +66,37 @@ typedef struct
     bool_t bIsWriteOngoing;
     uint32_t uDataWritten;
     uint32_t uCrcOfDataWritten;
+    uint32_t uCrcWithPartPage;
     uint32_t uCurrentSeqN;
+    uint32_t uBlobGen;
+    uint8_t* puTailBuf;
+    uint32_t uTailBufL;
+    bool_t bIsAbSlot;
+    bool_t bActiveIsOri;
+    t_eFSS_TYPE_TimeCtx* ptCtxTime;
+    f_eFSS_TYPE_TimeCb fTime;
+    t_eFSS_TYPE_LatHist tLatAdd;
+    t_eFSS_TYPE_LatHist tLatStatus;
+    t_eFSS_TYPE_LatHist tLatFormat;
+    bool_t bIsFormatOngoing;
+    uint32_t uFormatIdx;
+    uint8_t uPadVal;
+    t_eFSS_TYPE_ScrubCtx tScrub;
 }t_eFSS_BLOB_Ctx;
 
+typedef struct
+{
+    uint8_t* puCache;
+    uint32_t uNSlot;
+    uint32_t uSlotPage[EFSS_BLOB_READERSLOT];
+    uint32_t uSlotAge[EFSS_BLOB_READERSLOT];
+    uint32_t uAgeCnt;
+    uint32_t uLastPage;
+    uint32_t uBlobSize;
+    uint32_t uBlobGen;
+    bool_t bIsOpen;
+}t_eFSS_BLOB_Reader;
+
 
 
 /***********************************************************************************************************************
@@ -91,6 +130,44 @@ e_eFSS_BLOB_RES eFSS_BLOB_InitCtx(t_eFSS_BLOB_Ctx* const p_ptCtx, const t_eFSS_T
  */
 e_eFSS_BLOB_RES eFSS_BLOB_IsInit(t_eFSS_BLOB_Ctx* const p_ptCtx, bool_t* const p_pbIsInit);
 
+/**
+ * @brief       Give to the blob module a buffer where to keep the last partially filled page during a write. When
+ *              this buffer is present eFSS_BLOB_AppendData write every page only once, when it's full, and never
+ *              need to load it back from the storage. The buffer must not be used for other operation after this
+ *              call.
+ *
+ * @param[in]   p_ptCtx        - Blob context
+ * @param[in]   p_puTailBuf    - Pointer to the buffer used to keep the tail page
+ * @param[in]   p_uTailBufL    - Size of p_puTailBuf, must be at least the size of a page buffer
+ *
+ * @return      e_eFSS_BLOB_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_BLOB_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *              e_eFSS_BLOB_RES_NOINITLIB     - Need to init the lib before calling this function
+ *              e_eFSS_BLOB_RES_CORRUPTCTX    - Context is corrupted
+ *              e_eFSS_BLOB_RES_WRITEONGOING  - A write operation is ongoing
+ *              e_eFSS_BLOB_RES_OK            - Operation ended correctly
+ */
+e_eFSS_BLOB_RES eFSS_BLOB_InitTailBuff(t_eFSS_BLOB_Ctx* const p_ptCtx, uint8_t* const p_puTailBuf,
+                                       const uint32_t p_uTailBufL);
+
+/**
+ * @brief       Use the origin and the backup area as two alternate A/B slots instead of an area and its copy. The
+ *              active slot is the valid one with the newest sequence number. A write is done in the not active slot,
+ *              that become the active one only when eFSS_BLOB_EndWrite write its last page, so every update write
+ *              the blob only once and no backup clone is needed. While a write is ongoing the last complete blob
+ *              can still be read from the active slot.
+ *              Must be called after the init and before any other operation on the storage.
+ *
+ * @param[in]   p_ptCtx        - Blob context
+ *
+ * @return      e_eFSS_BLOB_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *              e_eFSS_BLOB_RES_NOINITLIB     - Need to init the lib before calling this function
+ *              e_eFSS_BLOB_RES_CORRUPTCTX    - Context is corrupted
+ *              e_eFSS_BLOB_RES_WRITEONGOING  - A write operation is ongoing
+ *              e_eFSS_BLOB_RES_OK            - Operation ended correctly
+ */
+e_eFSS_BLOB_RES eFSS_BLOB_InitAbSlot(t_eFSS_BLOB_Ctx* const p_ptCtx);
+
 /**
  * @brief       Get the status of the storage. This need to be the first function to call when using the blob, just to
  *              be sure that something usefull and not corrupted is avaiable for the next operation.
@@ -156,6 +233,19 @@ e_eFSS_BLOB_RES eFSS_BLOB_GetInfo(t_eFSS_BLOB_Ctx* const p_ptCtx, uint32_t* cons
  */
 e_eFSS_BLOB_RES eFSS_BLOB_Format(t_eFSS_BLOB_Ctx* const p_ptCtx);
 
+/**
+ * @brief       Same as eFSS_BLOB_Format, but write only one page for every call. The first call start the format,
+ *              every following call continue it till the original and the backup pages are written. Till the format
+ *              is not ended e_eFSS_BLOB_RES_INPROGRESS is returned. Calling any other function that verify the
+ *              storage abandon the format, and the storage is checked like after a power loss during the format.
+ *
+ * @param[in]   p_ptCtx      - Blob context
+ *
+ * @return      e_eFSS_BLOB_RES_INPROGRESS         - The format is not ended, call the function again
+ *              Every other value returned by eFSS_BLOB_Format
+ */
+e_eFSS_BLOB_RES eFSS_BLOB_FormatStep(t_eFSS_BLOB_Ctx* const p_ptCtx);
+
 /**
  * @brief       Read the blob already presente in storage.
  *
@@ -262,6 +352,117 @@ e_eFSS_BLOB_RES eFSS_BLOB_EndWrite(t_eFSS_BLOB_Ctx* const p_ptCtx);
  */
 e_eFSS_BLOB_RES eFSS_BLOB_AbortWrite(t_eFSS_BLOB_Ctx* const p_ptCtx);
 
+/**
+ * @brief       Open a streaming reader on the blob already present in storage. The reader keep a small LRU cache of
+ *              pages already loaded and validated, so repeated or sequential small reads load every page from the
+ *              storage only once. The reader is invalidated by any operation that can modify the stored blob
+ *              (Format, StartWrite, GetStorageStatus), and must be opened again after that.
+ *
+ * @param[in]   p_ptCtx      - Blob context
+ * @param[in]   p_ptReader   - Reader context to open
+ * @param[in]   p_puCache    - Pointer to a buffer used to cache pages. Every page use a slot of the size of the
+ *                             usable page buffer, and only EFSS_BLOB_READERSLOT slots are used.
+ * @param[in]   p_uCacheL    - Size of p_puCache, must contain at least one slot
+ *
+ * @return      e_eFSS_BLOB_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *		        e_eFSS_BLOB_RES_BADPARAM           - In case of an invalid parameter passed to the function
+ *              e_eFSS_BLOB_RES_OK                 - Operation ended correctly
+ *              e_eFSS_BLOB_RES_OK_BKP_RCVRD       - All ok, but some page where recovered
+ *              e_eFSS_BLOB_RES_NOTVALIDBLOB       - No valid blob founded
+ *              e_eFSS_BLOB_RES_NEWVERSIONBLOB     - New version of the blob requested
+ *              e_eFSS_BLOB_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_BLOB_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_BLOB_RES_WRITEONGOING       - A write operation is ongoing
+ *              e_eFSS_BLOB_RES_CLBCKERASEERR      - Erase callback returned error
+ *              e_eFSS_BLOB_RES_CLBCKWRITEERR      - Write callback returned error
+ *              e_eFSS_BLOB_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_BLOB_RES_CLBCKCRCERR        - Crc callback returned error
+ *              e_eFSS_BLOB_RES_WRITENOMATCHREAD   - After Write operation the Read operation readed different data
+ */
+e_eFSS_BLOB_RES eFSS_BLOB_ReaderOpen(t_eFSS_BLOB_Ctx* const p_ptCtx, t_eFSS_BLOB_Reader* const p_ptReader,
+                                     uint8_t* const p_puCache, const uint32_t p_uCacheL);
+
+/**
+ * @brief       Read the blob using an opened reader. Pages are served from the reader cache when possible, and when
+ *              a sequential access is detected the page following the requested one is loaded in advance.
+ *
+ * @param[in]   p_ptCtx      - Blob context
+ * @param[in]   p_ptReader   - Reader context opened with eFSS_BLOB_ReaderOpen
+ * @param[in]   p_uOffset    - Offset where to start read the blob
+ * @param[in]   p_uBuffL     - Size of p_puBuff and of the chunk we are going to read
+ * @param[out]  p_puBuff     - Pointer to a buffer where to copy readed data
+ *
+ * @return      e_eFSS_BLOB_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *		        e_eFSS_BLOB_RES_BADPARAM           - In case of an invalid parameter passed to the function
+ *              e_eFSS_BLOB_RES_OK                 - Operation ended correctly
+ *              e_eFSS_BLOB_RES_NOTVALIDBLOB       - No valid blob founded
+ *              e_eFSS_BLOB_RES_NEWVERSIONBLOB     - New version of the blob requested
+ *              e_eFSS_BLOB_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_BLOB_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_BLOB_RES_WRITEONGOING       - A write operation is ongoing
+ *              e_eFSS_BLOB_RES_READERNOTVALID     - The reader is not open or the blob changed after the opening
+ *              e_eFSS_BLOB_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_BLOB_RES_CLBCKCRCERR        - Crc callback returned error
+ */
+e_eFSS_BLOB_RES eFSS_BLOB_ReaderRead(t_eFSS_BLOB_Ctx* const p_ptCtx, t_eFSS_BLOB_Reader* const p_ptReader,
+                                     const uint32_t p_uOffset, const uint32_t p_uBuffL, uint8_t* const p_puBuff);
+
+/**
+ * @brief       Verify a part of the blob pages against their backup, repairing a divergent or corrupted copy.
+ *              Every call continue from the page where the previous one stopped and process pages till the budget
+ *              is exhausted, so this function can be called periodically by an idle task to walk the whole storage
+ *              incrementally. If the blob was not already checked, or a not valid original page is found, the
+ *              whole storage is verified and repaired like in eFSS_BLOB_GetStorageStatus, and every opened reader is
+ *              invalidated. Using A/B slots only the pages of the active slot are verified, the other one is not a
+ *              backup.
+ *
+ * @param[in]   p_ptCtx       - Blob context
+ * @param[in]   p_tBudget     - Budget of this call, see t_eFSS_TYPE_ScrubBudget
+ *
+ * @return      e_eFSS_BLOB_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_BLOB_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_BLOB_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_BLOB_RES_WRITEONGOING       - A write operation is ongoing
+ *              e_eFSS_BLOB_RES_NOTVALIDBLOB       - No valid blob founded
+ *              e_eFSS_BLOB_RES_NEWVERSIONBLOB     - New version of the blob requested
+ *              e_eFSS_BLOB_RES_CLBCKERASEERR      - Erase callback returned error
+ *              e_eFSS_BLOB_RES_CLBCKWRITEERR      - Write callback returned error
+ *              e_eFSS_BLOB_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_BLOB_RES_CLBCKCRCERR        - Crc callback returned error
+ *              e_eFSS_BLOB_RES_WRITENOMATCHREAD   - After Write operation the Read operation readed different data
+ *              e_eFSS_BLOB_RES_INPROGRESS         - The budget is exhausted before verifying every page
+ *              e_eFSS_BLOB_RES_OK_BKP_RCVRD       - Every page is verified and at least one page was repaired in
+ *                                                   this pass, the next call start a new pass
+ *              e_eFSS_BLOB_RES_OK                 - Every page is verified, the next call start a new pass
+ */
+e_eFSS_BLOB_RES eFSS_BLOB_Scrub(t_eFSS_BLOB_Ctx* const p_ptCtx, const t_eFSS_TYPE_ScrubBudget p_tBudget);
+
+/**
+ * @brief       Get the statistics of the operations done on the storage area since the init or the last reset,
+ *              see t_eFSS_TYPE_Stats.
+ *
+ * @param[in]   p_ptCtx       - Blob context
+ * @param[out]  p_ptStats     - Pointer to a statistics struct that will be filled with the collected counters
+ *
+ * @return      e_eFSS_BLOB_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_BLOB_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_BLOB_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_BLOB_RES_OK            - Operation ended correctly
+ */
+e_eFSS_BLOB_RES eFSS_BLOB_GetStats(t_eFSS_BLOB_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats);
+
+/**
+ * @brief       Reset to zero every statistics counter
+ *
+ * @param[in]   p_ptCtx       - Blob context
+ *
+ * @return      e_eFSS_BLOB_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_BLOB_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_BLOB_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_BLOB_RES_OK            - Operation ended correctly
+ */
+e_eFSS_BLOB_RES eFSS_BLOB_ResetStats(t_eFSS_BLOB_Ctx* const p_ptCtx);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
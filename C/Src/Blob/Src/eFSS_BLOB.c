@@ -17,6 +17,10 @@
  * 5 - Buffer passed during init as support buffer can be used for other operation when we are not calling a module
  *     function.
  * 6 - Generate backup pages only when the write process is ended.
+ * 7 - When A/B slots are used the origin and the backup area are two alternate slots. The active one is the valid slot
+ *     with the highest sequential number, writes are done in the other one and no page is ever cloned.
+ * 8 - The data outside the blob length are set to zero, or to the erased value with the programmable trailer, so
+ *     appending to a partially written page or storing the size and CRC only program erased byte in place.
  */
 
 /***********************************************************************************************************************
@@ -51,7 +55,12 @@ static e_eFSS_BLOB_RES eFSS_BLOB_BlobCtoBLOBRes(const e_eFSS_BLOBC_RES p_eCRes);
  **********************************************************************************************************************/
 static e_eFSS_BLOB_RES eFSS_BLOB_OriginBackupAligner(t_eFSS_BLOB_Ctx* const p_ptCtx);
 static e_eFSS_BLOB_RES eFSS_BLOB_IsAreaValid(t_eFSS_BLOB_Ctx* const p_ptCtx, const bool_t p_bIsOri,
-                                             bool_t* const p_pbIsVal);
+                                             bool_t* const p_pbIsVal, uint32_t* const p_puSeqN);
+static e_eFSS_BLOB_RES eFSS_BLOB_FindActiveSlot(t_eFSS_BLOB_Ctx* const p_ptCtx);
+static e_eFSS_BLOB_RES eFSS_BLOB_ReaderGetPage(t_eFSS_BLOB_Ctx* const p_ptCtx, t_eFSS_BLOB_Reader* const p_ptReader,
+                                               const uint32_t p_uPage, uint8_t** const p_ppuPage);
+static e_eFSS_BLOB_RES eFSS_BLOB_FormatNextPage(t_eFSS_BLOB_Ctx* const p_ptCtx, const t_eFSS_BLOBC_StorBuf p_tBuff,
+                                                const uint32_t p_uUsePages);
 
 
 
@@ -104,8 +113,17 @@ e_eFSS_BLOB_RES eFSS_BLOB_InitCtx(t_eFSS_BLOB_Ctx* const p_ptCtx, const t_eFSS_T
                     p_ptCtx->bIsWriteOngoing = false;
                     p_ptCtx->uDataWritten = 0u;
                     p_ptCtx->uCrcOfDataWritten = 0u;
+                    p_ptCtx->uCrcWithPartPage = 0u;
                     p_ptCtx->uCurrentSeqN = 0u;
-
+                    p_ptCtx->uBlobGen = 0u;
+                    p_ptCtx->puTailBuf = NULL;
+                    p_ptCtx->uTailBufL = 0u;
+                    p_ptCtx->bIsAbSlot = false;
+                    p_ptCtx->bActiveIsOri = true;
+                    p_ptCtx->bIsFormatOngoing = false;
+                    p_ptCtx->uFormatIdx = 0u;
+                    p_ptCtx->uPadVal = 0u;
+                    (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
                 }
                 else
                 {
@@ -114,7 +132,33 @@ e_eFSS_BLOB_RES eFSS_BLOB_InitCtx(t_eFSS_BLOB_Ctx* const p_ptCtx, const t_eFSS_T
                     p_ptCtx->bIsWriteOngoing = false;
                     p_ptCtx->uDataWritten = 0u;
                     p_ptCtx->uCrcOfDataWritten = 0u;
+                    p_ptCtx->uCrcWithPartPage = 0u;
                     p_ptCtx->uCurrentSeqN = 0u;
+                    p_ptCtx->uBlobGen = 0u;
+                    p_ptCtx->puTailBuf = NULL;
+                    p_ptCtx->uTailBufL = 0u;
+                    p_ptCtx->bIsAbSlot = false;
+                    p_ptCtx->bActiveIsOri = true;
+                    p_ptCtx->bIsFormatOngoing = false;
+                    p_ptCtx->uFormatIdx = 0u;
+                    (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
+
+                    /* With the programmable trailer pad with the erased value, so the pad can be programmed later */
+                    if( e_eFSS_TYPE_TRAIL_PROG == p_tStorSet.eTrailer )
+                    {
+                        p_ptCtx->uPadVal = p_tStorSet.uErasedVal;
+                    }
+                    else
+                    {
+                        p_ptCtx->uPadVal = 0u;
+                    }
+
+                    /* Latency of the public function is measured here, the storage one by the core */
+                    p_ptCtx->ptCtxTime = p_tCtxCb.ptCtxTime;
+                    p_ptCtx->fTime = p_tCtxCb.fTime;
+                    (void)memset(&p_ptCtx->tLatAdd, 0, sizeof(t_eFSS_TYPE_LatHist));
+                    (void)memset(&p_ptCtx->tLatStatus, 0, sizeof(t_eFSS_TYPE_LatHist));
+                    (void)memset(&p_ptCtx->tLatFormat, 0, sizeof(t_eFSS_TYPE_LatHist));
                 }
             }
             else
@@ -127,7 +171,17 @@ e_eFSS_BLOB_RES eFSS_BLOB_InitCtx(t_eFSS_BLOB_Ctx* const p_ptCtx, const t_eFSS_T
                 p_ptCtx->bIsWriteOngoing = false;
                 p_ptCtx->uDataWritten = 0u;
                 p_ptCtx->uCrcOfDataWritten = 0u;
+                p_ptCtx->uCrcWithPartPage = 0u;
                 p_ptCtx->uCurrentSeqN = 0u;
+                p_ptCtx->uBlobGen = 0u;
+                p_ptCtx->puTailBuf = NULL;
+                p_ptCtx->uTailBufL = 0u;
+                p_ptCtx->bIsAbSlot = false;
+                p_ptCtx->bActiveIsOri = true;
+                p_ptCtx->bIsFormatOngoing = false;
+                p_ptCtx->uFormatIdx = 0u;
+                p_ptCtx->uPadVal = 0u;
+                (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
             }
         }
     }
@@ -155,6 +209,130 @@ e_eFSS_BLOB_RES eFSS_BLOB_IsInit(t_eFSS_BLOB_Ctx* const p_ptCtx, bool_t* const p
 	return l_eRes;
 }
 
+e_eFSS_BLOB_RES eFSS_BLOB_InitTailBuff(t_eFSS_BLOB_Ctx* const p_ptCtx, uint8_t* const p_puTailBuf,
+                                       const uint32_t p_uTailBufL)
+{
+	/* Local return variable */
+	e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+    bool_t l_bIsInit;
+
+    /* Local variable used for storage */
+    t_eFSS_BLOBC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puTailBuf ) )
+	{
+		l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_BLOBC_IsInit(&p_ptCtx->tBLOBCCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Cannot change the tail buffer while it could contain data */
+                    if( true == p_ptCtx->bIsWriteOngoing )
+                    {
+                        l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
+                    }
+                    else
+                    {
+                        l_uUsePages = 0u;
+                        l_eResC = eFSS_BLOBC_GetBuffNUsable(&p_ptCtx->tBLOBCCtx, &l_tBuff, &l_uUsePages);
+                        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                        {
+                            /* The tail buffer must contain a whole page */
+                            if( p_uTailBufL < l_tBuff.uBufL )
+                            {
+                                l_eRes = e_eFSS_BLOB_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                p_ptCtx->puTailBuf = p_puTailBuf;
+                                p_ptCtx->uTailBufL = p_uTailBufL;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_BLOB_RES eFSS_BLOB_InitAbSlot(t_eFSS_BLOB_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_BLOBC_IsInit(&p_ptCtx->tBLOBCCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    if( true == p_ptCtx->bIsWriteOngoing )
+                    {
+                        l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
+                    }
+                    else
+                    {
+                        /* The meaning of the two area changed, the active slot must be searched again */
+                        p_ptCtx->bIsAbSlot = true;
+                        p_ptCtx->bIsBlobCheked = false;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
 e_eFSS_BLOB_RES eFSS_BLOB_GetStorageStatus(t_eFSS_BLOB_Ctx* const p_ptCtx)
 {
 	/* Local return variable */
@@ -164,6 +342,10 @@ e_eFSS_BLOB_RES eFSS_BLOB_GetStorageStatus(t_eFSS_BLOB_Ctx* const p_ptCtx)
     /* Local variable for calculation */
     bool_t l_bIsInit;
 
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
 	{
@@ -191,20 +373,25 @@ e_eFSS_BLOB_RES eFSS_BLOB_GetStorageStatus(t_eFSS_BLOB_Ctx* const p_ptCtx)
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     if( true == p_ptCtx->bIsWriteOngoing )
                     {
                         l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
                     }
                     else
                     {
-                        /* Align if possible corrupted area, forcing the process */
+                        /* Align if possible corrupted area, forcing the process. The aligner set the checked
+                           flag again when the blob is valid */
+                        p_ptCtx->bIsBlobCheked = false;
                         l_eRes = eFSS_BLOB_OriginBackupAligner(p_ptCtx);
+                    }
 
-                        if( ( e_eFSS_BLOB_RES_OK == l_eRes ) || ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == l_eRes ) )
-                        {
-                            /* All ok now */
-                            p_ptCtx->bIsBlobCheked = false;
-                        }
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatStatus);
                     }
                 }
             }
@@ -265,7 +452,7 @@ e_eFSS_BLOB_RES eFSS_BLOB_GetInfo(t_eFSS_BLOB_Ctx* const p_ptCtx, uint32_t* cons
                     else
                     {
                         /* If a write operation is started we are not able to provide correct data */
-                        if( true == p_ptCtx->bIsWriteOngoing )
+                        if( ( true == p_ptCtx->bIsWriteOngoing ) && ( false == p_ptCtx->bIsAbSlot ) )
                         {
                             l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
                         }
@@ -286,7 +473,7 @@ e_eFSS_BLOB_RES eFSS_BLOB_GetInfo(t_eFSS_BLOB_Ctx* const p_ptCtx, uint32_t* cons
                                 if( e_eFSS_BLOB_RES_OK == l_eRes )
                                 {
                                     /* Load the last page, where blob length is stored */
-                                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, true,
+                                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, p_ptCtx->bActiveIsOri,
                                                                         ( l_uUsePages - 1u ), &l_uSeqNumb);
                                     l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
                                     if( e_eFSS_BLOB_RES_OK == l_eRes )
@@ -329,8 +516,10 @@ e_eFSS_BLOB_RES eFSS_BLOB_Format(t_eFSS_BLOB_Ctx* const p_ptCtx)
     bool_t l_bIsInit;
     t_eFSS_BLOBC_StorBuf l_tBuff;
     uint32_t l_uUsePages;
-    uint32_t l_uCurrPage;
-    uint32_t l_uCrcOffset;
+
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -359,6 +548,9 @@ e_eFSS_BLOB_RES eFSS_BLOB_Format(t_eFSS_BLOB_Ctx* const p_ptCtx)
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     /* If a write operation is started we are not able to do other operation */
                     if( true == p_ptCtx->bIsWriteOngoing )
                     {
@@ -374,62 +566,97 @@ e_eFSS_BLOB_RES eFSS_BLOB_Format(t_eFSS_BLOB_Ctx* const p_ptCtx)
 
                         if( e_eFSS_BLOB_RES_OK == l_eRes )
                         {
-                            /* To format the blob we need to :
-                               1 - Write zero in every page
-                               2 - Use One as sequence numbers of every page
-                               2 - use as CRC the seed
-                               3 - Write in the last page the calculated CRC and Zero as blob Len
-                             */
-
-                            /* Init local variable */
-                            l_uCurrPage = 0u;
+                            /* Start a new format even if a stepped one is ongoing, and execute it till the end */
+                            p_ptCtx->bIsFormatOngoing = false;
+                            l_eRes = e_eFSS_BLOB_RES_INPROGRESS;
 
-                            /* Do the things here */
-                            while( ( l_uCurrPage < l_uUsePages ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
+                            while( e_eFSS_BLOB_RES_INPROGRESS == l_eRes )
                             {
-                                /* Clear buffer */
-                                (void)memset(l_tBuff.puBuf, 0, l_tBuff.uBufL);
+                                l_eRes = eFSS_BLOB_FormatNextPage(p_ptCtx, l_tBuff, l_uUsePages);
+                            }
+                        }
+                    }
 
-                                if( ( l_uUsePages - 1u ) == l_uCurrPage )
-                                {
-                                    /* Last page, Insert the CRC seed. No need to udpate the LEN because is zero  */
-                                    l_uCrcOffset = ( l_tBuff.uBufL - EFSS_BLOB_CRCOFF );
-                                    if( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_uCrcOffset], EFSS_BLOB_SEED ) )
-                                    {
-                                        l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
-                                    }
-                                }
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatFormat);
+                    }
+                }
+            }
+        }
+	}
 
-                                /* If all ok flush the page in storage */
-                                if( e_eFSS_BLOB_RES_OK == l_eRes )
-                                {
-                                    l_eResC = eFSS_BLOBC_FlushBufferInPage( &p_ptCtx->tBLOBCCtx, true, l_uCurrPage,
-                                                                            EFSS_SEQN_START );
-                                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
-                                }
+	return l_eRes;
+}
 
-                                /* Erase next page */
-                                l_uCurrPage++;
-                            }
+e_eFSS_BLOB_RES eFSS_BLOB_FormatStep(t_eFSS_BLOB_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
 
-                            /* original page done, if all ok create the backup */
-                            if( e_eFSS_BLOB_RES_OK == l_eRes )
-                            {
-                                l_eResC = eFSS_BLOBC_CloneArea(&p_ptCtx->tBLOBCCtx, true);
-                                l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+    /* Local variable for calculation */
+    bool_t l_bIsInit;
+    t_eFSS_BLOBC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
 
-                                if( e_eFSS_BLOB_RES_OK == l_eRes )
-                                {
-                                    /* Erase internal status data */
-                                    p_ptCtx->bIsBlobCheked = true;
-                                    p_ptCtx->bIsWriteOngoing = false;
-                                    p_ptCtx->uDataWritten = 0u;
-                                    p_ptCtx->uCrcOfDataWritten = 0u;
-                                    p_ptCtx->uCurrentSeqN = EFSS_SEQN_START;
-                                }
-                            }
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_BLOBC_IsInit(&p_ptCtx->tBLOBCCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Measure the latency of the single step, the clone of the backup pages included */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
+                    /* If a write operation is started we are not able to do other operation */
+                    if( true == p_ptCtx->bIsWriteOngoing )
+                    {
+                        l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
+                    }
+                    else
+                    {
+                        l_uUsePages = 0u;
+                        l_eResC = eFSS_BLOBC_GetBuffNUsable(&p_ptCtx->tBLOBCCtx, &l_tBuff, &l_uUsePages);
+                        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                        {
+                            l_eRes = eFSS_BLOB_FormatNextPage(p_ptCtx, l_tBuff, l_uUsePages);
                         }
                     }
+
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatFormat);
+                    }
                 }
             }
         }
@@ -488,7 +715,7 @@ e_eFSS_BLOB_RES eFSS_BLOB_ReadBlob(t_eFSS_BLOB_Ctx* const p_ptCtx, const uint32_
                 }
                 else
                 {
-                    if( true == p_ptCtx->bIsWriteOngoing )
+                    if( ( true == p_ptCtx->bIsWriteOngoing ) && ( false == p_ptCtx->bIsAbSlot ) )
                     {
                         l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
                     }
@@ -507,7 +734,7 @@ e_eFSS_BLOB_RES eFSS_BLOB_ReadBlob(t_eFSS_BLOB_Ctx* const p_ptCtx, const uint32_
                             if( e_eFSS_BLOB_RES_OK == l_eRes )
                             {
                                 /* Get Blob info, load last page */
-                                l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, true,
+                                l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, p_ptCtx->bActiveIsOri,
                                                                         ( l_uUsePages - 1u ), &l_uSeqN);
                                 l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
                                 if( e_eFSS_BLOB_RES_OK == l_eRes )
@@ -548,8 +775,9 @@ e_eFSS_BLOB_RES eFSS_BLOB_ReadBlob(t_eFSS_BLOB_Ctx* const p_ptCtx, const uint32_
                                                 while( ( l_uRemToRead > 0u ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
                                                 {
                                                     /* Read the current buffer */
-                                                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, true,
-                                                                                            l_uCurrPage, &l_uSeqN);
+                                                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx,
+                                                                                        p_ptCtx->bActiveIsOri,
+                                                                                        l_uCurrPage, &l_uSeqN);
                                                     l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
 
                                                     if( e_eFSS_BLOB_RES_OK == l_eRes )
@@ -636,6 +864,13 @@ e_eFSS_BLOB_RES eFSS_BLOB_StartWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
                     }
                     else
                     {
+                        /* The backup area can still keep the blob present before the last write, force the
+                           alignment so an abort will restore the last complete blob */
+                        if( false == p_ptCtx->bIsAbSlot )
+                        {
+                            p_ptCtx->bIsBlobCheked = false;
+                        }
+
                         /* Fix any memory problem */
                         l_eRes = eFSS_BLOB_OriginBackupAligner(p_ptCtx);
 
@@ -643,7 +878,7 @@ e_eFSS_BLOB_RES eFSS_BLOB_StartWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
                         {
                             /* Load a page just to read sequential number and increase it */
                             l_uSeqN = 0u;
-                            l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, true,
+                            l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, p_ptCtx->bActiveIsOri,
                                                                     0u, &l_uSeqN);
                             l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
 
@@ -652,8 +887,16 @@ e_eFSS_BLOB_RES eFSS_BLOB_StartWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
                                 /* Now we can write data */
                                 p_ptCtx->bIsWriteOngoing = true;
                                 p_ptCtx->uDataWritten = 0u;
-                                p_ptCtx->uCrcOfDataWritten = 0u;
+                                p_ptCtx->uCrcOfDataWritten = EFSS_BLOB_SEED;
+                                p_ptCtx->uCrcWithPartPage = EFSS_BLOB_SEED;
                                 p_ptCtx->uCurrentSeqN = l_uSeqN + 1u;
+
+                                /* Blob is going to change, any opened reader is no more valid. Using A/B slots
+                                   the active slot is not touched till the end of the write */
+                                if( false == p_ptCtx->bIsAbSlot )
+                                {
+                                    p_ptCtx->uBlobGen++;
+                                }
                             }
                         }
                     }
@@ -684,7 +927,15 @@ e_eFSS_BLOB_RES eFSS_BLOB_AppendData(t_eFSS_BLOB_Ctx* const p_ptCtx, uint8_t* co
     uint32_t l_uCurPageOff;
     uint32_t l_uRemToWrite;
     uint32_t l_uWrittenByte;
+    uint32_t l_uToCopy;
     uint32_t l_uSeqN;
+    bool_t l_bIsPageFull;
+    bool_t l_bIsFirstFlush;
+    bool_t l_bWriteInOri;
+
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuff ) )
@@ -713,6 +964,9 @@ e_eFSS_BLOB_RES eFSS_BLOB_AppendData(t_eFSS_BLOB_Ctx* const p_ptCtx, uint8_t* co
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     if( false == p_ptCtx->bIsWriteOngoing )
                     {
                         l_eRes = e_eFSS_BLOB_RES_WRITENOSTARTED;
@@ -744,68 +998,109 @@ e_eFSS_BLOB_RES eFSS_BLOB_AppendData(t_eFSS_BLOB_Ctx* const p_ptCtx, uint8_t* co
                                 l_uCurrPage = (uint32_t)(p_ptCtx->uDataWritten / l_tBuff.uBufL);
                                 l_uCurPageOff = (uint32_t)(p_ptCtx->uDataWritten % l_tBuff.uBufL);
 
+                                /* Write in the origin area, or in the not active slot when using A/B slots */
+                                l_bWriteInOri = ( ( false == p_ptCtx->bIsAbSlot ) ||
+                                                  ( false == p_ptCtx->bActiveIsOri ) );
+
                                 while( ( l_uRemToWrite > 0u ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
                                 {
-                                    /* First load the page that we want to write, because we could have some
-                                       already appended data */
-                                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, true, l_uCurrPage,
-                                                                            &l_uSeqN);
-                                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                                    /* Init variable */
+                                    l_uWrittenByte = p_uBuffL - l_uRemToWrite;
+                                    l_uToCopy = l_tBuff.uBufL - l_uCurPageOff;
+                                    if( l_uToCopy > l_uRemToWrite )
+                                    {
+                                        l_uToCopy = l_uRemToWrite;
+                                    }
+                                    l_bIsPageFull = ( ( l_uCurPageOff + l_uToCopy ) == l_tBuff.uBufL );
 
-                                    if( e_eFSS_BLOB_RES_OK == l_eRes )
+                                    /* A page is flushed here for the first time when kept in RAM till full, or
+                                       when started from the beginning */
+                                    l_bIsFirstFlush = ( ( NULL != p_ptCtx->puTailBuf ) || ( 0u == l_uCurPageOff ) );
+
+                                    if( NULL != p_ptCtx->puTailBuf )
                                     {
-                                        /* Init variable */
-                                        l_uWrittenByte = p_uBuffL - l_uRemToWrite;
+                                        /* Collect data in the tail buffer, the page is written only when full */
+                                        (void)memcpy(&p_ptCtx->puTailBuf[l_uCurPageOff], &p_puBuff[l_uWrittenByte],
+                                                     l_uToCopy);
 
-                                        /* Are we able to fill a full page? If yes, we can calculate the CRC of the
-                                           whole page also, if not, we insert data and fill the remaining space with
-                                           zero. We will calculate the CRC of the inserted data on the next round */
-                                        if( l_uRemToWrite >= ( l_tBuff.uBufL - l_uCurPageOff ) )
+                                        if( true == l_bIsPageFull )
                                         {
-                                            /* full fill the page with data */
-                                            (void)memcpy(&l_tBuff.puBuf[l_uCurPageOff], &p_puBuff[l_uWrittenByte],
-                                                         ( l_tBuff.uBufL - l_uCurPageOff ) );
+                                            (void)memcpy(l_tBuff.puBuf, p_ptCtx->puTailBuf, l_tBuff.uBufL);
+                                        }
+                                    }
+                                    else
+                                    {
+                                        /* Only a page where we have already appended some data need to be loaded,
+                                           a page where we start from the beginning is written blind */
+                                        if( 0u != l_uCurPageOff )
+                                        {
+                                            l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, l_bWriteInOri,
+                                                                                l_uCurrPage, &l_uSeqN);
+                                            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                                        }
 
-                                            l_uCurPageOff = 0u;
-                                            l_uRemToWrite -= ( l_tBuff.uBufL - l_uCurPageOff );
+                                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                                        {
+                                            /* Pad the unused data and copy the new one */
+                                            (void)memset(&l_tBuff.puBuf[l_uCurPageOff], (int)p_ptCtx->uPadVal,
+                                                         ( l_tBuff.uBufL - l_uCurPageOff ) );
+                                            (void)memcpy(&l_tBuff.puBuf[l_uCurPageOff], &p_puBuff[l_uWrittenByte],
+                                                         l_uToCopy);
+                                        }
+                                    }
 
-                                            /* if it's not the last page we can calculate the CRC of the buffer.
-                                               The CRC of the last page is calculated at the end, when we are able to
-                                               append the BLOB size also */
-                                            if( ( l_uUsePages - 1u ) != l_uCurrPage )
+                                    /* Flush a full page, or a partial page when it cannot be kept in RAM */
+                                    if( ( e_eFSS_BLOB_RES_OK == l_eRes ) &&
+                                        ( ( true == l_bIsPageFull ) || ( NULL == p_ptCtx->puTailBuf ) ) )
+                                    {
+                                        /* The CRC of the last page is calculated at the end, when we are able to
+                                           append the BLOB size also */
+                                        if( ( l_uUsePages - 1u ) != l_uCurrPage )
+                                        {
+                                            if( true == l_bIsPageFull )
                                             {
+                                                /* Full page, can be added to the CRC of the blob */
                                                 l_eResC =  eFSS_BLOBC_CalcCrcInBuff(&p_ptCtx->tBLOBCCtx,
                                                                                           p_ptCtx->uCrcOfDataWritten,
                                                                                           l_tBuff.uBufL,
                                                                                           &p_ptCtx->uCrcOfDataWritten);
                                                 l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                                                p_ptCtx->uCrcWithPartPage = p_ptCtx->uCrcOfDataWritten;
+                                            }
+                                            else
+                                            {
+                                                /* Keep also the CRC of the padded page as it will be flushed,
+                                                   so the end of the write will not need to load it again */
+                                                l_eResC =  eFSS_BLOBC_CalcCrcInBuff(&p_ptCtx->tBLOBCCtx,
+                                                                                          p_ptCtx->uCrcOfDataWritten,
+                                                                                          l_tBuff.uBufL,
+                                                                                          &p_ptCtx->uCrcWithPartPage);
+                                                l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
                                             }
-                                        }
-                                        else
-                                        {
-                                            /* Set to zero the unused data, and do no calculate the CRC. */
-                                            (void)memset(&l_tBuff.puBuf[l_uCurPageOff], 0,
-                                                         ( l_tBuff.uBufL - l_uCurPageOff ) );
-
-                                            /* Copy remaining data */
-                                            (void)memcpy(&l_tBuff.puBuf[l_uCurPageOff], &p_puBuff[l_uWrittenByte],
-                                                         l_uRemToWrite);
-                                            l_uCurPageOff = 0u;
-                                            l_uRemToWrite = 0u;
                                         }
 
-                                        /* If previous operation are OK we can flush the updated page */
+                                        if( ( e_eFSS_BLOB_RES_OK == l_eRes ) && ( true == l_bIsFirstFlush ) )
+                                        {
+                                            /* Every page of the area will be rewritten before the end of the
+                                               write, erase the whole block only once */
+                                            l_eResC = eFSS_BLOBC_EraseBlkIfFirst(&p_ptCtx->tBLOBCCtx, l_bWriteInOri,
+                                                                                 l_uCurrPage);
+                                            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                                        }
+
                                         if( e_eFSS_BLOB_RES_OK == l_eRes )
                                         {
                                             /* Buffer flush */
-                                            l_eResC = eFSS_BLOBC_FlushBufferInPage(&p_ptCtx->tBLOBCCtx, true,
+                                            l_eResC = eFSS_BLOBC_FlushBufferInPage(&p_ptCtx->tBLOBCCtx, l_bWriteInOri,
                                                                                    l_uCurrPage, p_ptCtx->uCurrentSeqN);
                                             l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
                                         }
-
-                                        /* Increase the page so we can write on the next one */
-                                        l_uCurrPage++;
                                     }
+
+                                    /* Continue on the next page */
+                                    l_uRemToWrite -= l_uToCopy;
+                                    l_uCurPageOff = 0u;
+                                    l_uCurrPage++;
                                 }
 
                                 /* If all ok increase context counter */
@@ -816,6 +1111,12 @@ e_eFSS_BLOB_RES eFSS_BLOB_AppendData(t_eFSS_BLOB_Ctx* const p_ptCtx, uint8_t* co
                             }
                         }
                     }
+
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatAdd);
+                    }
                 }
             }
         }
@@ -836,10 +1137,10 @@ e_eFSS_BLOB_RES eFSS_BLOB_EndWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
     uint32_t l_uUsePages;
     uint32_t l_uCurrPage;
     uint32_t l_uCurPageOff;
-    uint32_t l_uRemToWrite;
     uint32_t l_uSeqN;
-    uint32_t l_uMaxBlobSize;
     uint32_t l_uLenCrcOff;
+    uint32_t l_uBlobCrc;
+    bool_t l_bWriteInOri;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -882,55 +1183,65 @@ e_eFSS_BLOB_RES eFSS_BLOB_EndWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
 
                         if( e_eFSS_BLOB_RES_OK == l_eRes )
                         {
-                            /* Calculat max blob len */
-                            l_uMaxBlobSize = ( ( l_uUsePages * l_tBuff.uBufL ) - EFSS_BLOB_LENOFF );
-
-                            /* Ok we need to complete the write process writing to zero any remaining pages and
-                               updating CRC and BLOB size field */
-                            l_uRemToWrite = ( l_uMaxBlobSize + EFSS_BLOB_LENOFF ) - p_ptCtx->uDataWritten;
-
-                            /* Find offset where to start zeeting to zero data */
+                            /* Ok we need to complete the write process padding any remaining pages and
+                               updating CRC and BLOB size field. Every page already written by AppendData is
+                               final and its CRC is already known, so only the tail page could need a load */
                             l_uCurrPage   = (uint32_t)(p_ptCtx->uDataWritten / l_tBuff.uBufL);
                             l_uCurPageOff = (uint32_t)(p_ptCtx->uDataWritten % l_tBuff.uBufL);
+                            l_uBlobCrc    = p_ptCtx->uCrcOfDataWritten;
+
+                            /* Write in the origin area, or in the not active slot when using A/B slots */
+                            l_bWriteInOri = ( ( false == p_ptCtx->bIsAbSlot ) || ( false == p_ptCtx->bActiveIsOri ) );
+
+                            if( ( 0u != l_uCurPageOff ) && ( ( l_uUsePages - 1u ) != l_uCurrPage ) &&
+                                ( NULL == p_ptCtx->puTailBuf ) )
+                            {
+                                /* The partially filled page is already padded and flushed, skip it */
+                                l_uBlobCrc = p_ptCtx->uCrcWithPartPage;
+                                l_uCurPageOff = 0u;
+                                l_uCurrPage++;
+                            }
 
-                            while( ( l_uRemToWrite > 0u ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
+                            while( ( l_uCurrPage < l_uUsePages ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
                             {
-                                /* First load the page that we want to write, because we could have some
-                                   already appended data */
-                                l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, true, l_uCurrPage,
+                                if( 0u == l_uCurPageOff )
+                                {
+                                    /* No data in this page */
+                                    (void)memset(l_tBuff.puBuf, (int)p_ptCtx->uPadVal, l_tBuff.uBufL);
+                                }
+                                else if( NULL != p_ptCtx->puTailBuf )
+                                {
+                                    /* Tail page data is still in RAM, never written */
+                                    (void)memcpy(l_tBuff.puBuf, p_ptCtx->puTailBuf, l_uCurPageOff);
+                                    (void)memset(&l_tBuff.puBuf[l_uCurPageOff], (int)p_ptCtx->uPadVal,
+                                                 ( l_tBuff.uBufL - l_uCurPageOff ) );
+                                }
+                                else
+                                {
+                                    /* Blob end in the last page, we need the data already appended */
+                                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, l_bWriteInOri, l_uCurrPage,
                                                                         &l_uSeqN);
-                                l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                                    if( e_eFSS_BLOB_RES_OK == l_eRes )
+                                    {
+                                        /* Pad the unused data */
+                                        (void)memset(&l_tBuff.puBuf[l_uCurPageOff], (int)p_ptCtx->uPadVal,
+                                                     ( l_tBuff.uBufL - l_uCurPageOff ) );
+                                    }
+                                }
 
                                 if( e_eFSS_BLOB_RES_OK == l_eRes )
                                 {
-                                    /* Now, if we need to set to zero more data that present in the buffer we are
-                                       sure we didnt reached the last page. */
-                                    if( l_uRemToWrite > ( l_tBuff.uBufL - l_uCurPageOff ) )
+                                    if( ( l_uUsePages - 1u ) != l_uCurrPage )
                                     {
-                                        /* full fill the page with data setted to zero */
-                                        (void)memset(&l_tBuff.puBuf[l_uCurPageOff], 0,
-                                                     ( l_tBuff.uBufL - l_uCurPageOff ) );
-                                        l_uCurPageOff = 0u;
-                                        l_uRemToWrite -= ( l_tBuff.uBufL - l_uCurPageOff );
-
-                                        /* Not the last page, update the CRC also */
-                                        l_eResC =  eFSS_BLOBC_CalcCrcInBuff(&p_ptCtx->tBLOBCCtx,
-                                                                                  p_ptCtx->uCrcOfDataWritten,
-                                                                                  l_tBuff.uBufL,
-                                                                                  &p_ptCtx->uCrcOfDataWritten);
+                                        /* Not the last page, update the CRC */
+                                        l_eResC =  eFSS_BLOBC_CalcCrcInBuff(&p_ptCtx->tBLOBCCtx, l_uBlobCrc,
+                                                                                  l_tBuff.uBufL, &l_uBlobCrc);
                                         l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
-
                                     }
                                     else
                                     {
-                                        /* Ok so this must be the last page. Set to zero the unused data */
-                                        (void)memset(&l_tBuff.puBuf[l_uCurPageOff], 0,
-                                                     ( l_tBuff.uBufL - l_uCurPageOff ) );
-
-                                        /* Update counter */
-                                        l_uCurPageOff = 0u;
-                                        l_uRemToWrite = 0u;
-
                                         /* We must update blob length and it's CRC  */
                                         l_uLenCrcOff = l_tBuff.uBufL - EFSS_BLOB_LENOFF;
                                         if( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_uLenCrcOff],
@@ -941,10 +1252,9 @@ e_eFSS_BLOB_RES eFSS_BLOB_EndWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
                                         else
                                         {
                                             /* Can now calculate the CRC of the last page, excluding the CRC itself */
-                                            l_eResC =  eFSS_BLOBC_CalcCrcInBuff(&p_ptCtx->tBLOBCCtx,
-                                                                                      p_ptCtx->uCrcOfDataWritten,
+                                            l_eResC =  eFSS_BLOBC_CalcCrcInBuff(&p_ptCtx->tBLOBCCtx, l_uBlobCrc,
                                                                                       l_tBuff.uBufL - EFSS_BLOB_CRCOFF,
-                                                                                      &p_ptCtx->uCrcOfDataWritten);
+                                                                                      &l_uBlobCrc);
                                             l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
 
                                             /* If all ok insert the CRC */
@@ -952,26 +1262,36 @@ e_eFSS_BLOB_RES eFSS_BLOB_EndWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
                                             {
                                                 l_uLenCrcOff = l_tBuff.uBufL - EFSS_BLOB_CRCOFF;
                                                 if( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_uLenCrcOff],
-                                                                                 p_ptCtx->uCrcOfDataWritten ) )
+                                                                                 l_uBlobCrc ) )
                                                 {
                                                     l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
                                                 }
                                             }
                                         }
                                     }
+                                }
 
-                                    /* if all ok can flush the page in the storage area */
-                                    if( e_eFSS_BLOB_RES_OK == l_eRes )
-                                    {
-                                        /* Buffer flush */
-                                        l_eResC = eFSS_BLOBC_FlushBufferInPage(&p_ptCtx->tBLOBCCtx, true, l_uCurrPage,
-                                                                               p_ptCtx->uCurrentSeqN);
-                                        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
-                                    }
+                                /* A page never flushed before start a block, erase it only once */
+                                if( ( e_eFSS_BLOB_RES_OK == l_eRes ) &&
+                                    ( ( 0u == l_uCurPageOff ) || ( NULL != p_ptCtx->puTailBuf ) ) )
+                                {
+                                    l_eResC = eFSS_BLOBC_EraseBlkIfFirst(&p_ptCtx->tBLOBCCtx, l_bWriteInOri,
+                                                                         l_uCurrPage);
+                                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                                }
 
-                                    /* Continue with the next one */
-                                    l_uCurrPage++;
+                                /* if all ok can flush the page in the storage area */
+                                if( e_eFSS_BLOB_RES_OK == l_eRes )
+                                {
+                                    /* Buffer flush */
+                                    l_eResC = eFSS_BLOBC_FlushBufferInPage(&p_ptCtx->tBLOBCCtx, l_bWriteInOri,
+                                                                           l_uCurrPage, p_ptCtx->uCurrentSeqN);
+                                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
                                 }
+
+                                /* Continue with the next one */
+                                l_uCurPageOff = 0u;
+                                l_uCurrPage++;
                             }
 
                             /* If all ok we are done, ripristinate the non writing situation */
@@ -980,7 +1300,511 @@ e_eFSS_BLOB_RES eFSS_BLOB_EndWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
                                 p_ptCtx->bIsWriteOngoing = false;
                                 p_ptCtx->uDataWritten = 0u;
                                 p_ptCtx->uCrcOfDataWritten = 0u;
+                                p_ptCtx->uCrcWithPartPage = 0u;
                                 p_ptCtx->uCurrentSeqN = 0u;
+
+                                if( true == p_ptCtx->bIsAbSlot )
+                                {
+                                    /* The last page is written, the new slot is now the active one */
+                                    p_ptCtx->bActiveIsOri = l_bWriteInOri;
+                                    p_ptCtx->uBlobGen++;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_BLOB_RES eFSS_BLOB_AbortWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+
+    /* Local variable for calculation */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_BLOBC_IsInit(&p_ptCtx->tBLOBCCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Cannot abort write if not started */
+                    if( false == p_ptCtx->bIsWriteOngoing )
+                    {
+                        l_eRes = e_eFSS_BLOB_RES_WRITENOSTARTED;
+                    }
+                    else
+                    {
+                        /* In order to abort a write we just need to ripristinate backup pages.
+                           If for some reasons the backup page are corrupted we will recognize this situation
+                           during any other operation. Using A/B slots the active one was never touched, and the
+                           written one is not valid, so nothing need to be restored */
+                        if( false == p_ptCtx->bIsAbSlot )
+                        {
+                            l_eResC = eFSS_BLOBC_CloneArea(&p_ptCtx->tBLOBCCtx, false);
+                            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                        }
+
+                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                        {
+                            /* area cloned! Ripristinate the context */
+                            p_ptCtx->bIsWriteOngoing = false;
+                            p_ptCtx->uDataWritten = 0u;
+                            p_ptCtx->uCrcOfDataWritten = 0u;
+                            p_ptCtx->uCrcWithPartPage = 0u;
+                            p_ptCtx->uCurrentSeqN = 0u;
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+e_eFSS_BLOB_RES eFSS_BLOB_ReaderOpen(t_eFSS_BLOB_Ctx* const p_ptCtx, t_eFSS_BLOB_Reader* const p_ptReader,
+                                     uint8_t* const p_puCache, const uint32_t p_uCacheL)
+{
+	/* Local return variable */
+	e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+    bool_t l_bIsInit;
+
+    /* Local variable used for storage */
+    t_eFSS_BLOBC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+    /* Local variable for general calculation */
+    uint32_t l_uBlobSize;
+    uint32_t l_uSeqN;
+    uint32_t l_uMaxBlobSize;
+    uint32_t l_uSlot;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptReader ) || ( NULL == p_puCache ) )
+	{
+		l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_BLOBC_IsInit(&p_ptCtx->tBLOBCCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    if( ( true == p_ptCtx->bIsWriteOngoing ) && ( false == p_ptCtx->bIsAbSlot ) )
+                    {
+                        l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
+                    }
+                    else
+                    {
+                        /* Fix any memory problem, after this every page of the origin area is validated */
+                        l_eRes = eFSS_BLOB_OriginBackupAligner(p_ptCtx);
+
+                        if( ( e_eFSS_BLOB_RES_OK == l_eRes ) || ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == l_eRes ) )
+                        {
+                            /* Retrive buffer and the numbers of page so we can check requested param */
+                            l_uUsePages = 0u;
+                            l_eResC = eFSS_BLOBC_GetBuffNUsable(&p_ptCtx->tBLOBCCtx, &l_tBuff, &l_uUsePages);
+                            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                            if( e_eFSS_BLOB_RES_OK == l_eRes )
+                            {
+                                /* The cache must contain at least one page */
+                                if( p_uCacheL < l_tBuff.uBufL )
+                                {
+                                    l_eRes = e_eFSS_BLOB_RES_BADPARAM;
+                                }
+                                else
+                                {
+                                    /* Get Blob info, load last page */
+                                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, p_ptCtx->bActiveIsOri,
+                                                                        ( l_uUsePages - 1u ), &l_uSeqN);
+                                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                                }
+
+                                if( e_eFSS_BLOB_RES_OK == l_eRes )
+                                {
+                                    /* Extract data from the last page */
+                                    if( true != eFSS_Utils_RetriveU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_BLOB_LENOFF],
+                                                                      &l_uBlobSize ) )
+                                    {
+                                        l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                                    }
+                                    else
+                                    {
+                                        /* Is retrived size coherent? */
+                                        l_uMaxBlobSize = ( l_uUsePages * l_tBuff.uBufL ) - EFSS_BLOB_LENOFF;
+                                        if( l_uBlobSize > l_uMaxBlobSize )
+                                        {
+                                            l_eRes = e_eFSS_BLOB_RES_NOTVALIDBLOB;
+                                        }
+                                        else
+                                        {
+                                            /* Fill the reader, every slot start empty */
+                                            p_ptReader->puCache = p_puCache;
+                                            p_ptReader->uNSlot = p_uCacheL / l_tBuff.uBufL;
+                                            if( p_ptReader->uNSlot > EFSS_BLOB_READERSLOT )
+                                            {
+                                                p_ptReader->uNSlot = EFSS_BLOB_READERSLOT;
+                                            }
+
+                                            for( l_uSlot = 0u; l_uSlot < EFSS_BLOB_READERSLOT; l_uSlot++ )
+                                            {
+                                                p_ptReader->uSlotPage[l_uSlot] = MAX_UINT32VAL;
+                                                p_ptReader->uSlotAge[l_uSlot] = 0u;
+                                            }
+
+                                            p_ptReader->uAgeCnt = 0u;
+                                            p_ptReader->uLastPage = MAX_UINT32VAL;
+                                            p_ptReader->uBlobSize = l_uBlobSize;
+                                            p_ptReader->uBlobGen = p_ptCtx->uBlobGen;
+                                            p_ptReader->bIsOpen = true;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_BLOB_RES eFSS_BLOB_ReaderRead(t_eFSS_BLOB_Ctx* const p_ptCtx, t_eFSS_BLOB_Reader* const p_ptReader,
+                                     const uint32_t p_uOffset, const uint32_t p_uBuffL, uint8_t* const p_puBuff)
+{
+	/* Local return variable */
+	e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+    bool_t l_bIsInit;
+
+    /* Local variable used for storage */
+    t_eFSS_BLOBC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+    /* Local variable used for page tracking */
+    uint8_t* l_puPage;
+    uint32_t l_uCurrPage;
+    uint32_t l_uCurPageOff;
+    uint32_t l_uRemToRead;
+    uint32_t l_uReadedByte;
+    uint32_t l_uToCopy;
+    uint32_t l_uLastDataPage;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptReader ) || ( NULL == p_puBuff ) )
+	{
+		l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_BLOBC_IsInit(&p_ptCtx->tBLOBCCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    if( ( true == p_ptCtx->bIsWriteOngoing ) && ( false == p_ptCtx->bIsAbSlot ) )
+                    {
+                        l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
+                    }
+                    else
+                    {
+                        /* Cached pages are valid only if the blob was not touched after the opening */
+                        if( ( true != p_ptReader->bIsOpen ) || ( p_ptReader->uBlobGen != p_ptCtx->uBlobGen ) ||
+                            ( false == p_ptCtx->bIsBlobCheked ) )
+                        {
+                            l_eRes = e_eFSS_BLOB_RES_READERNOTVALID;
+                        }
+                        else
+                        {
+                            /* Retrive buffer and the numbers of page so we can check requested param */
+                            l_uUsePages = 0u;
+                            l_eResC = eFSS_BLOBC_GetBuffNUsable(&p_ptCtx->tBLOBCCtx, &l_tBuff, &l_uUsePages);
+                            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                            if( e_eFSS_BLOB_RES_OK == l_eRes )
+                            {
+                                /* Verify data validity */
+                                if( ( p_uBuffL <= 0u ) || ( p_uBuffL > p_ptReader->uBlobSize ) ||
+                                    ( p_uOffset >= p_ptReader->uBlobSize ) ||
+                                    ( p_uOffset > ( p_ptReader->uBlobSize - p_uBuffL ) ) ||
+                                    ( p_ptReader->uNSlot <= 0u ) || ( p_ptReader->uNSlot > EFSS_BLOB_READERSLOT ) )
+                                {
+                                    l_eRes = e_eFSS_BLOB_RES_BADPARAM;
+                                }
+                                else
+                                {
+                                    /* Init read counter */
+                                    l_uRemToRead = p_uBuffL;
+                                    l_uLastDataPage = (uint32_t)( ( p_ptReader->uBlobSize - 1u ) / l_tBuff.uBufL );
+
+                                    /* Find starting page */
+                                    l_uCurrPage   = (uint32_t)(p_uOffset / l_tBuff.uBufL);
+                                    l_uCurPageOff = (uint32_t)(p_uOffset % l_tBuff.uBufL);
+
+                                    while( ( l_uRemToRead > 0u ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
+                                    {
+                                        /* Get the current page from the cache, or load it */
+                                        l_puPage = NULL;
+                                        l_eRes = eFSS_BLOB_ReaderGetPage(p_ptCtx, p_ptReader, l_uCurrPage,
+                                                                         &l_puPage);
+
+                                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                                        {
+                                            /* Sequential access, load in advance the next page with data */
+                                            if( ( ( p_ptReader->uLastPage + 1u ) == l_uCurrPage ) &&
+                                                ( l_uCurrPage < l_uLastDataPage ) && ( p_ptReader->uNSlot > 1u ) )
+                                            {
+                                                l_eRes = eFSS_BLOB_ReaderGetPage(p_ptCtx, p_ptReader,
+                                                                                 ( l_uCurrPage + 1u ), NULL);
+                                            }
+
+                                            p_ptReader->uLastPage = l_uCurrPage;
+                                        }
+
+                                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                                        {
+                                            /* Copy data to the user buffer */
+                                            l_uReadedByte = p_uBuffL - l_uRemToRead;
+                                            l_uToCopy = l_tBuff.uBufL - l_uCurPageOff;
+                                            if( l_uToCopy > l_uRemToRead )
+                                            {
+                                                l_uToCopy = l_uRemToRead;
+                                            }
+
+                                            (void)memcpy(&p_puBuff[l_uReadedByte], &l_puPage[l_uCurPageOff],
+                                                         l_uToCopy);
+                                            l_uRemToRead -= l_uToCopy;
+                                            l_uCurPageOff = 0u;
+                                            l_uCurrPage++;
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_BLOB_RES eFSS_BLOB_Scrub(t_eFSS_BLOB_Ctx* const p_ptCtx, const t_eFSS_TYPE_ScrubBudget p_tBudget)
+{
+	/* Return local var */
+    e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local variable for storage */
+    t_eFSS_BLOBC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+    uint32_t l_uSeqN;
+
+    /* Local variable for the budget */
+    t_eFSS_TYPE_ScrubBudget l_tBudget;
+    uint32_t l_uStartTime;
+    uint32_t l_uPageDone;
+    bool_t l_bIsStop;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_BLOBC_IsInit(&p_ptCtx->tBLOBCCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* During a write the backup is different from the origin on purpose */
+                    if( true == p_ptCtx->bIsWriteOngoing )
+                    {
+                        l_eRes = e_eFSS_BLOB_RES_WRITEONGOING;
+                    }
+                    else
+                    {
+                        /* Fix any memory problem, if the blob is not checked the whole storage is verified */
+                        l_eRes = eFSS_BLOB_OriginBackupAligner(p_ptCtx);
+
+                        if( e_eFSS_BLOB_RES_OK_BKP_RCVRD == l_eRes )
+                        {
+                            p_ptCtx->tScrub.bIsRepaired = true;
+                            l_eRes = e_eFSS_BLOB_RES_OK;
+                        }
+
+                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                        {
+                            l_eResC = eFSS_BLOBC_GetBuffNUsable(&p_ptCtx->tBLOBCCtx, &l_tBuff, &l_uUsePages);
+                            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                        }
+
+                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                        {
+                            /* Without a start time only the page limit can be used */
+                            l_tBudget = p_tBudget;
+                            if( false == eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime) )
+                            {
+                                l_tBudget.uMaxTime = 0u;
+                                l_uStartTime = 0u;
+                            }
+
+                            l_uPageDone = 0u;
+                            l_bIsStop = false;
+
+                            while( false == l_bIsStop )
+                            {
+                                if( true == p_ptCtx->bIsAbSlot )
+                                {
+                                    /* The other slot is an older blob, only the active one can be verified */
+                                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, p_ptCtx->bActiveIsOri,
+                                                                        p_ptCtx->tScrub.uNextIdx, &l_uSeqN);
+                                }
+                                else
+                                {
+                                    /* Compare the original page with the backup one, cloning it if different */
+                                    l_eResC = eFSS_BLOBC_CloneOriPageInBkpIfNotEq(&p_ptCtx->tBLOBCCtx,
+                                                                                  p_ptCtx->tScrub.uNextIdx);
+                                }
+                                l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                                if( ( e_eFSS_BLOB_RES_OK == l_eRes ) || ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == l_eRes ) )
+                                {
+                                    if( e_eFSS_BLOB_RES_OK_BKP_RCVRD == l_eRes )
+                                    {
+                                        p_ptCtx->tScrub.bIsRepaired = true;
+                                    }
+
+                                    l_uPageDone++;
+                                    p_ptCtx->tScrub.uNextIdx++;
+
+                                    if( p_ptCtx->tScrub.uNextIdx >= l_uUsePages )
+                                    {
+                                        /* Pass ended, the next call start a new one */
+                                        if( true == p_ptCtx->tScrub.bIsRepaired )
+                                        {
+                                            l_eRes = e_eFSS_BLOB_RES_OK_BKP_RCVRD;
+                                        }
+                                        else
+                                        {
+                                            l_eRes = e_eFSS_BLOB_RES_OK;
+                                        }
+
+                                        (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
+                                        l_bIsStop = true;
+                                    }
+                                    else
+                                    {
+                                        l_eRes = e_eFSS_BLOB_RES_INPROGRESS;
+                                        l_bIsStop = eFSS_Utils_IsBudgetEnded(p_ptCtx->ptCtxTime, p_ptCtx->fTime,
+                                                                             l_tBudget, l_uStartTime, l_uPageDone);
+                                    }
+                                }
+                                else
+                                {
+                                    /* Restart the pass */
+                                    (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
+
+                                    if( ( e_eFSS_BLOB_RES_NOTVALIDBLOB == l_eRes ) ||
+                                        ( e_eFSS_BLOB_RES_NEWVERSIONFOUND == l_eRes ) )
+                                    {
+                                        /* A page of the used area is corrupted, the single page cannot be trusted
+                                         * so verify and repair the whole storage */
+                                        p_ptCtx->bIsBlobCheked = false;
+                                        l_eRes = eFSS_BLOB_OriginBackupAligner(p_ptCtx);
+
+                                        if( e_eFSS_BLOB_RES_OK == l_eRes )
+                                        {
+                                            l_eRes = e_eFSS_BLOB_RES_OK_BKP_RCVRD;
+                                        }
+                                    }
+                                    l_bIsStop = true;
+                                }
                             }
                         }
                     }
@@ -992,13 +1816,13 @@ e_eFSS_BLOB_RES eFSS_BLOB_EndWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
 	return l_eRes;
 }
 
-e_eFSS_BLOB_RES eFSS_BLOB_AbortWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
+e_eFSS_BLOB_RES eFSS_BLOB_GetStats(t_eFSS_BLOB_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats)
 {
-	/* Local return variable */
-	e_eFSS_BLOB_RES l_eRes;
+	/* Return local var */
+    e_eFSS_BLOB_RES l_eRes;
     e_eFSS_BLOBC_RES l_eResC;
 
-    /* Local variable for calculation */
+    /* Local var for init */
     bool_t l_bIsInit;
 
 	/* Check pointer validity */
@@ -1028,27 +1852,70 @@ e_eFSS_BLOB_RES eFSS_BLOB_AbortWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
                 }
                 else
                 {
-                    /* Cannot abort write if not started */
-                    if( false == p_ptCtx->bIsWriteOngoing )
+                    /* The counters are kept by the low level core of the storage area */
+                    l_eResC = eFSS_BLOBC_GetStats(&p_ptCtx->tBLOBCCtx, p_ptStats);
+                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                    /* The latency of the public functions are kept here */
+                    if( e_eFSS_BLOB_RES_OK == l_eRes )
                     {
-                        l_eRes = e_eFSS_BLOB_RES_WRITENOSTARTED;
+                        p_ptStats->tLatAdd = p_ptCtx->tLatAdd;
+                        p_ptStats->tLatStatus = p_ptCtx->tLatStatus;
+                        p_ptStats->tLatFormat = p_ptCtx->tLatFormat;
                     }
-                    else
-                    {
-                        /* In order to abort a write we just need to ripristinate backup pages.
-                           If for some reasons the backup page are corrupted we will recognize this situation
-                           during any other operation. */
-                        l_eResC = eFSS_BLOBC_CloneArea(&p_ptCtx->tBLOBCCtx, false);
-                        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                }
+            }
+        }
+	}
 
-                        if( e_eFSS_BLOB_RES_OK == l_eRes )
-                        {
-                            /* area cloned! Ripristinate the context */
-                            p_ptCtx->bIsWriteOngoing = false;
-                            p_ptCtx->uDataWritten = 0u;
-                            p_ptCtx->uCrcOfDataWritten = 0u;
-                            p_ptCtx->uCurrentSeqN = 0u;
-                        }
+	return l_eRes;
+}
+
+e_eFSS_BLOB_RES eFSS_BLOB_ResetStats(t_eFSS_BLOB_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_BLOBC_IsInit(&p_ptCtx->tBLOBCCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Reset the counters of the low level core */
+                    l_eResC = eFSS_BLOBC_ResetStats(&p_ptCtx->tBLOBCCtx);
+                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                    if( e_eFSS_BLOB_RES_OK == l_eRes )
+                    {
+                        (void)memset(&p_ptCtx->tLatAdd, 0, sizeof(t_eFSS_TYPE_LatHist));
+                        (void)memset(&p_ptCtx->tLatStatus, 0, sizeof(t_eFSS_TYPE_LatHist));
+                        (void)memset(&p_ptCtx->tLatFormat, 0, sizeof(t_eFSS_TYPE_LatHist));
                     }
                 }
             }
@@ -1059,7 +1926,6 @@ e_eFSS_BLOB_RES eFSS_BLOB_AbortWrite(t_eFSS_BLOB_Ctx* const p_ptCtx)
 }
 
 
-
 /***********************************************************************************************************************
  *  PRIVATE FUNCTION
  **********************************************************************************************************************/
@@ -1092,6 +1958,28 @@ static bool_t eFSS_BLOB_IsStatusStillCoherent(t_eFSS_BLOB_Ctx* const p_ptCtx)
             /* We need more space for the BLOB */
             l_bRes = false;
         }
+        else if( ( NULL != p_ptCtx->puTailBuf ) && ( p_ptCtx->uTailBufL < l_tBuff.uBufL ) )
+        {
+            /* Tail buffer too small to contain a page */
+            l_bRes = false;
+        }
+        else if( ( false == p_ptCtx->bIsAbSlot ) && ( false == p_ptCtx->bActiveIsOri ) )
+        {
+            /* Without A/B slots the origin area is always the active one */
+            l_bRes = false;
+        }
+        else if( p_ptCtx->tScrub.uNextIdx >= l_uUsePages )
+        {
+            /* The scrubber cannot go over the usable pages */
+            l_bRes = false;
+        }
+        else if( ( true == p_ptCtx->bIsFormatOngoing ) &&
+                 ( ( p_ptCtx->uFormatIdx >= ( l_uUsePages * 2u ) ) ||
+                   ( true == p_ptCtx->bIsWriteOngoing ) ) )
+        {
+            /* A stepped format cannot go over the two areas, and no write can be started during it */
+            l_bRes = false;
+        }
         else
         {
             /* If we are not doing some write in flash, we must have parameter setted to zero */
@@ -1114,7 +2002,7 @@ static bool_t eFSS_BLOB_IsStatusStillCoherent(t_eFSS_BLOB_Ctx* const p_ptCtx)
             else
             {
                 if( ( 0u != p_ptCtx->uDataWritten ) || ( 0u != p_ptCtx->uCrcOfDataWritten ) ||
-                    ( 0u != p_ptCtx->uCurrentSeqN ) )
+                    ( 0u != p_ptCtx->uCrcWithPartPage ) || ( 0u != p_ptCtx->uCurrentSeqN ) )
                 {
                     /* wrong */
                     l_bRes = false;
@@ -1215,6 +2103,12 @@ static e_eFSS_BLOB_RES eFSS_BLOB_BlobCtoBLOBRes(const e_eFSS_BLOBC_RES p_eCRes)
             break;
         }
 
+        case e_eFSS_BLOBC_RES_INPROGRESS:
+        {
+            l_eRes = e_eFSS_BLOB_RES_INPROGRESS;
+            break;
+        }
+
         default:
         {
             l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
@@ -1234,6 +2128,7 @@ static e_eFSS_BLOB_RES eFSS_BLOB_OriginBackupAligner(t_eFSS_BLOB_Ctx* const p_pt
     /* Local variable for calculation */
     t_eFSS_BLOBC_StorBuf l_tBuff;
     uint32_t l_uUsableP;
+    uint32_t l_uSeqN;
     bool_t l_bIsValidOrig;
     bool_t l_bIsValidBkup;
 
@@ -1243,11 +2138,23 @@ static e_eFSS_BLOB_RES eFSS_BLOB_OriginBackupAligner(t_eFSS_BLOB_Ctx* const p_pt
     /* Check if alignement is needed */
     if( false == p_ptCtx->bIsBlobCheked )
     {
+        /* A stepped format not ended is abandoned, the storage is verified like after a power loss */
+        p_ptCtx->bIsFormatOngoing = false;
+        p_ptCtx->uFormatIdx = 0u;
+
+        /* Area can be repaired in the process, any opened reader is no more valid */
+        p_ptCtx->uBlobGen++;
+
         /* Get needed data structures */
         l_eResC = eFSS_BLOBC_GetBuffNUsable(&p_ptCtx->tBLOBCCtx, &l_tBuff, &l_uUsableP);
         l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
 
-        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        if( ( e_eFSS_BLOB_RES_OK == l_eRes ) && ( true == p_ptCtx->bIsAbSlot ) )
+        {
+            /* Using A/B slots nothing is cloned, just find the slot with the newest valid blob */
+            l_eRes = eFSS_BLOB_FindActiveSlot(p_ptCtx);
+        }
+        else if( e_eFSS_BLOB_RES_OK == l_eRes )
         {
             /* Check is needed, how can we do it?
             * 1 - Verify if original partition contain a valid blob.
@@ -1259,7 +2166,7 @@ static e_eFSS_BLOB_RES eFSS_BLOB_OriginBackupAligner(t_eFSS_BLOB_Ctx* const p_pt
 
             /* Verify Original */
             l_bIsValidOrig = false;
-            l_eRes = eFSS_BLOB_IsAreaValid(p_ptCtx, true, &l_bIsValidOrig);
+            l_eRes = eFSS_BLOB_IsAreaValid(p_ptCtx, true, &l_bIsValidOrig, &l_uSeqN);
 
             if( e_eFSS_BLOB_RES_OK == l_eRes )
             {
@@ -1273,7 +2180,7 @@ static e_eFSS_BLOB_RES eFSS_BLOB_OriginBackupAligner(t_eFSS_BLOB_Ctx* const p_pt
                 {
                     /* Original area corrupted, need to verify the backup one */
                     l_bIsValidBkup = false;
-                    l_eRes = eFSS_BLOB_IsAreaValid(p_ptCtx, false, &l_bIsValidBkup);
+                    l_eRes = eFSS_BLOB_IsAreaValid(p_ptCtx, false, &l_bIsValidBkup, &l_uSeqN);
 
                     if( e_eFSS_BLOB_RES_OK == l_eRes )
                     {
@@ -1312,11 +2219,11 @@ static e_eFSS_BLOB_RES eFSS_BLOB_OriginBackupAligner(t_eFSS_BLOB_Ctx* const p_pt
 }
 
 static e_eFSS_BLOB_RES eFSS_BLOB_IsAreaValid(t_eFSS_BLOB_Ctx* const p_ptCtx, const bool_t p_bIsOri,
-                                             bool_t* const p_pbIsVal)
+                                             bool_t* const p_pbIsVal, uint32_t* const p_puSeqN)
 {
     /* The LEN refeers to the LEN of the written blob.
-       The CRC refers ponly to the CRC of the written buffer. If len is zero the CRC is the SEED.
-       Other written data must be setted to zero */
+       The CRC refers ponly to the CRC of the written buffer. If len is zero the CRC is the one of the pad.
+       Other written data must be setted to the pad value */
 
 	/* Local return variable */
 	e_eFSS_BLOB_RES l_eRes;
@@ -1337,10 +2244,11 @@ static e_eFSS_BLOB_RES eFSS_BLOB_IsAreaValid(t_eFSS_BLOB_Ctx* const p_ptCtx, con
     uint32_t l_uBlobCrc;
     uint32_t l_uRemByteToNoCheck;
     uint32_t l_uZeroToCheck;
+    uint32_t l_uZeroToSkip;
     uint32_t l_uMaxBlobSize;
 
     /* Check data validity */
-    if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsVal ) )
+    if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsVal ) || ( NULL == p_puSeqN ) )
     {
         l_eRes = e_eFSS_BLOB_RES_BADPOINTER;
     }
@@ -1355,7 +2263,7 @@ static e_eFSS_BLOB_RES eFSS_BLOB_IsAreaValid(t_eFSS_BLOB_Ctx* const p_ptCtx, con
         {
             /* Check this area, how can we do it?
             * 1 - Verify CRC validity
-            * 2 - Verify that data outside blob len is setted to zero
+            * 2 - Verify that data outside blob len is setted to the pad value
             * 3 - Verify that every page has the same sequential number of the other one
             * 4 - Verify that data length is coherent
             */
@@ -1404,7 +2312,7 @@ static e_eFSS_BLOB_RES eFSS_BLOB_IsAreaValid(t_eFSS_BLOB_Ctx* const p_ptCtx, con
 
                 while( ( l_uCurrPage < l_uUsableP ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
                 {
-                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, true, l_uCurrPage, &l_uTempSeqN);
+                    l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, p_bIsOri, l_uCurrPage, &l_uTempSeqN);
                     l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
 
                     if( e_eFSS_BLOB_RES_OK == l_eRes )
@@ -1417,16 +2325,24 @@ static e_eFSS_BLOB_RES eFSS_BLOB_IsAreaValid(t_eFSS_BLOB_Ctx* const p_ptCtx, con
                         }
                         else
                         {
-                            /* ------------ Check that unsued data is zero */
+                            /* ------------ Check that unsued data is padded */
                             if( l_uRemByteToNoCheck < l_tBuff.uBufL )
                             {
-                                /* How many zero to check? */
+                                /* How many pad to check? Length and CRC of the last page are not padded */
                                 l_uZeroToCheck = l_tBuff.uBufL - l_uRemByteToNoCheck;
+                                if( ( l_uUsableP - 1u ) == l_uCurrPage )
+                                {
+                                    l_uZeroToSkip = EFSS_BLOB_LENOFF;
+                                }
+                                else
+                                {
+                                    l_uZeroToSkip = 0u;
+                                }
 
                                 /* Check */
-                                while( ( l_uZeroToCheck > 0u ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
+                                while( ( l_uZeroToCheck > l_uZeroToSkip ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
                                 {
-                                    if( 0u != l_tBuff.puBuf[ l_tBuff.uBufL - l_uZeroToCheck ] )
+                                    if( p_ptCtx->uPadVal != l_tBuff.puBuf[ l_tBuff.uBufL - l_uZeroToCheck ] )
                                     {
                                         /* Not valid blob */
                                         l_eRes = e_eFSS_BLOB_RES_NOTVALIDBLOB;
@@ -1479,8 +2395,281 @@ static e_eFSS_BLOB_RES eFSS_BLOB_IsAreaValid(t_eFSS_BLOB_Ctx* const p_ptCtx, con
                     }
                 }
             }
+
+            /* A not valid blob is the result of the check, not an error */
+            if( e_eFSS_BLOB_RES_OK == l_eRes )
+            {
+                *p_pbIsVal = true;
+                *p_puSeqN = l_uReadedSeqN;
+            }
+            else if( e_eFSS_BLOB_RES_NOTVALIDBLOB == l_eRes )
+            {
+                *p_pbIsVal = false;
+                l_eRes = e_eFSS_BLOB_RES_OK;
+            }
+            else
+            {
+                *p_pbIsVal = false;
+            }
+        }
+    }
+
+	return l_eRes;
+}
+
+static e_eFSS_BLOB_RES eFSS_BLOB_FindActiveSlot(t_eFSS_BLOB_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_BLOB_RES l_eRes;
+
+    /* Local variable for calculation */
+    bool_t l_bIsValidOrig;
+    bool_t l_bIsValidBkup;
+    uint32_t l_uSeqNOrig;
+    uint32_t l_uSeqNBkup;
+
+    /* Verify both slots */
+    l_bIsValidOrig = false;
+    l_bIsValidBkup = false;
+    l_uSeqNOrig = 0u;
+    l_uSeqNBkup = 0u;
+    l_eRes = eFSS_BLOB_IsAreaValid(p_ptCtx, true, &l_bIsValidOrig, &l_uSeqNOrig);
+
+    if( e_eFSS_BLOB_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_BLOB_IsAreaValid(p_ptCtx, false, &l_bIsValidBkup, &l_uSeqNBkup);
+    }
+
+    if( e_eFSS_BLOB_RES_OK == l_eRes )
+    {
+        if( ( true == l_bIsValidOrig ) && ( true == l_bIsValidBkup ) )
+        {
+            /* Both slots valid, the active one is the one with the newest blob. Same sequence number is found
+               only after a format, when the two slots are equals */
+            p_ptCtx->bActiveIsOri = ( l_uSeqNOrig >= l_uSeqNBkup );
+        }
+        else if( true == l_bIsValidOrig )
+        {
+            p_ptCtx->bActiveIsOri = true;
+        }
+        else if( true == l_bIsValidBkup )
+        {
+            p_ptCtx->bActiveIsOri = false;
+        }
+        else
+        {
+            /* Neiother slots is valid, not valid blob stored */
+            l_eRes = e_eFSS_BLOB_RES_NOTVALIDBLOB;
+        }
+    }
+
+	return l_eRes;
+}
+
+static e_eFSS_BLOB_RES eFSS_BLOB_ReaderGetPage(t_eFSS_BLOB_Ctx* const p_ptCtx, t_eFSS_BLOB_Reader* const p_ptReader,
+                                               const uint32_t p_uPage, uint8_t** const p_ppuPage)
+{
+	/* Local return variable */
+	e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+
+    /* Local variable for storage */
+    t_eFSS_BLOBC_StorBuf l_tBuff;
+    uint32_t l_uUsableP;
+
+    /* Local variable for calculation */
+    uint32_t l_uSeqN;
+    uint32_t l_uSlot;
+    uint32_t l_uFound;
+    uint32_t l_uOldest;
+
+    /* Get needed basic data structures */
+    l_uUsableP = 0u;
+    l_eResC = eFSS_BLOBC_GetBuffNUsable(&p_ptCtx->tBLOBCCtx, &l_tBuff, &l_uUsableP);
+    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+    if( e_eFSS_BLOB_RES_OK == l_eRes )
+    {
+        /* Search the page in the cache, and in the meantime the least recently used slot */
+        l_uFound = MAX_UINT32VAL;
+        l_uOldest = 0u;
+
+        for( l_uSlot = 0u; l_uSlot < p_ptReader->uNSlot; l_uSlot++ )
+        {
+            if( p_uPage == p_ptReader->uSlotPage[l_uSlot] )
+            {
+                l_uFound = l_uSlot;
+            }
+
+            if( p_ptReader->uSlotAge[l_uSlot] < p_ptReader->uSlotAge[l_uOldest] )
+            {
+                l_uOldest = l_uSlot;
+            }
+        }
+
+        if( MAX_UINT32VAL == l_uFound )
+        {
+            /* Not cached, load and validate the page, then keep it in the least recently used slot */
+            l_eResC = eFSS_BLOBC_LoadPageInBuff(&p_ptCtx->tBLOBCCtx, p_ptCtx->bActiveIsOri, p_uPage, &l_uSeqN);
+            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+            if( e_eFSS_BLOB_RES_OK == l_eRes )
+            {
+                (void)memcpy(&p_ptReader->puCache[l_uOldest * l_tBuff.uBufL], l_tBuff.puBuf, l_tBuff.uBufL);
+                p_ptReader->uSlotPage[l_uOldest] = p_uPage;
+                l_uFound = l_uOldest;
+            }
+            else
+            {
+                /* Be sure to not keep half loaded page */
+                p_ptReader->uSlotPage[l_uOldest] = MAX_UINT32VAL;
+                p_ptReader->uSlotAge[l_uOldest] = 0u;
+            }
+        }
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            /* Mark the slot as the most recently used one */
+            p_ptReader->uAgeCnt++;
+            p_ptReader->uSlotAge[l_uFound] = p_ptReader->uAgeCnt;
+
+            if( NULL != p_ppuPage )
+            {
+                *p_ppuPage = &p_ptReader->puCache[l_uFound * l_tBuff.uBufL];
+            }
         }
     }
 
 	return l_eRes;
-}
\ No newline at end of file
+}
+
+static e_eFSS_BLOB_RES eFSS_BLOB_FormatNextPage(t_eFSS_BLOB_Ctx* const p_ptCtx, const t_eFSS_BLOBC_StorBuf p_tBuff,
+                                                const uint32_t p_uUsePages)
+{
+    /* Local return variable */
+    e_eFSS_BLOB_RES l_eRes;
+    e_eFSS_BLOBC_RES l_eResC;
+
+    /* Local variable for calculation */
+    uint32_t l_uCrcOffset;
+    uint32_t l_uCloneIdx;
+    uint32_t l_uBlobCrc;
+    uint32_t l_uCrcPage;
+
+    /* Init return value */
+    l_eRes = e_eFSS_BLOB_RES_OK;
+
+    /* To format the blob we need to :
+       1 - Write the pad value in every page
+       2 - Use One as sequence numbers of every page
+       3 - Write in the last page Zero as blob Len and the CRC of the padded pages
+       4 - Clone the original pages in the backup ones
+       Every call write only one page, the first p_uUsePages calls write the original area and the others the backup
+       one. Till the format is ended the blob is not checked, so any other operation will verify the storage again
+       and will abandon the format, like after a power loss */
+    if( false == p_ptCtx->bIsFormatOngoing )
+    {
+        p_ptCtx->bIsFormatOngoing = true;
+        p_ptCtx->uFormatIdx = 0u;
+        p_ptCtx->bIsBlobCheked = false;
+
+        /* Blob is going to change, any opened reader is no more valid */
+        p_ptCtx->uBlobGen++;
+    }
+
+    if( p_ptCtx->uFormatIdx < p_uUsePages )
+    {
+        /* Clear buffer */
+        (void)memset(p_tBuff.puBuf, (int)p_ptCtx->uPadVal, p_tBuff.uBufL);
+
+        if( ( p_uUsePages - 1u ) == p_ptCtx->uFormatIdx )
+        {
+            /* Last page, the CRC is the one of every padded page and of the zero LEN, like the check does */
+            l_uCrcOffset = ( p_tBuff.uBufL - EFSS_BLOB_CRCOFF );
+            l_uBlobCrc = EFSS_BLOB_SEED;
+            l_uCrcPage = 0u;
+
+            while( ( l_uCrcPage < ( p_uUsePages - 1u ) ) && ( e_eFSS_BLOB_RES_OK == l_eRes ) )
+            {
+                l_eResC = eFSS_BLOBC_CalcCrcInBuff(&p_ptCtx->tBLOBCCtx, l_uBlobCrc, p_tBuff.uBufL, &l_uBlobCrc);
+                l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+                l_uCrcPage++;
+            }
+
+            if( e_eFSS_BLOB_RES_OK == l_eRes )
+            {
+                if( true != eFSS_Utils_InsertU32(&p_tBuff.puBuf[p_tBuff.uBufL - EFSS_BLOB_LENOFF], 0u ) )
+                {
+                    l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eResC = eFSS_BLOBC_CalcCrcInBuff(&p_ptCtx->tBLOBCCtx, l_uBlobCrc, l_uCrcOffset, &l_uBlobCrc);
+                    l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+                    if( e_eFSS_BLOB_RES_OK == l_eRes )
+                    {
+                        if( true != eFSS_Utils_InsertU32(&p_tBuff.puBuf[l_uCrcOffset], l_uBlobCrc ) )
+                        {
+                            l_eRes = e_eFSS_BLOB_RES_CORRUPTCTX;
+                        }
+                    }
+                }
+            }
+        }
+
+        /* Every original page is rewritten, with erase blocks bigger than a page erase the whole block only once */
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            l_eResC = eFSS_BLOBC_EraseBlkIfFirst(&p_ptCtx->tBLOBCCtx, true, p_ptCtx->uFormatIdx);
+            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+        }
+
+        /* If all ok flush the page in storage */
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            l_eResC = eFSS_BLOBC_FlushBufferInPage( &p_ptCtx->tBLOBCCtx, true, p_ptCtx->uFormatIdx,
+                                                    EFSS_SEQN_START );
+            l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+
+            if( e_eFSS_BLOB_RES_OK == l_eRes )
+            {
+                /* Original page done, the backup is created by the next steps */
+                p_ptCtx->uFormatIdx++;
+                l_eRes = e_eFSS_BLOB_RES_INPROGRESS;
+            }
+        }
+    }
+    else
+    {
+        /* original page done, create the backup */
+        l_uCloneIdx = p_ptCtx->uFormatIdx - p_uUsePages;
+        l_eResC = eFSS_BLOBC_CloneAreaStep(&p_ptCtx->tBLOBCCtx, true, &l_uCloneIdx);
+        l_eRes = eFSS_BLOB_BlobCtoBLOBRes(l_eResC);
+        p_ptCtx->uFormatIdx = p_uUsePages + l_uCloneIdx;
+
+        if( e_eFSS_BLOB_RES_OK == l_eRes )
+        {
+            /* Erase internal status data */
+            p_ptCtx->bIsBlobCheked = true;
+            p_ptCtx->bIsWriteOngoing = false;
+            p_ptCtx->uDataWritten = 0u;
+            p_ptCtx->uCrcOfDataWritten = 0u;
+            p_ptCtx->uCrcWithPartPage = 0u;
+            p_ptCtx->uCurrentSeqN = 0u;
+            p_ptCtx->bActiveIsOri = true;
+
+            /* Blob changed, any opened reader is no more valid */
+            p_ptCtx->uBlobGen++;
+        }
+    }
+
+    if( e_eFSS_BLOB_RES_INPROGRESS != l_eRes )
+    {
+        /* Format ended */
+        p_ptCtx->bIsFormatOngoing = false;
+        p_ptCtx->uFormatIdx = 0u;
+    }
+
+    return l_eRes;
+}
@@ -43,6 +43,7 @@ typedef enum
     e_eFSS_BLOBC_RES_NEWVERSIONFOUND,
     e_eFSS_BLOBC_RES_WRITENOMATCHREAD,
     e_eFSS_BLOBC_RES_OK_BKP_RCVRD,
+    e_eFSS_BLOBC_RES_INPROGRESS,
 }e_eFSS_BLOBC_RES;
 
 typedef struct
@@ -154,6 +155,27 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_LoadPageInBuff(t_eFSS_BLOBC_Ctx* const p_ptCtx, cons
 e_eFSS_BLOBC_RES eFSS_BLOBC_FlushBufferInPage(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bInOrigin,
                                               const uint32_t p_uIdx, const uint32_t p_uSeqN);
 
+/**
+ * @brief       Erase the erase block starting at the page p_uIdx of the origin or backup area, only when the page is
+ *              the first of its block and the areas are aligned to the blocks. Call it before flushing a group of
+ *              pages that will be entirely rewritten, so every page can be programmed without erasing the block again.
+ *              Does nothing when every page can be erased alone. The data of the erased pages is lost
+ *
+ * @param[in]   p_ptCtx       - Blob Core context
+ * @param[in]   p_bInOrigin   - Choose if erase the block in origin or backup area
+ * @param[in]   p_uIdx        - Index of the page we want to write next. Must be a value that can vary from 0 to
+ *                              p_puUsePages-1 (returned from eFSS_BLOBC_GetBuffNUsable).
+ *
+ * @return      e_eFSS_BLOBC_RES_BADPOINTER        - In case of bad pointer passed to the function
+ *		        e_eFSS_BLOBC_RES_BADPARAM          - In case of an invalid parameter passed to the function
+ *		        e_eFSS_BLOBC_RES_CORRUPTCTX        - Context is corrupted
+ *		        e_eFSS_BLOBC_RES_NOINITLIB         - Need to init lib before calling function
+ *		        e_eFSS_BLOBC_RES_CLBCKERASEERR     - The erase callback reported an error
+ *              e_eFSS_BLOBC_RES_OK                - Operation ended correctly
+ */
+e_eFSS_BLOBC_RES eFSS_BLOBC_EraseBlkIfFirst(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bInOrigin,
+                                            const uint32_t p_uIdx);
+
 /**
  * @brief       Calculate the Crc of the data present in the buffer. It's not necessary to calculate the CRC
  *              value of the whole buffer, we can choose to calculate the CRC of a portion of the buffer. In this
@@ -206,6 +228,19 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_CalcCrcInBuff(t_eFSS_BLOBC_Ctx* const p_ptCtx, const
  */
 e_eFSS_BLOBC_RES eFSS_BLOBC_CloneOriAreaInBkpIfNotEq(t_eFSS_BLOBC_Ctx* const p_ptCtx);
 
+/**
+ * @brief       Same as eFSS_BLOBC_CloneOriAreaInBkpIfNotEq, but verify only the page of index p_uIdx of the original
+ *              area, so the areas can be compared incrementally.
+ *
+ * @param[in]   p_ptCtx      - Blob Core context
+ * @param[in]   p_uIdx       - Index of the page to verify, must be lower than the numbers of usable pages
+ *
+ * @return      e_eFSS_BLOBC_RES_OK_BKP_RCVRD      - The backup page was different and a copy has been made
+ *              e_eFSS_BLOBC_RES_OK                - The backup page is equal to the original one
+ *              Every other value returned by eFSS_BLOBC_CloneOriAreaInBkpIfNotEq
+ */
+e_eFSS_BLOBC_RES eFSS_BLOBC_CloneOriPageInBkpIfNotEq(t_eFSS_BLOBC_Ctx* const p_ptCtx, const uint32_t p_uIdx);
+
 /**
  * @brief       Clone an area of the storage in the other one. So we can clone the original area in to the backup one
  *              or viceversa. In this case the cloning phase comprend the sequential number, but not the others private
@@ -230,6 +265,49 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_CloneOriAreaInBkpIfNotEq(t_eFSS_BLOBC_Ctx* const p_p
  */
 e_eFSS_BLOBC_RES eFSS_BLOBC_CloneArea(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bStartOri);
 
+/**
+ * @brief       Same as eFSS_BLOBC_CloneArea, but clone only one page for every call, so the operation can be
+ *              interleaved with other work. The index of the page to clone is kept by the caller, it must be set to
+ *              zero before the first call and it is increased by one every time a page is cloned.
+ *
+ * @param[in]   p_ptCtx      - Blob Core context
+ * @param[in]   p_bStartOri  - bool_t parameter, if setted to true we will clone the original area in to the backup one
+ * @param[in]   p_puCurIdx   - Pointer to the index of the next page to clone, updated after every cloned page
+ *
+ * @return      e_eFSS_BLOBC_RES_INPROGRESS        - Page cloned, call again the function to clone the next one
+ *              e_eFSS_BLOBC_RES_OK                - The last page was cloned, operation ended correctly
+ *              Every other value returned by eFSS_BLOBC_CloneArea. e_eFSS_BLOBC_RES_BADPARAM is returned also
+ *              if the index is not a page of the area
+ */
+e_eFSS_BLOBC_RES eFSS_BLOBC_CloneAreaStep(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bStartOri,
+                                          uint32_t* const p_puCurIdx);
+
+/**
+ * @brief       Get the statistics of the operations done on the storage area since the init or the last reset,
+ *              see t_eFSS_TYPE_Stats.
+ *
+ * @param[in]   p_ptCtx       - Blob Core context
+ * @param[out]  p_ptStats     - Pointer to a statistics struct that will be filled with the collected counters
+ *
+ * @return      e_eFSS_BLOBC_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_BLOBC_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_BLOBC_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_BLOBC_RES_OK            - Operation ended correctly
+ */
+e_eFSS_BLOBC_RES eFSS_BLOBC_GetStats(t_eFSS_BLOBC_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats);
+
+/**
+ * @brief       Reset to zero every statistics counter
+ *
+ * @param[in]   p_ptCtx       - Blob Core context
+ *
+ * @return      e_eFSS_BLOBC_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_BLOBC_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_BLOBC_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_BLOBC_RES_OK            - Operation ended correctly
+ */
+e_eFSS_BLOBC_RES eFSS_BLOBC_ResetStats(t_eFSS_BLOBC_Ctx* const p_ptCtx);
+
 
 
 #ifdef __cplusplus
@@ -54,6 +54,7 @@ typedef struct
 typedef struct
 {
     t_eFSS_COREHL_Ctx tCOREHLCtx;
+    uint32_t uJournalPages;
 }t_eFSS_DBC_Ctx;
 
 
@@ -69,6 +70,8 @@ typedef struct
  * @param[in]   p_tStorSet       - Storage settings
  * @param[in]   p_puBuff         - Pointer to a buffer used by the modules to make calc, must be pageSize * 2
  * @param[in]   p_uBuffL         - Size of p_puBuff
+ * @param[in]   p_uJournalPages  - Numbers of pages, at the end of the storage area, reserved for the journal. The
+ *                                 remaining pages must be an even number, they are used for original and backup pages
  *
  * @return      e_eFSS_DBC_RES_BADPOINTER    - In case of bad pointer passed to the function
  *		        e_eFSS_DBC_RES_BADPARAM      - In case of an invalid parameter passed to the function
@@ -76,7 +79,7 @@ typedef struct
  */
 e_eFSS_DBC_RES eFSS_DBC_InitCtx(t_eFSS_DBC_Ctx* const p_ptCtx, const t_eFSS_TYPE_CbStorCtx p_tCtxCb,
 								const t_eFSS_TYPE_StorSet p_tStorSet, uint8_t* const p_puBuff,
-                                const uint32_t p_uBuffL);
+                                const uint32_t p_uBuffL, const uint32_t p_uJournalPages);
 
 /**
  * @brief       Check if the lib is initialized
@@ -130,6 +133,20 @@ e_eFSS_DBC_RES eFSS_DBC_GetBuffNUsable(t_eFSS_DBC_Ctx* const p_ptCtx, t_eFSS_DBC
  */
 e_eFSS_DBC_RES eFSS_DBC_LoadPageInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx);
 
+/**
+ * @brief       Load a page from the storage area in to the internal buffer reading only the original page, see
+ *              eFSS_COREHL_LoadPageInBuffTrustOri. The backup page is read, and repaired, only if the original page
+ *              is not valid, so use eFSS_DBC_LoadPageInBuff when the backup page must be verified.
+ *
+ * @param[in]   p_ptCtx         - Database Core context
+ * @param[in]   p_uPageIndx     - uint32_t index rappresenting the page that we want to load from storage. Must be a
+ *                                a value that can vary from 0 to p_puUsePages-1 (returned from
+ *                                eFSS_DBC_GetBuffNUsable).
+ *
+ * @return      Same value returned by eFSS_DBC_LoadPageInBuff
+ */
+e_eFSS_DBC_RES eFSS_DBC_LoadPageInBuffTrustOri(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx);
+
 /**
  * @brief       Flush the internal buffer in to the storage area. Backup pages area managed automatically
  *              After this operation the used buffer will contain the same values as before, except for the private
@@ -153,8 +170,188 @@ e_eFSS_DBC_RES eFSS_DBC_LoadPageInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint
  */
 e_eFSS_DBC_RES eFSS_DBC_FlushBuffInPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx);
 
+/**
+ * @brief       Erase the erase block of the origin page and the one of its backup page, only when the page is the
+ *              first of its block and the backup pages are aligned to the blocks. Call it before flushing a group of
+ *              pages that will be entirely rewritten, so every page can be programmed without erasing the block again.
+ *              Does nothing when every page can be erased alone. The data of the erased pages is lost
+ *
+ * @param[in]   p_ptCtx             - Database Core context
+ * @param[in]   p_uPageIndx         - uint32_t index rappresenting the page that we want to flush next. Must be a
+ *                                    a value that can vary from 0 to p_puUsePages-1 (returned from
+ *                                    eFSS_DBC_GetBuffNUsable).
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_DBC_RES_CLBCKERASEERR    - The erase callback reported an error
+ *              e_eFSS_DBC_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DBC_RES eFSS_DBC_EraseBlkIfFirst(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx);
+
+/**
+ * @brief       Flush the internal buffer only in the backup page of the passed index, marking the backup page as
+ *              staged by an ongoing transaction. The origin page is not modified. The last page flushed by a
+ *              transaction must be flushed with p_bIsCommit set to true, this page is the commit marker of the whole
+ *              transaction: if it's present in storage every other staged page is already written.
+ *              After this operation the used buffer will contain the same values as before, except for the private
+ *              metadata
+ *
+ * @param[in]   p_ptCtx             - Database Core context
+ * @param[in]   p_uPageIndx         - uint32_t index rappresenting the page that we want to stage in storage. Must be
+ *                                    a value that can vary from 0 to p_puUsePages-1 (returned from
+ *                                    eFSS_DBC_GetBuffNUsable).
+ * @param[in]   p_bIsCommit         - true if the page is the last one of the transaction
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB        - Need to init lib before calling function
+ *              e_eFSS_DBC_RES_CLBCKCRCERR      - The crc callback reported an error
+ *		        e_eFSS_DBC_RES_CLBCKERASEERR    - The erase callback reported an error
+ *		        e_eFSS_DBC_RES_CLBCKWRITEERR    - The write callback reported an error
+ *		        e_eFSS_DBC_RES_CLBCKREADERR     - The read callback reported an error
+ *		        e_eFSS_DBC_RES_WRITENOMATCHREAD - Writen data dosent match what requested
+ *              e_eFSS_DBC_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DBC_RES eFSS_DBC_FlushBuffInTxPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                          const bool_t p_bIsCommit);
+
+/**
+ * @brief       Load in the internal buffer a page previously staged with eFSS_DBC_FlushBuffInTxPage. No backup
+ *              management is done by this function.
+ *
+ * @param[in]   p_ptCtx         - Database Core context
+ * @param[in]   p_uPageIndx     - uint32_t index rappresenting the page that we want to load from storage. Must be a
+ *                                a value that can vary from 0 to p_puUsePages-1 (returned from
+ *                                eFSS_DBC_GetBuffNUsable).
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_DBC_RES_CLBCKREADERR     - The read callback reported an error
+ *              e_eFSS_DBC_RES_CLBCKCRCERR      - The crc callback reported an error
+ *              e_eFSS_DBC_RES_NOTVALIDDB       - The readed page is invalid or is not a staged page
+ *              e_eFSS_DBC_RES_NEWVERSIONFOUND  - The readed page has a new version
+ *              e_eFSS_DBC_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DBC_RES eFSS_DBC_LoadTxPageInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx);
+
+/**
+ * @brief       Complete or discard an interrupted transaction. If the commit marker page is found every staged page
+ *              is copied in his origin page, otherwise every staged page is restored from his origin page.
+ *              This function must be called before loading any page of the database, because
+ *              eFSS_DBC_LoadPageInBuff consider a staged page as a corrupted backup page.
+ *              After this operation the content of the internal buffer is undefined.
+ *
+ * @param[in]   p_ptCtx         - Database Core context
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_DBC_RES_CLBCKREADERR     - The read callback reported an error
+ *              e_eFSS_DBC_RES_CLBCKCRCERR      - The crc callback reported an error
+ *              e_eFSS_DBC_RES_CLBCKERASEERR    - Error reported from the callback
+ *              e_eFSS_DBC_RES_CLBCKWRITEERR    - Error reported from the callback
+ *              e_eFSS_DBC_RES_WRITENOMATCHREAD - For some unknow reason data write dosent match data readed
+ *              e_eFSS_DBC_RES_OK_BKP_RCVRD     - An interrupted transaction was found and completed or discarded
+ *              e_eFSS_DBC_RES_OK               - Operation ended correctly, no interrupted transaction found
+ */
+e_eFSS_DBC_RES eFSS_DBC_RecoverTx(t_eFSS_DBC_Ctx* const p_ptCtx);
+
 
 
+/**
+ * @brief       Load a journal page from the storage area in to the internal buffer. Journal pages have no backup.
+ *
+ * @param[in]   p_ptCtx         - Database Core context
+ * @param[in]   p_uJournalIndx  - uint32_t index rappresenting the journal page that we want to load from storage.
+ *                                Must be a value that can vary from 0 to p_uJournalPages-1 (passed to
+ *                                eFSS_DBC_InitCtx).
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_DBC_RES_CLBCKREADERR     - The read callback reported an error
+ *              e_eFSS_DBC_RES_CLBCKCRCERR      - The crc callback reported an error
+ *              e_eFSS_DBC_RES_NOTVALIDDB       - The readed page is invalid or is not a journal page
+ *              e_eFSS_DBC_RES_NEWVERSIONFOUND  - The readed page has a new version
+ *              e_eFSS_DBC_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DBC_RES eFSS_DBC_LoadJournalPageInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uJournalIndx);
+
+/**
+ * @brief       Flush the internal buffer in to a journal page. Journal pages have no backup.
+ *              After this operation the used buffer will contain the same values as before, except for the private
+ *              metadata
+ *
+ * @param[in]   p_ptCtx         - Database Core context
+ * @param[in]   p_uJournalIndx  - uint32_t index rappresenting the journal page that we want to flush in storage.
+ *                                Must be a value that can vary from 0 to p_uJournalPages-1 (passed to
+ *                                eFSS_DBC_InitCtx).
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB        - Need to init lib before calling function
+ *              e_eFSS_DBC_RES_CLBCKCRCERR      - The crc callback reported an error
+ *		        e_eFSS_DBC_RES_CLBCKERASEERR    - The erase callback reported an error
+ *		        e_eFSS_DBC_RES_CLBCKWRITEERR    - The write callback reported an error
+ *		        e_eFSS_DBC_RES_CLBCKREADERR     - The read callback reported an error
+ *		        e_eFSS_DBC_RES_WRITENOMATCHREAD - Writen data dosent match what requested
+ *              e_eFSS_DBC_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DBC_RES eFSS_DBC_FlushBuffInJournalPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uJournalIndx);
+
+/**
+ * @brief       Add the data of a range of the buffer to the CRC of the page loaded in it. Calling it before and after
+ *              changing the range lets the next flush reuse the CRC instead of calculating it over the whole page
+ *              (see eFSS_COREHL_UpdCrcInBuff).
+ *
+ * @param[in]   p_ptCtx             - Database Core context
+ * @param[in]   p_uOffset           - Offset of the range in the buffer returned by eFSS_DBC_GetBuffNUsable
+ * @param[in]   p_uLen              - Length of the range
+ * @param[in]   p_bArm              - true if the next flush of the buffer can use the updated CRC
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB        - Need to init lib before calling function
+ *              e_eFSS_DBC_RES_CLBCKCRCERR      - The crc callback reported an error
+ *              e_eFSS_DBC_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DBC_RES eFSS_DBC_UpdCrcInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uOffset, const uint32_t p_uLen,
+                                     const bool_t p_bArm);
+
+/**
+ * @brief       Get the statistics of the operations done on the storage area since the init or the last reset,
+ *              see t_eFSS_TYPE_Stats.
+ *
+ * @param[in]   p_ptCtx       - Database Core context
+ * @param[out]  p_ptStats     - Pointer to a statistics struct that will be filled with the collected counters
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_DBC_RES_OK            - Operation ended correctly
+ */
+e_eFSS_DBC_RES eFSS_DBC_GetStats(t_eFSS_DBC_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats);
+
+/**
+ * @brief       Reset to zero every statistics counter
+ *
+ * @param[in]   p_ptCtx       - Database Core context
+ *
+ * @return      e_eFSS_DBC_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_DBC_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_DBC_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_DBC_RES_OK            - Operation ended correctly
+ */
+e_eFSS_DBC_RES eFSS_DBC_ResetStats(t_eFSS_DBC_Ctx* const p_ptCtx);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
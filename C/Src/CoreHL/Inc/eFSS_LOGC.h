@@ -63,6 +63,7 @@ typedef struct
     t_eFSS_COREHL_Ctx tCOREHLCtx;
     bool_t bFlashCache;
     bool_t bFullBckup;
+    bool_t bTrustOri;
 }t_eFSS_LOGC_Ctx;
 
 
@@ -114,6 +115,22 @@ e_eFSS_LOGC_RES eFSS_LOGC_IsInit(t_eFSS_LOGC_Ctx* const p_ptCtx, bool_t* const p
  */
 e_eFSS_LOGC_RES eFSS_LOGC_IsFlashCacheUsed(t_eFSS_LOGC_Ctx* const p_ptCtx, bool_t* const p_pbIsFlashCacheUsed);
 
+/**
+ * @brief       Select how eFSS_LOGC_LoadBufferAs load a page when the full backup is used. If p_bTrustOri is true only
+ *              the original page is read, and the backup one only if the original is not valid, see
+ *              eFSS_COREHL_LoadPageInBuffTrustOri. Cache and eFSS_LOGC_ScrubPair always verify both pages.
+ *              After the init of the context the backup page is always verified.
+ *
+ * @param[in]   p_ptCtx       - Log Core context
+ * @param[in]   p_bTrustOri   - true to trust the original page
+ *
+ * @return      e_eFSS_LOGC_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_LOGC_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_LOGC_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_LOGC_RES_OK            - Operation ended correctly
+ */
+e_eFSS_LOGC_RES eFSS_LOGC_SetTrustOri(t_eFSS_LOGC_Ctx* const p_ptCtx, const bool_t p_bTrustOri);
+
 /**
  * @brief       Get the numbers of usable page and the internal buffer
  *
@@ -196,6 +213,7 @@ e_eFSS_LOGC_RES eFSS_LOGC_ReadCache(t_eFSS_LOGC_Ctx* const p_ptCtx, uint32_t* co
  * @param[in]   p_uFillInPage    - Number of filled byte in page, this value dosent comprend the space needed to store
  *                                 this parameter. So the max value can be the size of the buffer returned by
  *                                 eFSS_LOGC_GetBuffNUsable minus the sizeof(uint32_t)
+ * @param[in]   p_uSeqN          - Sequence number that will be stored in the metadata of the page
  *
  *
  * @return      e_eFSS_LOGC_RES_BADPOINTER        - In case of bad pointer passed to the function
@@ -210,7 +228,26 @@ e_eFSS_LOGC_RES eFSS_LOGC_ReadCache(t_eFSS_LOGC_Ctx* const p_ptCtx, uint32_t* co
  *              e_eFSS_LOGC_RES_OK                - Operation ended correctly
  */
 e_eFSS_LOGC_RES eFSS_LOGC_FlushBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_eFSS_LOGC_PAGETYPE p_ePageType,
-                                        const uint32_t p_uIdx, const uint32_t p_uFillInPage);
+                                        const uint32_t p_uIdx, const uint32_t p_uFillInPage, const uint32_t p_uSeqN);
+
+/**
+ * @brief       Erase the erase block of the log page at p_uIdx position and the one of its backup page, only when
+ *              the page is the first of its block and the log pages are aligned to the blocks. Call it before
+ *              flushing a page whose following pages can be lost, so they can be programmed later without erasing
+ *              the block again. Does nothing when every page can be erased alone. The data of the erased pages is
+ *              lost. Flash cache pages are never erased.
+ *
+ * @param[in]   p_ptCtx          - Log Core context
+ * @param[in]   p_uIdx           - Index of the log page we want to write next
+ *
+ * @return      e_eFSS_LOGC_RES_BADPOINTER        - In case of bad pointer passed to the function
+ *		        e_eFSS_LOGC_RES_BADPARAM          - In case of an invalid parameter passed to the function
+ *		        e_eFSS_LOGC_RES_CORRUPTCTX        - Context is corrupted
+ *		        e_eFSS_LOGC_RES_NOINITLIB         - Need to init lib before calling function
+ *		        e_eFSS_LOGC_RES_CLBCKERASEERR     - The erase callback reported an error
+ *              e_eFSS_LOGC_RES_OK                - Operation ended correctly
+ */
+e_eFSS_LOGC_RES eFSS_LOGC_EraseBlkIfFirst(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uIdx);
 
 /**
  * @brief       Read a page of data at p_uIdx position with an expected subtype equals to p_ePageType. Load in
@@ -226,6 +263,7 @@ e_eFSS_LOGC_RES eFSS_LOGC_FlushBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_
  *                                 This value dosent comprend the space needed to store this parameter.
  *                                 So the max value can be the size of the buffer returned by
  *                                 eFSS_LOGC_GetBuffNUsable minus the sizeof(uint32_t)
+ * @param[out]  p_puSeqN         - Pointer to an uint32_t where the sequence number stored in the page will be copied
  *
  * @return      e_eFSS_LOGC_RES_BADPOINTER        - In case of bad pointer passed to the function
  *		        e_eFSS_LOGC_RES_BADPARAM          - In case of an invalid parameter passed to the function
@@ -243,7 +281,8 @@ e_eFSS_LOGC_RES eFSS_LOGC_FlushBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_
  *              e_eFSS_LOGC_RES_OK                - Operation ended correctly
  */
 e_eFSS_LOGC_RES eFSS_LOGC_LoadBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_eFSS_LOGC_PAGETYPE p_ePageType,
-                                       const uint32_t p_uIdx, uint32_t* const p_puFillInPage);
+                                       const uint32_t p_uIdx, uint32_t* const p_puFillInPage,
+                                       uint32_t* const p_puSeqN);
 
 /**
  * @brief       Load in to the internal buffer the value of a page pointed by the index p_uIdx. The loaded page will
@@ -302,6 +341,7 @@ e_eFSS_LOGC_RES eFSS_LOGC_IsPageNewOrBkup(t_eFSS_LOGC_Ctx* const p_ptCtx, const
  * @param[in]   p_eTypeFlush    - Subtype that the pointe page need to have to be considered a valid page. If page
  *                                is valid but subtype dosent page the flush operation will be performed even if
  *                                data present in buffer match the one present in to the page
+ * @param[in]   p_uSeqN         - Sequence number that will be stored in the metadata of the page
  *
  * @return      e_eFSS_LOGC_RES_BADPOINTER        - In case of bad pointer passed to the function
  *		        e_eFSS_LOGC_RES_BADPARAM          - In case of an invalid parameter passed to the functionsB
@@ -318,7 +358,110 @@ e_eFSS_LOGC_RES eFSS_LOGC_IsPageNewOrBkup(t_eFSS_LOGC_Ctx* const p_ptCtx, const
  *              e_eFSS_LOGC_RES_OK                - Operation ended correctly, no flush operation performed
  */
 e_eFSS_LOGC_RES eFSS_LOGC_FlushBuffIfNotEquals(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uIdx,
-                                               const uint32_t p_uFillInPage, const e_eFSS_LOGC_PAGETYPE p_eTypeFlush);
+                                               const uint32_t p_uFillInPage, const e_eFSS_LOGC_PAGETYPE p_eTypeFlush,
+                                               const uint32_t p_uSeqN);
+
+/**
+ * @brief       Read only the sequence number stored in the page pointed by p_uIdx. The original page is read first,
+ *              if it is not valid and fullbackup is enabled the backup page is read. No page is ripristinated by
+ *              this function, so it is cheap and can be used to search the newest page without modify the storage.
+ *              Every log page subtype (log, newest and newest backup) is accepted. Only the page trailer is probed,
+ *              see eFSS_COREHL_ProbePageInBuff: when the ranged read callback is present the CRC is not verified and
+ *              the returned sequence number is only an hint. After this call the internal buffer will contain the
+ *              readed page, or only his trailer.
+ *
+ * @param[in]   p_ptCtx          - Log Core context
+ * @param[in]   p_uIdx           - Index of the log page we want to read
+ * @param[out]  p_puSeqN         - Pointer to an uint32_t where the sequence number stored in the page will be copied
+ *
+ * @return      e_eFSS_LOGC_RES_BADPOINTER        - In case of bad pointer passed to the function
+ *		        e_eFSS_LOGC_RES_BADPARAM          - In case of an invalid parameter passed to the function
+ *		        e_eFSS_LOGC_RES_CORRUPTCTX        - Context is corrupted
+ *		        e_eFSS_LOGC_RES_NOINITLIB         - Need to init lib before calling function
+ *		        e_eFSS_LOGC_RES_CLBCKREADERR      - The read callback reported an error
+ *              e_eFSS_LOGC_RES_CLBCKCRCERR       - The crc callback reported an error
+ *              e_eFSS_LOGC_RES_NOTVALIDLOG       - Both origin and backup pages are corrupted or are not log pages
+ *              e_eFSS_LOGC_RES_NEWVERSIONFOUND   - The readed page has a new version
+ *              e_eFSS_LOGC_RES_OK                - Operation ended correctly
+ */
+e_eFSS_LOGC_RES eFSS_LOGC_GetPageSeqN(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uIdx,
+                                      uint32_t* const p_puSeqN);
+
+/**
+ * @brief       Add the data of a range of the buffer to the CRC of the page loaded in it. Calling it before and after
+ *              changing the range lets the next flush reuse the CRC instead of calculating it over the whole page
+ *              (see eFSS_COREHL_UpdCrcInBuff).
+ *
+ * @param[in]   p_ptCtx           - Log Core context
+ * @param[in]   p_uOffset         - Offset of the range in the buffer returned by eFSS_LOGC_GetBuffNUsable
+ * @param[in]   p_uLen            - Length of the range
+ * @param[in]   p_bArm            - true if the next flush of the buffer can use the updated CRC
+ *
+ * @return      e_eFSS_LOGC_RES_BADPOINTER        - In case of bad pointer passed to the function
+ *		        e_eFSS_LOGC_RES_BADPARAM          - In case of an invalid parameter passed to the function
+ *		        e_eFSS_LOGC_RES_CORRUPTCTX        - Context is corrupted
+ *		        e_eFSS_LOGC_RES_NOINITLIB         - Need to init lib before calling function
+ *              e_eFSS_LOGC_RES_CLBCKCRCERR       - The crc callback reported an error
+ *              e_eFSS_LOGC_RES_OK                - Operation ended correctly
+ */
+e_eFSS_LOGC_RES eFSS_LOGC_UpdCrcInBuff(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uOffset,
+                                       const uint32_t p_uLen, const bool_t p_bArm);
+
+/**
+ * @brief       Verify a pair of origin and backup pages, repairing a divergent or corrupted copy like a load does.
+ *              When the full backup is used the first pairs are the log pages, in the same order of the log index,
+ *              and when the flash cache is used the last pair is the cache one. The role of a log page is taken
+ *              from the subtype of the origin page, or of the backup one if the origin is not valid. A log pair
+ *              where both pages are not valid was never written after the format and is skipped.
+ *              The internal buffer is used.
+ *
+ * @param[in]   p_ptCtx          - Log Core context
+ * @param[in]   p_uIdx           - Index of the pair to verify
+ * @param[out]  p_puNPair        - Pointer to a uint32_t that will be filled with the numbers of pairs. If it is zero
+ *                               no page has a backup and nothing is verified
+ *
+ * @return      e_eFSS_LOGC_RES_BADPOINTER        - In case of bad pointer passed to the function
+ *		        e_eFSS_LOGC_RES_BADPARAM          - In case of an invalid parameter passed to the function
+ *		        e_eFSS_LOGC_RES_CORRUPTCTX        - Context is corrupted
+ *		        e_eFSS_LOGC_RES_NOINITLIB         - Need to init lib before calling function
+ *		        e_eFSS_LOGC_RES_CLBCKREADERR      - The read callback reported an error
+ *              e_eFSS_LOGC_RES_CLBCKCRCERR       - The crc callback reported an error
+ *              e_eFSS_LOGC_RES_NOTVALIDLOG       - Both the pages of the cache pair are not valid
+ *              e_eFSS_LOGC_RES_NEWVERSIONFOUND   - The pair has a new version
+ *              e_eFSS_LOGC_RES_CLBCKERASEERR     - Error reported from the callback
+ *              e_eFSS_LOGC_RES_CLBCKWRITEERR     - Error reported from the callback
+ *              e_eFSS_LOGC_RES_WRITENOMATCHREAD  - For some unknow reason data write dosent match data readed
+ *              e_eFSS_LOGC_RES_OK_BKP_RCVRD      - A page of the pair was repaired
+ *              e_eFSS_LOGC_RES_OK                - Operation ended correctly
+ */
+e_eFSS_LOGC_RES eFSS_LOGC_ScrubPair(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uIdx,
+                                    uint32_t* const p_puNPair);
+
+/**
+ * @brief       Get the statistics of the operations done on the storage area since the init or the last reset,
+ *              see t_eFSS_TYPE_Stats.
+ *
+ * @param[in]   p_ptCtx       - Log Core context
+ * @param[out]  p_ptStats     - Pointer to a statistics struct that will be filled with the collected counters
+ *
+ * @return      e_eFSS_LOGC_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_LOGC_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_LOGC_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_LOGC_RES_OK            - Operation ended correctly
+ */
+e_eFSS_LOGC_RES eFSS_LOGC_GetStats(t_eFSS_LOGC_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats);
+
+/**
+ * @brief       Reset to zero every statistics counter
+ *
+ * @param[in]   p_ptCtx       - Log Core context
+ *
+ * @return      e_eFSS_LOGC_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_LOGC_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_LOGC_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_LOGC_RES_OK            - Operation ended correctly
+ */
+e_eFSS_LOGC_RES eFSS_LOGC_ResetStats(t_eFSS_LOGC_Ctx* const p_ptCtx);
 
 #ifdef __cplusplus
 } /* extern "C" */
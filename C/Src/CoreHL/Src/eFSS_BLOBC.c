@@ -49,6 +49,12 @@
  **********************************************************************************************************************/
 static bool_t eFSS_BLOBC_IsStatusStillCoherent(t_eFSS_BLOBC_Ctx* const p_ptCtx);
 static e_eFSS_BLOBC_RES eFSS_BLOBC_HLtoBLOBCRes(const e_eFSS_COREHL_RES p_eHLRes);
+static e_eFSS_BLOBC_RES eFSS_BLOBC_ClonePage(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bStartOri,
+                                             const uint32_t p_uLastPageIdx, const uint32_t p_uIdx);
+static e_eFSS_BLOBC_RES eFSS_BLOBC_AlignBkpPage(t_eFSS_BLOBC_Ctx* const p_ptCtx, const uint32_t p_uLastPageIdx,
+                                                const uint32_t p_uIdx, const bool_t p_bWholeArea);
+static e_eFSS_BLOBC_RES eFSS_BLOBC_EraseBlkIfAligned(t_eFSS_BLOBC_Ctx* const p_ptCtx, const uint32_t p_uLastPageIdx,
+                                                     const uint32_t p_uPageIdx);
 
 
 
@@ -400,6 +406,79 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_FlushBufferInPage(t_eFSS_BLOBC_Ctx* const p_ptCtx, c
 	return l_eRes;
 }
 
+e_eFSS_BLOBC_RES eFSS_BLOBC_EraseBlkIfFirst(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bInOrigin,
+                                            const uint32_t p_uIdx)
+{
+	/* Return local var */
+	e_eFSS_BLOBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    /* Local var used for calculation */
+	uint32_t l_uLastPageIdx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+        if( e_eFSS_BLOBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Verify index */
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+                    if( e_eFSS_BLOBC_RES_OK == l_eRes )
+                    {
+                        l_uLastPageIdx = (uint32_t)( l_tStorSet.uTotPages / EFSS_BLOBC_NPAGEMIN );
+
+                        if( p_uIdx >= l_uLastPageIdx )
+                        {
+                            l_eRes = e_eFSS_BLOBC_RES_BADPARAM;
+                        }
+                        else if( true == p_bInOrigin )
+                        {
+                            l_eRes = eFSS_BLOBC_EraseBlkIfAligned(p_ptCtx, l_uLastPageIdx, p_uIdx);
+                        }
+                        else
+                        {
+                            l_eRes = eFSS_BLOBC_EraseBlkIfAligned(p_ptCtx, l_uLastPageIdx,
+                                                                  ( p_uIdx + l_uLastPageIdx ) );
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
 e_eFSS_BLOBC_RES eFSS_BLOBC_CalcCrcInBuff(t_eFSS_BLOBC_Ctx* const p_ptCtx, const uint32_t p_uSeed,
                                           const uint32_t p_uCrcL, uint32_t* const p_puCrc)
 {
@@ -483,10 +562,8 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_CloneOriAreaInBkpIfNotEq(t_eFSS_BLOBC_Ctx* const p_p
     t_eFSS_TYPE_StorSet l_tStorSet;
 
     /* Local var used for calculation */
-    bool_t l_bIsEquals;
     bool_t l_bSomeWhereNotEquals;
 	uint32_t l_uLastPageIdx;
-    uint8_t l_uSubTR;
     uint32_t l_uCurIdx;
 
 	/* Check pointer validity */
@@ -524,57 +601,26 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_CloneOriAreaInBkpIfNotEq(t_eFSS_BLOBC_Ctx* const p_p
                     {
                         /* Init var */
                         l_bSomeWhereNotEquals = false;
-                        l_uSubTR = 0u;
 
                         /* Get last page */
                         l_uLastPageIdx = (uint32_t)( l_tStorSet.uTotPages / EFSS_BLOBC_NPAGEMIN );
                         l_uCurIdx = 0u;
 
                         /* Start cloning if needed process */
-                        while( ( l_uCurIdx < l_uLastPageIdx ) && ( ( e_eFSS_BLOBC_RES_OK == l_eRes ) ) )
+                        while( ( l_uCurIdx < l_uLastPageIdx ) && ( e_eFSS_BLOBC_RES_OK == l_eRes ) )
                         {
-                            /* Load the page in to the internal buffer */
-                            l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, l_uCurIdx, &l_uSubTR);
-                            l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+                            l_eRes = eFSS_BLOBC_AlignBkpPage(p_ptCtx, l_uLastPageIdx, l_uCurIdx, true);
 
-                            if( e_eFSS_BLOBC_RES_OK == l_eRes )
+                            if( e_eFSS_BLOBC_RES_OK_BKP_RCVRD == l_eRes )
                             {
-                                /* Verify basic data */
-                                if( EFSS_PAGESUBTYPE_BLOBORI != l_uSubTR )
-                                {
-                                    l_eRes = e_eFSS_BLOBC_RES_NOTVALIDBLOB;
-                                }
-                                else
-                                {
-                                    /* Verify if orginal page match the backup one */
-                                    l_bIsEquals = false;
-                                    l_eResHL = eFSS_COREHL_IsBuffEqualToPage(&p_ptCtx->tCOREHLCtx,
-                                                                             (l_uLastPageIdx + l_uCurIdx),
-                                                                             &l_bIsEquals,
-                                                                             &l_uSubTR);
-
-                                    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
-
-                                    if( ( ( e_eFSS_BLOBC_RES_OK == l_eRes ) &&
-                                          ( ( false == l_bIsEquals ) || ( EFSS_PAGESUBTYPE_BLOBBKP != l_uSubTR ) ) ) ||
-                                        ( e_eFSS_BLOBC_RES_NOTVALIDBLOB == l_eRes ) ||
-                                        ( e_eFSS_BLOBC_RES_NEWVERSIONFOUND == l_eRes ) )
-                                    {
-                                        /* Backup pages is not valid or equals, clone */
-                                        l_bSomeWhereNotEquals = true;
-
-                                        /* Not equal! Flush ori in backup */
-                                        l_eResHL = eFSS_COREHL_FlushBuffInPage(&p_ptCtx->tCOREHLCtx,
-                                                                               (l_uLastPageIdx + l_uCurIdx),
-                                                                               EFSS_PAGESUBTYPE_BLOBBKP);
-                                        l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
-                                    }
+                                /* Backup pages was not valid or equals and was cloned */
+                                l_bSomeWhereNotEquals = true;
+                                l_eRes = e_eFSS_BLOBC_RES_OK;
+                            }
 
-                                    if( e_eFSS_BLOBC_RES_OK == l_eRes )
-                                    {
-                                        l_uCurIdx++;
-                                    }
-                                }
+                            if( e_eFSS_BLOBC_RES_OK == l_eRes )
+                            {
+                                l_uCurIdx++;
                             }
                         }
 
@@ -591,7 +637,7 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_CloneOriAreaInBkpIfNotEq(t_eFSS_BLOBC_Ctx* const p_p
 	return l_eRes;
 }
 
-e_eFSS_BLOBC_RES eFSS_BLOBC_CloneArea(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bStartOri)
+e_eFSS_BLOBC_RES eFSS_BLOBC_CloneOriPageInBkpIfNotEq(t_eFSS_BLOBC_Ctx* const p_ptCtx, const uint32_t p_uIdx)
 {
 	/* Return local var */
 	e_eFSS_BLOBC_RES l_eRes;
@@ -605,14 +651,6 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_CloneArea(t_eFSS_BLOBC_Ctx* const p_ptCtx, const boo
 
     /* Local var used for calculation */
 	uint32_t l_uLastPageIdx;
-    uint8_t l_uSubTypeReaded;
-
-    /* Local variable for ori backup target */
-    uint32_t l_uReadAreaOf;
-    uint32_t l_uWriteAreaOf;
-    uint8_t l_uReadtAreaT;
-    uint8_t l_uWriteAreaT;
-    uint32_t l_uCurIdx;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -641,61 +679,169 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_CloneArea(t_eFSS_BLOBC_Ctx* const p_ptCtx, const boo
                 }
                 else
                 {
-                    /* Get storage data */
+                    /* Verify index */
                     l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
                     l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
 
                     if( e_eFSS_BLOBC_RES_OK == l_eRes )
                     {
-                        /* Get last page in order to separate the two different area */
-                        l_uLastPageIdx = ( uint32_t )( l_tStorSet.uTotPages / EFSS_BLOBC_NPAGEMIN ) ;
+                        l_uLastPageIdx = (uint32_t)( l_tStorSet.uTotPages / EFSS_BLOBC_NPAGEMIN );
 
-                        if( true == p_bStartOri )
+                        if( p_uIdx >= l_uLastPageIdx )
                         {
-                            l_uReadAreaOf  = 0u;
-                            l_uWriteAreaOf = l_uLastPageIdx;
-                            l_uReadtAreaT  = EFSS_PAGESUBTYPE_BLOBORI;
-                            l_uWriteAreaT  = EFSS_PAGESUBTYPE_BLOBBKP;
+                            l_eRes = e_eFSS_BLOBC_RES_BADPARAM;
                         }
                         else
                         {
-                            l_uReadAreaOf  = l_uLastPageIdx;
-                            l_uWriteAreaOf = 0u;
-                            l_uReadtAreaT  = EFSS_PAGESUBTYPE_BLOBBKP;
-                            l_uWriteAreaT  = EFSS_PAGESUBTYPE_BLOBORI;
+                            l_eRes = eFSS_BLOBC_AlignBkpPage(p_ptCtx, l_uLastPageIdx, p_uIdx, false);
                         }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_BLOBC_RES eFSS_BLOBC_CloneArea(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bStartOri)
+{
+	/* Return local var */
+	e_eFSS_BLOBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    /* Local var used for calculation */
+	uint32_t l_uLastPageIdx;
+    uint32_t l_uCurIdx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+        if( e_eFSS_BLOBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Get storage data */
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+                    if( e_eFSS_BLOBC_RES_OK == l_eRes )
+                    {
+                        /* Get last page in order to separate the two different area */
+                        l_uLastPageIdx = ( uint32_t )( l_tStorSet.uTotPages / EFSS_BLOBC_NPAGEMIN ) ;
 
                         /* Init counter var */
                         l_uCurIdx = 0u;
-                        l_uSubTypeReaded = 0u;
 
                         /* Start cloning process */
                         while( ( l_uCurIdx < l_uLastPageIdx ) && ( e_eFSS_BLOBC_RES_OK == l_eRes ) )
                         {
-                            /* Load the page in to the internal buffer */
-                            l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, ( l_uCurIdx + l_uReadAreaOf ),
-                                                                  &l_uSubTypeReaded);
-                            l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+                            l_eRes = eFSS_BLOBC_ClonePage(p_ptCtx, p_bStartOri, l_uLastPageIdx, l_uCurIdx);
+                            l_uCurIdx++;
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_BLOBC_RES eFSS_BLOBC_CloneAreaStep(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bStartOri,
+                                          uint32_t* const p_puCurIdx)
+{
+	/* Return local var */
+	e_eFSS_BLOBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    /* Local var used for calculation */
+	uint32_t l_uLastPageIdx;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puCurIdx ) )
+	{
+		l_eRes = e_eFSS_BLOBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+        if( e_eFSS_BLOBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Get storage data */
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+                    if( e_eFSS_BLOBC_RES_OK == l_eRes )
+                    {
+                        /* Get last page in order to separate the two different area */
+                        l_uLastPageIdx = ( uint32_t )( l_tStorSet.uTotPages / EFSS_BLOBC_NPAGEMIN ) ;
+
+                        if( *p_puCurIdx >= l_uLastPageIdx )
+                        {
+                            l_eRes = e_eFSS_BLOBC_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            /* Clone only the current page */
+                            l_eRes = eFSS_BLOBC_ClonePage(p_ptCtx, p_bStartOri, l_uLastPageIdx, *p_puCurIdx);
 
                             if( e_eFSS_BLOBC_RES_OK == l_eRes )
                             {
-                                /* Verify basic data */
-                                if( l_uReadtAreaT != l_uSubTypeReaded )
-                                {
-                                    l_eRes = e_eFSS_BLOBC_RES_NOTVALIDBLOB;
-                                }
-                                else
-                                {
-                                    /* Flush the just readed data from an area in to ther other one */
-                                    l_eResHL = eFSS_COREHL_FlushBuffInPage(&p_ptCtx->tCOREHLCtx,
-                                                                           ( l_uCurIdx + l_uWriteAreaOf ),
-                                                                           l_uWriteAreaT);
-                                    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+                                *p_puCurIdx = *p_puCurIdx + 1u;
 
-                                    if( e_eFSS_BLOBC_RES_OK == l_eRes )
-                                    {
-                                        l_uCurIdx++;
-                                    }
+                                if( *p_puCurIdx < l_uLastPageIdx )
+                                {
+                                    l_eRes = e_eFSS_BLOBC_RES_INPROGRESS;
                                 }
                             }
                         }
@@ -708,6 +854,100 @@ e_eFSS_BLOBC_RES eFSS_BLOBC_CloneArea(t_eFSS_BLOBC_Ctx* const p_ptCtx, const boo
 	return l_eRes;
 }
 
+e_eFSS_BLOBC_RES eFSS_BLOBC_GetStats(t_eFSS_BLOBC_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats)
+{
+	/* Return local var */
+    e_eFSS_BLOBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+        if( e_eFSS_BLOBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The counters are kept by the low level core */
+                    l_eResHL = eFSS_COREHL_GetStats(&p_ptCtx->tCOREHLCtx, p_ptStats);
+                    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_BLOBC_RES eFSS_BLOBC_ResetStats(t_eFSS_BLOBC_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_BLOBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_BLOBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+        if( e_eFSS_BLOBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_BLOBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_BLOBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_BLOBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Reset the counters of the low level core */
+                    l_eResHL = eFSS_COREHL_ResetStats(&p_ptCtx->tCOREHLCtx);
+                    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
 
 
 /***********************************************************************************************************************
@@ -849,4 +1089,154 @@ static e_eFSS_BLOBC_RES eFSS_BLOBC_HLtoBLOBCRes(const e_eFSS_COREHL_RES p_eHLRes
     }
 
     return l_eRes;
-}
\ No newline at end of file
+}
+
+static e_eFSS_BLOBC_RES eFSS_BLOBC_ClonePage(t_eFSS_BLOBC_Ctx* const p_ptCtx, const bool_t p_bStartOri,
+                                             const uint32_t p_uLastPageIdx, const uint32_t p_uIdx)
+{
+    /* Return local var */
+    e_eFSS_BLOBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local variable for ori backup target */
+    uint32_t l_uReadAreaOf;
+    uint32_t l_uWriteAreaOf;
+    uint8_t l_uReadtAreaT;
+    uint8_t l_uWriteAreaT;
+    uint8_t l_uSubTypeReaded;
+
+    if( true == p_bStartOri )
+    {
+        l_uReadAreaOf  = 0u;
+        l_uWriteAreaOf = p_uLastPageIdx;
+        l_uReadtAreaT  = EFSS_PAGESUBTYPE_BLOBORI;
+        l_uWriteAreaT  = EFSS_PAGESUBTYPE_BLOBBKP;
+    }
+    else
+    {
+        l_uReadAreaOf  = p_uLastPageIdx;
+        l_uWriteAreaOf = 0u;
+        l_uReadtAreaT  = EFSS_PAGESUBTYPE_BLOBBKP;
+        l_uWriteAreaT  = EFSS_PAGESUBTYPE_BLOBORI;
+    }
+
+    /* Load the page in to the internal buffer */
+    l_uSubTypeReaded = 0u;
+    l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, ( p_uIdx + l_uReadAreaOf ), &l_uSubTypeReaded);
+    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+    if( e_eFSS_BLOBC_RES_OK == l_eRes )
+    {
+        /* Verify basic data */
+        if( l_uReadtAreaT != l_uSubTypeReaded )
+        {
+            l_eRes = e_eFSS_BLOBC_RES_NOTVALIDBLOB;
+        }
+        else
+        {
+            /* The whole destination area is cloned, erase every block of it only once */
+            l_eRes = eFSS_BLOBC_EraseBlkIfAligned(p_ptCtx, p_uLastPageIdx, ( p_uIdx + l_uWriteAreaOf ) );
+
+            if( e_eFSS_BLOBC_RES_OK == l_eRes )
+            {
+                /* Flush the just readed data from an area in to ther other one */
+                l_eResHL = eFSS_COREHL_FlushBuffInPage(&p_ptCtx->tCOREHLCtx, ( p_uIdx + l_uWriteAreaOf ),
+                                                       l_uWriteAreaT);
+                l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_BLOBC_RES eFSS_BLOBC_AlignBkpPage(t_eFSS_BLOBC_Ctx* const p_ptCtx, const uint32_t p_uLastPageIdx,
+                                                const uint32_t p_uIdx, const bool_t p_bWholeArea)
+{
+    /* Return local var */
+    e_eFSS_BLOBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var used for calculation */
+    bool_t l_bIsEquals;
+    uint8_t l_uSubTR;
+
+    /* Load the page in to the internal buffer */
+    l_uSubTR = 0u;
+    l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, p_uIdx, &l_uSubTR);
+    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+    if( e_eFSS_BLOBC_RES_OK == l_eRes )
+    {
+        /* Verify basic data */
+        if( EFSS_PAGESUBTYPE_BLOBORI != l_uSubTR )
+        {
+            l_eRes = e_eFSS_BLOBC_RES_NOTVALIDBLOB;
+        }
+        else
+        {
+            /* Verify if orginal page match the backup one */
+            l_bIsEquals = false;
+            l_eResHL = eFSS_COREHL_IsBuffEqualToPage(&p_ptCtx->tCOREHLCtx, ( p_uLastPageIdx + p_uIdx ), &l_bIsEquals,
+                                                     &l_uSubTR);
+            l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+            if( ( ( e_eFSS_BLOBC_RES_OK == l_eRes ) &&
+                  ( ( false == l_bIsEquals ) || ( EFSS_PAGESUBTYPE_BLOBBKP != l_uSubTR ) ) ) ||
+                ( e_eFSS_BLOBC_RES_NOTVALIDBLOB == l_eRes ) ||
+                ( e_eFSS_BLOBC_RES_NEWVERSIONFOUND == l_eRes ) )
+            {
+                /* Not equal! When the whole area is aligned the next backup pages of the block are compared later,
+                   so the block can be erased once and the erased pages will be written again if needed */
+                if( true == p_bWholeArea )
+                {
+                    l_eRes = eFSS_BLOBC_EraseBlkIfAligned(p_ptCtx, p_uLastPageIdx, ( p_uLastPageIdx + p_uIdx ) );
+                }
+                else
+                {
+                    l_eRes = e_eFSS_BLOBC_RES_OK;
+                }
+
+                if( e_eFSS_BLOBC_RES_OK == l_eRes )
+                {
+                    /* Flush ori in backup */
+                    l_eResHL = eFSS_COREHL_FlushBuffInPage(&p_ptCtx->tCOREHLCtx, ( p_uLastPageIdx + p_uIdx ),
+                                                           EFSS_PAGESUBTYPE_BLOBBKP);
+                    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+                }
+
+                if( e_eFSS_BLOBC_RES_OK == l_eRes )
+                {
+                    l_eRes = e_eFSS_BLOBC_RES_OK_BKP_RCVRD;
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_BLOBC_RES eFSS_BLOBC_EraseBlkIfAligned(t_eFSS_BLOBC_Ctx* const p_ptCtx, const uint32_t p_uLastPageIdx,
+                                                     const uint32_t p_uPageIdx)
+{
+    /* Return local var */
+    e_eFSS_BLOBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+    l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+
+    /* Erase only when the page start a block and the block contain only pages of the same area */
+    if( ( e_eFSS_BLOBC_RES_OK == l_eRes ) && ( l_tStorSet.uPagesPerBlk > 1u ) &&
+        ( 0u == ( p_uPageIdx % l_tStorSet.uPagesPerBlk ) ) &&
+        ( 0u == ( p_uLastPageIdx % l_tStorSet.uPagesPerBlk ) ) )
+    {
+        l_eResHL = eFSS_COREHL_EraseBlk(&p_ptCtx->tCOREHLCtx, p_uPageIdx);
+        l_eRes = eFSS_BLOBC_HLtoBLOBCRes(l_eResHL);
+    }
+
+    return l_eRes;
+}
@@ -17,8 +17,15 @@
  *
  * In this module the storage is organizated as follow :
  *
- * - [ 0                            -    ( uTotPages / 2 ) - 1    ]  -> Original pages
- * - [ ( uTotPages / 2 )            -    uTotPages - 1            ]  -> Backup pages
+ * - [ 0                            -    ( uDbPages / 2 ) - 1     ]  -> Original pages
+ * - [ ( uDbPages / 2 )             -    uDbPages - 1             ]  -> Backup pages
+ * - [ uDbPages                     -    uTotPages - 1            ]  -> Journal pages
+ *
+ * Where uDbPages is uTotPages - uJournalPages. Journal pages have no backup, and are managed by the upper layer.
+ *
+ * During a transaction the new value of every modified page is first staged in his backup page, using a dedicated
+ * subtype. The last staged page use the commit subtype, and only after that the origin pages are written. In this
+ * way an interrupted transaction can be completed (commit page found) or discarded (commit page not found).
  *
  */
 
@@ -36,6 +43,9 @@
 #define EFSS_PAGETYPE_DB                                                                         ( ( uint8_t )   0x03u )
 #define EFSS_PAGESUBTYPE_DBORI                                                                   ( ( uint8_t )   0x01u )
 #define EFSS_PAGESUBTYPE_DBBKP                                                                   ( ( uint8_t )   0x02u )
+#define EFSS_PAGESUBTYPE_DBTXBKP                                                                 ( ( uint8_t )   0x03u )
+#define EFSS_PAGESUBTYPE_DBTXCMT                                                                 ( ( uint8_t )   0x04u )
+#define EFSS_PAGESUBTYPE_DBJRN                                                                   ( ( uint8_t )   0x05u )
 #define EFSS_DBC_NPAGEMIN                                                                        ( ( uint32_t )     2u )
 
 
@@ -45,6 +55,9 @@
  **********************************************************************************************************************/
 static bool_t eFSS_DBC_IsStatusStillCoherent(t_eFSS_DBC_Ctx* const p_ptCtx);
 static e_eFSS_DBC_RES eFSS_DBC_HLtoDBCRes(const e_eFSS_COREHL_RES p_eHLRes);
+static e_eFSS_DBC_RES eFSS_DBC_RecoverTxPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                             const uint32_t p_uUsePages, const bool_t p_bIsCommitted,
+                                             bool_t* const p_pbIsRecovered);
 
 
 
@@ -53,7 +66,7 @@ static e_eFSS_DBC_RES eFSS_DBC_HLtoDBCRes(const e_eFSS_COREHL_RES p_eHLRes);
  **********************************************************************************************************************/
 e_eFSS_DBC_RES eFSS_DBC_InitCtx(t_eFSS_DBC_Ctx* const p_ptCtx, const t_eFSS_TYPE_CbStorCtx p_tCtxCb,
 								const t_eFSS_TYPE_StorSet p_tStorSet, uint8_t* const p_puBuff,
-                                const uint32_t p_uBuffL)
+                                const uint32_t p_uBuffL, const uint32_t p_uJournalPages)
 {
     /* Return local var */
     e_eFSS_DBC_RES l_eRes;
@@ -69,8 +82,15 @@ e_eFSS_DBC_RES eFSS_DBC_InitCtx(t_eFSS_DBC_Ctx* const p_ptCtx, const t_eFSS_TYPE
 	}
 	else
 	{
-        /* The database needs at least 2 pages, one for original and one for backup */
-        l_uNPage = p_tStorSet.uTotPages;
+        /* The database needs at least 2 pages, one for original and one for backup, journal pages excluded */
+        if( p_uJournalPages >= p_tStorSet.uTotPages )
+        {
+            l_uNPage = 0u;
+        }
+        else
+        {
+            l_uNPage = p_tStorSet.uTotPages - p_uJournalPages;
+        }
 
         /* Check numbers of page validity */
         if( ( l_uNPage < EFSS_DBC_NPAGEMIN ) || ( 0u != ( l_uNPage % EFSS_DBC_NPAGEMIN ) ) )
@@ -79,6 +99,8 @@ e_eFSS_DBC_RES eFSS_DBC_InitCtx(t_eFSS_DBC_Ctx* const p_ptCtx, const t_eFSS_TYPE
         }
         else
         {
+            p_ptCtx->uJournalPages = p_uJournalPages;
+
             /* Can now init low level context */
             l_eResHL = eFSS_COREHL_InitCtx(&p_ptCtx->tCOREHLCtx, p_tCtxCb, p_tStorSet, EFSS_PAGETYPE_DB, p_puBuff,
                                            p_uBuffL);
@@ -160,7 +182,8 @@ e_eFSS_DBC_RES eFSS_DBC_GetBuffNUsable(t_eFSS_DBC_Ctx* const p_ptCtx, t_eFSS_DBC
                     {
                         p_ptBuff->puBuf = l_tBuff.puBuf;
                         p_ptBuff->uBufL = l_tBuff.uBufL;
-                        *p_puUsePages = (uint32_t)( l_tStorSet.uTotPages / EFSS_DBC_NPAGEMIN );
+                        *p_puUsePages = (uint32_t)( ( l_tStorSet.uTotPages - p_ptCtx->uJournalPages ) /
+                                                    EFSS_DBC_NPAGEMIN );
                     }
                 }
             }
@@ -219,7 +242,7 @@ e_eFSS_DBC_RES eFSS_DBC_LoadPageInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint
 
                     if( e_eFSS_DBC_RES_OK == l_eRes )
                     {
-                        l_uTotPages = l_tStorSet.uTotPages;
+                        l_uTotPages = l_tStorSet.uTotPages - p_ptCtx->uJournalPages;
                         if( p_uPageIndx >= ( l_uTotPages / EFSS_DBC_NPAGEMIN ) )
                         {
                             l_eRes = e_eFSS_DBC_RES_BADPARAM;
@@ -241,6 +264,77 @@ e_eFSS_DBC_RES eFSS_DBC_LoadPageInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint
 	return l_eRes;
 }
 
+e_eFSS_DBC_RES eFSS_DBC_LoadPageInBuffTrustOri(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx)
+{
+	/* Return local var */
+	e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    /* Local var used for calculation */
+    uint32_t l_uTotPages;
+    uint32_t l_uBkpIdx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Need to check page index validity, get the HL stor settings and verify */
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                    if( e_eFSS_DBC_RES_OK == l_eRes )
+                    {
+                        l_uTotPages = l_tStorSet.uTotPages - p_ptCtx->uJournalPages;
+                        if( p_uPageIndx >= ( l_uTotPages / EFSS_DBC_NPAGEMIN ) )
+                        {
+                            l_eRes = e_eFSS_DBC_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            l_uBkpIdx = p_uPageIndx + ( l_uTotPages / EFSS_DBC_NPAGEMIN );
+                            l_eResHL = eFSS_COREHL_LoadPageInBuffTrustOri(&p_ptCtx->tCOREHLCtx, p_uPageIndx, l_uBkpIdx,
+                                                                          EFSS_PAGESUBTYPE_DBORI,
+                                                                          EFSS_PAGESUBTYPE_DBBKP);
+                            l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
 e_eFSS_DBC_RES eFSS_DBC_FlushBuffInPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx)
 {
 	/* Return local var */
@@ -290,7 +384,7 @@ e_eFSS_DBC_RES eFSS_DBC_FlushBuffInPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uin
 
                     if( e_eFSS_DBC_RES_OK == l_eRes )
                     {
-                        l_uTotPages = l_tStorSet.uTotPages;
+                        l_uTotPages = l_tStorSet.uTotPages - p_ptCtx->uJournalPages;
                         if( p_uPageIndx >= ( l_uTotPages / EFSS_DBC_NPAGEMIN ) )
                         {
                             l_eRes = e_eFSS_DBC_RES_BADPARAM;
@@ -314,104 +408,770 @@ e_eFSS_DBC_RES eFSS_DBC_FlushBuffInPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uin
 
 
 
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eFSS_DBC_IsStatusStillCoherent(t_eFSS_DBC_Ctx* const p_ptCtx)
+e_eFSS_DBC_RES eFSS_DBC_EraseBlkIfFirst(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx)
 {
-    /* Return local var */
-    bool_t l_bRes;
+	/* Return local var */
+	e_eFSS_DBC_RES l_eRes;
     e_eFSS_COREHL_RES l_eResHL;
 
+    /* Local var for init */
+    bool_t l_bIsInit;
+
     /* Local var used for storage */
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint32_t l_uNPage;
 
-    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
-    if( e_eFSS_COREHL_RES_OK != l_eResHL )
-    {
-        l_bRes = false;
-    }
-    else
-    {
-        l_uNPage = l_tStorSet.uTotPages;
+    /* Local var used for calculation */
+    uint32_t l_uTotPages;
 
-        /* Check numbers of page validity */
-        if( ( l_uNPage < EFSS_DBC_NPAGEMIN ) || ( 0u != ( l_uNPage % EFSS_DBC_NPAGEMIN ) ) )
-        {
-            l_bRes = false;
-        }
-        else
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
         {
-            l_bRes = true;
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Need to check page index validity, get the HL stor settings and verify */
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                    if( e_eFSS_DBC_RES_OK == l_eRes )
+                    {
+                        l_uTotPages = ( l_tStorSet.uTotPages - p_ptCtx->uJournalPages ) / EFSS_DBC_NPAGEMIN;
+                        if( p_uPageIndx >= l_uTotPages )
+                        {
+                            l_eRes = e_eFSS_DBC_RES_BADPARAM;
+                        }
+                        else if( ( l_tStorSet.uPagesPerBlk > 1u ) &&
+                                 ( 0u == ( p_uPageIndx % l_tStorSet.uPagesPerBlk ) ) &&
+                                 ( 0u == ( l_uTotPages % l_tStorSet.uPagesPerBlk ) ) )
+                        {
+                            /* Both the origin and the backup block contain only pages of this area */
+                            l_eResHL = eFSS_COREHL_EraseBlk(&p_ptCtx->tCOREHLCtx, p_uPageIndx);
+                            l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                            if( e_eFSS_DBC_RES_OK == l_eRes )
+                            {
+                                l_eResHL = eFSS_COREHL_EraseBlk(&p_ptCtx->tCOREHLCtx, p_uPageIndx + l_uTotPages);
+                                l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+                            }
+                        }
+                        else
+                        {
+                            /* Block not aligned or page erase, every flush will erase what it needs */
+                        }
+                    }
+                }
+            }
         }
-    }
+	}
 
-    return l_bRes;
+	return l_eRes;
 }
 
-static e_eFSS_DBC_RES eFSS_DBC_HLtoDBCRes(const e_eFSS_COREHL_RES p_eHLRes)
+e_eFSS_DBC_RES eFSS_DBC_FlushBuffInTxPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                          const bool_t p_bIsCommit)
 {
-    /* Return local var */
-    e_eFSS_DBC_RES l_eRes;
-
-    switch(p_eHLRes)
-    {
-        case e_eFSS_COREHL_RES_OK:
-        {
-            l_eRes = e_eFSS_DBC_RES_OK;
-            break;
-        }
+	/* Return local var */
+	e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
 
-        case e_eFSS_COREHL_RES_NOINITLIB:
-        {
-            l_eRes = e_eFSS_DBC_RES_NOINITLIB;
-            break;
-        }
+    /* Local var for init */
+    bool_t l_bIsInit;
 
-        case e_eFSS_COREHL_RES_BADPARAM:
-        {
-            l_eRes = e_eFSS_DBC_RES_BADPARAM;
-            break;
-        }
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
 
-        case e_eFSS_COREHL_RES_BADPOINTER:
-        {
-            l_eRes = e_eFSS_DBC_RES_BADPOINTER;
-            break;
-        }
+    /* Local var used for calculation */
+    uint32_t l_uTotPages;
+    uint32_t l_uBkpIndex;
+    uint8_t l_uSubType;
 
-        case e_eFSS_COREHL_RES_CORRUPTCTX:
-        {
-            l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
-            break;
-        }
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
 
-        case e_eFSS_COREHL_RES_CLBCKERASEERR:
+        if( e_eFSS_DBC_RES_OK == l_eRes )
         {
-            l_eRes = e_eFSS_DBC_RES_CLBCKERASEERR;
-            break;
-        }
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Need to check page index validity, get the HL stor settings and verify */
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
 
-        case e_eFSS_COREHL_RES_CLBCKWRITEERR:
-        {
-            l_eRes = e_eFSS_DBC_RES_CLBCKWRITEERR;
-            break;
-        }
+                    if( e_eFSS_DBC_RES_OK == l_eRes )
+                    {
+                        l_uTotPages = l_tStorSet.uTotPages - p_ptCtx->uJournalPages;
+                        if( p_uPageIndx >= ( l_uTotPages / EFSS_DBC_NPAGEMIN ) )
+                        {
+                            l_eRes = e_eFSS_DBC_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            l_uBkpIndex = p_uPageIndx + ( l_uTotPages / EFSS_DBC_NPAGEMIN );
 
-        case e_eFSS_COREHL_RES_CLBCKREADERR:
-        {
-            l_eRes = e_eFSS_DBC_RES_CLBCKREADERR;
-            break;
+                            if( true == p_bIsCommit )
+                            {
+                                l_uSubType = EFSS_PAGESUBTYPE_DBTXCMT;
+                            }
+                            else
+                            {
+                                l_uSubType = EFSS_PAGESUBTYPE_DBTXBKP;
+                            }
+
+                            /* Only the backup page is written, the origin page still contains the old value */
+                            l_eResHL = eFSS_COREHL_FlushBuffInPage(&p_ptCtx->tCOREHLCtx, l_uBkpIndex, l_uSubType);
+                            l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+                        }
+                    }
+                }
+            }
         }
+	}
 
-        case e_eFSS_COREHL_RES_CLBCKCRCERR:
-        {
-            l_eRes = e_eFSS_DBC_RES_CLBCKCRCERR;
-            break;
-        }
+	return l_eRes;
+}
 
-        case e_eFSS_COREHL_RES_NOTVALIDPAGE:
+e_eFSS_DBC_RES eFSS_DBC_LoadTxPageInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx)
+{
+	/* Return local var */
+	e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    /* Local var used for calculation */
+    uint32_t l_uTotPages;
+    uint32_t l_uBkpIndex;
+    uint8_t l_uSubType;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Need to check page index validity, get the HL stor settings and verify */
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                    if( e_eFSS_DBC_RES_OK == l_eRes )
+                    {
+                        l_uTotPages = l_tStorSet.uTotPages - p_ptCtx->uJournalPages;
+                        if( p_uPageIndx >= ( l_uTotPages / EFSS_DBC_NPAGEMIN ) )
+                        {
+                            l_eRes = e_eFSS_DBC_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            l_uBkpIndex = p_uPageIndx + ( l_uTotPages / EFSS_DBC_NPAGEMIN );
+
+                            l_uSubType = 0u;
+                            l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, l_uBkpIndex, &l_uSubType);
+                            l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                            if( e_eFSS_DBC_RES_OK == l_eRes )
+                            {
+                                if( ( EFSS_PAGESUBTYPE_DBTXBKP != l_uSubType ) &&
+                                    ( EFSS_PAGESUBTYPE_DBTXCMT != l_uSubType ) )
+                                {
+                                    /* Not a staged page */
+                                    l_eRes = e_eFSS_DBC_RES_NOTVALIDDB;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DBC_RES eFSS_DBC_RecoverTx(t_eFSS_DBC_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+	e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    /* Local var used for calculation */
+    uint32_t l_uUsePages;
+    uint32_t l_uPageIndx;
+    uint32_t l_uCmtIndx;
+    uint8_t l_uSubType;
+    bool_t l_bIsCommitted;
+    bool_t l_bIsRecovered;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                    if( e_eFSS_DBC_RES_OK == l_eRes )
+                    {
+                        l_uUsePages = ( l_tStorSet.uTotPages - p_ptCtx->uJournalPages ) / EFSS_DBC_NPAGEMIN;
+
+                        /* Search the commit marker in the backup area */
+                        l_bIsCommitted = false;
+                        l_uCmtIndx = 0u;
+                        l_uPageIndx = 0u;
+
+                        while( ( l_uPageIndx < l_uUsePages ) && ( false == l_bIsCommitted ) &&
+                               ( e_eFSS_DBC_RES_OK == l_eRes ) )
+                        {
+                            l_uSubType = 0u;
+                            l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, l_uPageIndx + l_uUsePages,
+                                                                  &l_uSubType);
+                            l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                            if( e_eFSS_DBC_RES_OK == l_eRes )
+                            {
+                                if( EFSS_PAGESUBTYPE_DBTXCMT == l_uSubType )
+                                {
+                                    l_bIsCommitted = true;
+                                    l_uCmtIndx = l_uPageIndx;
+                                }
+                            }
+                            else if( ( e_eFSS_DBC_RES_NOTVALIDDB == l_eRes ) ||
+                                     ( e_eFSS_DBC_RES_NEWVERSIONFOUND == l_eRes ) )
+                            {
+                                /* Not a staged page, it will be managed when loaded */
+                                l_eRes = e_eFSS_DBC_RES_OK;
+                            }
+                            else
+                            {
+                                /* Error, the loop will exit */
+                            }
+
+                            l_uPageIndx++;
+                        }
+
+                        /* Complete or discard every staged page, the commit marker must be the last one */
+                        l_bIsRecovered = false;
+                        l_uPageIndx = 0u;
+
+                        while( ( l_uPageIndx < l_uUsePages ) && ( e_eFSS_DBC_RES_OK == l_eRes ) )
+                        {
+                            if( ( false == l_bIsCommitted ) || ( l_uCmtIndx != l_uPageIndx ) )
+                            {
+                                l_eRes = eFSS_DBC_RecoverTxPage(p_ptCtx, l_uPageIndx, l_uUsePages, l_bIsCommitted,
+                                                                &l_bIsRecovered);
+                            }
+
+                            l_uPageIndx++;
+                        }
+
+                        if( ( e_eFSS_DBC_RES_OK == l_eRes ) && ( true == l_bIsCommitted ) )
+                        {
+                            l_eRes = eFSS_DBC_RecoverTxPage(p_ptCtx, l_uCmtIndx, l_uUsePages, l_bIsCommitted,
+                                                            &l_bIsRecovered);
+                        }
+
+                        if( ( e_eFSS_DBC_RES_OK == l_eRes ) && ( true == l_bIsRecovered ) )
+                        {
+                            l_eRes = e_eFSS_DBC_RES_OK_BKP_RCVRD;
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DBC_RES eFSS_DBC_LoadJournalPageInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uJournalIndx)
+{
+	/* Return local var */
+	e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    /* Local var used for calculation */
+    uint32_t l_uPageIndx;
+    uint8_t l_uSubType;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Check journal index validity */
+                    if( p_uJournalIndx >= p_ptCtx->uJournalPages )
+                    {
+                        l_eRes = e_eFSS_DBC_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                        if( e_eFSS_DBC_RES_OK == l_eRes )
+                        {
+                            /* Journal pages are placed after the origin and backup pages */
+                            l_uPageIndx = ( l_tStorSet.uTotPages - p_ptCtx->uJournalPages ) + p_uJournalIndx;
+
+                            l_uSubType = 0u;
+                            l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, l_uPageIndx, &l_uSubType);
+                            l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                            if( e_eFSS_DBC_RES_OK == l_eRes )
+                            {
+                                if( EFSS_PAGESUBTYPE_DBJRN != l_uSubType )
+                                {
+                                    /* Not a journal page */
+                                    l_eRes = e_eFSS_DBC_RES_NOTVALIDDB;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DBC_RES eFSS_DBC_FlushBuffInJournalPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uJournalIndx)
+{
+	/* Return local var */
+	e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+
+    /* Local var used for calculation */
+    uint32_t l_uPageIndx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Check journal index validity */
+                    if( p_uJournalIndx >= p_ptCtx->uJournalPages )
+                    {
+                        l_eRes = e_eFSS_DBC_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                        if( e_eFSS_DBC_RES_OK == l_eRes )
+                        {
+                            /* Journal pages are placed after the origin and backup pages */
+                            l_uPageIndx = ( l_tStorSet.uTotPages - p_ptCtx->uJournalPages ) + p_uJournalIndx;
+
+                            l_eResHL = eFSS_COREHL_FlushBuffInPage(&p_ptCtx->tCOREHLCtx, l_uPageIndx,
+                                                                   EFSS_PAGESUBTYPE_DBJRN);
+                            l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DBC_RES eFSS_DBC_UpdCrcInBuff(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uOffset, const uint32_t p_uLen,
+                                     const bool_t p_bArm)
+{
+	/* Return local var */
+	e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The buffer is the same of the high level core, the range is checked there */
+                    l_eResHL = eFSS_COREHL_UpdCrcInBuff(&p_ptCtx->tCOREHLCtx, p_uOffset, p_uLen, p_bArm);
+                    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DBC_RES eFSS_DBC_GetStats(t_eFSS_DBC_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats)
+{
+	/* Return local var */
+    e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The counters are kept by the low level core */
+                    l_eResHL = eFSS_COREHL_GetStats(&p_ptCtx->tCOREHLCtx, p_ptStats);
+                    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DBC_RES eFSS_DBC_ResetStats(t_eFSS_DBC_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+        if( e_eFSS_DBC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DBC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Reset the counters of the low level core */
+                    l_eResHL = eFSS_COREHL_ResetStats(&p_ptCtx->tCOREHLCtx);
+                    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSS_DBC_IsStatusStillCoherent(t_eFSS_DBC_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_bRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var used for storage */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint32_t l_uNPage;
+
+    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+    if( e_eFSS_COREHL_RES_OK != l_eResHL )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( p_ptCtx->uJournalPages >= l_tStorSet.uTotPages )
+        {
+            l_uNPage = 0u;
+        }
+        else
+        {
+            l_uNPage = l_tStorSet.uTotPages - p_ptCtx->uJournalPages;
+        }
+
+        /* Check numbers of page validity */
+        if( ( l_uNPage < EFSS_DBC_NPAGEMIN ) || ( 0u != ( l_uNPage % EFSS_DBC_NPAGEMIN ) ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            l_bRes = true;
+        }
+    }
+
+    return l_bRes;
+}
+
+static e_eFSS_DBC_RES eFSS_DBC_HLtoDBCRes(const e_eFSS_COREHL_RES p_eHLRes)
+{
+    /* Return local var */
+    e_eFSS_DBC_RES l_eRes;
+
+    switch(p_eHLRes)
+    {
+        case e_eFSS_COREHL_RES_OK:
+        {
+            l_eRes = e_eFSS_DBC_RES_OK;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_NOINITLIB:
+        {
+            l_eRes = e_eFSS_DBC_RES_NOINITLIB;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_BADPARAM:
+        {
+            l_eRes = e_eFSS_DBC_RES_BADPARAM;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_BADPOINTER:
+        {
+            l_eRes = e_eFSS_DBC_RES_BADPOINTER;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_CORRUPTCTX:
+        {
+            l_eRes = e_eFSS_DBC_RES_CORRUPTCTX;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_CLBCKERASEERR:
+        {
+            l_eRes = e_eFSS_DBC_RES_CLBCKERASEERR;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_CLBCKWRITEERR:
+        {
+            l_eRes = e_eFSS_DBC_RES_CLBCKWRITEERR;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_CLBCKREADERR:
+        {
+            l_eRes = e_eFSS_DBC_RES_CLBCKREADERR;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_CLBCKCRCERR:
+        {
+            l_eRes = e_eFSS_DBC_RES_CLBCKCRCERR;
+            break;
+        }
+
+        case e_eFSS_COREHL_RES_NOTVALIDPAGE:
         {
             l_eRes = e_eFSS_DBC_RES_NOTVALIDDB;
             break;
@@ -442,5 +1202,82 @@ static e_eFSS_DBC_RES eFSS_DBC_HLtoDBCRes(const e_eFSS_COREHL_RES p_eHLRes)
         }
     }
 
+    return l_eRes;
+}
+
+static e_eFSS_DBC_RES eFSS_DBC_RecoverTxPage(t_eFSS_DBC_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                             const uint32_t p_uUsePages, const bool_t p_bIsCommitted,
+                                             bool_t* const p_pbIsRecovered)
+{
+    /* Return local var */
+    e_eFSS_DBC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var used for calculation */
+    uint32_t l_uBkpIndex;
+    uint8_t l_uSubType;
+
+    l_uBkpIndex = p_uPageIndx + p_uUsePages;
+
+    /* Load the backup page and check if it was staged by a transaction */
+    l_uSubType = 0u;
+    l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, l_uBkpIndex, &l_uSubType);
+    l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+    if( e_eFSS_DBC_RES_OK == l_eRes )
+    {
+        if( ( EFSS_PAGESUBTYPE_DBTXBKP == l_uSubType ) || ( EFSS_PAGESUBTYPE_DBTXCMT == l_uSubType ) )
+        {
+            if( true == p_bIsCommitted )
+            {
+                /* Transaction committed, the staged page is the new value of the origin and of the backup */
+                l_eResHL = eFSS_COREHL_FlushBuffInPageNBkp(&p_ptCtx->tCOREHLCtx, p_uPageIndx, l_uBkpIndex,
+                                                           EFSS_PAGESUBTYPE_DBORI, EFSS_PAGESUBTYPE_DBBKP);
+                l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+            }
+            else
+            {
+                /* Transaction not committed, the origin page still has the old value, copy it in the backup */
+                l_eResHL = eFSS_COREHL_LoadPageInBuff(&p_ptCtx->tCOREHLCtx, p_uPageIndx, &l_uSubType);
+                l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+
+                if( e_eFSS_DBC_RES_OK == l_eRes )
+                {
+                    if( EFSS_PAGESUBTYPE_DBORI == l_uSubType )
+                    {
+                        l_eResHL = eFSS_COREHL_FlushBuffInPage(&p_ptCtx->tCOREHLCtx, l_uBkpIndex,
+                                                               EFSS_PAGESUBTYPE_DBBKP);
+                        l_eRes = eFSS_DBC_HLtoDBCRes(l_eResHL);
+                    }
+                    else
+                    {
+                        /* The origin page is not a valid origin page */
+                        l_eRes = e_eFSS_DBC_RES_NOTVALIDDB;
+                    }
+                }
+
+                if( ( e_eFSS_DBC_RES_NOTVALIDDB == l_eRes ) || ( e_eFSS_DBC_RES_NEWVERSIONFOUND == l_eRes ) )
+                {
+                    /* Nothing to restore, the page will be reported invalid when loaded */
+                    l_eRes = e_eFSS_DBC_RES_OK;
+                }
+            }
+
+            if( e_eFSS_DBC_RES_OK == l_eRes )
+            {
+                *p_pbIsRecovered = true;
+            }
+        }
+    }
+    else if( ( e_eFSS_DBC_RES_NOTVALIDDB == l_eRes ) || ( e_eFSS_DBC_RES_NEWVERSIONFOUND == l_eRes ) )
+    {
+        /* Not a staged page, it will be managed when loaded */
+        l_eRes = e_eFSS_DBC_RES_OK;
+    }
+    else
+    {
+        /* Error */
+    }
+
     return l_eRes;
 }
\ No newline at end of file
@@ -11,8 +11,9 @@
 /* In this module the page field has the following meaning:
  * ------------------------------------------------------------------ User data
  * - [uint8_t] -                    -> N byte of user data           |
- * ------------------------------------------------------------------ Metadata  (4 byte)
+ * ------------------------------------------------------------------ Metadata  (8 byte)
  * - uint32_t  - Byte in Page       -> Valorized byte in page        |
+ * - uint32_t  - Sequence number    -> Sequence number of the page   |
  * ------------------------------------------------------------------ Under we have LL/HL metadata (20byte)
  * - LOW LEVEL / HIGH LEVEL METADATA                                 |
  * ------------------------------------------------------------------ End of Page
@@ -25,6 +26,9 @@
  * - [ uTotPages - 1 - 1            -    uTotPages - 1 - 1             ]  -> Cache original
  * - [ uTotPages - 1                -    uTotPages - 1                 ]  -> Cache backup
  *
+ * The sequence number is choosen by the user of this module, and can be used to find the newest page without reading
+ * the whole storage area.
+ *
  */
 
 /***********************************************************************************************************************
@@ -47,8 +51,9 @@
 #define EFSS_PAGESUBTYPE_LOGNEWESTBKPBKP                                                         ( ( uint8_t )   0x06u )
 #define EFSS_PAGESUBTYPE_LOGCACHEORI                                                             ( ( uint8_t )   0x07u )
 #define EFSS_PAGESUBTYPE_LOGCACHEBKP                                                             ( ( uint8_t )   0x08u )
-#define EFSS_LOGC_PAGEMIN_L                                                                      ( ( uint32_t )     4u )
-#define EFSS_LOGC_CACHEMIN_L                                                                     ( ( uint32_t )    12u )
+#define EFSS_LOGC_PAGEMIN_L                                                                      ( ( uint32_t )     8u )
+#define EFSS_LOGC_SEQNOFF                                                                        ( ( uint32_t )     4u )
+#define EFSS_LOGC_CACHEMIN_L                                                                     ( ( uint32_t )    16u )
 
 
 
@@ -66,12 +71,14 @@ static e_eFSS_LOGC_RES eFSS_LOGC_HLtoLOGCRes(const e_eFSS_COREHL_RES p_eHLRes);
 static uint32_t eFSS_LOGC_GetMaxPage(const bool_t p_bIsFullBkup, const bool_t p_bIsFCache, const uint32_t p_uTotPages);
 
 static e_eFSS_LOGC_RES eFSS_LOGC_FlushBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
-                                           const bool_t p_bIsBkpP, const uint32_t p_uByteUse,
+                                           const bool_t p_bIsBkpP, const uint32_t p_uByteUse, const uint32_t p_uSeqN,
 								           const uint32_t p_uOrigIdx, const uint32_t p_uBackupIdx,
                                            const uint8_t p_uOriSubT, const uint8_t p_uBckUpSubT);
 
 static e_eFSS_LOGC_RES eFSS_LOGC_LoadBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
-                                          const bool_t p_bIsBkpP, uint32_t* const p_puByteUse,
+                                          const bool_t p_bIsBkpP, const bool_t p_bTrustOri,
+                                          uint32_t* const p_puByteUse,
+                                          uint32_t* const p_puSeqN,
                                           const uint32_t p_uOrigIdx, const uint32_t p_uBackupIdx,
                                           const uint8_t p_uOriSubT, const uint8_t p_uBckUpSubT);
 
@@ -140,6 +147,7 @@ e_eFSS_LOGC_RES eFSS_LOGC_InitCtx(t_eFSS_LOGC_Ctx* const p_ptCtx, const t_eFSS_T
                         /* Fill context */
                         p_ptCtx->bFlashCache = p_bFlashCache;
                         p_ptCtx->bFullBckup = p_bFullBckup;
+                        p_ptCtx->bTrustOri = false;
                     }
                 }
                 else
@@ -219,6 +227,51 @@ e_eFSS_LOGC_RES eFSS_LOGC_IsFlashCacheUsed(t_eFSS_LOGC_Ctx* const p_ptCtx, bool_
 	return l_eRes;
 }
 
+e_eFSS_LOGC_RES eFSS_LOGC_SetTrustOri(t_eFSS_LOGC_Ctx* const p_ptCtx, const bool_t p_bTrustOri)
+{
+	/* Local return variable */
+	e_eFSS_LOGC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local variable for calculation */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOGC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+        if( e_eFSS_LOGC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOGC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOGC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    p_ptCtx->bTrustOri = p_bTrustOri;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
 e_eFSS_LOGC_RES eFSS_LOGC_GetBuffNUsable(t_eFSS_LOGC_Ctx* const p_ptCtx, t_eFSS_LOGC_StorBuf* const p_ptBuff,
                                          uint32_t* const p_puUsePages)
 {
@@ -369,7 +422,7 @@ e_eFSS_LOGC_RES eFSS_LOGC_WriteCache(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint3
                                         l_uCacheIdxBkp = l_tStorSet.uTotPages - 1u;
 
                                         /* Flush */
-                                        l_eRes = eFSS_LOGC_FlushBuff(p_ptCtx, true, 8u, l_uCacheIdx, l_uCacheIdxBkp,
+                                        l_eRes = eFSS_LOGC_FlushBuff(p_ptCtx, true, 8u, 0u, l_uCacheIdx, l_uCacheIdxBkp,
                                                                      EFSS_PAGESUBTYPE_LOGCACHEORI,
                                                                      EFSS_PAGESUBTYPE_LOGCACHEBKP);
                                     }
@@ -400,6 +453,7 @@ e_eFSS_LOGC_RES eFSS_LOGC_ReadCache(t_eFSS_LOGC_Ctx* const p_ptCtx, uint32_t* co
     uint32_t l_uCacheIdx;
     uint32_t l_uCacheIdxBkp;
     uint32_t l_uByteInP;
+    uint32_t l_uSeqN;
     uint32_t l_uUsableP;
 
 	/* Check pointer validity */
@@ -445,8 +499,9 @@ e_eFSS_LOGC_RES eFSS_LOGC_ReadCache(t_eFSS_LOGC_Ctx* const p_ptCtx, uint32_t* co
                             l_uCacheIdxBkp = l_tStorSet.uTotPages - 1u;
 
                             /* Before reading fix any error in original and backup pages */
-                            l_eRes = eFSS_LOGC_LoadBuff(p_ptCtx, true, &l_uByteInP, l_uCacheIdx, l_uCacheIdxBkp,
-                                                        EFSS_PAGESUBTYPE_LOGCACHEORI, EFSS_PAGESUBTYPE_LOGCACHEBKP);
+                            l_eRes = eFSS_LOGC_LoadBuff(p_ptCtx, true, false, &l_uByteInP, &l_uSeqN, l_uCacheIdx,
+                                                        l_uCacheIdxBkp, EFSS_PAGESUBTYPE_LOGCACHEORI,
+                                                        EFSS_PAGESUBTYPE_LOGCACHEBKP);
 
                             if( ( e_eFSS_LOGC_RES_OK == l_eRes ) || ( e_eFSS_LOGC_RES_OK_BKP_RCVRD == l_eRes ) )
                             {
@@ -495,7 +550,7 @@ e_eFSS_LOGC_RES eFSS_LOGC_ReadCache(t_eFSS_LOGC_Ctx* const p_ptCtx, uint32_t* co
 }
 
 e_eFSS_LOGC_RES eFSS_LOGC_FlushBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_eFSS_LOGC_PAGETYPE p_ePageType,
-                                        const uint32_t p_uIdx, const uint32_t p_uFillInPage)
+                                        const uint32_t p_uIdx, const uint32_t p_uFillInPage, const uint32_t p_uSeqN)
 {
 	/* Local return variable */
 	e_eFSS_LOGC_RES l_eRes;
@@ -588,10 +643,93 @@ e_eFSS_LOGC_RES eFSS_LOGC_FlushBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_
 
                             if( e_eFSS_LOGC_RES_OK == l_eRes )
                             {
-                                l_eRes = eFSS_LOGC_FlushBuff(p_ptCtx, p_ptCtx->bFullBckup, p_uFillInPage, p_uIdx,
-                                                             ( l_uNPageU + p_uIdx ), l_uPagSubTOri, l_uPagSubTBkp);
+                                l_eRes = eFSS_LOGC_FlushBuff(p_ptCtx, p_ptCtx->bFullBckup, p_uFillInPage, p_uSeqN,
+                                                             p_uIdx, ( l_uNPageU + p_uIdx ), l_uPagSubTOri,
+                                                             l_uPagSubTBkp);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOGC_RES eFSS_LOGC_EraseBlkIfFirst(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uIdx)
+{
+	/* Local return variable */
+	e_eFSS_LOGC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local storage variable */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint32_t l_uNPageU;
+
+    /* Local variable for calculation */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOGC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+        if( e_eFSS_LOGC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOGC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOGC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Get the needed data from HL level */
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+                    if( e_eFSS_LOGC_RES_OK == l_eRes )
+                    {
+                        /* Calculate n page */
+                        l_uNPageU = eFSS_LOGC_GetMaxPage(p_ptCtx->bFullBckup, p_ptCtx->bFlashCache,
+                                                         l_tStorSet.uTotPages);
+
+                        /* Verify page coherence */
+                        if( p_uIdx >= l_uNPageU )
+                        {
+                            l_eRes = e_eFSS_LOGC_RES_BADPARAM;
+                        }
+                        else if( ( l_tStorSet.uPagesPerBlk > 1u ) &&
+                                 ( 0u == ( p_uIdx % l_tStorSet.uPagesPerBlk ) ) &&
+                                 ( 0u == ( l_uNPageU % l_tStorSet.uPagesPerBlk ) ) )
+                        {
+                            /* The block contains only log pages, and the one of the backup too */
+                            l_eResHL = eFSS_COREHL_EraseBlk(&p_ptCtx->tCOREHLCtx, p_uIdx);
+                            l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+                            if( ( e_eFSS_LOGC_RES_OK == l_eRes ) && ( true == p_ptCtx->bFullBckup ) )
+                            {
+                                l_eResHL = eFSS_COREHL_EraseBlk(&p_ptCtx->tCOREHLCtx, ( l_uNPageU + p_uIdx ) );
+                                l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
                             }
                         }
+                        else
+                        {
+                            /* Block not aligned or page erase, every flush will erase what it needs */
+                        }
                     }
                 }
             }
@@ -602,7 +740,8 @@ e_eFSS_LOGC_RES eFSS_LOGC_FlushBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_
 }
 
 e_eFSS_LOGC_RES eFSS_LOGC_LoadBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_eFSS_LOGC_PAGETYPE p_ePageType,
-                                       const uint32_t p_uIdx, uint32_t* const p_puFillInPage)
+                                       const uint32_t p_uIdx, uint32_t* const p_puFillInPage,
+                                       uint32_t* const p_puSeqN)
 {
 	/* Local return variable */
 	e_eFSS_LOGC_RES l_eRes;
@@ -694,8 +833,9 @@ e_eFSS_LOGC_RES eFSS_LOGC_LoadBufferAs(t_eFSS_LOGC_Ctx* const p_ptCtx, const e_e
 
                             if( e_eFSS_LOGC_RES_OK == l_eRes )
                             {
-                                l_eRes = eFSS_LOGC_LoadBuff(p_ptCtx, p_ptCtx->bFullBckup, p_puFillInPage, p_uIdx,
-                                                            ( l_uNPageU + p_uIdx ), l_uPagSubTOri, l_uPagSubTBkp);
+                                l_eRes = eFSS_LOGC_LoadBuff(p_ptCtx, p_ptCtx->bFullBckup, p_ptCtx->bTrustOri,
+                                                            p_puFillInPage, p_puSeqN, p_uIdx, ( l_uNPageU + p_uIdx ),
+                                                            l_uPagSubTOri, l_uPagSubTBkp);
                             }
                         }
                     }
@@ -1001,7 +1141,8 @@ e_eFSS_LOGC_RES eFSS_LOGC_IsPageNewOrBkup(t_eFSS_LOGC_Ctx* const p_ptCtx, const
 }
 
 e_eFSS_LOGC_RES eFSS_LOGC_FlushBuffIfNotEquals(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uIdx,
-                                               const uint32_t p_uFillInPage, const e_eFSS_LOGC_PAGETYPE p_eTypeFlush)
+                                               const uint32_t p_uFillInPage, const e_eFSS_LOGC_PAGETYPE p_eTypeFlush,
+                                               const uint32_t p_uSeqN)
 {
 	/* Local return variable */
 	e_eFSS_LOGC_RES l_eRes;
@@ -1104,8 +1245,12 @@ e_eFSS_LOGC_RES eFSS_LOGC_FlushBuffIfNotEquals(t_eFSS_LOGC_Ctx* const p_ptCtx, c
                                 else
                                 {
                                     /* Insert the parameter in to the buffer so we can compare the page */
-                                    if( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L],
-                                                                     p_uFillInPage) )
+                                    if( ( true != eFSS_Utils_InsertU32(
+                                                      &l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L],
+                                                      p_uFillInPage) ) ||
+                                        ( true != eFSS_Utils_InsertU32(
+                                                      &l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_SEQNOFF],
+                                                      p_uSeqN) ) )
                                     {
                                         l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
                                     }
@@ -1124,8 +1269,8 @@ e_eFSS_LOGC_RES eFSS_LOGC_FlushBuffIfNotEquals(t_eFSS_LOGC_Ctx* const p_ptCtx, c
                                         {
                                             /* Not equal! Flush buffer here */
                                             l_eRes = eFSS_LOGC_FlushBuff(p_ptCtx, p_ptCtx->bFullBckup, p_uFillInPage,
-                                                                         p_uIdx, ( l_uNPageU + p_uIdx ), l_uPagSubTOri,
-                                                                         l_uPagSubTBkp);
+                                                                         p_uSeqN, p_uIdx, ( l_uNPageU + p_uIdx ),
+                                                                         l_uPagSubTOri, l_uPagSubTBkp);
 
                                             if( e_eFSS_LOGC_RES_OK == l_eRes )
                                             {
@@ -1184,6 +1329,421 @@ e_eFSS_LOGC_RES eFSS_LOGC_FlushBuffIfNotEquals(t_eFSS_LOGC_Ctx* const p_ptCtx, c
 }
 
 
+e_eFSS_LOGC_RES eFSS_LOGC_GetPageSeqN(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uIdx,
+                                      uint32_t* const p_puSeqN)
+{
+	/* Local return variable */
+	e_eFSS_LOGC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local storage variable */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_COREHL_StorBuf l_tBuff;
+    uint32_t l_uNPageU;
+
+    /* Local variable for calculation */
+    bool_t l_bIsInit;
+    uint8_t l_uPageSubTypeRed;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puSeqN ) )
+	{
+		l_eRes = e_eFSS_LOGC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+        if( e_eFSS_LOGC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOGC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOGC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eResHL = eFSS_COREHL_GetBuffNStor(&p_ptCtx->tCOREHLCtx, &l_tBuff, &l_tStorSet);
+                    l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+                    if( e_eFSS_LOGC_RES_OK == l_eRes )
+                    {
+                        /* Calculate n page */
+                        l_uNPageU = eFSS_LOGC_GetMaxPage(p_ptCtx->bFullBckup, p_ptCtx->bFlashCache,
+                                                         l_tStorSet.uTotPages);
+
+                        if( p_uIdx >= l_uNPageU )
+                        {
+                            l_eRes = e_eFSS_LOGC_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            /* Only probe the trailer of the original page, nothing is repaired here */
+                            l_uPageSubTypeRed = 0x00u;
+                            l_eResHL = eFSS_COREHL_ProbePageInBuff(&p_ptCtx->tCOREHLCtx, p_uIdx, EFSS_LOGC_PAGEMIN_L,
+                                                                   &l_uPageSubTypeRed);
+                            l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+                            if( ( e_eFSS_LOGC_RES_OK == l_eRes ) &&
+                                ( EFSS_PAGESUBTYPE_LOGORI           != l_uPageSubTypeRed ) &&
+                                ( EFSS_PAGESUBTYPE_LOGNEWESTORI     != l_uPageSubTypeRed ) &&
+                                ( EFSS_PAGESUBTYPE_LOGNEWESTBKPORI  != l_uPageSubTypeRed ) )
+                            {
+                                l_eRes = e_eFSS_LOGC_RES_NOTVALIDLOG;
+                            }
+
+                            if( ( true == p_ptCtx->bFullBckup ) &&
+                                ( ( e_eFSS_LOGC_RES_NOTVALIDLOG == l_eRes ) ||
+                                  ( e_eFSS_LOGC_RES_NEWVERSIONFOUND == l_eRes ) ) )
+                            {
+                                /* Original page not usable, try the backup one */
+                                l_uPageSubTypeRed = 0x00u;
+                                l_eResHL = eFSS_COREHL_ProbePageInBuff(&p_ptCtx->tCOREHLCtx, ( l_uNPageU + p_uIdx ),
+                                                                       EFSS_LOGC_PAGEMIN_L, &l_uPageSubTypeRed);
+                                l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+                                if( ( e_eFSS_LOGC_RES_OK == l_eRes ) &&
+                                    ( EFSS_PAGESUBTYPE_LOGBKP           != l_uPageSubTypeRed ) &&
+                                    ( EFSS_PAGESUBTYPE_LOGNEWESTBKP     != l_uPageSubTypeRed ) &&
+                                    ( EFSS_PAGESUBTYPE_LOGNEWESTBKPBKP  != l_uPageSubTypeRed ) )
+                                {
+                                    l_eRes = e_eFSS_LOGC_RES_NOTVALIDLOG;
+                                }
+                            }
+
+                            if( e_eFSS_LOGC_RES_OK == l_eRes )
+                            {
+                                /* Retrive parameter */
+                                if( true != eFSS_Utils_RetriveU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_SEQNOFF],
+                                                                  p_puSeqN) )
+                                {
+                                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOGC_RES eFSS_LOGC_ScrubPair(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uIdx,
+                                    uint32_t* const p_puNPair)
+{
+	/* Local return variable */
+	e_eFSS_LOGC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local storage variable */
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint32_t l_uNPageU;
+    uint32_t l_uNPair;
+
+    /* Local variable for calculation */
+    bool_t l_bIsInit;
+    uint8_t l_uPageSubTypeRed;
+    uint8_t l_uPagSubTOri;
+    uint32_t l_uByteInP;
+    uint32_t l_uSeqN;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puNPair ) )
+	{
+		l_eRes = e_eFSS_LOGC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+        if( e_eFSS_LOGC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOGC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOGC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eResHL = eFSS_COREHL_GetStorSett(&p_ptCtx->tCOREHLCtx, &l_tStorSet);
+                    l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+                    if( e_eFSS_LOGC_RES_OK == l_eRes )
+                    {
+                        /* Calculate n page and n pair */
+                        l_uNPageU = eFSS_LOGC_GetMaxPage(p_ptCtx->bFullBckup, p_ptCtx->bFlashCache,
+                                                         l_tStorSet.uTotPages);
+                        l_uNPair = 0u;
+
+                        if( true == p_ptCtx->bFullBckup )
+                        {
+                            l_uNPair = l_uNPageU;
+                        }
+
+                        if( true == p_ptCtx->bFlashCache )
+                        {
+                            l_uNPair++;
+                        }
+
+                        *p_puNPair = l_uNPair;
+
+                        if( 0u == l_uNPair )
+                        {
+                            /* No page has a backup, nothing to verify */
+                        }
+                        else if( p_uIdx >= l_uNPair )
+                        {
+                            l_eRes = e_eFSS_LOGC_RES_BADPARAM;
+                        }
+                        else if( ( true == p_ptCtx->bFlashCache ) && ( ( l_uNPair - 1u ) == p_uIdx ) )
+                        {
+                            /* Flash cache pair */
+                            l_eRes = eFSS_LOGC_LoadBuff(p_ptCtx, true, false, &l_uByteInP, &l_uSeqN,
+                                                        ( l_tStorSet.uTotPages - 2u ), ( l_tStorSet.uTotPages - 1u ),
+                                                        EFSS_PAGESUBTYPE_LOGCACHEORI, EFSS_PAGESUBTYPE_LOGCACHEBKP);
+                        }
+                        else
+                        {
+                            /* Log pair, the origin is written first so his role is the one to keep. Origin and
+                             * backup subtype of every role are consecutive */
+                            l_uPageSubTypeRed = 0x00u;
+                            l_eResHL = eFSS_COREHL_ProbePageInBuff(&p_ptCtx->tCOREHLCtx, p_uIdx, EFSS_LOGC_PAGEMIN_L,
+                                                                   &l_uPageSubTypeRed);
+                            l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+                            l_uPagSubTOri = l_uPageSubTypeRed;
+
+                            if( ( e_eFSS_LOGC_RES_OK == l_eRes ) &&
+                                ( EFSS_PAGESUBTYPE_LOGORI           != l_uPageSubTypeRed ) &&
+                                ( EFSS_PAGESUBTYPE_LOGNEWESTORI     != l_uPageSubTypeRed ) &&
+                                ( EFSS_PAGESUBTYPE_LOGNEWESTBKPORI  != l_uPageSubTypeRed ) )
+                            {
+                                l_eRes = e_eFSS_LOGC_RES_NOTVALIDLOG;
+                            }
+
+                            if( ( e_eFSS_LOGC_RES_NOTVALIDLOG == l_eRes ) ||
+                                ( e_eFSS_LOGC_RES_NEWVERSIONFOUND == l_eRes ) )
+                            {
+                                /* Original page not usable, take the role from the backup one */
+                                l_uPageSubTypeRed = 0x00u;
+                                l_eResHL = eFSS_COREHL_ProbePageInBuff(&p_ptCtx->tCOREHLCtx, ( l_uNPageU + p_uIdx ),
+                                                                       EFSS_LOGC_PAGEMIN_L, &l_uPageSubTypeRed);
+                                l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+                                l_uPagSubTOri = (uint8_t)( l_uPageSubTypeRed - 1u );
+
+                                if( ( e_eFSS_LOGC_RES_OK == l_eRes ) &&
+                                    ( EFSS_PAGESUBTYPE_LOGBKP           != l_uPageSubTypeRed ) &&
+                                    ( EFSS_PAGESUBTYPE_LOGNEWESTBKP     != l_uPageSubTypeRed ) &&
+                                    ( EFSS_PAGESUBTYPE_LOGNEWESTBKPBKP  != l_uPageSubTypeRed ) )
+                                {
+                                    l_eRes = e_eFSS_LOGC_RES_NOTVALIDLOG;
+                                }
+                            }
+
+                            if( e_eFSS_LOGC_RES_OK == l_eRes )
+                            {
+                                /* Load the pair, the page not valid or not equal is repaired */
+                                l_eRes = eFSS_LOGC_LoadBuff(p_ptCtx, true, false, &l_uByteInP, &l_uSeqN, p_uIdx,
+                                                            ( l_uNPageU + p_uIdx ), l_uPagSubTOri,
+                                                            (uint8_t)( l_uPagSubTOri + 1u ) );
+                            }
+                            else if( e_eFSS_LOGC_RES_NOTVALIDLOG == l_eRes )
+                            {
+                                /* Neither page is valid, the pair was never written after the format */
+                                l_eRes = e_eFSS_LOGC_RES_OK;
+                            }
+                            else
+                            {
+                                /* Error */
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOGC_RES eFSS_LOGC_UpdCrcInBuff(t_eFSS_LOGC_Ctx* const p_ptCtx, const uint32_t p_uOffset,
+                                       const uint32_t p_uLen, const bool_t p_bArm)
+{
+	/* Local return variable */
+	e_eFSS_LOGC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local storage variable */
+    t_eFSS_COREHL_StorBuf l_tBuff;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOGC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+        if( e_eFSS_LOGC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOGC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOGC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eResHL = eFSS_COREHL_GetBuff(&p_ptCtx->tCOREHLCtx, &l_tBuff);
+                    l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+                    if( e_eFSS_LOGC_RES_OK == l_eRes )
+                    {
+                        /* The range cannot include the metadata of this module */
+                        if( ( p_uOffset >= ( l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L ) ) ||
+                            ( p_uLen > ( l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L - p_uOffset ) ) )
+                        {
+                            l_eRes = e_eFSS_LOGC_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            l_eResHL = eFSS_COREHL_UpdCrcInBuff(&p_ptCtx->tCOREHLCtx, p_uOffset, p_uLen, p_bArm);
+                            l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOGC_RES eFSS_LOGC_GetStats(t_eFSS_LOGC_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats)
+{
+	/* Return local var */
+    e_eFSS_LOGC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOGC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+        if( e_eFSS_LOGC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOGC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOGC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The counters are kept by the low level core */
+                    l_eResHL = eFSS_COREHL_GetStats(&p_ptCtx->tCOREHLCtx, p_ptStats);
+                    l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOGC_RES eFSS_LOGC_ResetStats(t_eFSS_LOGC_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_LOGC_RES l_eRes;
+    e_eFSS_COREHL_RES l_eResHL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOGC_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResHL = eFSS_COREHL_IsInit(&p_ptCtx->tCOREHLCtx, &l_bIsInit);
+        l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+        if( e_eFSS_LOGC_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOGC_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOGC_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Reset the counters of the low level core */
+                    l_eResHL = eFSS_COREHL_ResetStats(&p_ptCtx->tCOREHLCtx);
+                    l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
 
 
 /***********************************************************************************************************************
@@ -1370,7 +1930,7 @@ static uint32_t eFSS_LOGC_GetMaxPage(const bool_t p_bIsFullBkup, const bool_t p_
 }
 
 static e_eFSS_LOGC_RES eFSS_LOGC_FlushBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
-                                           const bool_t p_bIsBkpP, const uint32_t p_uByteUse,
+                                           const bool_t p_bIsBkpP, const uint32_t p_uByteUse, const uint32_t p_uSeqN,
 								           const uint32_t p_uOrigIdx, const uint32_t p_uBackupIdx,
                                            const uint8_t p_uOriSubT, const uint8_t p_uBckUpSubT)
 {
@@ -1396,12 +1956,28 @@ static e_eFSS_LOGC_RES eFSS_LOGC_FlushBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
         }
         else
         {
-            /* Insert Meta */
-            if( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L], p_uByteUse) )
+            /* Insert Meta, keeping the CRC of the page updated if it was */
+            l_eResHL = eFSS_COREHL_UpdCrcInBuff(&p_ptCtx->tCOREHLCtx, ( l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L ),
+                                                EFSS_LOGC_PAGEMIN_L, false);
+            l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+
+            if( e_eFSS_LOGC_RES_OK == l_eRes )
             {
-                l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                if( ( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L],
+                                                   p_uByteUse) ) ||
+                    ( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_SEQNOFF], p_uSeqN) ) )
+                {
+                    l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eResHL = eFSS_COREHL_UpdCrcInBuff(&p_ptCtx->tCOREHLCtx, ( l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L ),
+                                                        EFSS_LOGC_PAGEMIN_L, false);
+                    l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+                }
             }
-            else
+
+            if( e_eFSS_LOGC_RES_OK == l_eRes )
             {
                 if( true == p_bIsBkpP )
                 {
@@ -1425,7 +2001,9 @@ static e_eFSS_LOGC_RES eFSS_LOGC_FlushBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
 }
 
 static e_eFSS_LOGC_RES eFSS_LOGC_LoadBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
-                                          const bool_t p_bIsBkpP, uint32_t* const p_puByteUse,
+                                          const bool_t p_bIsBkpP, const bool_t p_bTrustOri,
+                                          uint32_t* const p_puByteUse,
+                                          uint32_t* const p_puSeqN,
                                           const uint32_t p_uOrigIdx, const uint32_t p_uBackupIdx,
                                           const uint8_t p_uOriSubT, const uint8_t p_uBckUpSubT)
 {
@@ -1437,7 +2015,7 @@ static e_eFSS_LOGC_RES eFSS_LOGC_LoadBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
     t_eFSS_COREHL_StorBuf l_tBuff;
     uint8_t l_uPageSubTypeRed;
 
-    if( NULL == p_puByteUse )
+    if( ( NULL == p_puByteUse ) || ( NULL == p_puSeqN ) )
     {
         l_eRes = e_eFSS_LOGC_RES_BADPOINTER;
     }
@@ -1450,7 +2028,13 @@ static e_eFSS_LOGC_RES eFSS_LOGC_LoadBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
 
         if( e_eFSS_LOGC_RES_OK == l_eRes )
         {
-            if( true == p_bIsBkpP )
+            if( ( true == p_bIsBkpP ) && ( true == p_bTrustOri ) )
+            {
+                l_eResHL = eFSS_COREHL_LoadPageInBuffTrustOri(&p_ptCtx->tCOREHLCtx, p_uOrigIdx, p_uBackupIdx,
+                                                              p_uOriSubT, p_uBckUpSubT);
+                l_eRes = eFSS_LOGC_HLtoLOGCRes(l_eResHL);
+            }
+            else if( true == p_bIsBkpP )
             {
                 l_eResHL = eFSS_COREHL_LoadPageInBuffNRipBkp(&p_ptCtx->tCOREHLCtx, p_uOrigIdx, p_uBackupIdx,
                                                              p_uOriSubT, p_uBckUpSubT);
@@ -1475,7 +2059,9 @@ static e_eFSS_LOGC_RES eFSS_LOGC_LoadBuff(t_eFSS_LOGC_Ctx* const p_ptCtx,
             if( ( e_eFSS_LOGC_RES_OK == l_eRes ) || ( e_eFSS_LOGC_RES_OK_BKP_RCVRD == l_eRes ) )
             {
                 /* Retrive parameter */
-                if( true != eFSS_Utils_RetriveU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L], p_puByteUse) )
+                if( ( true != eFSS_Utils_RetriveU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_PAGEMIN_L],
+                                                    p_puByteUse) ) ||
+                    ( true != eFSS_Utils_RetriveU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOGC_SEQNOFF], p_puSeqN) ) )
                 {
                     l_eRes = e_eFSS_LOGC_RES_CORRUPTCTX;
                 }
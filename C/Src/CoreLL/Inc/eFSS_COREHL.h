@@ -152,6 +152,30 @@ e_eFSS_COREHL_RES eFSS_COREHL_GetBuffNStor(t_eFSS_COREHL_Ctx* const p_ptCtx, t_e
 e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuff(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uPIdx,
                                              uint8_t* const p_puSubTypeRead);
 
+/**
+ * @brief       Probe a page of the storage area reading only his trailer, see eFSS_CORELL_ProbePageInBuff. Only the
+ *              last p_uUsrTrailL byte of user data, the subtype and the low level metadata are placed in the internal
+ *              buffer. When the user provide the ranged read callback the CRC is not verified, so use this function
+ *              only to collect hint that will be verified later.
+ *
+ * @param[in]   p_ptCtx         - High Level Core context
+ * @param[in]   p_uPIdx         - uint32_t index rappresenting the page that we want to probe
+ * @param[in]   p_uUsrTrailL    - Number of byte at the end of the user data to read
+ * @param[out]  p_puSubTypeRead - pointer to a uint8_t where we will store the subtype readed from the probed page
+ *
+ * @return      e_eFSS_COREHL_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSS_COREHL_RES_BADPARAM        - In case of an invalid parameter passed to the function
+ *		        e_eFSS_COREHL_RES_CORRUPTCTX      - Context is corrupted
+ *		        e_eFSS_COREHL_RES_NOINITLIB       - Need to init lib before calling function
+ *		        e_eFSS_COREHL_RES_CLBCKREADERR    - The read callback reported an error
+ *              e_eFSS_COREHL_RES_CLBCKCRCERR     - The crc callback reported an error
+ *              e_eFSS_COREHL_RES_NOTVALIDPAGE    - The readed page is invalid
+ *              e_eFSS_COREHL_RES_NEWVERSIONFOUND - The readed page has a new version
+ *              e_eFSS_COREHL_RES_OK              - Operation ended correctly
+ */
+e_eFSS_COREHL_RES eFSS_COREHL_ProbePageInBuff(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uPIdx,
+                                              const uint32_t p_uUsrTrailL, uint8_t* const p_puSubTypeRead);
+
 /**
  * @brief       Flush the internal buffer in to the storage area. After this operation the used buffer will contain
  *              the same values as before, except for the private metadata
@@ -196,6 +220,28 @@ e_eFSS_COREHL_RES eFSS_COREHL_FlushBuffInPage(t_eFSS_COREHL_Ctx* const p_ptCtx,
 e_eFSS_COREHL_RES eFSS_COREHL_CalcCrcInBuff(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uCrcSeed,
                                             const uint32_t p_uLenCalc, uint32_t* const p_puCrc);
 
+/**
+ * @brief       Add the data of a range of the buffer to the CRC of the page stored in the buffer, so the flush does
+ *              not need to calculate the CRC of the whole page. Call it before and after changing the range: the
+ *              first call with p_bArm equals to true lets the next flush use the updated CRC. Every change made to
+ *              the buffer between that call and the flush must be added in the same way. See
+ *              eFSS_CORELL_UpdCrcInBuff for the cases where the CRC cannot be updated and is calculated as usual.
+ *
+ * @param[in]   p_ptCtx       - High Level Core context
+ * @param[in]   p_uOffset     - Offset of the range, cannot exceed the size reported by eFSS_COREHL_GetBuff
+ * @param[in]   p_uLen        - Length of the range, cannot exceed the size reported by eFSS_COREHL_GetBuff
+ * @param[in]   p_bArm        - true if the next flush of the buffer can use the updated CRC
+ *
+ * @return      e_eFSS_COREHL_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_COREHL_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_COREHL_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_COREHL_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_COREHL_RES_CLBCKCRCERR      - The CRC callback reported an error
+ *              e_eFSS_COREHL_RES_OK               - Operation ended correctly
+ */
+e_eFSS_COREHL_RES eFSS_COREHL_UpdCrcInBuff(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uOffset,
+                                           const uint32_t p_uLen, const bool_t p_bArm);
+
 /**
  * @brief       Flush the internal buffer in to the storage area and generate a backup copy in another page.
  *              Flushed original page and flushed backup pages will have different subtype that we can choose.
@@ -260,11 +306,34 @@ e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuffNRipBkp(t_eFSS_COREHL_Ctx* const p_p
                                                     const uint32_t p_uOriIdx, const uint32_t p_uBkpIdx,
                                                     const uint8_t p_uOriSubT, const uint8_t p_uBkpSubT);
 
+/**
+ * @brief       Load the page present in p_uOriIdx in to the internal buffer trusting it without reading the backup
+ *              page in p_uBkpIdx. The original page is always the one kept when the two pages are different, so when
+ *              it is valid the backup is not needed to know the content of the page. Only if the original page is
+ *              not valid the function fall back to eFSS_COREHL_LoadPageInBuffNRipBkp, repairing it.
+ *              A backup page corrupted or different from a valid original one is not detected, so use
+ *              eFSS_COREHL_LoadPageInBuffNRipBkp when the pages must be verified, for example in a scrub.
+ *
+ * @param[in]   p_ptCtx    - Pointer to all callback context
+ * @param[in]   p_uOriIdx  - Page index of the original data
+ * @param[in]   p_uBkpIdx  - Page index of the backup data
+ * @param[in]   p_uOriSubT - Sub type of the original page
+ * @param[in]   p_uBkpSubT - Sub type of the backup pages
+ *
+ * @return      Same value returned by eFSS_COREHL_LoadPageInBuffNRipBkp
+ */
+e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuffTrustOri(t_eFSS_COREHL_Ctx* const p_ptCtx,
+                                                    const uint32_t p_uOriIdx, const uint32_t p_uBkpIdx,
+                                                    const uint8_t p_uOriSubT, const uint8_t p_uBkpSubT);
+
 /**
  * @brief       Check if the data present in to the internal buffer is equals to an another page. Keep in mind that
  *              subtype and others private metadata are not compared, the comparsion is only done using raw data.
  *              Th previusly present data in buffer is not modified after this call.
  *              Keep in mind also that the comparsion works only if the pointed page is a valid page.
+ *              When the ranged read callback is available only the trailer of the page is readed first: if the CRC
+ *              of the buffer data chained with it differs from the stored one the page is reported as not equals,
+ *              even if it is corrupted, and the whole page is compared only when the CRC match.
  *
  * @param[in]   p_ptCtx         - High Level Core context
  * @param[in]   p_uPIdx         - uint32_t index rappresenting the page that we want to compare
@@ -285,6 +354,48 @@ e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuffNRipBkp(t_eFSS_COREHL_Ctx* const p_p
 e_eFSS_COREHL_RES eFSS_COREHL_IsBuffEqualToPage(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uPIdx,
                                                 bool_t* const p_pbIsEquals, uint8_t* const p_puSubTypePage);
 
+/**
+ * @brief       Get the statistics of the operations done on the storage area since the init or the last reset,
+ *              see t_eFSS_TYPE_Stats.
+ *
+ * @param[in]   p_ptCtx       - High Level Core context
+ * @param[out]  p_ptStats     - Pointer to a statistics struct that will be filled with the collected counters
+ *
+ * @return      e_eFSS_COREHL_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_COREHL_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_COREHL_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_COREHL_RES_OK            - Operation ended correctly
+ */
+e_eFSS_COREHL_RES eFSS_COREHL_GetStats(t_eFSS_COREHL_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats);
+
+/**
+ * @brief       Reset to zero every statistics counter
+ *
+ * @param[in]   p_ptCtx       - High Level Core context
+ *
+ * @return      e_eFSS_COREHL_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_COREHL_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_COREHL_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_COREHL_RES_OK            - Operation ended correctly
+ */
+e_eFSS_COREHL_RES eFSS_COREHL_ResetStats(t_eFSS_COREHL_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Erase the erase block containing the passed page, or only the page when every page can be erased
+ *              alone. Used to erase a whole block once before programming its pages one by one
+ *
+ * @param[in]   p_ptCtx       - High Level Core context
+ * @param[in]   p_uPIdx       - uint32_t index rappresenting a page of the block that we want to erase
+ *
+ * @return      e_eFSS_COREHL_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_COREHL_RES_BADPARAM      - In case of an invalid parameter passed to the function
+ *		        e_eFSS_COREHL_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_COREHL_RES_NOINITLIB     - Need to init lib before calling function
+ *		        e_eFSS_COREHL_RES_CLBCKERASEERR - The erase callback reported an error
+ *              e_eFSS_COREHL_RES_OK            - Operation ended correctly
+ */
+e_eFSS_COREHL_RES eFSS_COREHL_EraseBlk(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uPIdx);
+
 
 
 #ifdef __cplusplus
@@ -54,6 +54,8 @@ typedef struct
 {
     uint8_t* puBuf;
     uint32_t uBufL;
+    bool_t   bCrcOk;
+    bool_t   bCrcUpd;
 }t_eFSS_CORELL_StorBufPrv;
 
 typedef struct
@@ -62,14 +64,25 @@ typedef struct
     uint32_t uBufL;
 }t_eFSS_CORELL_StorBuf;
 
+typedef struct
+{
+    uint32_t uBlkIndx;
+    uint32_t uNextPage;
+}t_eFSS_CORELL_ErsBlk;
+
 typedef struct
 {
     bool_t  bIsInit;
     t_eFSS_TYPE_CbStorCtx tCtxCb;
     t_eFSS_TYPE_StorSet tStorSett;
     uint8_t uStorType;
+    bool_t  bSingleBuf;
+    bool_t  bBlkChecked;
+    t_eFSS_CORELL_ErsBlk tErsBlk1;
+    t_eFSS_CORELL_ErsBlk tErsBlk2;
     t_eFSS_CORELL_StorBufPrv tBuff1;
     t_eFSS_CORELL_StorBufPrv tBuff2;
+    t_eFSS_TYPE_Stats tStats;
 }t_eFSS_CORELL_Ctx;
 
 
@@ -82,9 +95,20 @@ typedef struct
  *
  * @param[in]   p_ptCtx          - Low Level Core context
  * @param[in]   p_tCtxCb         - All callback collection context
- * @param[in]   p_tStorSet       - Storage settings
+ * @param[in]   p_tStorSet       - Storage settings. The eTrailer field select the format of the private metadata
+ *                                 stored at the end of every page, and so the size of the buffer returned by
+ *                                 eFSS_CORELL_GetBuff. A compact trailer need a storage type lower than 16.
+ *                                 An erase block bigger than a page (uPagesPerBlk) need the two page buffer and
+ *                                 a page of at least 16 byte. In this case, before the first access to the
+ *                                 storage, a block rewrite interrupted by a power loss is completed, see
+ *                                 eFSS_CORELL_FlushBuffInPage.
  * @param[in]   p_uStorType      - Storage type (Used only to mark pages)
- * @param[in]   p_puBuff         - Pointer to a buffer used by the modules to make calc, must be pageSize * 2
+ * @param[in]   p_puBuff         - Pointer to a buffer used by the modules to make calc, must be pageSize * 2.
+ *                                 When the ranged read callback is present it can also be pageSize plus a scratch
+ *                                 area smaller than a page but bigger than the private metadata (19 byte, 8 or 6
+ *                                 byte with a compact trailer): in this single buffer mode pages are verified
+ *                                 streaming them in the scratch area, and the buffer 2 cannot be used to load or
+ *                                 flush a page.
  * @param[in]   p_uBuffL         - Size of p_puBuff
  *
  * @return      e_eFSS_CORELL_RES_BADPOINTER    - In case of bad pointer passed to the function
@@ -121,7 +145,8 @@ e_eFSS_CORELL_RES eFSS_CORELL_GetStorSett(t_eFSS_CORELL_Ctx* const p_ptCtx, t_eF
 
 /**
  * @brief       Get the reference of the two buffer used to read and write the storage area. Returned buffer lenght
- *              refer only to the user avaiable data, private metadata is removed from the buffer length.
+ *              refer only to the user avaiable data, private metadata is removed from the buffer length. In single
+ *              buffer mode the buffer 2 is the scratch area.
  *
  * @param[in]   p_ptCtx       - Low Level Core context
  * @param[out]  p_ptBuff1     - Pointer to a pointer struct that will be filled with info about buffer 1
@@ -169,15 +194,67 @@ e_eFSS_CORELL_RES eFSS_CORELL_GetBuffNStor(t_eFSS_CORELL_Ctx* const p_ptCtx, t_e
  *              e_eFSS_CORELL_RES_CLBCKCRCERR     - The crc callback reported an error
  *              e_eFSS_CORELL_RES_NOTVALIDPAGE    - The readed page is invalid
  *              e_eFSS_CORELL_RES_NEWVERSIONFOUND - The readed page has a new version
+ *		        e_eFSS_CORELL_RES_CLBCKERASEERR   - The erase callback reported an error, only when completing an
+ *                                                  interrupted block rewrite
+ *		        e_eFSS_CORELL_RES_CLBCKWRITEERR   - The write callback reported an error, only when completing an
+ *                                                  interrupted block rewrite
+ *              e_eFSS_CORELL_RES_WRITENOMATCHREAD - Writen data dosent match what was requested, only when
+ *                                                   completing an interrupted block rewrite
  *              e_eFSS_CORELL_RES_OK              - Operation ended correctly
  */
 e_eFSS_CORELL_RES eFSS_CORELL_LoadPageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, const e_eFSS_CORELL_BUFFTYPE p_eBuffType,
 								             const uint32_t p_uPageIndx);
 
+/**
+ * @brief       Probe a page of the storage area reading only his trailer: the last p_uUsrTrailL byte of user data and
+ *              the private metadata. The readed byte are placed at the same offset of the choosen buffer. If the
+ *              ranged read callback is not present the whole page is loaded and verified like in
+ *              eFSS_CORELL_LoadPageInBuff. Otherwise the CRC cannot be verified, so a probed page can only be
+ *              considered a plausible one, and the readed data must be used as an hint.
+ *
+ * @param[in]   p_ptCtx       - Low Level Core context
+ * @param[in]   p_eBuffType   - Enum used to select wich buffer we want to use for the reading process
+ * @param[in]   p_uPageIndx   - uint32_t index rappresenting the page that we want to probe
+ * @param[in]   p_uUsrTrailL  - Number of byte at the end of the user data to read with the metadata
+ *
+ * @return      e_eFSS_CORELL_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSS_CORELL_RES_BADPARAM        - In case of an invalid parameter passed to the function
+ *		        e_eFSS_CORELL_RES_CORRUPTCTX      - Context is corrupted
+ *		        e_eFSS_CORELL_RES_NOINITLIB       - Need to init lib before calling function
+ *		        e_eFSS_CORELL_RES_CLBCKREADERR    - The read callback reported an error
+ *              e_eFSS_CORELL_RES_CLBCKCRCERR     - The crc callback reported an error
+ *              e_eFSS_CORELL_RES_NOTVALIDPAGE    - The readed page is invalid
+ *              e_eFSS_CORELL_RES_NEWVERSIONFOUND - The readed page has a new version
+ *		        e_eFSS_CORELL_RES_CLBCKERASEERR   - The erase callback reported an error, only when completing an
+ *                                                  interrupted block rewrite
+ *		        e_eFSS_CORELL_RES_CLBCKWRITEERR   - The write callback reported an error, only when completing an
+ *                                                  interrupted block rewrite
+ *              e_eFSS_CORELL_RES_WRITENOMATCHREAD - Writen data dosent match what was requested, only when
+ *                                                   completing an interrupted block rewrite
+ *              e_eFSS_CORELL_RES_OK              - Operation ended correctly
+ */
+e_eFSS_CORELL_RES eFSS_CORELL_ProbePageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                              const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uPageIndx,
+                                              const uint32_t p_uUsrTrailL);
+
 /**
  * @brief       Flush one of the two buffer in to the storage area. Keep in mind that the other buffer will be used
  *              to check if the data was flushed correctly, and so after this operation it will contains different value
  *              from the one stored before. Only the buffer of the flushed area will be valid after this operation.
+ *              When bBlankCheck is enabled in the storage settings the page is checked before the first try, using
+ *              the IsErased callback if present or reading it back, and the erase is skipped if already blank.
+ *              When an erase block holds more than one page the blank check is always done, and a page that is not
+ *              blank is written after rewriting the other pages of its block through the spare block. Once every
+ *              other page is copied in the spare block a marker is written in the free slot of the spare block (only
+ *              its 16 byte when the ranged write callback is present), and it is erased only after the pages are
+ *              copied back. If a power loss leaves the marker valid, the copy
+ *              back is done again before the first access of the next context to the storage, so only the flushed
+ *              page can be lost, like it happens when a page is erased alone. A page of one of the last two blocks
+ *              erased by eFSS_CORELL_EraseBlk that follows every page flushed in it since the erase is known to be
+ *              blank, and is programmed without the blank check.
+ *              With the programmable trailer and the ranged write callback, a page whose new data only program
+ *              erased bit of the stored one is not erased: the changed data and the CRC, in the next free CRC slot,
+ *              are written in place and verified. When every slot is used the page is erased as usual.
  *
  * @param[in]   p_ptCtx       - Low Level Core context
  * @param[in]   p_eBuffType   - Enum used to select wich buffer we want to use for the writing process
@@ -197,6 +274,99 @@ e_eFSS_CORELL_RES eFSS_CORELL_LoadPageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, c
 e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
 								              const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uPageIndx);
 
+/**
+ * @brief       Erase the whole erase block that contains a page, or only the page when every page can be erased
+ *              alone. Every page of the block can then be flushed without erasing it again, so a group of pages can
+ *              be written with a single erase. The data stored in the other pages of the block is lost, call it only
+ *              when all of them are going to be written again. The buffer 1 is not modified, the buffer 2 can be
+ *              used to complete an interrupted block rewrite before the first access to the storage. The context
+ *              remember the last two erased blocks, so the pages of an origin and of a backup block can be flushed
+ *              in increasing order without reading them first.
+ *
+ * @param[in]   p_ptCtx       - Low Level Core context
+ * @param[in]   p_uPageIndx   - uint32_t index rappresenting a page of the block that we want to erase
+ *
+ * @return      e_eFSS_CORELL_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_CORELL_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_CORELL_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_CORELL_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_CORELL_RES_CLBCKERASEERR    - The erase callback reported an error
+ *		        e_eFSS_CORELL_RES_CLBCKWRITEERR    - The write callback reported an error, only when completing an
+ *                                                   interrupted block rewrite
+ *		        e_eFSS_CORELL_RES_CLBCKREADERR     - The read callback reported an error, only when completing an
+ *                                                   interrupted block rewrite
+ *              e_eFSS_CORELL_RES_CLBCKCRCERR      - The crc callback reported an error, only when completing an
+ *                                                   interrupted block rewrite
+ *              e_eFSS_CORELL_RES_WRITENOMATCHREAD - Writen data dosent match what was requested, only when
+ *                                                   completing an interrupted block rewrite
+ *              e_eFSS_CORELL_RES_OK               - Operation ended correctly
+ */
+e_eFSS_CORELL_RES eFSS_CORELL_EraseBlk(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx);
+
+/**
+ * @brief       Compare the first p_uCmpL byte of the buffer 1 with the ones stored in a page, verifying the page like
+ *              eFSS_CORELL_LoadPageInBuff does. The buffer 1 is not modified: the page is streamed in the buffer 2,
+ *              in one single read, or in chunk of the scratch area size in single buffer mode. After this operation
+ *              the last part of the page (the private metadata and the user data before them) can be found at the
+ *              end of the buffer 2.
+ *
+ * @param[in]   p_ptCtx       - Low Level Core context
+ * @param[in]   p_uPageIndx   - uint32_t index rappresenting the page that we want to compare
+ * @param[in]   p_uCmpL       - Number of byte to compare, starting from the first one
+ * @param[out]  p_pbIsEquals  - Pointer to a bool_t that will be true if the page is valid and the data are equals
+ *
+ * @return      e_eFSS_CORELL_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSS_CORELL_RES_BADPARAM        - In case of an invalid parameter passed to the function
+ *		        e_eFSS_CORELL_RES_CORRUPTCTX      - Context is corrupted
+ *		        e_eFSS_CORELL_RES_NOINITLIB       - Need to init lib before calling function
+ *		        e_eFSS_CORELL_RES_CLBCKREADERR    - The read callback reported an error
+ *              e_eFSS_CORELL_RES_CLBCKCRCERR     - The crc callback reported an error
+ *              e_eFSS_CORELL_RES_NOTVALIDPAGE    - The readed page is invalid
+ *              e_eFSS_CORELL_RES_NEWVERSIONFOUND - The readed page has a new version
+ *		        e_eFSS_CORELL_RES_CLBCKERASEERR   - The erase callback reported an error, only when completing an
+ *                                                  interrupted block rewrite
+ *		        e_eFSS_CORELL_RES_CLBCKWRITEERR   - The write callback reported an error, only when completing an
+ *                                                  interrupted block rewrite
+ *              e_eFSS_CORELL_RES_WRITENOMATCHREAD - Writen data dosent match what was requested, only when
+ *                                                   completing an interrupted block rewrite
+ *              e_eFSS_CORELL_RES_OK              - Operation ended correctly
+ */
+e_eFSS_CORELL_RES eFSS_CORELL_CmpPageWithBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                              const uint32_t p_uCmpL, bool_t* const p_pbIsEquals);
+
+/**
+ * @brief       Fast check done before eFSS_CORELL_CmpPageWithBuff. The CRC of the first p_uCmpL byte of the buffer 1
+ *              is chained with the rest of the page, readed with the ranged read callback at the end of the buffer 2,
+ *              and compared with the stored one. If they differ the page cannot be equal to the buffer, or is
+ *              corrupted, and the whole page is not readed. The private metadata are verified like
+ *              eFSS_CORELL_ProbePageInBuff does. When the ranged read is not available, or the not compared part of
+ *              the page is bigger than the buffer 2, nothing is readed and p_pbCanBeEquals is always true.
+ *
+ * @param[in]   p_ptCtx          - Low Level Core context
+ * @param[in]   p_uPageIndx      - uint32_t index rappresenting the page that we want to compare
+ * @param[in]   p_uCmpL          - Number of byte to compare, starting from the first one
+ * @param[out]  p_pbCanBeEquals  - Pointer to a bool_t that will be false if the page is surely different from the
+ *                                 buffer, true if eFSS_CORELL_CmpPageWithBuff is needed
+ *
+ * @return      e_eFSS_CORELL_RES_BADPOINTER      - In case of bad pointer passed to the function
+ *		        e_eFSS_CORELL_RES_BADPARAM        - In case of an invalid parameter passed to the function
+ *		        e_eFSS_CORELL_RES_CORRUPTCTX      - Context is corrupted
+ *		        e_eFSS_CORELL_RES_NOINITLIB       - Need to init lib before calling function
+ *		        e_eFSS_CORELL_RES_CLBCKREADERR    - The read callback reported an error
+ *              e_eFSS_CORELL_RES_CLBCKCRCERR     - The crc callback reported an error
+ *              e_eFSS_CORELL_RES_NOTVALIDPAGE    - The readed page is invalid
+ *              e_eFSS_CORELL_RES_NEWVERSIONFOUND - The readed page has a new version
+ *		        e_eFSS_CORELL_RES_CLBCKERASEERR   - The erase callback reported an error, only when completing an
+ *                                                  interrupted block rewrite
+ *		        e_eFSS_CORELL_RES_CLBCKWRITEERR   - The write callback reported an error, only when completing an
+ *                                                  interrupted block rewrite
+ *              e_eFSS_CORELL_RES_WRITENOMATCHREAD - Writen data dosent match what was requested, only when
+ *                                                   completing an interrupted block rewrite
+ *              e_eFSS_CORELL_RES_OK              - Operation ended correctly
+ */
+e_eFSS_CORELL_RES eFSS_CORELL_CmpPageCrcWithBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                                 const uint32_t p_uCmpL, bool_t* const p_pbCanBeEquals);
+
 /**
  * @brief       Calculate the Crc of the data present in the choosen buffer. It's not necessary to calculate the CRC
  *              value of the whole pages, we can choose to calculate the CRC of a portion of the page. In this
@@ -216,11 +386,63 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
  *		        e_eFSS_CORELL_RES_CLBCKCRCERR      - The CRC callback reported an error
  *              e_eFSS_CORELL_RES_OK               - Operation ended correctly
  */
-e_eFSS_CORELL_RES eFSS_CORELL_CalcCrcInBuff(const t_eFSS_CORELL_Ctx* p_ptCtx,
+e_eFSS_CORELL_RES eFSS_CORELL_CalcCrcInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx,
                                             const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uCrcSeed,
 								            const uint32_t p_uLenCalc, uint32_t* const p_puCrc);
 
 
+/**
+ * @brief       Add the data of a range of the choosen buffer to the CRC stored in his private metadata, without
+ *              calculating the CRC of the whole page. Adding a range two times removes it, so calling this function
+ *              before and after changing the range moves the stored CRC from the old data to the new one. When
+ *              p_bArm is true the next flush of the buffer uses the stored CRC instead of calculating it again.
+ *              Once armed, every change made to the buffer till the flush must be added in this way. The stored
+ *              CRC is updated only when the CRC callback is eFSS_Utils_Crc32Cb and the buffer holds a page just
+ *              loaded or flushed, otherwise nothing is done and the flush will calculate the CRC as usual.
+ *
+ * @param[in]   p_ptCtx       - Low Level Core context
+ * @param[in]   p_eBuffType   - Enum used to select wich buffer we want to update
+ * @param[in]   p_uOffset     - Offset of the range, the private metadata are not included
+ * @param[in]   p_uLen        - Length of the range, the private metadata are not included
+ * @param[in]   p_bArm        - true if the next flush of the buffer can use the stored CRC
+ *
+ * @return      e_eFSS_CORELL_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_CORELL_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_CORELL_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_CORELL_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_CORELL_RES_CLBCKCRCERR      - The CRC callback reported an error
+ *              e_eFSS_CORELL_RES_OK               - Operation ended correctly
+ */
+e_eFSS_CORELL_RES eFSS_CORELL_UpdCrcInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                           const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uOffset,
+                                           const uint32_t p_uLen, const bool_t p_bArm);
+
+/**
+ * @brief       Get the statistics collected since the init or the last reset. Every callback call is counted, the
+ *              failed ones too.
+ *
+ * @param[in]   p_ptCtx       - Low Level Core context
+ * @param[out]  p_ptStats     - Pointer to a statistics struct that will be filled with the collected counters
+ *
+ * @return      e_eFSS_CORELL_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_CORELL_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_CORELL_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_CORELL_RES_OK            - Operation ended correctly
+ */
+e_eFSS_CORELL_RES eFSS_CORELL_GetStats(t_eFSS_CORELL_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats);
+
+/**
+ * @brief       Reset to zero every statistics counter
+ *
+ * @param[in]   p_ptCtx       - Low Level Core context
+ *
+ * @return      e_eFSS_CORELL_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_CORELL_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_CORELL_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_CORELL_RES_OK            - Operation ended correctly
+ */
+e_eFSS_CORELL_RES eFSS_CORELL_ResetStats(t_eFSS_CORELL_Ctx* const p_ptCtx);
+
 
 #ifdef __cplusplus
 } /* extern "C" */
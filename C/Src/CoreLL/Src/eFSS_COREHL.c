@@ -38,6 +38,14 @@
  **********************************************************************************************************************/
 static e_eFSS_COREHL_RES eFSS_COREHL_LLtoHLRes(const e_eFSS_CORELL_RES p_eLLRes);
 static bool_t eFSS_COREHL_IsStatusStillCoherent(t_eFSS_COREHL_Ctx* const p_ptCtx);
+static e_eFSS_COREHL_RES eFSS_COREHL_LoadNRipBkpSingleBuf(t_eFSS_COREHL_Ctx* const p_ptCtx,
+                                                        const t_eFSS_CORELL_StorBuf* p_ptBuff1,
+                                                        const t_eFSS_CORELL_StorBuf* p_ptBuff2,
+                                                        const uint32_t p_uOriIdx, const uint32_t p_uBkpIdx,
+                                                        const uint8_t p_uOriSubT, const uint8_t p_uBkpSubT);
+static void eFSS_COREHL_SetSubType(t_eFSS_COREHL_Ctx* const p_ptCtx, const e_eFSS_CORELL_BUFFTYPE p_eBuffType,
+                                   const t_eFSS_CORELL_StorBuf* p_ptBuff, const uint8_t p_uSubType,
+                                   const bool_t p_bArm);
 
 
 
@@ -331,6 +339,77 @@ e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuff(t_eFSS_COREHL_Ctx* const p_ptCtx, c
     return l_eRes;
 }
 
+e_eFSS_COREHL_RES eFSS_COREHL_ProbePageInBuff(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uPIdx,
+                                              const uint32_t p_uUsrTrailL, uint8_t* const p_puSubTypeRead)
+{
+    /* Return local var */
+    e_eFSS_COREHL_RES l_eRes;
+    e_eFSS_CORELL_RES l_eResLL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local variable for storage */
+    t_eFSS_CORELL_StorBuf l_tBuff1;
+    t_eFSS_CORELL_StorBuf l_tBuff2;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puSubTypeRead ) )
+    {
+        l_eRes = e_eFSS_COREHL_RES_BADPOINTER;
+    }
+    else
+    {
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResLL = eFSS_CORELL_IsInit(&p_ptCtx->tCORELLCtx, &l_bIsInit);
+        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+        if( e_eFSS_COREHL_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_COREHL_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_COREHL_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_COREHL_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eResLL = eFSS_CORELL_GetBuff(&p_ptCtx->tCORELLCtx, &l_tBuff1, &l_tBuff2);
+                    l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                    if( e_eFSS_COREHL_RES_OK == l_eRes )
+                    {
+                        /* Check param validity */
+                        if( p_uUsrTrailL > ( l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ) )
+                        {
+                            l_eRes = e_eFSS_COREHL_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            /* The subtype is part of the trailer */
+                            l_eResLL = eFSS_CORELL_ProbePageInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1,
+                                                                   p_uPIdx, ( p_uUsrTrailL + EFSS_COREHL_PAGEMIN_L ));
+                            l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                            if( e_eFSS_COREHL_RES_OK == l_eRes )
+                            {
+                                *p_puSubTypeRead = l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
 e_eFSS_COREHL_RES eFSS_COREHL_FlushBuffInPage(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uPIdx,
                                               const uint8_t p_uSubTypeToWrite)
 {
@@ -377,7 +456,7 @@ e_eFSS_COREHL_RES eFSS_COREHL_FlushBuffInPage(t_eFSS_COREHL_Ctx* const p_ptCtx,
                     if( e_eFSS_COREHL_RES_OK == l_eRes )
                     {
                         /* Setup sub page type */
-                        l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uSubTypeToWrite;
+                        eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1, p_uSubTypeToWrite, false);
                         (void)l_tBuff1.uBufL;
 
                         /* Flush */
@@ -457,6 +536,72 @@ e_eFSS_COREHL_RES eFSS_COREHL_CalcCrcInBuff(t_eFSS_COREHL_Ctx* const p_ptCtx, co
     return l_eRes;
 }
 
+e_eFSS_COREHL_RES eFSS_COREHL_UpdCrcInBuff(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uOffset,
+                                           const uint32_t p_uLen, const bool_t p_bArm)
+{
+    /* Return local var */
+    e_eFSS_COREHL_RES l_eRes;
+    e_eFSS_CORELL_RES l_eResLL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local variable for storage */
+    t_eFSS_CORELL_StorBuf l_tBuff1;
+    t_eFSS_CORELL_StorBuf l_tBuff2;
+
+    if( NULL == p_ptCtx )
+    {
+        l_eRes = e_eFSS_COREHL_RES_BADPOINTER;
+    }
+    else
+    {
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResLL = eFSS_CORELL_IsInit(&p_ptCtx->tCORELLCtx, &l_bIsInit);
+        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+        if( e_eFSS_COREHL_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_COREHL_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_COREHL_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_COREHL_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The range cannot include the sub page type */
+                    l_eResLL = eFSS_CORELL_GetBuff(&p_ptCtx->tCORELLCtx, &l_tBuff1, &l_tBuff2);
+                    l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                    if( e_eFSS_COREHL_RES_OK == l_eRes )
+                    {
+                        if( ( p_uOffset >= ( l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ) ) ||
+                            ( p_uLen > ( l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L - p_uOffset ) ) )
+                        {
+                            l_eRes = e_eFSS_COREHL_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            l_eResLL = eFSS_CORELL_UpdCrcInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1,
+                                                                p_uOffset, p_uLen, p_bArm);
+                            l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
 e_eFSS_COREHL_RES eFSS_COREHL_FlushBuffInPageNBkp(t_eFSS_COREHL_Ctx* const p_ptCtx,
 								                  const uint32_t p_uOriIdx, const uint32_t p_uBkpIdx,
                                                   const uint8_t p_uOriSubT, const uint8_t p_uBkpSubT)
@@ -512,7 +657,7 @@ e_eFSS_COREHL_RES eFSS_COREHL_FlushBuffInPageNBkp(t_eFSS_COREHL_Ctx* const p_ptC
                         if( e_eFSS_COREHL_RES_OK == l_eRes)
                         {
                             /* Update subtype */
-                            l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uOriSubT;
+                            eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1, p_uOriSubT, false);
 
                             /* Flush */
                             l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1,
@@ -522,7 +667,7 @@ e_eFSS_COREHL_RES eFSS_COREHL_FlushBuffInPageNBkp(t_eFSS_COREHL_Ctx* const p_ptC
                             if( e_eFSS_COREHL_RES_OK == l_eRes)
                             {
                                 /* Update subtype of the backup page */
-                                l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uBkpSubT;
+                                eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1, p_uBkpSubT, true);
 
                                 /* Flush backup page */
                                 l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1,
@@ -532,7 +677,8 @@ e_eFSS_COREHL_RES eFSS_COREHL_FlushBuffInPageNBkp(t_eFSS_COREHL_Ctx* const p_ptC
                                 if( e_eFSS_COREHL_RES_OK == l_eRes)
                                 {
                                     /* Ripristinate original page */
-                                    l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uOriSubT;
+                                    eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1,
+                                                           p_uOriSubT, false);
                                     (void)l_tBuff1.uBufL;
                                 }
                             }
@@ -604,38 +750,17 @@ e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuffNRipBkp(t_eFSS_COREHL_Ctx* const p_p
                         l_eResLL = eFSS_CORELL_GetBuff(&p_ptCtx->tCORELLCtx, &l_tBuff1, &l_tBuff2);
                         l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
 
-                        if( e_eFSS_COREHL_RES_OK == l_eRes)
+                        if( ( e_eFSS_COREHL_RES_OK == l_eRes ) && ( l_tBuff2.uBufL < l_tBuff1.uBufL ) )
                         {
-                            /* Load original page in internal buffer */
-                            l_eResLL = eFSS_CORELL_LoadPageInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1,
-                                                                  p_uOriIdx);
-                            l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
-
-                            if( ( e_eFSS_COREHL_RES_OK == l_eRes ) ||
-                                ( e_eFSS_COREHL_RES_NOTVALIDPAGE == l_eRes ) ||
-                                ( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes ) )
-                            {
-                                /* Page readed, is valid? */
-                                if( ( e_eFSS_COREHL_RES_OK == l_eRes ) &&
-                                    ( p_uOriSubT == l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] ) )
-                                {
-                                    l_bIsOriVal = true;
-                                    l_bIsOriNew = false;
-                                }
-                                else if( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes )
-                                {
-                                    l_bIsOriVal = false;
-                                    l_bIsOriNew = true;
-                                }
-                                else
-                                {
-                                    l_bIsOriVal = false;
-                                    l_bIsOriNew = false;
-                                }
-
-                                /* Load backup page in internal buffer */
-                                l_eResLL = eFSS_CORELL_LoadPageInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_2,
-                                                                      p_uBkpIdx);
+                            /* Single buffer mode, the second buffer is only a scratch area */
+                            l_eRes = eFSS_COREHL_LoadNRipBkpSingleBuf(p_ptCtx, &l_tBuff1, &l_tBuff2, p_uOriIdx,
+                                                                      p_uBkpIdx, p_uOriSubT, p_uBkpSubT);
+                        }
+                        else if( e_eFSS_COREHL_RES_OK == l_eRes )
+                        {
+                                /* Load original page in internal buffer */
+                                l_eResLL = eFSS_CORELL_LoadPageInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1,
+                                                                      p_uOriIdx);
                                 l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
 
                                 if( ( e_eFSS_COREHL_RES_OK == l_eRes ) ||
@@ -644,43 +769,123 @@ e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuffNRipBkp(t_eFSS_COREHL_Ctx* const p_p
                                 {
                                     /* Page readed, is valid? */
                                     if( ( e_eFSS_COREHL_RES_OK == l_eRes ) &&
-                                        ( p_uBkpSubT == l_tBuff2.puBuf[ l_tBuff2.uBufL - EFSS_COREHL_PAGEMIN_L ] ) )
+                                        ( p_uOriSubT == l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] ) )
                                     {
-                                        l_bIsBkpVal = true;
-                                        l_bIsBkpNew = false;
+                                        l_bIsOriVal = true;
+                                        l_bIsOriNew = false;
                                     }
                                     else if( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes )
                                     {
-                                        l_bIsBkpVal = false;
-                                        l_bIsBkpNew = true;
+                                        l_bIsOriVal = false;
+                                        l_bIsOriNew = true;
                                     }
                                     else
                                     {
-                                        l_bIsBkpVal = false;
-                                        l_bIsBkpNew = false;
+                                        l_bIsOriVal = false;
+                                        l_bIsOriNew = false;
                                     }
 
-                                    /* We have all the data needed to make a decision */
-                                    if( ( true == l_bIsOriVal ) && ( true == l_bIsBkpVal ) )
+                                    /* Load backup page in internal buffer */
+                                    l_eResLL = eFSS_CORELL_LoadPageInBuff(&p_ptCtx->tCORELLCtx,
+                                                                          e_eFSS_CORELL_BUFFTYPE_2, p_uBkpIdx);
+                                    l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                                    if( ( e_eFSS_COREHL_RES_OK == l_eRes ) ||
+                                        ( e_eFSS_COREHL_RES_NOTVALIDPAGE == l_eRes ) ||
+                                        ( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes ) )
                                     {
-                                        /* Both page are valid, are they identical ( except the subtype of course )? */
-                                        if( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf,
-                                                        ( l_tBuff2.uBufL - EFSS_COREHL_PAGEMIN_L ) ) )
+                                        /* Page readed, is valid? */
+                                        if( ( e_eFSS_COREHL_RES_OK == l_eRes ) &&
+                                            ( p_uBkpSubT == l_tBuff2.puBuf[ l_tBuff2.uBufL - EFSS_COREHL_PAGEMIN_L ] ) )
                                         {
-                                            /* Page are equals */
-                                            l_eRes = e_eFSS_COREHL_RES_OK;
+                                            l_bIsBkpVal = true;
+                                            l_bIsBkpNew = false;
+                                        }
+                                        else if( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes )
+                                        {
+                                            l_bIsBkpVal = false;
+                                            l_bIsBkpNew = true;
                                         }
                                         else
                                         {
-                                            /* Page are not equals, copy origin in backup */
-                                            l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uBkpSubT;
+                                            l_bIsBkpVal = false;
+                                            l_bIsBkpNew = false;
+                                        }
+
+                                        /* We have all the data needed to make a decision */
+                                        if( ( true == l_bIsOriVal ) && ( true == l_bIsBkpVal ) )
+                                        {
+                                            /* Both page are valid, are they identical ( except the subtype of
+                                               course )? */
+                                            if( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf,
+                                                            ( l_tBuff2.uBufL - EFSS_COREHL_PAGEMIN_L ) ) )
+                                            {
+                                                /* Page are equals */
+                                                l_eRes = e_eFSS_COREHL_RES_OK;
+                                            }
+                                            else
+                                            {
+                                                /* Page are not equals, copy origin in backup */
+                                                eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1,
+                                                                       p_uBkpSubT, true);
+                                                l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx,
+                                                                                       e_eFSS_CORELL_BUFFTYPE_1,
+                                                                                       p_uBkpIdx);
+                                                l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                                                /* Ripristinate original one */
+                                                eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1,
+                                                                       p_uOriSubT, false);
+                                                (void)l_tBuff1.uBufL;
+
+                                                /* If recovered return it */
+                                                if( e_eFSS_COREHL_RES_OK == l_eRes )
+                                                {
+                                                    l_eRes = e_eFSS_COREHL_RES_OK_BKP_RCVRD;
+                                                }
+                                            }
+                                        }
+                                        else if( ( false == l_bIsOriVal ) && ( true == l_bIsBkpVal ) )
+                                        {
+                                            /* Original page is not valid, ripristinate it from the backup area */
+                                            eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_2, &l_tBuff2,
+                                                                   p_uOriSubT, true);
+
+                                            l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx,
+                                                                                   e_eFSS_CORELL_BUFFTYPE_2,
+                                                                                   p_uOriIdx);
+                                            l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                                            /* Ripristinate backup one */
+                                            eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_2, &l_tBuff2,
+                                                                   p_uBkpSubT, false);
+
+                                            /* If recovered return it */
+                                            if( e_eFSS_COREHL_RES_OK == l_eRes )
+                                            {
+                                                /* Buffer 1 must contains the original page */
+                                                (void)memcpy(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff2.uBufL);
+                                                eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1,
+                                                                       p_uOriSubT, false);
+                                                (void)l_tBuff1.uBufL;
+
+                                                l_eRes = e_eFSS_COREHL_RES_OK_BKP_RCVRD;
+                                            }
+                                        }
+                                        else if( ( true == l_bIsOriVal ) && ( false == l_bIsBkpVal ) )
+                                        {
+                                            /* Backup is not valid, ripristinate it from the origin area */
+                                            eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1,
+                                                                   p_uBkpSubT, true);
+
                                             l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx,
                                                                                    e_eFSS_CORELL_BUFFTYPE_1,
                                                                                    p_uBkpIdx);
                                             l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
 
                                             /* Ripristinate original one */
-                                            l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uOriSubT;
+                                            eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, &l_tBuff1,
+                                                                   p_uOriSubT, false);
                                             (void)l_tBuff1.uBufL;
 
                                             /* If recovered return it */
@@ -689,65 +894,116 @@ e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuffNRipBkp(t_eFSS_COREHL_Ctx* const p_p
                                                 l_eRes = e_eFSS_COREHL_RES_OK_BKP_RCVRD;
                                             }
                                         }
+                                        else
+                                        {
+                                            if( ( true == l_bIsOriNew ) || ( true == l_bIsBkpNew ) )
+                                            {
+                                                /* No valid page found, but probably we have a new storage version */
+                                                l_eRes = e_eFSS_COREHL_RES_NEWVERSIONFOUND;
+                                            }
+                                            else
+                                            {
+                                                /* No a single valid pages found */
+                                                l_eRes = e_eFSS_COREHL_RES_NOTVALIDPAGE;
+                                            }
+                                        }
                                     }
-                                    else if( ( false == l_bIsOriVal ) && ( true == l_bIsBkpVal ) )
-                                    {
-                                        /* Original page is not valid, ripristinate it from the backup area */
-                                        l_tBuff2.puBuf[ l_tBuff2.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uOriSubT;
+                                }
+                        }
+                        else
+                        {
+                            /* Error already reported */
+                        }
+                    }
+                }
+            }
+        }
+    }
 
-                                        l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx,
-                                                                               e_eFSS_CORELL_BUFFTYPE_2,
-                                                                               p_uOriIdx);
-                                        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+    /* Keep track of the recovered pages */
+    if( e_eFSS_COREHL_RES_OK_BKP_RCVRD == l_eRes )
+    {
+        p_ptCtx->tCORELLCtx.tStats.uBkpRcvrdCnt++;
+    }
 
-                                        /* Ripristinate backup one */
-                                        l_tBuff2.puBuf[ l_tBuff2.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uBkpSubT;
+    return l_eRes;
+}
 
-                                        /* If recovered return it */
-                                        if( e_eFSS_COREHL_RES_OK == l_eRes )
-                                        {
-                                            /* Buffer 1 must contains the original page */
-                                            (void)memcpy(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff2.uBufL);
-                                            l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uOriSubT;
-                                            (void)l_tBuff1.uBufL;
+e_eFSS_COREHL_RES eFSS_COREHL_LoadPageInBuffTrustOri(t_eFSS_COREHL_Ctx* const p_ptCtx,
+                                                    const uint32_t p_uOriIdx, const uint32_t p_uBkpIdx,
+                                                    const uint8_t p_uOriSubT, const uint8_t p_uBkpSubT)
+{
+    /* Return local var */
+    e_eFSS_COREHL_RES l_eRes;
+    e_eFSS_CORELL_RES l_eResLL;
 
-                                            l_eRes = e_eFSS_COREHL_RES_OK_BKP_RCVRD;
-                                        }
-                                    }
-                                    else if( ( true == l_bIsOriVal ) && ( false == l_bIsBkpVal ) )
-                                    {
-                                        /* Backup is not valid, ripristinate it from the origin area */
-                                        l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uBkpSubT;
+    /* Local var for init */
+    bool_t l_bIsInit;
 
-                                        l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx,
-                                                                               e_eFSS_CORELL_BUFFTYPE_1,
-                                                                               p_uBkpIdx);
-                                        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+    /* Local variable for storage */
+    t_eFSS_CORELL_StorBuf l_tBuff1;
+    t_eFSS_CORELL_StorBuf l_tBuff2;
 
-                                        /* Ripristinate original one */
-                                        l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] = p_uOriSubT;
-                                        (void)l_tBuff1.uBufL;
+    if( NULL == p_ptCtx )
+    {
+        l_eRes = e_eFSS_COREHL_RES_BADPOINTER;
+    }
+    else
+    {
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResLL = eFSS_CORELL_IsInit(&p_ptCtx->tCORELLCtx, &l_bIsInit);
+        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
 
-                                        /* If recovered return it */
-                                        if( e_eFSS_COREHL_RES_OK == l_eRes )
-                                        {
-                                            l_eRes = e_eFSS_COREHL_RES_OK_BKP_RCVRD;
-                                        }
-                                    }
-                                    else
-                                    {
-                                        if( ( true == l_bIsOriNew ) || ( true == l_bIsBkpNew ) )
-                                        {
-                                            /* No valid page found, but probably we have a new storage version */
-                                            l_eRes = e_eFSS_COREHL_RES_NEWVERSIONFOUND;
-                                        }
-                                        else
-                                        {
-                                            /* No a single valid pages found */
-                                            l_eRes = e_eFSS_COREHL_RES_NOTVALIDPAGE;
-                                        }
-                                    }
-                                }
+        if( e_eFSS_COREHL_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_COREHL_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_COREHL_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_COREHL_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Check parameter validity */
+                    if( p_uBkpIdx == p_uOriIdx )
+                    {
+                        l_eRes = e_eFSS_COREHL_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        l_eResLL = eFSS_CORELL_GetBuff(&p_ptCtx->tCORELLCtx, &l_tBuff1, &l_tBuff2);
+                        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                        if( e_eFSS_COREHL_RES_OK == l_eRes )
+                        {
+                            /* Load only the original page, the backup is read only if the original is not usable */
+                            l_eResLL = eFSS_CORELL_LoadPageInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1,
+                                                                  p_uOriIdx);
+                            l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                            if( ( e_eFSS_COREHL_RES_OK == l_eRes ) &&
+                                ( p_uOriSubT == l_tBuff1.puBuf[ l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ] ) )
+                            {
+                                /* Original page valid, it is the one to keep anyway so the backup is not needed */
+                                l_eRes = e_eFSS_COREHL_RES_OK;
+                            }
+                            else if( ( e_eFSS_COREHL_RES_OK == l_eRes ) ||
+                                     ( e_eFSS_COREHL_RES_NOTVALIDPAGE == l_eRes ) ||
+                                     ( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes ) )
+                            {
+                                /* Original page not usable, fall back to the full origin and backup verification */
+                                l_eRes = eFSS_COREHL_LoadPageInBuffNRipBkp(p_ptCtx, p_uOriIdx, p_uBkpIdx, p_uOriSubT,
+                                                                           p_uBkpSubT);
+                            }
+                            else
+                            {
+                                /* Error already reported */
                             }
                         }
                     }
@@ -773,6 +1029,9 @@ e_eFSS_COREHL_RES eFSS_COREHL_IsBuffEqualToPage(t_eFSS_COREHL_Ctx* const p_ptCtx
     t_eFSS_CORELL_StorBuf l_tBuff1;
     t_eFSS_CORELL_StorBuf l_tBuff2;
 
+    /* Local variable for calculation */
+    bool_t l_bCanBeEq;
+
     if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsEquals ) || ( NULL == p_puSubTypePage ) )
     {
         l_eRes = e_eFSS_COREHL_RES_BADPOINTER;
@@ -804,26 +1063,34 @@ e_eFSS_COREHL_RES eFSS_COREHL_IsBuffEqualToPage(t_eFSS_COREHL_Ctx* const p_ptCtx
 
                     if( e_eFSS_COREHL_RES_OK == l_eRes )
                     {
-                        /* Load the pointed page in the support buffer */
-                        l_eResLL = eFSS_CORELL_LoadPageInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_2, p_uPIdx);
+                        /* Read only the trailer of the page first, a different CRC is enough to say not equal */
+                        l_bCanBeEq = false;
+                        l_eResLL = eFSS_CORELL_CmpPageCrcWithBuff(&p_ptCtx->tCORELLCtx, p_uPIdx,
+                                                                  ( l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ),
+                                                                  &l_bCanBeEq);
                         l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
 
+                        if( ( e_eFSS_COREHL_RES_OK == l_eRes ) && ( false == l_bCanBeEq ) )
+                        {
+                            *p_pbIsEquals = false;
+                        }
+                        else if( e_eFSS_COREHL_RES_OK == l_eRes )
+                        {
+                            /* Compare the pointed page with the buffer, exclude the subtype from comparsion */
+                            l_eResLL = eFSS_CORELL_CmpPageWithBuff(&p_ptCtx->tCORELLCtx, p_uPIdx,
+                                                                   ( l_tBuff1.uBufL - EFSS_COREHL_PAGEMIN_L ),
+                                                                   p_pbIsEquals);
+                            l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+                        }
+                        else
+                        {
+                            /* Error already reported */
+                        }
+
                         if( e_eFSS_COREHL_RES_OK == l_eRes )
                         {
-                            /* Copy the subtype */
+                            /* Copy the subtype, the page trailer is at the end of the support buffer */
                             *p_puSubTypePage = l_tBuff2.puBuf[ l_tBuff2.uBufL - EFSS_COREHL_PAGEMIN_L ];
-
-                            /* Verify if they are equals, exclude the subtype from comparsion */
-                            if( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf,
-                                            ( l_tBuff2.uBufL - EFSS_COREHL_PAGEMIN_L ) ) )
-                            {
-                                /* Page are equals */
-                                *p_pbIsEquals = true;
-                            }
-                            else
-                            {
-                                *p_pbIsEquals = false;
-                            }
                         }
                     }
                 }
@@ -834,6 +1101,147 @@ e_eFSS_COREHL_RES eFSS_COREHL_IsBuffEqualToPage(t_eFSS_COREHL_Ctx* const p_ptCtx
     return l_eRes;
 }
 
+e_eFSS_COREHL_RES eFSS_COREHL_GetStats(t_eFSS_COREHL_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats)
+{
+	/* Return local var */
+    e_eFSS_COREHL_RES l_eRes;
+    e_eFSS_CORELL_RES l_eResLL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_COREHL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResLL = eFSS_CORELL_IsInit(&p_ptCtx->tCORELLCtx, &l_bIsInit);
+        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+        if( e_eFSS_COREHL_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_COREHL_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_COREHL_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_COREHL_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The counters are kept by the low level core */
+                    l_eResLL = eFSS_CORELL_GetStats(&p_ptCtx->tCORELLCtx, p_ptStats);
+                    l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_COREHL_RES eFSS_COREHL_ResetStats(t_eFSS_COREHL_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_COREHL_RES l_eRes;
+    e_eFSS_CORELL_RES l_eResLL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_COREHL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResLL = eFSS_CORELL_IsInit(&p_ptCtx->tCORELLCtx, &l_bIsInit);
+        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+        if( e_eFSS_COREHL_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_COREHL_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_COREHL_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_COREHL_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Reset the counters of the low level core */
+                    l_eResLL = eFSS_CORELL_ResetStats(&p_ptCtx->tCORELLCtx);
+                    l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_COREHL_RES eFSS_COREHL_EraseBlk(t_eFSS_COREHL_Ctx* const p_ptCtx, const uint32_t p_uPIdx)
+{
+	/* Return local var */
+    e_eFSS_COREHL_RES l_eRes;
+    e_eFSS_CORELL_RES l_eResLL;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_COREHL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResLL = eFSS_CORELL_IsInit(&p_ptCtx->tCORELLCtx, &l_bIsInit);
+        l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+        if( e_eFSS_COREHL_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_COREHL_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_COREHL_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_COREHL_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Page index is checked by the low level core */
+                    l_eResLL = eFSS_CORELL_EraseBlk(&p_ptCtx->tCORELLCtx, p_uPIdx);
+                    l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
 
 
 /***********************************************************************************************************************
@@ -957,4 +1365,146 @@ static bool_t eFSS_COREHL_IsStatusStillCoherent(t_eFSS_COREHL_Ctx* const p_ptCtx
     }
 
     return l_bRes;
-}
\ No newline at end of file
+}
+
+static e_eFSS_COREHL_RES eFSS_COREHL_LoadNRipBkpSingleBuf(t_eFSS_COREHL_Ctx* const p_ptCtx,
+                                                        const t_eFSS_CORELL_StorBuf* p_ptBuff1,
+                                                        const t_eFSS_CORELL_StorBuf* p_ptBuff2,
+                                                        const uint32_t p_uOriIdx, const uint32_t p_uBkpIdx,
+                                                        const uint8_t p_uOriSubT, const uint8_t p_uBkpSubT)
+{
+    /* Return local var */
+    e_eFSS_COREHL_RES l_eRes;
+    e_eFSS_CORELL_RES l_eResLL;
+
+    /* Local var used for calculation */
+    bool_t l_bIsOriVal;
+    bool_t l_bIsOriNew;
+    bool_t l_bIsBkpEq;
+
+    /* Load original page in internal buffer */
+    l_eResLL = eFSS_CORELL_LoadPageInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1, p_uOriIdx);
+    l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+    if( ( e_eFSS_COREHL_RES_OK == l_eRes ) || ( e_eFSS_COREHL_RES_NOTVALIDPAGE == l_eRes ) ||
+        ( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes ) )
+    {
+        /* Page readed, is valid? */
+        if( ( e_eFSS_COREHL_RES_OK == l_eRes ) &&
+            ( p_uOriSubT == p_ptBuff1->puBuf[ p_ptBuff1->uBufL - EFSS_COREHL_PAGEMIN_L ] ) )
+        {
+            l_bIsOriVal = true;
+            l_bIsOriNew = false;
+        }
+        else if( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes )
+        {
+            l_bIsOriVal = false;
+            l_bIsOriNew = true;
+        }
+        else
+        {
+            l_bIsOriVal = false;
+            l_bIsOriNew = false;
+        }
+
+        if( true == l_bIsOriVal )
+        {
+            /* Compare the backup page with the original one, there is no room to load it: stream it in the
+               scratch area. Exclude the subtype from comparsion */
+            l_bIsBkpEq = false;
+            l_eResLL = eFSS_CORELL_CmpPageWithBuff(&p_ptCtx->tCORELLCtx, p_uBkpIdx,
+                                                   ( p_ptBuff1->uBufL - EFSS_COREHL_PAGEMIN_L ),
+                                                   &l_bIsBkpEq);
+            l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+            if( ( e_eFSS_COREHL_RES_OK == l_eRes ) && ( true == l_bIsBkpEq ) &&
+                ( p_uBkpSubT == p_ptBuff2->puBuf[ p_ptBuff2->uBufL - EFSS_COREHL_PAGEMIN_L ] ) )
+            {
+                /* Page are equals */
+                l_eRes = e_eFSS_COREHL_RES_OK;
+            }
+            else if( ( e_eFSS_COREHL_RES_OK == l_eRes ) ||
+                     ( e_eFSS_COREHL_RES_NOTVALIDPAGE == l_eRes ) ||
+                     ( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes ) )
+            {
+                /* Backup is not valid or not equals, ripristinate it from the origin area */
+                eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, p_ptBuff1, p_uBkpSubT, true);
+
+                l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1, p_uBkpIdx);
+                l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                /* Ripristinate original one */
+                eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, p_ptBuff1, p_uOriSubT, false);
+
+                /* If recovered return it */
+                if( e_eFSS_COREHL_RES_OK == l_eRes )
+                {
+                    l_eRes = e_eFSS_COREHL_RES_OK_BKP_RCVRD;
+                }
+            }
+            else
+            {
+                /* Error already reported */
+            }
+        }
+        else
+        {
+            /* Original page is not valid, load the backup one in the same buffer */
+            l_eResLL = eFSS_CORELL_LoadPageInBuff(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1, p_uBkpIdx);
+            l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+            if( ( e_eFSS_COREHL_RES_OK == l_eRes ) &&
+                ( p_uBkpSubT == p_ptBuff1->puBuf[ p_ptBuff1->uBufL - EFSS_COREHL_PAGEMIN_L ] ) )
+            {
+                /* Ripristinate the original page from the backup area */
+                eFSS_COREHL_SetSubType(p_ptCtx, e_eFSS_CORELL_BUFFTYPE_1, p_ptBuff1, p_uOriSubT, true);
+
+                l_eResLL = eFSS_CORELL_FlushBuffInPage(&p_ptCtx->tCORELLCtx, e_eFSS_CORELL_BUFFTYPE_1, p_uOriIdx);
+                l_eRes = eFSS_COREHL_LLtoHLRes(l_eResLL);
+
+                /* If recovered return it, buffer 1 already contains the original page */
+                if( e_eFSS_COREHL_RES_OK == l_eRes )
+                {
+                    l_eRes = e_eFSS_COREHL_RES_OK_BKP_RCVRD;
+                }
+            }
+            else if( ( e_eFSS_COREHL_RES_OK == l_eRes ) ||
+                     ( e_eFSS_COREHL_RES_NOTVALIDPAGE == l_eRes ) ||
+                     ( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes ) )
+            {
+                if( ( true == l_bIsOriNew ) || ( e_eFSS_COREHL_RES_NEWVERSIONFOUND == l_eRes ) )
+                {
+                    /* No valid page found, but probably we have a new storage version */
+                    l_eRes = e_eFSS_COREHL_RES_NEWVERSIONFOUND;
+                }
+                else
+                {
+                    /* No a single valid pages found */
+                    l_eRes = e_eFSS_COREHL_RES_NOTVALIDPAGE;
+                }
+            }
+            else
+            {
+                /* Error already reported */
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static void eFSS_COREHL_SetSubType(t_eFSS_COREHL_Ctx* const p_ptCtx, const e_eFSS_CORELL_BUFFTYPE p_eBuffType,
+                                   const t_eFSS_CORELL_StorBuf* p_ptBuff, const uint8_t p_uSubType,
+                                   const bool_t p_bArm)
+{
+    /* Local var used for calculation */
+    uint32_t l_uSubTOff;
+
+    l_uSubTOff = p_ptBuff->uBufL - EFSS_COREHL_PAGEMIN_L;
+
+    /* Move the stored CRC from the old sub type to the new one. If this fails the stored CRC is simply discarded
+       and calculated again during the flush, so the result can be ignored */
+    (void)eFSS_CORELL_UpdCrcInBuff(&p_ptCtx->tCORELLCtx, p_eBuffType, l_uSubTOff, EFSS_COREHL_PAGEMIN_L, p_bArm);
+    p_ptBuff->puBuf[l_uSubTOff] = p_uSubType;
+    (void)eFSS_CORELL_UpdCrcInBuff(&p_ptCtx->tCORELLCtx, p_eBuffType, l_uSubTOff, EFSS_COREHL_PAGEMIN_L, false);
+}
@@ -18,6 +18,24 @@
  * - uint32_t  - uPageMagicNumber   -> Magic number of the page      |
  * - uint32_t  - uPageCrc           -> 32 bit CRC                    |
  * ------------------------------------------------------------------ End of Page
+ *
+ * With a compact trailer the private metadata are instead:
+ * ------------------------------------------------------------------ Private metadata (8 or 6 byte)
+ * - uint16_t  - uPageIndx          -> Page Index                    |
+ * - uint8_t   - uPageType/Version  -> Type (high) and version (low) |
+ * - uint8_t   - uPageMagicNumber   -> Magic number of the page      |
+ * - uint32_t  - uPageCrc           -> 32 bit CRC, or 16 bit CRC     |
+ * ------------------------------------------------------------------ End of Page
+ * The total number of page is not stored, it is used to seed the CRC so a page of an area with a different size is
+ * still not valid.
+ *
+ * With a programmable trailer the 32 bit CRC of the full metadata is replaced by four CRC slots:
+ * ------------------------------------------------------------------ Private metadata (31 byte)
+ * - [15 byte] -                    -> Full metadata without CRC     |
+ * - uint32_t  - uPageCrcSlot[4]    -> 32 bit CRC slots              |
+ * ------------------------------------------------------------------ End of Page
+ * A slot is free when every byte is at the erased value. The CRC of the page is the one in the last used slot, or in
+ * the first slot if none is used, and the CRC slots are not part of the CRC.
  */
 
 /***********************************************************************************************************************
@@ -34,6 +52,19 @@
 #define EFSS_CORELL_PAGEMIN_L                                                                      ( ( uint32_t )  19u )
 #define EFSS_CORELL_CRC_L                                                                          ( ( uint32_t )   4u )
 #define EFSS_CORELL_PAGEMAGNUM                                                             ( ( uint32_t )  0xA5A5A5A5u )
+#define EFSS_CORELL_PAGEMINC_L                                                                     ( ( uint32_t )   8u )
+#define EFSS_CORELL_PAGEMINC16_L                                                                   ( ( uint32_t )   6u )
+#define EFSS_CORELL_CRC16_L                                                                        ( ( uint32_t )   2u )
+#define EFSS_CORELL_PAGEMAGNUMC                                                                   ( ( uint8_t )  0x5Au )
+#define EFSS_CORELL_MAXPAGEC                                                                 ( ( uint32_t )  0xFFFFu )
+#define EFSS_CORELL_MAXNIBBLE                                                                     ( ( uint8_t )  0x0Fu )
+#define EFSS_CORELL_STREAM_EQUAL                                                                  ( ( uint8_t )  0x01u )
+#define EFSS_CORELL_STREAM_BLANK                                                                  ( ( uint8_t )  0x02u )
+#define EFSS_CORELL_BLKMARKNUM                                                             ( ( uint32_t )  0x5AFEB10Cu )
+#define EFSS_CORELL_BLKMARK_L                                                                      ( ( uint32_t )  16u )
+#define EFSS_CORELL_PAGEMINP_L                                                                     ( ( uint32_t )  31u )
+#define EFSS_CORELL_CRCSLOT_N                                                                      ( ( uint32_t )   4u )
+#define EFSS_CORELL_CRCSLOT_L                                                                      ( ( uint32_t )  16u )
 
 
 
@@ -56,10 +87,65 @@ typedef struct
  *  PRIVATE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eFSS_CORELL_IsStatusStillCoherent(const t_eFSS_CORELL_Ctx* p_ptCtx);
-static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractData(const t_eFSS_CORELL_StorBufPrv* p_ptBuff,
+static e_eFSS_CORELL_RES eFSS_CORELL_IsPageBlank(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                                 const t_eFSS_CORELL_StorBufPrv* p_ptBuff, bool_t* const p_pbIsBlank);
+static e_eFSS_CORELL_RES eFSS_CORELL_StreamPage(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                               const uint8_t p_uCheck, const uint32_t p_uCheckL,
+                                               bool_t* const p_pbIsOk, uint32_t* const p_puCrc);
+static e_eFSS_CORELL_RES eFSS_CORELL_AddCrcRange(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                                 const t_eFSS_CORELL_StorBufPrv* p_ptBuff, const uint32_t p_uOffset,
+                                                 const uint32_t p_uLen, uint32_t* const p_puCrc);
+static e_eFSS_CORELL_RES eFSS_CORELL_RewriteBlk(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                                const t_eFSS_CORELL_StorBufPrv* p_ptBuff);
+static e_eFSS_CORELL_RES eFSS_CORELL_CopyBlk(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uFromIndx,
+                                             const uint32_t p_uToIndx, const uint32_t p_uSkipOff,
+                                             const t_eFSS_CORELL_StorBufPrv* p_ptBuff);
+static e_eFSS_CORELL_RES eFSS_CORELL_WriteBlkMark(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uBlkIndx,
+                                                  const uint32_t p_uSkipOff, const t_eFSS_CORELL_StorBufPrv* p_ptBuff);
+static e_eFSS_CORELL_RES eFSS_CORELL_IsBlkMark(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uSkipOff,
+                                               const t_eFSS_CORELL_StorBufPrv* p_ptBuff, uint32_t* const p_puBlkIndx,
+                                               bool_t* const p_pbIsMark);
+static e_eFSS_CORELL_RES eFSS_CORELL_RecoverBlk(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                                t_eFSS_CORELL_StorBufPrv* const p_ptBuff);
+static e_eFSS_CORELL_RES eFSS_CORELL_EraseSpare(t_eFSS_CORELL_Ctx* const p_ptCtx);
+static e_eFSS_CORELL_RES eFSS_CORELL_CopyPage(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uFromIndx,
+                                              const uint32_t p_uToIndx, const t_eFSS_CORELL_StorBufPrv* p_ptBuff);
+static t_eFSS_CORELL_ErsBlk* eFSS_CORELL_GetErsBlk(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx);
+static void eFSS_CORELL_ForgetErsBlk(t_eFSS_CORELL_Ctx* const p_ptCtx);
+static bool_t eFSS_CORELL_ProgPage(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                   const t_eFSS_CORELL_StorBufPrv* p_ptMainBuf,
+                                   const t_eFSS_CORELL_StorBufPrv* p_ptBkpBuf);
+static uint32_t eFSS_CORELL_GetUsedSlot(const t_eFSS_TYPE_StorSet* p_ptStorSet, const uint8_t* p_puSlot);
+static bool_t eFSS_CORELL_IsSlotFree(const t_eFSS_TYPE_StorSet* p_ptStorSet, const uint8_t* p_puSlot);
+static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractData(const t_eFSS_TYPE_StorSet* p_ptStorSet,
+                                                    const t_eFSS_CORELL_StorBufPrv* p_ptBuff,
                                                     t_eFSS_CORELLPRV_PrvMeta* const p_ptPar);
-static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertData(t_eFSS_CORELL_StorBufPrv* const p_ptBuff,
+static bool_t eFSS_CORELL_IsTrailUsable(const t_eFSS_TYPE_StorSet* p_ptStorSet, const uint8_t p_uStorType);
+static bool_t eFSS_CORELL_IsBlkUsable(const t_eFSS_TYPE_StorSet* p_ptStorSet, const bool_t p_bSingleBuf);
+static uint32_t eFSS_CORELL_GetMetaL(const t_eFSS_TYPE_StorSet* p_ptStorSet);
+static uint32_t eFSS_CORELL_GetCrcL(const t_eFSS_TYPE_StorSet* p_ptStorSet);
+static uint32_t eFSS_CORELL_GetCrcSeed(const t_eFSS_TYPE_StorSet* p_ptStorSet);
+static uint32_t eFSS_CORELL_GetCrcToStore(const t_eFSS_TYPE_StorSet* p_ptStorSet, const uint32_t p_uCrc);
+static bool_t eFSS_CORELL_CbErase(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx);
+static bool_t eFSS_CORELL_CbWrite(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                  const uint8_t* p_puData, const uint32_t p_uDataL);
+static bool_t eFSS_CORELL_CbRead(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                 uint8_t* const p_puData, const uint32_t p_uDataL);
+static bool_t eFSS_CORELL_CbWriteRange(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                       const uint32_t p_uOffset, const uint8_t* p_puData, const uint32_t p_uDataL);
+static bool_t eFSS_CORELL_CbReadRange(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                      const uint32_t p_uOffset, uint8_t* const p_puData, const uint32_t p_uDataL);
+static bool_t eFSS_CORELL_CbCrc32(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uSeed, const uint8_t* p_puData,
+                                  const uint32_t p_uDataL, uint32_t* const p_puCrc);
+static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertData(const t_eFSS_TYPE_StorSet* p_ptStorSet,
+                                                   t_eFSS_CORELL_StorBufPrv* const p_ptBuff,
                                                    const t_eFSS_CORELLPRV_PrvMeta* p_ptPar);
+static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractDataC(const t_eFSS_TYPE_StorSet* p_ptStorSet,
+                                                     const t_eFSS_CORELL_StorBufPrv* p_ptBuff,
+                                                     t_eFSS_CORELLPRV_PrvMeta* const p_ptPar);
+static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertDataC(const t_eFSS_TYPE_StorSet* p_ptStorSet,
+                                                    t_eFSS_CORELL_StorBufPrv* const p_ptBuff,
+                                                    const t_eFSS_CORELLPRV_PrvMeta* p_ptPar);
 
 
 
@@ -84,14 +170,21 @@ e_eFSS_CORELL_RES eFSS_CORELL_InitCtx(t_eFSS_CORELL_Ctx* const p_ptCtx, const t_
         if( ( NULL == p_tCtxCb.ptCtxErase ) || ( NULL == p_tCtxCb.fErase ) ||
             ( NULL == p_tCtxCb.ptCtxWrite ) || ( NULL == p_tCtxCb.fWrite ) ||
             ( NULL == p_tCtxCb.ptCtxRead  ) || ( NULL == p_tCtxCb.fRead  ) ||
-            ( NULL == p_tCtxCb.ptCtxCrc32 ) || ( NULL == p_tCtxCb.fCrc32 ) )
+            ( NULL == p_tCtxCb.ptCtxCrc32 ) || ( NULL == p_tCtxCb.fCrc32 ) ||
+            ( ( NULL != p_tCtxCb.fIsErased ) && ( NULL == p_tCtxCb.ptCtxIsErased ) ) ||
+            ( ( NULL != p_tCtxCb.fReadRange ) && ( NULL == p_tCtxCb.ptCtxReadRange ) ) ||
+            ( ( NULL != p_tCtxCb.fWriteRange ) && ( NULL == p_tCtxCb.ptCtxWriteRange ) ) ||
+            ( ( NULL != p_tCtxCb.fTime ) && ( NULL == p_tCtxCb.ptCtxTime ) ) )
         {
             l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
         }
         else
         {
-            /* Check data validity */
-            if( p_uBuffL != ( 2u * p_tStorSet.uPagesLen ) )
+            /* Check data validity: two page buffer, or one page buffer plus a scratch area big enough to hold the
+               private metadata when the ranged read callback can stream the page in it */
+            if( ( p_uBuffL != ( 2u * p_tStorSet.uPagesLen ) ) &&
+                ( ( NULL == p_tCtxCb.fReadRange ) || ( p_uBuffL > ( 2u * p_tStorSet.uPagesLen ) ) ||
+                  ( p_uBuffL <= ( p_tStorSet.uPagesLen + eFSS_CORELL_GetMetaL(&p_tStorSet) ) ) ) )
             {
                 l_eRes = e_eFSS_CORELL_RES_BADPARAM;
             }
@@ -104,8 +197,12 @@ e_eFSS_CORELL_RES eFSS_CORELL_InitCtx(t_eFSS_CORELL_Ctx* const p_ptCtx, const t_
                 }
                 else
                 {
-                    /* Check data validity */
-                    if( p_tStorSet.uPagesLen <= EFSS_CORELL_PAGEMIN_L )
+                    /* Check data validity, the page must hold the chosen private metadata and the area whole
+                       erase blocks */
+                    if( ( p_tStorSet.uPagesLen <= eFSS_CORELL_GetMetaL(&p_tStorSet) ) ||
+                        ( false == eFSS_CORELL_IsTrailUsable(&p_tStorSet, p_uStorType) ) ||
+                        ( false == eFSS_CORELL_IsBlkUsable(&p_tStorSet,
+                                                           ( p_uBuffL != ( 2u * p_tStorSet.uPagesLen ) ) ) ) )
                     {
                         l_eRes = e_eFSS_CORELL_RES_BADPARAM;
                     }
@@ -123,10 +220,18 @@ e_eFSS_CORELL_RES eFSS_CORELL_InitCtx(t_eFSS_CORELL_Ctx* const p_ptCtx, const t_
                             p_ptCtx->tCtxCb 	= p_tCtxCb;
                             p_ptCtx->tStorSett 	= p_tStorSet;
                             p_ptCtx->uStorType  = p_uStorType;
+                            p_ptCtx->bSingleBuf = ( p_uBuffL != ( 2u * p_tStorSet.uPagesLen ) );
+                            p_ptCtx->bBlkChecked = false;
+                            eFSS_CORELL_ForgetErsBlk(p_ptCtx);
                             p_ptCtx->tBuff1.puBuf = p_puBuff;
-                            p_ptCtx->tBuff1.uBufL = p_uBuffL / 2u;
+                            p_ptCtx->tBuff1.uBufL = p_tStorSet.uPagesLen;
                             p_ptCtx->tBuff2.puBuf = &p_puBuff[p_ptCtx->tBuff1.uBufL];
-                            p_ptCtx->tBuff2.uBufL = p_ptCtx->tBuff1.uBufL;
+                            p_ptCtx->tBuff2.uBufL = p_uBuffL - p_tStorSet.uPagesLen;
+                            p_ptCtx->tBuff1.bCrcOk = false;
+                            p_ptCtx->tBuff1.bCrcUpd = false;
+                            p_ptCtx->tBuff2.bCrcOk = false;
+                            p_ptCtx->tBuff2.bCrcUpd = false;
+                            (void)memset(&p_ptCtx->tStats, 0, sizeof(t_eFSS_TYPE_Stats));
 
                             /* All OK */
                             l_eRes = e_eFSS_CORELL_RES_OK;
@@ -225,10 +330,10 @@ e_eFSS_CORELL_RES eFSS_CORELL_GetBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, t_eFSS_C
                 /* Return the usable buffer to the upper layer */
                 /* Remeber that we don't return the whole buffer because some private metadata are managerd here */
                 p_ptBuff1->puBuf = p_ptCtx->tBuff1.puBuf;
-                p_ptBuff1->uBufL = p_ptCtx->tBuff1.uBufL - EFSS_CORELL_PAGEMIN_L;
+                p_ptBuff1->uBufL = p_ptCtx->tBuff1.uBufL - eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett);
 
                 p_ptBuff2->puBuf = p_ptCtx->tBuff2.puBuf;
-                p_ptBuff2->uBufL = p_ptCtx->tBuff2.uBufL - EFSS_CORELL_PAGEMIN_L;
+                p_ptBuff2->uBufL = p_ptCtx->tBuff2.uBufL - eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett);
 
                 l_eRes = e_eFSS_CORELL_RES_OK;
             }
@@ -269,10 +374,10 @@ e_eFSS_CORELL_RES eFSS_CORELL_GetBuffNStor(t_eFSS_CORELL_Ctx* const p_ptCtx, t_e
                 /* Return the usable buffer to the upper layer */
                 /* Remeber that we don't return the whole buffer because some private metadata are managerd here */
                 p_ptBuff1->puBuf = p_ptCtx->tBuff1.puBuf;
-                p_ptBuff1->uBufL = p_ptCtx->tBuff1.uBufL - EFSS_CORELL_PAGEMIN_L;
+                p_ptBuff1->uBufL = p_ptCtx->tBuff1.uBufL - eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett);
 
                 p_ptBuff2->puBuf = p_ptCtx->tBuff2.puBuf;
-                p_ptBuff2->uBufL = p_ptCtx->tBuff2.uBufL - EFSS_CORELL_PAGEMIN_L;
+                p_ptBuff2->uBufL = p_ptCtx->tBuff2.uBufL - eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett);
 
                 *p_ptStorSet = p_ptCtx->tStorSett;
 
@@ -340,7 +445,15 @@ e_eFSS_CORELL_RES eFSS_CORELL_LoadPageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, c
                         case e_eFSS_CORELL_BUFFTYPE_2:
                         {
                             l_ptMainBuf = &p_ptCtx->tBuff2;
-                            l_eRes = e_eFSS_CORELL_RES_OK;
+                            /* In single buffer mode the second buffer is only a scratch area */
+                            if( true == p_ptCtx->bSingleBuf )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_OK;
+                            }
                             break;
                         }
 
@@ -352,19 +465,26 @@ e_eFSS_CORELL_RES eFSS_CORELL_LoadPageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, c
                         }
                     }
 
+                    /* The buffer is going to be overwritten, use it to complete an interrupted block rewrite */
+                    if( e_eFSS_CORELL_RES_OK == l_eRes )
+                    {
+                        l_eRes = eFSS_CORELL_RecoverBlk(p_ptCtx, l_ptMainBuf);
+                    }
+
                     /* Check validity */
                     if( e_eFSS_CORELL_RES_OK == l_eRes )
                     {
                         /* Init var */
                         l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
                         l_uTryPerformed = 0u;
+                        l_ptMainBuf->bCrcOk = false;
+                        l_ptMainBuf->bCrcUpd = false;
 
                         /* Read at least uRWERetry times, after that surrend */
                         while( ( e_eFSS_CORELL_RES_OK != l_eRes ) &&
                                ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) )
                         {
-                            l_bCbRes = (*(p_ptCtx->tCtxCb.fRead))(p_ptCtx->tCtxCb.ptCtxRead, p_uPageIndx,
-                                                                  l_ptMainBuf->puBuf, l_ptMainBuf->uBufL);
+                            l_bCbRes = eFSS_CORELL_CbRead(p_ptCtx, p_uPageIndx, l_ptMainBuf->puBuf, l_ptMainBuf->uBufL);
                             l_uTryPerformed++;
 
                             if( false == l_bCbRes )
@@ -377,10 +497,13 @@ e_eFSS_CORELL_RES eFSS_CORELL_LoadPageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, c
                             }
                         }
 
+                        /* Every try after the first one is a retry */
+                        p_ptCtx->tStats.uRetryCnt += ( l_uTryPerformed - 1u );
+
                         if( e_eFSS_CORELL_RES_OK == l_eRes )
                         {
                             /* Page readed, extract metadata and check validity */
-                            l_eRes = eFSS_CORELLPRV_ExtractData(l_ptMainBuf, &l_tPrvMeta);
+                            l_eRes = eFSS_CORELLPRV_ExtractData(&p_ptCtx->tStorSett, l_ptMainBuf, &l_tPrvMeta);
 
                             if( e_eFSS_CORELL_RES_OK == l_eRes )
                             {
@@ -388,12 +511,12 @@ e_eFSS_CORELL_RES eFSS_CORELL_LoadPageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, c
                                 /* Init var */
                                 l_uPageCrcCalc = 0u;
 
-                                if( l_ptMainBuf->uBufL > EFSS_CORELL_PAGEMIN_L )
+                                if( l_ptMainBuf->uBufL > eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett) )
                                 {
-                                    l_uBuffCrcLen = ( l_ptMainBuf->uBufL - EFSS_CORELL_CRC_L );
-                                    l_bCbRes = (*(p_ptCtx->tCtxCb.fCrc32))(p_ptCtx->tCtxCb.ptCtxCrc32, MAX_UINT32VAL,
-                                                                          l_ptMainBuf->puBuf, l_uBuffCrcLen,
-                                                                          &l_uPageCrcCalc );
+                                    l_uBuffCrcLen = ( l_ptMainBuf->uBufL - eFSS_CORELL_GetCrcL(&p_ptCtx->tStorSett) );
+                                    l_bCbRes = eFSS_CORELL_CbCrc32(p_ptCtx, eFSS_CORELL_GetCrcSeed(&p_ptCtx->tStorSett),
+                                                                   l_ptMainBuf->puBuf, l_uBuffCrcLen,
+                                                                   &l_uPageCrcCalc );
 
                                     if( true != l_bCbRes )
                                     {
@@ -409,13 +532,17 @@ e_eFSS_CORELL_RES eFSS_CORELL_LoadPageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, c
                                 if( e_eFSS_CORELL_RES_OK == l_eRes )
                                 {
                                     /* calculated CRC must be equals to the stored CRC */
-                                    if( l_uPageCrcCalc != l_tPrvMeta.uPageCrc )
+                                    if( eFSS_CORELL_GetCrcToStore(&p_ptCtx->tStorSett, l_uPageCrcCalc) !=
+                                        l_tPrvMeta.uPageCrc )
                                     {
                                         l_eRes = e_eFSS_CORELL_RES_NOTVALIDPAGE;
                                     }
                                     else
                                     {
-                                        /* Crc is correct, page validity is cofirmed. Check others metadata in order
+                                        /* Crc is correct, it can be updated from now on */
+                                        l_ptMainBuf->bCrcOk = true;
+
+                                        /* Page validity is cofirmed. Check others metadata in order
                                            to be sure that the previously saved page is related to this subtype */
                                         if( ( EFSS_CORELL_PAGEMAGNUM          != l_tPrvMeta.uPageMagicNumber ) ||
                                             ( p_ptCtx->tStorSett.uTotPages    != l_tPrvMeta.uPageTot ) ||
@@ -446,6 +573,158 @@ e_eFSS_CORELL_RES eFSS_CORELL_LoadPageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, c
 	return l_eRes;
 }
 
+e_eFSS_CORELL_RES eFSS_CORELL_ProbePageInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                              const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uPageIndx,
+                                              const uint32_t p_uUsrTrailL)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+    bool_t l_bCbRes;
+
+    /* Local var used for storage */
+    t_eFSS_CORELL_StorBufPrv* l_ptMainBuf;
+    t_eFSS_CORELLPRV_PrvMeta l_tPrvMeta;
+
+    /* Local var used for calculation */
+    uint32_t l_uTryPerformed;
+    uint32_t l_uProbeOff;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eFSS_CORELL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eFSS_CORELL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check parameter validity */
+                if( ( p_uPageIndx >= p_ptCtx->tStorSett.uTotPages ) ||
+                    ( p_uUsrTrailL > ( p_ptCtx->tStorSett.uPagesLen - eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett) ) ) )
+                {
+                    l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                }
+                else if( NULL == p_ptCtx->tCtxCb.fReadRange )
+                {
+                    /* No way to read only the trailer, load and verify the whole page */
+                    l_eRes = eFSS_CORELL_LoadPageInBuff(p_ptCtx, p_eBuffType, p_uPageIndx);
+                }
+                else
+                {
+                    switch(p_eBuffType)
+                    {
+                        case e_eFSS_CORELL_BUFFTYPE_1:
+                        {
+                            l_ptMainBuf = &p_ptCtx->tBuff1;
+                            l_eRes = e_eFSS_CORELL_RES_OK;
+                            break;
+                        }
+
+                        case e_eFSS_CORELL_BUFFTYPE_2:
+                        {
+                            l_ptMainBuf = &p_ptCtx->tBuff2;
+                            /* In single buffer mode the second buffer is only a scratch area */
+                            if( true == p_ptCtx->bSingleBuf )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_OK;
+                            }
+                            break;
+                        }
+
+                        default:
+                        {
+                            l_ptMainBuf = &p_ptCtx->tBuff2;
+                            l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                            break;
+                        }
+                    }
+
+                    /* The buffer is going to be overwritten, use it to complete an interrupted block rewrite */
+                    if( e_eFSS_CORELL_RES_OK == l_eRes )
+                    {
+                        l_eRes = eFSS_CORELL_RecoverBlk(p_ptCtx, l_ptMainBuf);
+                    }
+
+                    /* Check validity */
+                    if( e_eFSS_CORELL_RES_OK == l_eRes )
+                    {
+                        /* Init var */
+                        l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+                        l_uTryPerformed = 0u;
+                        l_uProbeOff = l_ptMainBuf->uBufL - eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett) - p_uUsrTrailL;
+                        l_ptMainBuf->bCrcOk = false;
+                        l_ptMainBuf->bCrcUpd = false;
+
+                        /* Read only the trailer, at least uRWERetry times, after that surrend */
+                        while( ( e_eFSS_CORELL_RES_OK != l_eRes ) &&
+                               ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) )
+                        {
+                            l_bCbRes = eFSS_CORELL_CbReadRange(p_ptCtx, p_uPageIndx, l_uProbeOff,
+                                                               &l_ptMainBuf->puBuf[l_uProbeOff],
+                                                               ( eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett) +
+                                                                 p_uUsrTrailL ) );
+                            l_uTryPerformed++;
+
+                            if( false == l_bCbRes )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+                            }
+                            else
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_OK;
+                            }
+                        }
+
+                        p_ptCtx->tStats.uRetryCnt += ( l_uTryPerformed - 1u );
+
+                        if( e_eFSS_CORELL_RES_OK == l_eRes )
+                        {
+                            /* Trailer readed, the CRC cannot be verified, check only the others metadata */
+                            l_eRes = eFSS_CORELLPRV_ExtractData(&p_ptCtx->tStorSett, l_ptMainBuf, &l_tPrvMeta);
+
+                            if( e_eFSS_CORELL_RES_OK == l_eRes )
+                            {
+                                if( ( EFSS_CORELL_PAGEMAGNUM          != l_tPrvMeta.uPageMagicNumber ) ||
+                                    ( p_ptCtx->tStorSett.uTotPages    != l_tPrvMeta.uPageTot ) ||
+                                    ( p_ptCtx->uStorType              != l_tPrvMeta.uPageType ) ||
+                                    ( p_uPageIndx                     != l_tPrvMeta.uPageIndx ) )
+                                {
+                                    l_eRes = e_eFSS_CORELL_RES_NOTVALIDPAGE;
+                                }
+                                else
+                                {
+                                    if( p_ptCtx->tStorSett.uPageVersion != l_tPrvMeta.uPageVersion )
+                                    {
+                                        l_eRes = e_eFSS_CORELL_RES_NEWVERSIONFOUND;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
 e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
 								              const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uPageIndx)
 {
@@ -455,13 +734,22 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
 
     /* Local var used for storage */
     t_eFSS_CORELL_StorBufPrv* l_ptMainBuf;
-    const t_eFSS_CORELL_StorBufPrv* l_ptBkpBuf;
+    t_eFSS_CORELL_StorBufPrv* l_ptBkpBuf;
     t_eFSS_CORELLPRV_PrvMeta l_tPrvMeta;
 
     /* Local var used for calculation */
     uint32_t l_uTryPerformed;
     uint32_t l_uPageCrcCalc;
     uint32_t l_uBuffCrcLen;
+    uint32_t l_uMetaOff;
+    uint32_t l_uMetaL;
+    bool_t l_bCrcUpd;
+    bool_t l_bSkipErase;
+    bool_t l_bIsEqual;
+    bool_t l_bBlkFail;
+    bool_t l_bIsErased;
+    bool_t l_bIsProg;
+    t_eFSS_CORELL_ErsBlk* l_ptErsBlk;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -505,7 +793,15 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
                         {
                             l_ptMainBuf = &p_ptCtx->tBuff2;
                             l_ptBkpBuf  = &p_ptCtx->tBuff1;
-                            l_eRes = e_eFSS_CORELL_RES_OK;
+                            /* In single buffer mode the second buffer is only a scratch area */
+                            if( true == p_ptCtx->bSingleBuf )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_OK;
+                            }
                             break;
                         }
 
@@ -518,6 +814,42 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
                         }
                     }
 
+                    /* The other buffer is going to be overwritten, use it to complete an interrupted block rewrite */
+                    if( e_eFSS_CORELL_RES_OK == l_eRes )
+                    {
+                        l_eRes = eFSS_CORELL_RecoverBlk(p_ptCtx, l_ptBkpBuf);
+                    }
+
+                    /* Check validity */
+                    if( e_eFSS_CORELL_RES_OK == l_eRes )
+                    {
+                        /* The other buffer is used to check the page, what it holds will be overwritten */
+                        l_ptBkpBuf->bCrcOk = false;
+                        l_ptBkpBuf->bCrcUpd = false;
+
+                        /* If every change was added to the stored CRC there is no need to calculate it again */
+                        l_bCrcUpd = ( ( true == l_ptMainBuf->bCrcOk ) && ( true == l_ptMainBuf->bCrcUpd ) );
+                        l_ptMainBuf->bCrcOk = false;
+                        l_ptMainBuf->bCrcUpd = false;
+                        l_uPageCrcCalc = 0u;
+                        l_uMetaL = eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett);
+                        l_uMetaOff = l_ptMainBuf->uBufL - l_uMetaL;
+
+                        if( true == l_bCrcUpd )
+                        {
+                            /* Remove the old metadata from the stored CRC */
+                            l_eRes = eFSS_CORELLPRV_ExtractData(&p_ptCtx->tStorSett, l_ptMainBuf, &l_tPrvMeta);
+
+                            if( e_eFSS_CORELL_RES_OK == l_eRes )
+                            {
+                                l_uPageCrcCalc = l_tPrvMeta.uPageCrc;
+                                l_eRes = eFSS_CORELL_AddCrcRange(p_ptCtx, l_ptMainBuf, l_uMetaOff,
+                                                                 ( l_uMetaL - EFSS_CORELL_CRC_L ),
+                                                                 &l_uPageCrcCalc);
+                            }
+                        }
+                    }
+
                     /* Check validity */
                     if( e_eFSS_CORELL_RES_OK == l_eRes )
                     {
@@ -530,20 +862,22 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
                         l_tPrvMeta.uPageCrc = 0u;
 
                         /* Insert requested data, even if CRC is still not calculated */
-                        l_eRes = eFSS_CORELLPRV_InsertData(l_ptMainBuf, &l_tPrvMeta);
+                        l_eRes = eFSS_CORELLPRV_InsertData(&p_ptCtx->tStorSett, l_ptMainBuf, &l_tPrvMeta);
 
                         if( e_eFSS_CORELL_RES_OK == l_eRes )
                         {
-                            /* Init var */
-                            l_uPageCrcCalc = 0u;
-
-                            /* Calculate CRC */
-                            if( l_ptMainBuf->uBufL > EFSS_CORELL_PAGEMIN_L )
+                            /* Calculate CRC, or add the new metadata to the updated one */
+                            if( true == l_bCrcUpd )
+                            {
+                                l_eRes = eFSS_CORELL_AddCrcRange(p_ptCtx, l_ptMainBuf, l_uMetaOff,
+                                                                 ( l_uMetaL - EFSS_CORELL_CRC_L ),
+                                                                 &l_uPageCrcCalc);
+                            }
+                            else if( l_ptMainBuf->uBufL > l_uMetaL )
                             {
-                                l_uBuffCrcLen = ( l_ptMainBuf->uBufL - EFSS_CORELL_CRC_L );
-                                l_bCbRes = (*(p_ptCtx->tCtxCb.fCrc32))(p_ptCtx->tCtxCb.ptCtxCrc32, MAX_UINT32VAL,
-                                                                       l_ptMainBuf->puBuf, l_uBuffCrcLen,
-                                                                       &l_uPageCrcCalc );
+                                l_uBuffCrcLen = ( l_ptMainBuf->uBufL - eFSS_CORELL_GetCrcL(&p_ptCtx->tStorSett) );
+                                l_bCbRes = eFSS_CORELL_CbCrc32(p_ptCtx, eFSS_CORELL_GetCrcSeed(&p_ptCtx->tStorSett),
+                                                               l_ptMainBuf->puBuf, l_uBuffCrcLen, &l_uPageCrcCalc );
 
                                 if( true != l_bCbRes )
                                 {
@@ -560,37 +894,77 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
                             {
                                 /* Insert Crc data in to the metadata, and insert metadata in to the buffer to flush */
                                 l_tPrvMeta.uPageCrc = l_uPageCrcCalc;
-                                l_eRes = eFSS_CORELLPRV_InsertData(l_ptMainBuf, &l_tPrvMeta);
+                                l_eRes = eFSS_CORELLPRV_InsertData(&p_ptCtx->tStorSett, l_ptMainBuf, &l_tPrvMeta);
 
                                 if( e_eFSS_CORELL_RES_OK == l_eRes )
                                 {
+                                    /* The stored CRC match the buffer again */
+                                    l_ptMainBuf->bCrcOk = true;
+
                                     /* Now that we have the buffer ready we need to: erase, write, and check the
                                        storage area indicated by the index */
                                     /* Init var */
                                     l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
                                     l_uTryPerformed = 0u;
+                                    l_bBlkFail = false;
+
+                                    /* A page of an erased block not yet flushed since the erase is still blank */
+                                    l_ptErsBlk = eFSS_CORELL_GetErsBlk(p_ptCtx, p_uPageIndx);
+                                    l_bIsErased = ( ( NULL != l_ptErsBlk ) &&
+                                                    ( p_uPageIndx >= l_ptErsBlk->uNextPage ) );
+
+                                    /* With the programmable trailer try to write the page in place first */
+                                    l_bIsProg = false;
+                                    if( ( e_eFSS_TYPE_TRAIL_PROG == p_ptCtx->tStorSett.eTrailer ) &&
+                                        ( NULL != p_ptCtx->tCtxCb.fWriteRange ) &&
+                                        ( false == p_ptCtx->bSingleBuf ) && ( false == l_bIsErased ) )
+                                    {
+                                        l_bIsProg = eFSS_CORELL_ProgPage(p_ptCtx, p_uPageIndx, l_ptMainBuf,
+                                                                         l_ptBkpBuf);
+
+                                        if( true == l_bIsProg )
+                                        {
+                                            l_eRes = e_eFSS_CORELL_RES_OK;
+                                        }
+                                    }
 
                                     while( ( e_eFSS_CORELL_RES_OK != l_eRes ) &&
-                                           ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) )
+                                           ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) &&
+                                           ( false == l_bBlkFail ) )
                                     {
-                                        /* Erase */
-                                        l_bCbRes = (*(p_ptCtx->tCtxCb.fErase))(p_ptCtx->tCtxCb.ptCtxErase, p_uPageIndx);
+                                        /* Blank check, only before the first try: a failed try could have
+                                           left the page programmed only partially. A page that cannot be
+                                           erased alone is always checked */
+                                        l_bSkipErase = false;
+                                        l_eRes = e_eFSS_CORELL_RES_OK;
 
-                                        if( true == l_bCbRes )
+                                        if( ( 0u == l_uTryPerformed ) && ( true == l_bIsErased ) )
                                         {
-                                            l_eRes = e_eFSS_CORELL_RES_OK;
+                                            /* Erased in this write series, no need to read it */
+                                            l_bSkipErase = true;
                                         }
-                                        else
+                                        else if( ( 0u == l_uTryPerformed ) &&
+                                                 ( ( true == p_ptCtx->tStorSett.bBlankCheck ) ||
+                                                   ( p_ptCtx->tStorSett.uPagesPerBlk > 1u ) ) )
                                         {
-                                            l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
+                                            l_eRes = eFSS_CORELL_IsPageBlank(p_ptCtx, p_uPageIndx, l_ptBkpBuf,
+                                                                             &l_bSkipErase);
                                         }
 
-                                        if( e_eFSS_CORELL_RES_OK == l_eRes )
+                                        if( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( false == l_bSkipErase ) &&
+                                            ( p_ptCtx->tStorSett.uPagesPerBlk > 1u ) )
                                         {
-                                            /* Write */
-                                            l_bCbRes = (*(p_ptCtx->tCtxCb.fWrite))(p_ptCtx->tCtxCb.ptCtxWrite,
-                                                                                   p_uPageIndx, l_ptMainBuf->puBuf,
-                                                                                   l_ptMainBuf->uBufL);
+                                            /* The page cannot be erased alone, rewrite the other pages of its
+                                               block. Every step of the rewrite is already retried, and after a
+                                               failure the spare block could hold the only copy of those pages, so
+                                               no other try is done */
+                                            l_eRes = eFSS_CORELL_RewriteBlk(p_ptCtx, p_uPageIndx, l_ptBkpBuf);
+                                            l_bBlkFail = ( e_eFSS_CORELL_RES_OK != l_eRes );
+                                        }
+                                        else if( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( false == l_bSkipErase ) )
+                                        {
+                                            /* Erase */
+                                            l_bCbRes = eFSS_CORELL_CbErase(p_ptCtx, p_uPageIndx);
 
                                             if( true == l_bCbRes )
                                             {
@@ -598,16 +972,19 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
                                             }
                                             else
                                             {
-                                                l_eRes = e_eFSS_CORELL_RES_CLBCKWRITEERR;
+                                                l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
                                             }
                                         }
+                                        else
+                                        {
+                                            /* Nothing to erase */
+                                        }
 
                                         if( e_eFSS_CORELL_RES_OK == l_eRes )
                                         {
-                                            /* Read */
-                                            l_bCbRes = (*(p_ptCtx->tCtxCb.fRead))(p_ptCtx->tCtxCb.ptCtxRead,
-                                                                                  p_uPageIndx, l_ptBkpBuf->puBuf,
-                                                                                  l_ptBkpBuf->uBufL);
+                                            /* Write */
+                                            l_bCbRes = eFSS_CORELL_CbWrite(p_ptCtx, p_uPageIndx, l_ptMainBuf->puBuf,
+                                                                           l_ptMainBuf->uBufL);
 
                                             if( true == l_bCbRes )
                                             {
@@ -615,25 +992,84 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
                                             }
                                             else
                                             {
-                                                l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+                                                l_eRes = e_eFSS_CORELL_RES_CLBCKWRITEERR;
                                             }
                                         }
 
-                                        if( e_eFSS_CORELL_RES_OK == l_eRes )
+                                        if( ( e_eFSS_CORELL_RES_OK == l_eRes ) &&
+                                            ( true == p_ptCtx->bSingleBuf ) )
                                         {
-                                            /* Compare buffer to write with the readed one */
-                                            if( 0 == memcmp(l_ptMainBuf->puBuf, l_ptBkpBuf->puBuf, l_ptMainBuf->uBufL) )
+                                            /* Stream the page back and compare it with the buffer to write */
+                                            l_eRes = eFSS_CORELL_StreamPage(p_ptCtx, p_uPageIndx,
+                                                                            EFSS_CORELL_STREAM_EQUAL,
+                                                                            l_ptMainBuf->uBufL, &l_bIsEqual, NULL);
+
+                                            if( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( true != l_bIsEqual ) )
                                             {
-                                                l_eRes = e_eFSS_CORELL_RES_OK;
+                                                l_eRes = e_eFSS_CORELL_RES_WRITENOMATCHREAD;
                                             }
-                                            else
+                                        }
+                                        else
+                                        {
+                                            if( e_eFSS_CORELL_RES_OK == l_eRes )
                                             {
-                                                l_eRes = e_eFSS_CORELL_RES_WRITENOMATCHREAD;
+                                                /* Read */
+                                                l_bCbRes = eFSS_CORELL_CbRead(p_ptCtx, p_uPageIndx, l_ptBkpBuf->puBuf,
+                                                                              l_ptBkpBuf->uBufL);
+
+                                                if( true == l_bCbRes )
+                                                {
+                                                    l_eRes = e_eFSS_CORELL_RES_OK;
+                                                }
+                                                else
+                                                {
+                                                    l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+                                                }
                                             }
+
+                                            if( e_eFSS_CORELL_RES_OK == l_eRes )
+                                            {
+                                                /* Compare buffer to write with the readed one */
+                                                if( 0 == memcmp(l_ptMainBuf->puBuf, l_ptBkpBuf->puBuf,
+                                                                l_ptMainBuf->uBufL) )
+                                                {
+                                                    l_eRes = e_eFSS_CORELL_RES_OK;
+                                                }
+                                                else
+                                                {
+                                                    l_eRes = e_eFSS_CORELL_RES_WRITENOMATCHREAD;
+                                                }
+                                            }
+                                        }
+
+                                        if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == l_eRes )
+                                        {
+                                            p_ptCtx->tStats.uRbMismatchCnt++;
                                         }
 
                                         l_uTryPerformed++;
                                     }
+
+                                    if( l_uTryPerformed > 0u )
+                                    {
+                                        p_ptCtx->tStats.uRetryCnt += ( l_uTryPerformed - 1u );
+                                    }
+
+                                    /* A page programmed in place does not change the blank pages of its block */
+                                    if( ( NULL != l_ptErsBlk ) && ( false == l_bIsProg ) )
+                                    {
+                                        if( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( true == l_bIsErased ) &&
+                                            ( 1u == l_uTryPerformed ) )
+                                        {
+                                            /* Only the following pages of the block are still blank */
+                                            l_ptErsBlk->uNextPage = p_uPageIndx + 1u;
+                                        }
+                                        else
+                                        {
+                                            /* A retry or a rewrite can have programmed any page of the block */
+                                            l_ptErsBlk->uBlkIndx = p_ptCtx->tStorSett.uTotPages;
+                                        }
+                                    }
                                 }
                             }
                         }
@@ -646,19 +1082,18 @@ e_eFSS_CORELL_RES eFSS_CORELL_FlushBuffInPage(t_eFSS_CORELL_Ctx* const p_ptCtx,
 	return l_eRes;
 }
 
-e_eFSS_CORELL_RES eFSS_CORELL_CalcCrcInBuff(const t_eFSS_CORELL_Ctx* p_ptCtx,
-                                            const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uCrcSeed,
-								            const uint32_t p_uLenCalc, uint32_t* const p_puCrc)
+e_eFSS_CORELL_RES eFSS_CORELL_EraseBlk(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx)
 {
 	/* Return local var */
 	e_eFSS_CORELL_RES l_eRes;
-    bool_t l_bCbRes;
 
     /* Local var used for calculation */
-	const uint8_t* l_puBuff;
+    uint32_t l_uTryPerformed;
+    uint32_t l_uEraseIndx;
+    t_eFSS_CORELL_ErsBlk* l_ptErsBlk;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puCrc ) )
+	if( NULL == p_ptCtx )
 	{
 		l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
 	}
@@ -679,50 +1114,65 @@ e_eFSS_CORELL_RES eFSS_CORELL_CalcCrcInBuff(const t_eFSS_CORELL_Ctx* p_ptCtx,
             else
             {
                 /* Check param validity */
-                if( ( p_uLenCalc <= 0u ) || ( p_uLenCalc > ( p_ptCtx->tStorSett.uPagesLen - EFSS_CORELL_PAGEMIN_L ) ) )
+                if( p_uPageIndx >= p_ptCtx->tStorSett.uTotPages )
                 {
                     l_eRes = e_eFSS_CORELL_RES_BADPARAM;
                 }
                 else
                 {
-                    switch(p_eBuffType)
+                    /* An interrupted block rewrite must be completed first, or it would overwrite the block later */
+                    l_eRes = eFSS_CORELL_RecoverBlk(p_ptCtx, &p_ptCtx->tBuff2);
+                }
+
+                if( e_eFSS_CORELL_RES_OK == l_eRes )
+                {
+                    /* The erase callback receive the first page of the block */
+                    if( p_ptCtx->tStorSett.uPagesPerBlk > 1u )
                     {
-                        case e_eFSS_CORELL_BUFFTYPE_1:
-                        {
-                            l_puBuff = p_ptCtx->tBuff1.puBuf;
-                            l_eRes = e_eFSS_CORELL_RES_OK;
-                            break;
-                        }
+                        l_uEraseIndx = p_uPageIndx - ( p_uPageIndx % p_ptCtx->tStorSett.uPagesPerBlk );
+                    }
+                    else
+                    {
+                        l_uEraseIndx = p_uPageIndx;
+                    }
 
-                        case e_eFSS_CORELL_BUFFTYPE_2:
+                    /* Init var, the block is not known to be blank till the erase succeed */
+                    l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
+                    l_uTryPerformed = 0u;
+                    l_ptErsBlk = eFSS_CORELL_GetErsBlk(p_ptCtx, l_uEraseIndx);
+
+                    if( NULL != l_ptErsBlk )
+                    {
+                        l_ptErsBlk->uBlkIndx = p_ptCtx->tStorSett.uTotPages;
+                    }
+
+                    while( ( e_eFSS_CORELL_RES_OK != l_eRes ) &&
+                           ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) )
+                    {
+                        if( true == eFSS_CORELL_CbErase(p_ptCtx, l_uEraseIndx) )
                         {
-                            l_puBuff = p_ptCtx->tBuff2.puBuf;
                             l_eRes = e_eFSS_CORELL_RES_OK;
-                            break;
                         }
-
-                        default:
+                        else
                         {
-                            l_puBuff = p_ptCtx->tBuff2.puBuf;
-                            l_eRes = e_eFSS_CORELL_RES_BADPARAM;
-                            break;
+                            l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
                         }
+
+                        l_uTryPerformed++;
                     }
 
-                    /* Check validity */
+                    p_ptCtx->tStats.uRetryCnt += ( l_uTryPerformed - 1u );
+
                     if( e_eFSS_CORELL_RES_OK == l_eRes )
                     {
-                        /* Set default value */
-                        *p_puCrc = 0u;
-
-                        /* Calc */
-                        l_bCbRes = (*(p_ptCtx->tCtxCb.fCrc32))(p_ptCtx->tCtxCb.ptCtxCrc32, p_uCrcSeed, l_puBuff,
-                                                               p_uLenCalc, p_puCrc);
-
-                        if( true != l_bCbRes )
+                        /* Remember the block, the oldest one is forgotten */
+                        if( p_ptCtx->tErsBlk1.uBlkIndx < p_ptCtx->tStorSett.uTotPages )
                         {
-                            l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+                            p_ptCtx->tErsBlk2 = p_ptCtx->tErsBlk1;
                         }
+
+                        p_ptCtx->tErsBlk1.uBlkIndx = l_uEraseIndx;
+                        p_ptCtx->tErsBlk1.uNextPage = l_uEraseIndx;
                     }
                 }
             }
@@ -732,75 +1182,1418 @@ e_eFSS_CORELL_RES eFSS_CORELL_CalcCrcInBuff(const t_eFSS_CORELL_Ctx* p_ptCtx,
 	return l_eRes;
 }
 
+e_eFSS_CORELL_RES eFSS_CORELL_CmpPageWithBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                              const uint32_t p_uCmpL, bool_t* const p_pbIsEquals)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var used for storage */
+    t_eFSS_CORELLPRV_PrvMeta l_tPrvMeta;
+
+    /* Local var used for calculation */
+    bool_t l_bIsEqual;
+    uint32_t l_uPageCrcCalc;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsEquals ) )
+	{
+		l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eFSS_CORELL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eFSS_CORELL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check parameter validity */
+                if( ( p_uPageIndx >= p_ptCtx->tStorSett.uTotPages ) || ( p_uCmpL > p_ptCtx->tBuff1.uBufL ) )
+                {
+                    l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                }
+                else
+                {
+                    /* The second buffer is going to be overwritten, use it to complete an interrupted block
+                       rewrite */
+                    l_bIsEqual = false;
+                    l_uPageCrcCalc = 0u;
+                    l_eRes = eFSS_CORELL_RecoverBlk(p_ptCtx, &p_ptCtx->tBuff2);
+
+                    if( e_eFSS_CORELL_RES_OK == l_eRes )
+                    {
+                        /* Stream the page in the second buffer, comparing it and calculating its CRC */
+                        l_eRes = eFSS_CORELL_StreamPage(p_ptCtx, p_uPageIndx, EFSS_CORELL_STREAM_EQUAL, p_uCmpL,
+                                                        &l_bIsEqual, &l_uPageCrcCalc);
+                    }
+
+                    if( e_eFSS_CORELL_RES_OK == l_eRes )
+                    {
+                        /* The trailer is at the end of the second buffer */
+                        l_eRes = eFSS_CORELLPRV_ExtractData(&p_ptCtx->tStorSett, &p_ptCtx->tBuff2, &l_tPrvMeta);
+
+                        if( e_eFSS_CORELL_RES_OK == l_eRes )
+                        {
+                            l_uPageCrcCalc = eFSS_CORELL_GetCrcToStore(&p_ptCtx->tStorSett, l_uPageCrcCalc);
+
+                            if( ( l_uPageCrcCalc                  != l_tPrvMeta.uPageCrc ) ||
+                                ( EFSS_CORELL_PAGEMAGNUM          != l_tPrvMeta.uPageMagicNumber ) ||
+                                ( p_ptCtx->tStorSett.uTotPages    != l_tPrvMeta.uPageTot ) ||
+                                ( p_ptCtx->uStorType              != l_tPrvMeta.uPageType ) ||
+                                ( p_uPageIndx                     != l_tPrvMeta.uPageIndx ) )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_NOTVALIDPAGE;
+                            }
+                            else
+                            {
+                                if( p_ptCtx->tStorSett.uPageVersion != l_tPrvMeta.uPageVersion )
+                                {
+                                    l_eRes = e_eFSS_CORELL_RES_NEWVERSIONFOUND;
+                                }
+                                else
+                                {
+                                    *p_pbIsEquals = l_bIsEqual;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_CORELL_RES eFSS_CORELL_CmpPageCrcWithBuff(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                                 const uint32_t p_uCmpL, bool_t* const p_pbCanBeEquals)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+    bool_t l_bCbRes;
+
+    /* Local var used for storage */
+    t_eFSS_CORELLPRV_PrvMeta l_tPrvMeta;
+
+    /* Local var used for calculation */
+    uint32_t l_uTryPerformed;
+    uint32_t l_uTrailL;
+    uint32_t l_uTrailOff;
+    uint32_t l_uBuffCrc;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_pbCanBeEquals ) )
+	{
+		l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eFSS_CORELL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eFSS_CORELL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check parameter validity */
+                if( ( p_uPageIndx >= p_ptCtx->tStorSett.uTotPages ) || ( p_uCmpL > p_ptCtx->tBuff1.uBufL ) )
+                {
+                    l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Nothing can be excluded till the page is not readed. The second buffer is going to be
+                       overwritten, use it to complete an interrupted block rewrite */
+                    *p_pbCanBeEquals = true;
+                    l_eRes = eFSS_CORELL_RecoverBlk(p_ptCtx, &p_ptCtx->tBuff2);
+                    l_uTrailL = p_ptCtx->tBuff1.uBufL - p_uCmpL;
+
+                    /* Only the not compared part of the page must be readed, and it must hold the private metadata */
+                    if( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( NULL != p_ptCtx->tCtxCb.fReadRange ) &&
+                        ( l_uTrailL >= eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett) ) &&
+                        ( l_uTrailL <= p_ptCtx->tBuff2.uBufL ) )
+                    {
+                        /* CRC of the compared data of the buffer, no need to read them from the page */
+                        l_uBuffCrc = eFSS_CORELL_GetCrcSeed(&p_ptCtx->tStorSett);
+                        l_bCbRes = true;
+
+                        if( p_uCmpL > 0u )
+                        {
+                            l_bCbRes = eFSS_CORELL_CbCrc32(p_ptCtx, l_uBuffCrc, p_ptCtx->tBuff1.puBuf, p_uCmpL,
+                                                           &l_uBuffCrc);
+                        }
+
+                        if( true != l_bCbRes )
+                        {
+                            l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+                        }
+                        else
+                        {
+                            /* Read the rest of the page at the end of the second buffer, like a streamed compare */
+                            l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+                            l_uTryPerformed = 0u;
+                            l_uTrailOff = p_ptCtx->tBuff2.uBufL - l_uTrailL;
+
+                            while( ( e_eFSS_CORELL_RES_OK != l_eRes ) &&
+                                   ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) )
+                            {
+                                l_bCbRes = eFSS_CORELL_CbReadRange(p_ptCtx, p_uPageIndx, p_uCmpL,
+                                                                   &p_ptCtx->tBuff2.puBuf[l_uTrailOff], l_uTrailL);
+                                l_uTryPerformed++;
+
+                                if( false == l_bCbRes )
+                                {
+                                    l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+                                }
+                                else
+                                {
+                                    l_eRes = e_eFSS_CORELL_RES_OK;
+                                }
+                            }
+
+                            p_ptCtx->tStats.uRetryCnt += ( l_uTryPerformed - 1u );
+                        }
+
+                        if( e_eFSS_CORELL_RES_OK == l_eRes )
+                        {
+                            /* Chain the readed part of the page, the stored CRC is excluded */
+                            l_bCbRes = eFSS_CORELL_CbCrc32(p_ptCtx, l_uBuffCrc, &p_ptCtx->tBuff2.puBuf[l_uTrailOff],
+                                                           ( l_uTrailL - eFSS_CORELL_GetCrcL(&p_ptCtx->tStorSett) ),
+                                                           &l_uBuffCrc);
+
+                            if( true != l_bCbRes )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+                            }
+                            else
+                            {
+                                l_eRes = eFSS_CORELLPRV_ExtractData(&p_ptCtx->tStorSett, &p_ptCtx->tBuff2,
+                                                                    &l_tPrvMeta);
+                            }
+                        }
+
+                        if( e_eFSS_CORELL_RES_OK == l_eRes )
+                        {
+                            if( ( EFSS_CORELL_PAGEMAGNUM          != l_tPrvMeta.uPageMagicNumber ) ||
+                                ( p_ptCtx->tStorSett.uTotPages    != l_tPrvMeta.uPageTot ) ||
+                                ( p_ptCtx->uStorType              != l_tPrvMeta.uPageType ) ||
+                                ( p_uPageIndx                     != l_tPrvMeta.uPageIndx ) )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_NOTVALIDPAGE;
+                            }
+                            else if( p_ptCtx->tStorSett.uPageVersion != l_tPrvMeta.uPageVersion )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_NEWVERSIONFOUND;
+                            }
+                            else
+                            {
+                                /* A different CRC means different data, or a corrupted page to rewrite anyway */
+                                l_uBuffCrc = eFSS_CORELL_GetCrcToStore(&p_ptCtx->tStorSett, l_uBuffCrc);
+                                *p_pbCanBeEquals = ( l_uBuffCrc == l_tPrvMeta.uPageCrc );
+                            }
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_CORELL_RES eFSS_CORELL_CalcCrcInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                            const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uCrcSeed,
+								            const uint32_t p_uLenCalc, uint32_t* const p_puCrc)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+    bool_t l_bCbRes;
+
+    /* Local var used for calculation */
+	const uint8_t* l_puBuff;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puCrc ) )
+	{
+		l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eFSS_CORELL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eFSS_CORELL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param validity */
+                if( ( p_uLenCalc <= 0u ) ||
+                    ( p_uLenCalc > ( p_ptCtx->tStorSett.uPagesLen - eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett) ) ) )
+                {
+                    l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                }
+                else
+                {
+                    switch(p_eBuffType)
+                    {
+                        case e_eFSS_CORELL_BUFFTYPE_1:
+                        {
+                            l_puBuff = p_ptCtx->tBuff1.puBuf;
+                            l_eRes = e_eFSS_CORELL_RES_OK;
+                            break;
+                        }
+
+                        case e_eFSS_CORELL_BUFFTYPE_2:
+                        {
+                            l_puBuff = p_ptCtx->tBuff2.puBuf;
+                            /* In single buffer mode the second buffer is only a scratch area */
+                            if( true == p_ptCtx->bSingleBuf )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_OK;
+                            }
+                            break;
+                        }
+
+                        default:
+                        {
+                            l_puBuff = p_ptCtx->tBuff2.puBuf;
+                            l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                            break;
+                        }
+                    }
+
+                    /* Check validity */
+                    if( e_eFSS_CORELL_RES_OK == l_eRes )
+                    {
+                        /* Set default value */
+                        *p_puCrc = 0u;
+
+                        /* Calc */
+                        l_bCbRes = eFSS_CORELL_CbCrc32(p_ptCtx, p_uCrcSeed, l_puBuff, p_uLenCalc, p_puCrc);
+
+                        if( true != l_bCbRes )
+                        {
+                            l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+
+
+e_eFSS_CORELL_RES eFSS_CORELL_UpdCrcInBuff(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                           const e_eFSS_CORELL_BUFFTYPE p_eBuffType, const uint32_t p_uOffset,
+                                           const uint32_t p_uLen, const bool_t p_bArm)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var used for storage */
+    t_eFSS_CORELL_StorBufPrv* l_ptMainBuf;
+
+    /* Local var used for calculation */
+    uint32_t l_uStoredCrc;
+    uint32_t l_uUsrL;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eFSS_CORELL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eFSS_CORELL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Check param validity */
+                l_uUsrL = p_ptCtx->tStorSett.uPagesLen - eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett);
+                if( ( p_uLen <= 0u ) || ( p_uOffset >= l_uUsrL ) || ( p_uLen > ( l_uUsrL - p_uOffset ) ) )
+                {
+                    l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                }
+                else
+                {
+                    switch(p_eBuffType)
+                    {
+                        case e_eFSS_CORELL_BUFFTYPE_1:
+                        {
+                            l_ptMainBuf = &p_ptCtx->tBuff1;
+                            l_eRes = e_eFSS_CORELL_RES_OK;
+                            break;
+                        }
+
+                        case e_eFSS_CORELL_BUFFTYPE_2:
+                        {
+                            l_ptMainBuf = &p_ptCtx->tBuff2;
+                            /* In single buffer mode the second buffer is only a scratch area */
+                            if( true == p_ptCtx->bSingleBuf )
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                l_eRes = e_eFSS_CORELL_RES_OK;
+                            }
+                            break;
+                        }
+
+                        default:
+                        {
+                            l_ptMainBuf = &p_ptCtx->tBuff2;
+                            l_eRes = e_eFSS_CORELL_RES_BADPARAM;
+                            break;
+                        }
+                    }
+
+                    /* Only the built-in CRC has a known polynomial, and only a just loaded or flushed buffer has a
+                       stored CRC that match the data. Otherwise the next flush will simply calculate it again. A
+                       16 bit stored CRC is only a part of the calculated one, it cannot be updated */
+                    if( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( true == l_ptMainBuf->bCrcOk ) &&
+                        ( &eFSS_Utils_Crc32Cb == p_ptCtx->tCtxCb.fCrc32 ) &&
+                        ( EFSS_CORELL_CRC_L == eFSS_CORELL_GetCrcL(&p_ptCtx->tStorSett) ) )
+                    {
+                        l_uStoredCrc = 0u;
+                        if( true != eFSS_Utils_RetriveU32(&l_ptMainBuf->puBuf[l_ptMainBuf->uBufL - EFSS_CORELL_CRC_L],
+                                                          &l_uStoredCrc) )
+                        {
+                            l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+                        }
+                        else
+                        {
+                            l_eRes = eFSS_CORELL_AddCrcRange(p_ptCtx, l_ptMainBuf, p_uOffset, p_uLen, &l_uStoredCrc);
+
+                            if( e_eFSS_CORELL_RES_OK == l_eRes )
+                            {
+                                if( true != eFSS_Utils_InsertU32(
+                                                &l_ptMainBuf->puBuf[l_ptMainBuf->uBufL - EFSS_CORELL_CRC_L],
+                                                l_uStoredCrc) )
+                                {
+                                    l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+                                }
+                            }
+                        }
+
+                        if( e_eFSS_CORELL_RES_OK == l_eRes )
+                        {
+                            if( true == p_bArm )
+                            {
+                                l_ptMainBuf->bCrcUpd = true;
+                            }
+                        }
+                        else
+                        {
+                            /* The stored CRC is lost, the flush will calculate it */
+                            l_ptMainBuf->bCrcOk = false;
+                            l_ptMainBuf->bCrcUpd = false;
+                        }
+                    }
+                }
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_CORELL_RES eFSS_CORELL_GetStats(t_eFSS_CORELL_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptStats ) )
+	{
+		l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eFSS_CORELL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eFSS_CORELL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Copy data */
+                *p_ptStats = p_ptCtx->tStats;
+                l_eRes = e_eFSS_CORELL_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_CORELL_RES eFSS_CORELL_ResetStats(t_eFSS_CORELL_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_CORELL_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+		if( false == p_ptCtx->bIsInit )
+		{
+			l_eRes = e_eFSS_CORELL_RES_NOINITLIB;
+		}
+		else
+		{
+            /* Check internal status validity */
+            if( false == eFSS_CORELL_IsStatusStillCoherent(p_ptCtx) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+            }
+            else
+            {
+                /* Restart every counter from zero */
+                (void)memset(&p_ptCtx->tStats, 0, sizeof(t_eFSS_TYPE_Stats));
+                l_eRes = e_eFSS_CORELL_RES_OK;
+            }
+		}
+	}
+
+	return l_eRes;
+}
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSS_CORELL_IsStatusStillCoherent(const t_eFSS_CORELL_Ctx* p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+
+	/* Check context pointer validity */
+    if( ( NULL == p_ptCtx->tCtxCb.ptCtxErase ) || ( NULL == p_ptCtx->tCtxCb.fErase ) ||
+        ( NULL == p_ptCtx->tCtxCb.ptCtxWrite ) || ( NULL == p_ptCtx->tCtxCb.fWrite ) ||
+        ( NULL == p_ptCtx->tCtxCb.ptCtxRead  ) || ( NULL == p_ptCtx->tCtxCb.fRead  ) ||
+        ( NULL == p_ptCtx->tCtxCb.ptCtxCrc32 ) || ( NULL == p_ptCtx->tCtxCb.fCrc32 ) ||
+        ( ( NULL != p_ptCtx->tCtxCb.fIsErased ) && ( NULL == p_ptCtx->tCtxCb.ptCtxIsErased ) ) ||
+        ( ( NULL != p_ptCtx->tCtxCb.fReadRange ) && ( NULL == p_ptCtx->tCtxCb.ptCtxReadRange ) ) ||
+        ( ( NULL != p_ptCtx->tCtxCb.fWriteRange ) && ( NULL == p_ptCtx->tCtxCb.ptCtxWriteRange ) ) ||
+        ( ( NULL != p_ptCtx->tCtxCb.fTime ) && ( NULL == p_ptCtx->tCtxCb.ptCtxTime ) ) ||
+        ( NULL == p_ptCtx->tBuff1.puBuf )      || ( NULL == p_ptCtx->tBuff2.puBuf )  ||
+        ( p_ptCtx->tBuff2.puBuf == p_ptCtx->tBuff1.puBuf ) )
+    {
+        l_eRes = false;
+    }
+    else
+    {
+        /* Check data validity */
+        if( p_ptCtx->tStorSett.uTotPages <= 0u )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            /* Check data validity */
+            if( ( p_ptCtx->tStorSett.uPagesLen <= eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett) ) ||
+                ( false == eFSS_CORELL_IsTrailUsable(&p_ptCtx->tStorSett, p_ptCtx->uStorType) ) ||
+                ( false == eFSS_CORELL_IsBlkUsable(&p_ptCtx->tStorSett, p_ptCtx->bSingleBuf) ) )
+            {
+                l_eRes = false;
+            }
+            else
+            {
+                /* Check data validity */
+                if( p_ptCtx->tStorSett.uRWERetry <= 0u )
+                {
+                        l_eRes = false;
+                }
+                else
+                {
+                    /* Check data validity */
+                    if( ( ( false == p_ptCtx->bSingleBuf ) && ( p_ptCtx->tBuff1.uBufL != p_ptCtx->tBuff2.uBufL ) ) ||
+                        ( ( true == p_ptCtx->bSingleBuf ) &&
+                          ( ( NULL == p_ptCtx->tCtxCb.fReadRange ) ||
+                            ( p_ptCtx->tBuff2.uBufL >= p_ptCtx->tBuff1.uBufL ) ||
+                            ( p_ptCtx->tBuff2.uBufL <= eFSS_CORELL_GetMetaL(&p_ptCtx->tStorSett) ) ) ) )
+                    {
+                        l_eRes = false;
+                    }
+                    else
+                    {
+                        /* Check data validity */
+                        if( p_ptCtx->tStorSett.uPagesLen != p_ptCtx->tBuff1.uBufL )
+                        {
+                            l_eRes = false;
+                        }
+                        else
+                        {
+                            l_eRes = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_IsPageBlank(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                                 const t_eFSS_CORELL_StorBufPrv* p_ptBuff, bool_t* const p_pbIsBlank)
+{
+    /* Return local var */
+    e_eFSS_CORELL_RES l_eRes;
+    bool_t l_bCbRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uIndex;
+
+    if( NULL != p_ptCtx->tCtxCb.fIsErased )
+    {
+        /* The user knows a faster way to check it, use it */
+        l_bCbRes = (*(p_ptCtx->tCtxCb.fIsErased))(p_ptCtx->tCtxCb.ptCtxIsErased, p_uPageIndx, p_pbIsBlank);
+    }
+    else if( true == p_ptCtx->bSingleBuf )
+    {
+        /* The page does not fit the scratch area, stream it */
+        l_bCbRes = true;
+    }
+    else
+    {
+        /* Read the page and compare every byte with the erased value */
+        l_bCbRes = eFSS_CORELL_CbRead(p_ptCtx, p_uPageIndx, p_ptBuff->puBuf, p_ptBuff->uBufL);
+
+        if( true == l_bCbRes )
+        {
+            *p_pbIsBlank = true;
+            l_uIndex = 0u;
+
+            while( ( true == *p_pbIsBlank ) && ( l_uIndex < p_ptBuff->uBufL ) )
+            {
+                if( p_ptCtx->tStorSett.uErasedVal != p_ptBuff->puBuf[l_uIndex] )
+                {
+                    *p_pbIsBlank = false;
+                }
+
+                l_uIndex++;
+            }
+        }
+    }
+
+    if( true == l_bCbRes )
+    {
+        l_eRes = e_eFSS_CORELL_RES_OK;
+
+        if( ( NULL == p_ptCtx->tCtxCb.fIsErased ) && ( true == p_ptCtx->bSingleBuf ) )
+        {
+            l_eRes = eFSS_CORELL_StreamPage(p_ptCtx, p_uPageIndx, EFSS_CORELL_STREAM_BLANK,
+                                            p_ptCtx->tBuff1.uBufL, p_pbIsBlank, NULL);
+        }
+    }
+    else
+    {
+        l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_AddCrcRange(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                                 const t_eFSS_CORELL_StorBufPrv* p_ptBuff, const uint32_t p_uOffset,
+                                                 const uint32_t p_uLen, uint32_t* const p_puCrc)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+    bool_t l_bCbRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uRangeCrc;
+    uint32_t l_uRangeCont;
+
+    /* The CRC is linear: the data of the range are added to the CRC with a zero seed and then moved after the zero
+       byte that follow them, till the end of the CRC area */
+    l_uRangeCrc = 0u;
+    l_bCbRes = eFSS_CORELL_CbCrc32(p_ptCtx, 0u, &p_ptBuff->puBuf[p_uOffset], p_uLen, &l_uRangeCrc);
+
+    if( true != l_bCbRes )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+    }
+    else
+    {
+        l_uRangeCont = 0u;
+        if( true != eFSS_Utils_Crc32Combine(l_uRangeCrc, 0u,
+                                            ( p_ptBuff->uBufL - eFSS_CORELL_GetCrcL(&p_ptCtx->tStorSett) -
+                                              p_uOffset - p_uLen ),
+                                            &l_uRangeCont) )
+        {
+            l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+        }
+        else
+        {
+            *p_puCrc ^= l_uRangeCont;
+            l_eRes = e_eFSS_CORELL_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_RewriteBlk(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                                const t_eFSS_CORELL_StorBufPrv* p_ptBuff)
+{
+    /* Return local var */
+    e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uBlkIndx;
+    uint32_t l_uSkipOff;
+
+    l_uSkipOff = p_uPageIndx % p_ptCtx->tStorSett.uPagesPerBlk;
+    l_uBlkIndx = p_uPageIndx - l_uSkipOff;
+
+    /* Copy the other pages of the block in the spare block, placed just after the last page, and copy them back
+       once the block is erased. The page to flush is left blank, it will be written by the caller. The free slot
+       of the spare block mark the copy as complete till the pages are copied back, so a power loss during the
+       copy back can be recovered by eFSS_CORELL_RecoverBlk */
+    l_eRes = eFSS_CORELL_CopyBlk(p_ptCtx, l_uBlkIndx, p_ptCtx->tStorSett.uTotPages, l_uSkipOff, p_ptBuff);
+
+    if( e_eFSS_CORELL_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_CORELL_WriteBlkMark(p_ptCtx, l_uBlkIndx, l_uSkipOff, p_ptBuff);
+    }
+
+    if( e_eFSS_CORELL_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_CORELL_CopyBlk(p_ptCtx, p_ptCtx->tStorSett.uTotPages, l_uBlkIndx, l_uSkipOff, p_ptBuff);
+    }
+
+    if( e_eFSS_CORELL_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_CORELL_EraseSpare(p_ptCtx);
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_WriteBlkMark(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uBlkIndx,
+                                                  const uint32_t p_uSkipOff, const t_eFSS_CORELL_StorBufPrv* p_ptBuff)
+{
+    /* Return local var */
+    e_eFSS_CORELL_RES l_eRes;
+    bool_t l_bCbRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uCrc;
+    uint32_t l_uBlkIndx;
+    bool_t l_bIsMark;
+
+    /* Marker: magic number, index of the block, offset of the free slot and CRC of them. The free slot of the spare
+       block is still erased, so no erase is needed */
+    (void)memset(p_ptBuff->puBuf, (int)p_ptCtx->tStorSett.uErasedVal, p_ptBuff->uBufL);
+    l_uCrc = 0u;
+
+    if( ( true != eFSS_Utils_InsertU32(&p_ptBuff->puBuf[0u], EFSS_CORELL_BLKMARKNUM) ) ||
+        ( true != eFSS_Utils_InsertU32(&p_ptBuff->puBuf[4u], p_uBlkIndx) ) ||
+        ( true != eFSS_Utils_InsertU32(&p_ptBuff->puBuf[8u], p_uSkipOff) ) )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+    }
+    else if( true != eFSS_CORELL_CbCrc32(p_ptCtx, MAX_UINT32VAL, p_ptBuff->puBuf,
+                                         ( EFSS_CORELL_BLKMARK_L - EFSS_CORELL_CRC_L ), &l_uCrc) )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+    }
+    else if( true != eFSS_Utils_InsertU32(&p_ptBuff->puBuf[12u], l_uCrc) )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+    }
+    else
+    {
+        /* Program only the marker when the ranged write is available, the rest of the slot is left erased */
+        if( NULL != p_ptCtx->tCtxCb.fWriteRange )
+        {
+            l_bCbRes = eFSS_CORELL_CbWriteRange(p_ptCtx, ( p_ptCtx->tStorSett.uTotPages + p_uSkipOff ), 0u,
+                                                p_ptBuff->puBuf, EFSS_CORELL_BLKMARK_L);
+        }
+        else
+        {
+            l_bCbRes = eFSS_CORELL_CbWrite(p_ptCtx, ( p_ptCtx->tStorSett.uTotPages + p_uSkipOff ), p_ptBuff->puBuf,
+                                           p_ptBuff->uBufL);
+        }
+
+        if( true != l_bCbRes )
+        {
+            l_eRes = e_eFSS_CORELL_RES_CLBCKWRITEERR;
+        }
+        else if( true != eFSS_CORELL_CbRead(p_ptCtx, ( p_ptCtx->tStorSett.uTotPages + p_uSkipOff ), p_ptBuff->puBuf,
+                                            p_ptBuff->uBufL) )
+        {
+            l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+        }
+        else
+        {
+            /* The block cannot be erased till the marker is readed back correctly */
+            l_uBlkIndx = 0u;
+            l_bIsMark = false;
+            l_eRes = eFSS_CORELL_IsBlkMark(p_ptCtx, p_uSkipOff, p_ptBuff, &l_uBlkIndx, &l_bIsMark);
+
+            if( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( ( true != l_bIsMark ) || ( p_uBlkIndx != l_uBlkIndx ) ) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_WRITENOMATCHREAD;
+                p_ptCtx->tStats.uRbMismatchCnt++;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_IsBlkMark(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uSkipOff,
+                                               const t_eFSS_CORELL_StorBufPrv* p_ptBuff, uint32_t* const p_puBlkIndx,
+                                               bool_t* const p_pbIsMark)
+{
+    /* Return local var */
+    e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uMagic;
+    uint32_t l_uSkipOff;
+    uint32_t l_uCrc;
+    uint32_t l_uCrcRead;
+
+    l_uMagic = 0u;
+    l_uSkipOff = 0u;
+    l_uCrc = 0u;
+    l_uCrcRead = 0u;
+    *p_pbIsMark = false;
+
+    if( ( true != eFSS_Utils_RetriveU32(&p_ptBuff->puBuf[0u], &l_uMagic) ) ||
+        ( true != eFSS_Utils_RetriveU32(&p_ptBuff->puBuf[4u], p_puBlkIndx) ) ||
+        ( true != eFSS_Utils_RetriveU32(&p_ptBuff->puBuf[8u], &l_uSkipOff) ) ||
+        ( true != eFSS_Utils_RetriveU32(&p_ptBuff->puBuf[12u], &l_uCrcRead) ) )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+    }
+    else if( true != eFSS_CORELL_CbCrc32(p_ptCtx, MAX_UINT32VAL, p_ptBuff->puBuf,
+                                         ( EFSS_CORELL_BLKMARK_L - EFSS_CORELL_CRC_L ), &l_uCrc) )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+    }
+    else
+    {
+        /* The marker must be in the free slot of a block of the area */
+        l_eRes = e_eFSS_CORELL_RES_OK;
+        *p_pbIsMark = ( ( EFSS_CORELL_BLKMARKNUM == l_uMagic ) && ( l_uCrc == l_uCrcRead ) &&
+                        ( p_uSkipOff == l_uSkipOff ) && ( *p_puBlkIndx < p_ptCtx->tStorSett.uTotPages ) &&
+                        ( 0u == ( *p_puBlkIndx % p_ptCtx->tStorSett.uPagesPerBlk ) ) );
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_RecoverBlk(t_eFSS_CORELL_Ctx* const p_ptCtx,
+                                                t_eFSS_CORELL_StorBufPrv* const p_ptBuff)
+{
+    /* Return local var */
+    e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uOff;
+    uint32_t l_uBlkIndx;
+    bool_t l_bIsMark;
+
+    l_eRes = e_eFSS_CORELL_RES_OK;
+
+    if( ( p_ptCtx->tStorSett.uPagesPerBlk > 1u ) && ( false == p_ptCtx->bBlkChecked ) )
+    {
+        /* The buffer is used to read the spare block */
+        p_ptBuff->bCrcOk = false;
+        p_ptBuff->bCrcUpd = false;
+
+        /* Search the marker of a completed copy in every slot of the spare block */
+        l_bIsMark = false;
+        l_uBlkIndx = 0u;
+        l_uOff = 0u;
+
+        while( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( false == l_bIsMark ) &&
+               ( l_uOff < p_ptCtx->tStorSett.uPagesPerBlk ) )
+        {
+            if( true != eFSS_CORELL_CbRead(p_ptCtx, ( p_ptCtx->tStorSett.uTotPages + l_uOff ), p_ptBuff->puBuf,
+                                           p_ptBuff->uBufL) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+            }
+            else
+            {
+                l_eRes = eFSS_CORELL_IsBlkMark(p_ptCtx, l_uOff, p_ptBuff, &l_uBlkIndx, &l_bIsMark);
+            }
 
+            if( false == l_bIsMark )
+            {
+                l_uOff++;
+            }
+        }
 
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eFSS_CORELL_IsStatusStillCoherent(const t_eFSS_CORELL_Ctx* p_ptCtx)
+        if( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( true == l_bIsMark ) )
+        {
+            /* The copy back was interrupted, do it again. The page that was going to be flushed is left blank,
+               like it happens when a single page is erased and the power is lost before writing it */
+            eFSS_CORELL_ForgetErsBlk(p_ptCtx);
+            l_eRes = eFSS_CORELL_CopyBlk(p_ptCtx, p_ptCtx->tStorSett.uTotPages, l_uBlkIndx, l_uOff, p_ptBuff);
+
+            if( e_eFSS_CORELL_RES_OK == l_eRes )
+            {
+                l_eRes = eFSS_CORELL_EraseSpare(p_ptCtx);
+            }
+        }
+
+        if( e_eFSS_CORELL_RES_OK == l_eRes )
+        {
+            p_ptCtx->bBlkChecked = true;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_EraseSpare(t_eFSS_CORELL_Ctx* const p_ptCtx)
 {
     /* Return local var */
-    bool_t l_eRes;
+    e_eFSS_CORELL_RES l_eRes;
 
-	/* Check context pointer validity */
-    if( ( NULL == p_ptCtx->tCtxCb.ptCtxErase ) || ( NULL == p_ptCtx->tCtxCb.fErase ) ||
-        ( NULL == p_ptCtx->tCtxCb.ptCtxWrite ) || ( NULL == p_ptCtx->tCtxCb.fWrite ) ||
-        ( NULL == p_ptCtx->tCtxCb.ptCtxRead  ) || ( NULL == p_ptCtx->tCtxCb.fRead  ) ||
-        ( NULL == p_ptCtx->tCtxCb.ptCtxCrc32 ) || ( NULL == p_ptCtx->tCtxCb.fCrc32 ) ||
-        ( NULL == p_ptCtx->tBuff1.puBuf )      || ( NULL == p_ptCtx->tBuff2.puBuf )  ||
-        ( p_ptCtx->tBuff2.puBuf == p_ptCtx->tBuff1.puBuf ) )
+    /* Local var used for calculation */
+    uint32_t l_uTryPerformed;
+
+    /* Init var */
+    l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
+    l_uTryPerformed = 0u;
+
+    /* Erasing the spare block remove the marker, the block copy is not needed anymore */
+    while( ( e_eFSS_CORELL_RES_OK != l_eRes ) && ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) )
     {
-        l_eRes = false;
+        if( true == eFSS_CORELL_CbErase(p_ptCtx, p_ptCtx->tStorSett.uTotPages) )
+        {
+            l_eRes = e_eFSS_CORELL_RES_OK;
+        }
+        else
+        {
+            l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
+        }
+
+        l_uTryPerformed++;
+    }
+
+    p_ptCtx->tStats.uRetryCnt += ( l_uTryPerformed - 1u );
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_CopyBlk(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uFromIndx,
+                                             const uint32_t p_uToIndx, const uint32_t p_uSkipOff,
+                                             const t_eFSS_CORELL_StorBufPrv* p_ptBuff)
+{
+    /* Return local var */
+    e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uTryPerformed;
+    uint32_t l_uOff;
+
+    /* Init var */
+    l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
+    l_uTryPerformed = 0u;
+
+    /* A failed copy could have left a page programmed only partially, so every try erase the destination block
+       again. The source block is only readed */
+    while( ( e_eFSS_CORELL_RES_OK != l_eRes ) && ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) )
+    {
+        if( true == eFSS_CORELL_CbErase(p_ptCtx, p_uToIndx) )
+        {
+            l_eRes = e_eFSS_CORELL_RES_OK;
+        }
+        else
+        {
+            l_eRes = e_eFSS_CORELL_RES_CLBCKERASEERR;
+        }
+
+        l_uOff = 0u;
+        while( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( l_uOff < p_ptCtx->tStorSett.uPagesPerBlk ) )
+        {
+            if( p_uSkipOff != l_uOff )
+            {
+                l_eRes = eFSS_CORELL_CopyPage(p_ptCtx, ( p_uFromIndx + l_uOff ), ( p_uToIndx + l_uOff ), p_ptBuff);
+            }
+
+            l_uOff++;
+        }
+
+        l_uTryPerformed++;
+    }
+
+    p_ptCtx->tStats.uRetryCnt += ( l_uTryPerformed - 1u );
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_CopyPage(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uFromIndx,
+                                              const uint32_t p_uToIndx, const t_eFSS_CORELL_StorBufPrv* p_ptBuff)
+{
+    /* Return local var */
+    e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uIndex;
+    uint32_t l_uCrc;
+    uint32_t l_uCrcRead;
+    bool_t l_bIsBlank;
+
+    /* The page is copied as it is, private metadata included */
+    if( true != eFSS_CORELL_CbRead(p_ptCtx, p_uFromIndx, p_ptBuff->puBuf, p_ptBuff->uBufL) )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
     }
     else
     {
-        /* Check data validity */
-        if( p_ptCtx->tStorSett.uTotPages <= 0u )
+        l_bIsBlank = true;
+        l_uIndex = 0u;
+
+        while( ( true == l_bIsBlank ) && ( l_uIndex < p_ptBuff->uBufL ) )
         {
-            l_eRes = false;
+            if( p_ptCtx->tStorSett.uErasedVal != p_ptBuff->puBuf[l_uIndex] )
+            {
+                l_bIsBlank = false;
+            }
+
+            l_uIndex++;
+        }
+
+        if( true == l_bIsBlank )
+        {
+            /* The destination is already erased, nothing to write */
+            l_eRes = e_eFSS_CORELL_RES_OK;
         }
         else
         {
-            /* Check data validity */
-            if( p_ptCtx->tStorSett.uPagesLen <= EFSS_CORELL_PAGEMIN_L )
+            /* The same buffer is used to read back the page, so the copy is verified by CRC */
+            l_uCrc = 0u;
+            l_uCrcRead = 0u;
+
+            if( true != eFSS_CORELL_CbCrc32(p_ptCtx, MAX_UINT32VAL, p_ptBuff->puBuf, p_ptBuff->uBufL, &l_uCrc) )
             {
-                l_eRes = false;
+                l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+            }
+            else if( true != eFSS_CORELL_CbWrite(p_ptCtx, p_uToIndx, p_ptBuff->puBuf, p_ptBuff->uBufL) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CLBCKWRITEERR;
+            }
+            else if( true != eFSS_CORELL_CbRead(p_ptCtx, p_uToIndx, p_ptBuff->puBuf, p_ptBuff->uBufL) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+            }
+            else if( true != eFSS_CORELL_CbCrc32(p_ptCtx, MAX_UINT32VAL, p_ptBuff->puBuf, p_ptBuff->uBufL,
+                                                 &l_uCrcRead) )
+            {
+                l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
+            }
+            else if( l_uCrc != l_uCrcRead )
+            {
+                l_eRes = e_eFSS_CORELL_RES_WRITENOMATCHREAD;
+                p_ptCtx->tStats.uRbMismatchCnt++;
+            }
+            else
+            {
+                l_eRes = e_eFSS_CORELL_RES_OK;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static t_eFSS_CORELL_ErsBlk* eFSS_CORELL_GetErsBlk(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx)
+{
+    /* Return local var */
+    t_eFSS_CORELL_ErsBlk* l_ptErsBlk;
+
+    /* Local var used for calculation */
+    uint32_t l_uBlkIndx;
+
+    if( p_ptCtx->tStorSett.uPagesPerBlk > 1u )
+    {
+        l_uBlkIndx = p_uPageIndx - ( p_uPageIndx % p_ptCtx->tStorSett.uPagesPerBlk );
+    }
+    else
+    {
+        l_uBlkIndx = p_uPageIndx;
+    }
+
+    if( l_uBlkIndx == p_ptCtx->tErsBlk1.uBlkIndx )
+    {
+        l_ptErsBlk = &p_ptCtx->tErsBlk1;
+    }
+    else if( l_uBlkIndx == p_ptCtx->tErsBlk2.uBlkIndx )
+    {
+        l_ptErsBlk = &p_ptCtx->tErsBlk2;
+    }
+    else
+    {
+        l_ptErsBlk = NULL;
+    }
+
+    return l_ptErsBlk;
+}
+
+static void eFSS_CORELL_ForgetErsBlk(t_eFSS_CORELL_Ctx* const p_ptCtx)
+{
+    /* No page index is equal to the number of pages */
+    p_ptCtx->tErsBlk1.uBlkIndx = p_ptCtx->tStorSett.uTotPages;
+    p_ptCtx->tErsBlk1.uNextPage = p_ptCtx->tStorSett.uTotPages;
+    p_ptCtx->tErsBlk2 = p_ptCtx->tErsBlk1;
+}
+
+static bool_t eFSS_CORELL_ProgPage(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                   const t_eFSS_CORELL_StorBufPrv* p_ptMainBuf,
+                                   const t_eFSS_CORELL_StorBufPrv* p_ptBkpBuf)
+{
+    /* Return local var */
+    bool_t l_bIsProg;
+    bool_t l_bCbRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uSlotOff;
+    uint32_t l_uUsedSlot;
+    uint32_t l_uFirst;
+    uint32_t l_uLast;
+    uint32_t l_uIndex;
+    uint8_t l_uOldVal;
+    uint8_t l_uNewVal;
+    bool_t l_bCanProg;
+    uint8_t* l_puSlot;
+    uint8_t l_auCrc[EFSS_CORELL_CRC_L];
+
+    /* The buffer hold the CRC in the first slot and every other slot free */
+    l_bIsProg = false;
+    l_uSlotOff = p_ptMainBuf->uBufL - EFSS_CORELL_CRCSLOT_L;
+    l_puSlot = &p_ptMainBuf->puBuf[l_uSlotOff];
+    (void)memcpy(l_auCrc, l_puSlot, EFSS_CORELL_CRC_L);
+
+    /* Read what the page hold now */
+    l_bCbRes = eFSS_CORELL_CbRead(p_ptCtx, p_uPageIndx, p_ptBkpBuf->puBuf, p_ptBkpBuf->uBufL);
+
+    if( true == l_bCbRes )
+    {
+        /* Every bit to change must still be at the erased value in the page */
+        l_bCanProg = true;
+        l_uFirst = l_uSlotOff;
+        l_uLast = 0u;
+        l_uIndex = 0u;
+
+        while( ( true == l_bCanProg ) && ( l_uIndex < l_uSlotOff ) )
+        {
+            l_uOldVal = p_ptBkpBuf->puBuf[l_uIndex];
+            l_uNewVal = p_ptMainBuf->puBuf[l_uIndex];
+
+            if( l_uOldVal != l_uNewVal )
+            {
+                if( 0u != ( ( uint8_t )( l_uOldVal ^ l_uNewVal ) &
+                            ( uint8_t )( l_uOldVal ^ p_ptCtx->tStorSett.uErasedVal ) ) )
+                {
+                    l_bCanProg = false;
+                }
+                else
+                {
+                    if( l_uFirst >= l_uSlotOff )
+                    {
+                        l_uFirst = l_uIndex;
+                    }
+                    l_uLast = l_uIndex;
+                }
+            }
+
+            l_uIndex++;
+        }
+
+        l_uUsedSlot = eFSS_CORELL_GetUsedSlot(&p_ptCtx->tStorSett, &p_ptBkpBuf->puBuf[l_uSlotOff]);
+
+        if( ( true == l_bCanProg ) && ( l_uFirst >= l_uSlotOff ) && ( l_uUsedSlot > 0u ) &&
+            ( 0 == memcmp(&p_ptBkpBuf->puBuf[l_uSlotOff + ( ( l_uUsedSlot - 1u ) * EFSS_CORELL_CRC_L )], l_auCrc,
+                          EFSS_CORELL_CRC_L) ) )
+        {
+            /* The page already hold the buffer */
+            (void)memcpy(l_puSlot, &p_ptBkpBuf->puBuf[l_uSlotOff], EFSS_CORELL_CRCSLOT_L);
+            l_bIsProg = true;
+        }
+        else if( ( true == l_bCanProg ) && ( l_uUsedSlot < EFSS_CORELL_CRCSLOT_N ) &&
+                 ( ( 0u == l_uUsedSlot ) || ( false == eFSS_CORELL_IsSlotFree(&p_ptCtx->tStorSett, l_auCrc) ) ) )
+        {
+            /* Keep the used slots of the page and put the new CRC in the first free one, a CRC that look like a
+               free slot can be used only in the first one */
+            (void)memcpy(l_puSlot, &p_ptBkpBuf->puBuf[l_uSlotOff], EFSS_CORELL_CRCSLOT_L);
+            (void)memcpy(&l_puSlot[l_uUsedSlot * EFSS_CORELL_CRC_L], l_auCrc, EFSS_CORELL_CRC_L);
+
+            /* Program the changed data first, so the new CRC is valid only when they are all written */
+            l_bCbRes = true;
+            if( l_uFirst < l_uSlotOff )
+            {
+                l_bCbRes = eFSS_CORELL_CbWriteRange(p_ptCtx, p_uPageIndx, l_uFirst, &p_ptMainBuf->puBuf[l_uFirst],
+                                                    ( ( l_uLast - l_uFirst ) + 1u ));
+            }
+
+            if( true == l_bCbRes )
+            {
+                l_bCbRes = eFSS_CORELL_CbWriteRange(p_ptCtx, p_uPageIndx,
+                                                    ( l_uSlotOff + ( l_uUsedSlot * EFSS_CORELL_CRC_L ) ),
+                                                    l_auCrc, EFSS_CORELL_CRC_L);
+            }
+
+            if( true == l_bCbRes )
+            {
+                l_bCbRes = eFSS_CORELL_CbRead(p_ptCtx, p_uPageIndx, p_ptBkpBuf->puBuf, p_ptBkpBuf->uBufL);
+            }
+
+            if( true == l_bCbRes )
+            {
+                if( 0 == memcmp(p_ptMainBuf->puBuf, p_ptBkpBuf->puBuf, p_ptMainBuf->uBufL) )
+                {
+                    l_bIsProg = true;
+                }
+                else
+                {
+                    p_ptCtx->tStats.uRbMismatchCnt++;
+                }
+            }
+
+            if( false == l_bIsProg )
+            {
+                /* Back to the trailer of a page to erase and write again */
+                (void)memcpy(l_puSlot, l_auCrc, EFSS_CORELL_CRC_L);
+                (void)memset(&l_puSlot[EFSS_CORELL_CRC_L], (int)p_ptCtx->tStorSett.uErasedVal,
+                             ( EFSS_CORELL_CRCSLOT_L - EFSS_CORELL_CRC_L ) );
+            }
+        }
+        else
+        {
+            /* The page must be erased */
+        }
+    }
+
+    return l_bIsProg;
+}
+
+static uint32_t eFSS_CORELL_GetUsedSlot(const t_eFSS_TYPE_StorSet* p_ptStorSet, const uint8_t* p_puSlot)
+{
+    /* Return local var */
+    uint32_t l_uUsedSlot;
+
+    /* Local var used for calculation */
+    uint32_t l_uIndex;
+
+    /* The slots are used in order, count till the last used one */
+    l_uUsedSlot = 0u;
+    l_uIndex = 0u;
+
+    while( l_uIndex < EFSS_CORELL_CRCSLOT_N )
+    {
+        if( false == eFSS_CORELL_IsSlotFree(p_ptStorSet, &p_puSlot[l_uIndex * EFSS_CORELL_CRC_L]) )
+        {
+            l_uUsedSlot = l_uIndex + 1u;
+        }
+
+        l_uIndex++;
+    }
+
+    return l_uUsedSlot;
+}
+
+static bool_t eFSS_CORELL_IsSlotFree(const t_eFSS_TYPE_StorSet* p_ptStorSet, const uint8_t* p_puSlot)
+{
+    /* Return local var */
+    bool_t l_bIsFree;
+
+    /* Local var used for calculation */
+    uint32_t l_uIndex;
+
+    l_bIsFree = true;
+    l_uIndex = 0u;
+
+    while( ( true == l_bIsFree ) && ( l_uIndex < EFSS_CORELL_CRC_L ) )
+    {
+        if( p_ptStorSet->uErasedVal != p_puSlot[l_uIndex] )
+        {
+            l_bIsFree = false;
+        }
+
+        l_uIndex++;
+    }
+
+    return l_bIsFree;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELL_StreamPage(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                               const uint8_t p_uCheck, const uint32_t p_uCheckL,
+                                               bool_t* const p_pbIsOk, uint32_t* const p_puCrc)
+{
+    /* Return local var */
+    e_eFSS_CORELL_RES l_eRes;
+    bool_t l_bCbRes;
+
+    /* Local var used for calculation */
+    uint32_t l_uOffset;
+    uint32_t l_uChunkL;
+    uint32_t l_uCrcL;
+    uint32_t l_uIndex;
+    uint32_t l_uTryPerformed;
+    uint8_t* l_puChunk;
+    uint8_t l_uStored;
+    uint8_t l_uNew;
+
+    /* Init var, the first chunk is the short one so the last one will hold the whole page trailer */
+    l_eRes = e_eFSS_CORELL_RES_OK;
+    *p_pbIsOk = true;
+    l_uOffset = 0u;
+    l_uChunkL = p_ptCtx->tBuff1.uBufL % p_ptCtx->tBuff2.uBufL;
+
+    if( 0u == l_uChunkL )
+    {
+        l_uChunkL = p_ptCtx->tBuff2.uBufL;
+    }
+
+    if( NULL != p_puCrc )
+    {
+        *p_puCrc = eFSS_CORELL_GetCrcSeed(&p_ptCtx->tStorSett);
+    }
+
+    /* Stop at the first difference only if the CRC is not requested */
+    while( ( e_eFSS_CORELL_RES_OK == l_eRes ) && ( l_uOffset < p_ptCtx->tBuff1.uBufL ) &&
+           ( ( true == *p_pbIsOk ) || ( NULL != p_puCrc ) ) )
+    {
+        /* Chunk are aligned to the end of the scratch area */
+        l_puChunk = &p_ptCtx->tBuff2.puBuf[p_ptCtx->tBuff2.uBufL - l_uChunkL];
+        l_bCbRes = false;
+        l_uTryPerformed = 0u;
+
+        while( ( true != l_bCbRes ) && ( l_uTryPerformed < p_ptCtx->tStorSett.uRWERetry ) )
+        {
+            if( l_uChunkL == p_ptCtx->tBuff1.uBufL )
+            {
+                l_bCbRes = eFSS_CORELL_CbRead(p_ptCtx, p_uPageIndx, l_puChunk, l_uChunkL);
+            }
+            else
+            {
+                l_bCbRes = eFSS_CORELL_CbReadRange(p_ptCtx, p_uPageIndx, l_uOffset, l_puChunk, l_uChunkL);
+            }
+
+            l_uTryPerformed++;
+        }
+
+        p_ptCtx->tStats.uRetryCnt += ( l_uTryPerformed - 1u );
+
+        if( true != l_bCbRes )
+        {
+            l_eRes = e_eFSS_CORELL_RES_CLBCKREADERR;
+        }
+        else
+        {
+            /* Check the readed chunk against the page buffer */
+            l_uIndex = 0u;
+
+            while( ( true == *p_pbIsOk ) && ( l_uIndex < l_uChunkL ) &&
+                   ( ( l_uOffset + l_uIndex ) < p_uCheckL ) )
+            {
+                l_uStored = l_puChunk[l_uIndex];
+                l_uNew = p_ptCtx->tBuff1.puBuf[l_uOffset + l_uIndex];
+
+                if( EFSS_CORELL_STREAM_BLANK == p_uCheck )
+                {
+                    *p_pbIsOk = ( p_ptCtx->tStorSett.uErasedVal == l_uStored );
+                }
+                else
+                {
+                    *p_pbIsOk = ( l_uStored == l_uNew );
+                }
+
+                l_uIndex++;
             }
-            else
+
+            /* Chain the CRC of the chunk, the stored CRC is excluded */
+            if( ( NULL != p_puCrc ) &&
+                ( l_uOffset < ( p_ptCtx->tBuff1.uBufL - eFSS_CORELL_GetCrcL(&p_ptCtx->tStorSett) ) ) )
             {
-                /* Check data validity */
-                if( p_ptCtx->tStorSett.uRWERetry <= 0u )
+                l_uCrcL = ( p_ptCtx->tBuff1.uBufL - eFSS_CORELL_GetCrcL(&p_ptCtx->tStorSett) ) - l_uOffset;
+
+                if( l_uCrcL > l_uChunkL )
                 {
-                        l_eRes = false;
+                    l_uCrcL = l_uChunkL;
                 }
-                else
+
+                l_bCbRes = eFSS_CORELL_CbCrc32(p_ptCtx, *p_puCrc, l_puChunk, l_uCrcL, p_puCrc);
+
+                if( true != l_bCbRes )
                 {
-                    /* Check data validity */
-                    if( p_ptCtx->tBuff1.uBufL != p_ptCtx->tBuff2.uBufL )
-                    {
-                        l_eRes = false;
-                    }
-                    else
-                    {
-                        /* Check data validity */
-                        if( p_ptCtx->tStorSett.uPagesLen != p_ptCtx->tBuff1.uBufL )
-                        {
-                            l_eRes = false;
-                        }
-                        else
-                        {
-                            l_eRes = true;
-                        }
-                    }
+                    l_eRes = e_eFSS_CORELL_RES_CLBCKCRCERR;
                 }
             }
+
+            l_uOffset += l_uChunkL;
+            l_uChunkL = p_ptCtx->tBuff2.uBufL;
         }
     }
 
     return l_eRes;
 }
 
-static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractData(const t_eFSS_CORELL_StorBufPrv* p_ptBuff,
+static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractData(const t_eFSS_TYPE_StorSet* p_ptStorSet,
+                                                    const t_eFSS_CORELL_StorBufPrv* p_ptBuff,
                                                     t_eFSS_CORELLPRV_PrvMeta* const p_ptPar)
 {
 	/* Return local var */
@@ -808,22 +2601,28 @@ static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractData(const t_eFSS_CORELL_StorBufP
 
     /* Local var for calculation */
     uint32_t l_uCurrIdx;
+    uint32_t l_uSlot;
     uint8_t* l_puCBuff;
 
-    if( ( NULL == p_ptBuff ) || ( NULL == p_ptPar ) )
+    if( ( NULL == p_ptStorSet ) || ( NULL == p_ptBuff ) || ( NULL == p_ptPar ) )
     {
         l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
     }
+    else if( ( e_eFSS_TYPE_TRAIL_COMPACT == p_ptStorSet->eTrailer ) ||
+             ( e_eFSS_TYPE_TRAIL_COMPACT_CRC16 == p_ptStorSet->eTrailer ) )
+    {
+        l_eRes = eFSS_CORELLPRV_ExtractDataC(p_ptStorSet, p_ptBuff, p_ptPar);
+    }
     else
     {
-        if( p_ptBuff->uBufL <= EFSS_CORELL_PAGEMIN_L )
+        if( p_ptBuff->uBufL <= eFSS_CORELL_GetMetaL(p_ptStorSet) )
         {
             l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
         }
         else
         {
             /* Init variable */
-            l_puCBuff = &p_ptBuff->puBuf[p_ptBuff->uBufL - EFSS_CORELL_PAGEMIN_L];
+            l_puCBuff = &p_ptBuff->puBuf[p_ptBuff->uBufL - eFSS_CORELL_GetMetaL(p_ptStorSet)];
             l_uCurrIdx = 0u;
 
             /* Estract */
@@ -862,6 +2661,17 @@ static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractData(const t_eFSS_CORELL_StorBufP
                             else
                             {
                                 l_uCurrIdx += 4u;
+                                if( e_eFSS_TYPE_TRAIL_PROG == p_ptStorSet->eTrailer )
+                                {
+                                    /* The CRC is in the last used slot, in the first one if none is used */
+                                    l_uSlot = eFSS_CORELL_GetUsedSlot(p_ptStorSet, &l_puCBuff[l_uCurrIdx]);
+                                    if( l_uSlot > 0u )
+                                    {
+                                        l_uSlot--;
+                                    }
+                                    l_uCurrIdx += ( l_uSlot * EFSS_CORELL_CRC_L );
+                                }
+
                                 if( false == eFSS_Utils_RetriveU32(&l_puCBuff[l_uCurrIdx], &p_ptPar->uPageCrc) )
                                 {
                                     l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
@@ -881,7 +2691,8 @@ static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractData(const t_eFSS_CORELL_StorBufP
     return l_eRes;
 }
 
-static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertData(t_eFSS_CORELL_StorBufPrv* const p_ptBuff,
+static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertData(const t_eFSS_TYPE_StorSet* p_ptStorSet,
+                                                   t_eFSS_CORELL_StorBufPrv* const p_ptBuff,
                                                    const t_eFSS_CORELLPRV_PrvMeta* p_ptPar)
 {
 	/* Return local var */
@@ -891,20 +2702,25 @@ static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertData(t_eFSS_CORELL_StorBufPrv* con
     uint32_t l_uCurrIdx;
     uint8_t* l_puCBuff;
 
-    if( ( NULL == p_ptBuff ) || ( NULL == p_ptPar ) )
+    if( ( NULL == p_ptStorSet ) || ( NULL == p_ptBuff ) || ( NULL == p_ptPar ) )
     {
         l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
     }
+    else if( ( e_eFSS_TYPE_TRAIL_COMPACT == p_ptStorSet->eTrailer ) ||
+             ( e_eFSS_TYPE_TRAIL_COMPACT_CRC16 == p_ptStorSet->eTrailer ) )
+    {
+        l_eRes = eFSS_CORELLPRV_InsertDataC(p_ptStorSet, p_ptBuff, p_ptPar);
+    }
     else
     {
-        if( p_ptBuff->uBufL <= EFSS_CORELL_PAGEMIN_L )
+        if( p_ptBuff->uBufL <= eFSS_CORELL_GetMetaL(p_ptStorSet) )
         {
             l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
         }
         else
         {
             /* Init variable */
-            l_puCBuff = &p_ptBuff->puBuf[p_ptBuff->uBufL - EFSS_CORELL_PAGEMIN_L];
+            l_puCBuff = &p_ptBuff->puBuf[p_ptBuff->uBufL - eFSS_CORELL_GetMetaL(p_ptStorSet)];
             l_uCurrIdx = 0u;
 
             /* Insert */
@@ -949,6 +2765,13 @@ static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertData(t_eFSS_CORELL_StorBufPrv* con
                                 }
                                 else
                                 {
+                                    if( e_eFSS_TYPE_TRAIL_PROG == p_ptStorSet->eTrailer )
+                                    {
+                                        /* The CRC is in the first slot, the other ones are free */
+                                        (void)memset(&l_puCBuff[l_uCurrIdx + EFSS_CORELL_CRC_L],
+                                                     (int)p_ptStorSet->uErasedVal,
+                                                     ( EFSS_CORELL_CRCSLOT_L - EFSS_CORELL_CRC_L ) );
+                                    }
                                     l_eRes = e_eFSS_CORELL_RES_OK;
                                 }
                             }
@@ -960,4 +2783,425 @@ static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertData(t_eFSS_CORELL_StorBufPrv* con
     }
 
     return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELLPRV_ExtractDataC(const t_eFSS_TYPE_StorSet* p_ptStorSet,
+                                                     const t_eFSS_CORELL_StorBufPrv* p_ptBuff,
+                                                     t_eFSS_CORELLPRV_PrvMeta* const p_ptPar)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var for calculation */
+    uint32_t l_uMetaL;
+    uint8_t* l_puCBuff;
+    uint16_t l_uIdxOrCrc;
+    uint8_t l_uTypeVer;
+    uint8_t l_uMagic;
+
+    l_uMetaL = eFSS_CORELL_GetMetaL(p_ptStorSet);
+
+    if( p_ptBuff->uBufL <= l_uMetaL )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+    }
+    else
+    {
+        /* Init variable */
+        l_puCBuff = &p_ptBuff->puBuf[p_ptBuff->uBufL - l_uMetaL];
+        l_uIdxOrCrc = 0u;
+        l_uTypeVer = 0u;
+        l_uMagic = 0u;
+
+        /* Estract */
+        if( ( false == eFSS_Utils_RetriveU16(&l_puCBuff[0u], &l_uIdxOrCrc) ) ||
+            ( false == eFSS_Utils_RetriveU8(&l_puCBuff[2u], &l_uTypeVer) ) ||
+            ( false == eFSS_Utils_RetriveU8(&l_puCBuff[3u], &l_uMagic) ) )
+        {
+            l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+        }
+        else
+        {
+            p_ptPar->uPageIndx = ( uint32_t )l_uIdxOrCrc;
+            p_ptPar->uPageType = ( uint8_t )( l_uTypeVer >> 4u );
+            p_ptPar->uPageVersion = ( uint16_t )( l_uTypeVer & EFSS_CORELL_MAXNIBBLE );
+
+            /* The total number of page is verified by the CRC, report the magic number of the full trailer so a
+               page can be verified in the same way */
+            p_ptPar->uPageTot = p_ptStorSet->uTotPages;
+
+            if( EFSS_CORELL_PAGEMAGNUMC == l_uMagic )
+            {
+                p_ptPar->uPageMagicNumber = EFSS_CORELL_PAGEMAGNUM;
+            }
+            else
+            {
+                p_ptPar->uPageMagicNumber = ( uint32_t )l_uMagic;
+            }
+
+            if( e_eFSS_TYPE_TRAIL_COMPACT_CRC16 == p_ptStorSet->eTrailer )
+            {
+                if( false == eFSS_Utils_RetriveU16(&l_puCBuff[4u], &l_uIdxOrCrc) )
+                {
+                    l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    p_ptPar->uPageCrc = ( uint32_t )l_uIdxOrCrc;
+                    l_eRes = e_eFSS_CORELL_RES_OK;
+                }
+            }
+            else
+            {
+                if( false == eFSS_Utils_RetriveU32(&l_puCBuff[4u], &p_ptPar->uPageCrc) )
+                {
+                    l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eRes = e_eFSS_CORELL_RES_OK;
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_CORELL_RES eFSS_CORELLPRV_InsertDataC(const t_eFSS_TYPE_StorSet* p_ptStorSet,
+                                                    t_eFSS_CORELL_StorBufPrv* const p_ptBuff,
+                                                    const t_eFSS_CORELLPRV_PrvMeta* p_ptPar)
+{
+	/* Return local var */
+	e_eFSS_CORELL_RES l_eRes;
+
+    /* Local var for calculation */
+    uint32_t l_uMetaL;
+    uint8_t* l_puCBuff;
+    uint8_t l_uTypeVer;
+    bool_t l_bCrcIns;
+
+    l_uMetaL = eFSS_CORELL_GetMetaL(p_ptStorSet);
+
+    if( p_ptBuff->uBufL <= l_uMetaL )
+    {
+        l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+    }
+    else
+    {
+        /* Init variable, index, type and version fit the compact fields: checked during the init */
+        l_puCBuff = &p_ptBuff->puBuf[p_ptBuff->uBufL - l_uMetaL];
+        l_uTypeVer = ( uint8_t )( ( uint8_t )( p_ptPar->uPageType << 4u ) |
+                                  ( ( uint8_t )p_ptPar->uPageVersion & EFSS_CORELL_MAXNIBBLE ) );
+
+        /* Insert */
+        if( e_eFSS_TYPE_TRAIL_COMPACT_CRC16 == p_ptStorSet->eTrailer )
+        {
+            l_bCrcIns = eFSS_Utils_InsertU16(&l_puCBuff[4u], ( uint16_t )p_ptPar->uPageCrc);
+        }
+        else
+        {
+            l_bCrcIns = eFSS_Utils_InsertU32(&l_puCBuff[4u], p_ptPar->uPageCrc);
+        }
+
+        if( ( false == eFSS_Utils_InsertU16(&l_puCBuff[0u], ( uint16_t )p_ptPar->uPageIndx) ) ||
+            ( false == eFSS_Utils_InsertU8(&l_puCBuff[2u], l_uTypeVer) ) ||
+            ( false == eFSS_Utils_InsertU8(&l_puCBuff[3u], EFSS_CORELL_PAGEMAGNUMC) ) ||
+            ( false == l_bCrcIns ) )
+        {
+            l_eRes = e_eFSS_CORELL_RES_CORRUPTCTX;
+        }
+        else
+        {
+            l_eRes = e_eFSS_CORELL_RES_OK;
+        }
+    }
+
+    return l_eRes;
+}
+
+static bool_t eFSS_CORELL_IsTrailUsable(const t_eFSS_TYPE_StorSet* p_ptStorSet, const uint8_t p_uStorType)
+{
+    /* Return local var */
+    bool_t l_bRes;
+
+    switch(p_ptStorSet->eTrailer)
+    {
+        case e_eFSS_TYPE_TRAIL_FULL:
+        case e_eFSS_TYPE_TRAIL_PROG:
+        {
+            l_bRes = true;
+            break;
+        }
+
+        case e_eFSS_TYPE_TRAIL_COMPACT:
+        case e_eFSS_TYPE_TRAIL_COMPACT_CRC16:
+        {
+            /* Index, type and version must fit the compact fields */
+            l_bRes = ( ( p_ptStorSet->uTotPages <= EFSS_CORELL_MAXPAGEC ) &&
+                       ( p_ptStorSet->uPageVersion <= EFSS_CORELL_MAXNIBBLE ) &&
+                       ( p_uStorType <= EFSS_CORELL_MAXNIBBLE ) );
+            break;
+        }
+
+        default:
+        {
+            l_bRes = false;
+            break;
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELL_IsBlkUsable(const t_eFSS_TYPE_StorSet* p_ptStorSet, const bool_t p_bSingleBuf)
+{
+    /* Return local var */
+    bool_t l_bRes;
+
+    if( p_ptStorSet->uPagesPerBlk <= 1u )
+    {
+        /* Every page can be erased alone */
+        l_bRes = true;
+    }
+    else
+    {
+        /* The area must be made of whole blocks, the spare block must be addressable and a whole page buffer is
+           needed to copy the pages of a block. A page must also hold the marker of a block copy */
+        l_bRes = ( ( 0u == ( p_ptStorSet->uTotPages % p_ptStorSet->uPagesPerBlk ) ) &&
+                   ( p_ptStorSet->uTotPages <= ( MAX_UINT32VAL - p_ptStorSet->uPagesPerBlk ) ) &&
+                   ( p_ptStorSet->uPagesLen >= EFSS_CORELL_BLKMARK_L ) && ( false == p_bSingleBuf ) );
+    }
+
+    return l_bRes;
+}
+
+static uint32_t eFSS_CORELL_GetMetaL(const t_eFSS_TYPE_StorSet* p_ptStorSet)
+{
+    /* Return local var */
+    uint32_t l_uMetaL;
+
+    switch(p_ptStorSet->eTrailer)
+    {
+        case e_eFSS_TYPE_TRAIL_COMPACT:
+        {
+            l_uMetaL = EFSS_CORELL_PAGEMINC_L;
+            break;
+        }
+
+        case e_eFSS_TYPE_TRAIL_COMPACT_CRC16:
+        {
+            l_uMetaL = EFSS_CORELL_PAGEMINC16_L;
+            break;
+        }
+
+        case e_eFSS_TYPE_TRAIL_PROG:
+        {
+            l_uMetaL = EFSS_CORELL_PAGEMINP_L;
+            break;
+        }
+
+        default:
+        {
+            l_uMetaL = EFSS_CORELL_PAGEMIN_L;
+            break;
+        }
+    }
+
+    return l_uMetaL;
+}
+
+static uint32_t eFSS_CORELL_GetCrcL(const t_eFSS_TYPE_StorSet* p_ptStorSet)
+{
+    /* Return local var */
+    uint32_t l_uCrcL;
+
+    if( e_eFSS_TYPE_TRAIL_COMPACT_CRC16 == p_ptStorSet->eTrailer )
+    {
+        l_uCrcL = EFSS_CORELL_CRC16_L;
+    }
+    else if( e_eFSS_TYPE_TRAIL_PROG == p_ptStorSet->eTrailer )
+    {
+        /* Every slot is excluded from the CRC */
+        l_uCrcL = EFSS_CORELL_CRCSLOT_L;
+    }
+    else
+    {
+        l_uCrcL = EFSS_CORELL_CRC_L;
+    }
+
+    return l_uCrcL;
+}
+
+static uint32_t eFSS_CORELL_GetCrcSeed(const t_eFSS_TYPE_StorSet* p_ptStorSet)
+{
+    /* Return local var */
+    uint32_t l_uSeed;
+
+    /* The compact trailer does not store the total number of page, it is added to the CRC seed */
+    if( ( e_eFSS_TYPE_TRAIL_FULL == p_ptStorSet->eTrailer ) || ( e_eFSS_TYPE_TRAIL_PROG == p_ptStorSet->eTrailer ) )
+    {
+        l_uSeed = MAX_UINT32VAL;
+    }
+    else
+    {
+        l_uSeed = ( MAX_UINT32VAL ^ p_ptStorSet->uTotPages );
+    }
+
+    return l_uSeed;
+}
+
+static uint32_t eFSS_CORELL_GetCrcToStore(const t_eFSS_TYPE_StorSet* p_ptStorSet, const uint32_t p_uCrc)
+{
+    /* Return local var */
+    uint32_t l_uCrc;
+
+    /* The 16 bit CRC is the low half of the calculated one */
+    if( e_eFSS_TYPE_TRAIL_COMPACT_CRC16 == p_ptStorSet->eTrailer )
+    {
+        l_uCrc = ( p_uCrc & ( ( uint32_t )MAX_UINT16VAL ) );
+    }
+    else
+    {
+        l_uCrc = p_uCrc;
+    }
+
+    return l_uCrc;
+}
+
+static bool_t eFSS_CORELL_CbErase(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx)
+{
+    /* Local variable */
+    bool_t l_bRes;
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+    p_ptCtx->tStats.uEraseCnt++;
+    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, &l_uStartTime);
+
+    l_bRes = (*(p_ptCtx->tCtxCb.fErase))(p_ptCtx->tCtxCb.ptCtxErase, p_uPageIndx);
+
+    if( true == l_bIsTimed )
+    {
+        (void)eFSS_Utils_AddLatency(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, l_uStartTime,
+                                    &p_ptCtx->tStats.tLatErase);
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELL_CbWrite(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                  const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+    /* Local variable */
+    bool_t l_bRes;
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+    p_ptCtx->tStats.uWriteCnt++;
+    p_ptCtx->tStats.uWriteByte += p_uDataL;
+    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, &l_uStartTime);
+
+    l_bRes = (*(p_ptCtx->tCtxCb.fWrite))(p_ptCtx->tCtxCb.ptCtxWrite, p_uPageIndx, p_puData, p_uDataL);
+
+    if( true == l_bIsTimed )
+    {
+        (void)eFSS_Utils_AddLatency(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, l_uStartTime,
+                                    &p_ptCtx->tStats.tLatWrite);
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELL_CbRead(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                 uint8_t* const p_puData, const uint32_t p_uDataL)
+{
+    /* Local variable */
+    bool_t l_bRes;
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+    p_ptCtx->tStats.uReadCnt++;
+    p_ptCtx->tStats.uReadByte += p_uDataL;
+    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, &l_uStartTime);
+
+    l_bRes = (*(p_ptCtx->tCtxCb.fRead))(p_ptCtx->tCtxCb.ptCtxRead, p_uPageIndx, p_puData, p_uDataL);
+
+    if( true == l_bIsTimed )
+    {
+        (void)eFSS_Utils_AddLatency(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, l_uStartTime,
+                                    &p_ptCtx->tStats.tLatRead);
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELL_CbWriteRange(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                       const uint32_t p_uOffset, const uint8_t* p_puData, const uint32_t p_uDataL)
+{
+    /* Local variable */
+    bool_t l_bRes;
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+    p_ptCtx->tStats.uWriteCnt++;
+    p_ptCtx->tStats.uWriteByte += p_uDataL;
+    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, &l_uStartTime);
+
+    l_bRes = (*(p_ptCtx->tCtxCb.fWriteRange))(p_ptCtx->tCtxCb.ptCtxWriteRange, p_uPageIndx, p_uOffset, p_puData,
+                                              p_uDataL);
+
+    if( true == l_bIsTimed )
+    {
+        (void)eFSS_Utils_AddLatency(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, l_uStartTime,
+                                    &p_ptCtx->tStats.tLatWrite);
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELL_CbReadRange(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uPageIndx,
+                                      const uint32_t p_uOffset, uint8_t* const p_puData, const uint32_t p_uDataL)
+{
+    /* Local variable */
+    bool_t l_bRes;
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+    p_ptCtx->tStats.uReadCnt++;
+    p_ptCtx->tStats.uReadByte += p_uDataL;
+    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, &l_uStartTime);
+
+    l_bRes = (*(p_ptCtx->tCtxCb.fReadRange))(p_ptCtx->tCtxCb.ptCtxReadRange, p_uPageIndx, p_uOffset, p_puData,
+                                             p_uDataL);
+
+    if( true == l_bIsTimed )
+    {
+        (void)eFSS_Utils_AddLatency(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, l_uStartTime,
+                                    &p_ptCtx->tStats.tLatRead);
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELL_CbCrc32(t_eFSS_CORELL_Ctx* const p_ptCtx, const uint32_t p_uSeed, const uint8_t* p_puData,
+                                  const uint32_t p_uDataL, uint32_t* const p_puCrc)
+{
+    /* Local variable */
+    bool_t l_bRes;
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+    p_ptCtx->tStats.uCrcByte += p_uDataL;
+    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, &l_uStartTime);
+
+    l_bRes = (*(p_ptCtx->tCtxCb.fCrc32))(p_ptCtx->tCtxCb.ptCtxCrc32, p_uSeed, p_puData, p_uDataL, p_puCrc);
+
+    if( true == l_bIsTimed )
+    {
+        (void)eFSS_Utils_AddLatency(p_ptCtx->tCtxCb.ptCtxTime, p_ptCtx->tCtxCb.fTime, l_uStartTime,
+                                    &p_ptCtx->tStats.tLatCrc);
+    }
+
+    return l_bRes;
 }
\ No newline at end of file
@@ -45,12 +45,54 @@ typedef struct
     uint8_t* puEleRaw;
 }t_eFSS_DB_DbElement;
 
+/* Location of an element inside the storage area. The user can optionally provide an array of uNEle of these struct
+ * in the ptEleLoc field of t_eFSS_DB_DbStruct. If provided, the array is filled only once during the init phase with
+ * the page index and the page offset of every element, so get and save operations can retrive the element position
+ * without scanning the whole default database struct. If ptEleLoc is NULL the position is calculated every time.
+ * uEleLocL is the number of struct in the ptEleLoc array, and cannot be less than uNEle.
+ * When the journal is used uJournalOff is the offset of the last value of the element in the journal, or
+ * MAX_UINT32VAL if the last value is stored in the element page.
+ * The array is owned by the database module after the init, and must not be modified by the user */
+typedef struct
+{
+    uint32_t uPageIdx;
+    uint32_t uPageOff;
+    uint32_t uJournalOff;
+}t_eFSS_DB_DbEleLoc;
+
+/* If uJournalPages is not zero the last uJournalPages pages of the storage area are used as a journal. Every saved
+ * element is appended to the journal instead of rewriting his page and his backup page, and only when the journal is
+ * full all the element are copied in their pages. The journal needs the location index, so ptEleLoc cannot be NULL,
+ * at least two journal pages, and every element must fit in a single journal page.
+ * Every journal page is written in a new journal page, so a power loss during the write lose only the element that
+ * was being saved. With the programmable trailer and the ranged write callback the saved element is instead appended
+ * to the newest journal page, only programming the new record in place, and after in his mirror, the next journal
+ * page. The erase is needed only when the page has no more free CRC slot, and the journal is copied in the element
+ * pages only when full. A power loss interrupt the write of the page or of his mirror, never both, so also in this
+ * case only the element that was being saved is lost.
+ * If bTrustOri is true get, save and commit read only the original page of the element, and the backup page is read
+ * only if the original one is not valid. The original page is the one kept anyway when the two differ, so the
+ * readed value is the same, but a corrupted backup page is repaired only by eFSS_DB_GetDBStatus or eFSS_DB_Scrub,
+ * that always verify both pages */
 typedef struct
 {
     uint32_t uNEle;
     t_eFSS_DB_DbElement* ptDefEle;
+    t_eFSS_DB_DbEleLoc* ptEleLoc;
+    uint32_t uEleLocL;
+    uint32_t uJournalPages;
+    bool_t bTrustOri;
 }t_eFSS_DB_DbStruct;
 
+/* Element staged by a transaction. The raw value is not copied, so the memory pointed by puRawVal must remain valid
+ * and unchanged till the transaction is committed or aborted */
+typedef struct
+{
+    uint32_t uPos;
+    uint16_t uRawValL;
+    uint8_t* puRawVal;
+}t_eFSS_DB_DbTxEle;
+
 
 
 /***********************************************************************************************************************
@@ -72,14 +114,50 @@ typedef enum
     e_eFSS_DB_RES_WRITENOMATCHREAD,
     e_eFSS_DB_RES_OK_BKP_RCVRD,
     e_eFSS_DB_RES_DBNOTCHECKED,
-    e_eFSS_DB_RES_PARAM_DEF_RESET
+    e_eFSS_DB_RES_PARAM_DEF_RESET,
+    e_eFSS_DB_RES_TXONGOING,
+    e_eFSS_DB_RES_TXNOTSTARTED,
+    e_eFSS_DB_RES_INPROGRESS
 }e_eFSS_DB_RES;
 
+/* Progress of an operation executed a step at a time with eFSS_DB_GetDBStatusStep or eFSS_DB_FormatToDefaultStep.
+ * Only indexes are kept here, every step reload the page it needs, so the internal buffer can be used by other
+ * functions between two steps. Fields are private to the database module */
+typedef struct
+{
+    uint32_t uOp;
+    uint32_t uPhase;
+    uint32_t uPage;
+    uint32_t uOff;
+    uint32_t uPageChk;
+    uint32_t uOffChk;
+    uint32_t uElem;
+    bool_t   bIsPageMod;
+    bool_t   bIsPageRec;
+}t_eFSS_DB_StepCtx;
+
 typedef struct
 {
     t_eFSS_DBC_Ctx           tDbcCtx;
     t_eFSS_DB_DbStruct       tDB;
     bool_t                   bIsDbCheked;
+    bool_t                   bIsTxOngoing;
+    t_eFSS_DB_DbTxEle*       ptTxEle;
+    uint32_t                 uTxEleMax;
+    uint32_t                 uTxNEle;
+    uint8_t*                 puJournalBuf;
+    uint32_t                 uJournalIdx;
+    uint32_t                 uJournalSeq;
+    uint32_t                 uJournalUsed;
+    bool_t                   bIsJournalApp;
+    uint8_t                  uJournalPad;
+    t_eFSS_TYPE_TimeCtx*     ptCtxTime;
+    f_eFSS_TYPE_TimeCb       fTime;
+    t_eFSS_TYPE_LatHist      tLatAdd;
+    t_eFSS_TYPE_LatHist      tLatStatus;
+    t_eFSS_TYPE_LatHist      tLatFormat;
+    t_eFSS_DB_StepCtx        tStep;
+    t_eFSS_TYPE_ScrubCtx     tScrub;
 }t_eFSS_DB_Ctx;
 
 
@@ -93,9 +171,12 @@ typedef struct
  * @param[in]   p_ptCtx          - Database context
  * @param[in]   p_tCtxCb         - All callback collection context
  * @param[in]   p_tStorSet       - Storage settings
- * @param[in]   p_puBuff         - Pointer to a buffer used by the modules to make calc, must be pageSize * 2
+ * @param[in]   p_puBuff         - Pointer to a buffer used by the modules to make calc, must be pageSize * 2, or
+ *                                 pageSize * 3 if the journal is used
  * @param[in]   p_uBuffL         - Size of p_puBuff
- * @param[in]   p_tDbStruct      - Struct containing the default struct of the database
+ * @param[in]   p_tDbStruct      - Struct containing the default struct of the database. If the ptEleLoc field is
+ *                                 not NULL it must point to an array of uEleLocL element, not less than uNEle,
+ *                                 that will be filled with the location of every element of the database
  *
  * @return      e_eFSS_DB_RES_BADPOINTER    - In case of bad pointer passed to the function
  *		        e_eFSS_DB_RES_BADPARAM      - In case of an invalid parameter passed to the function
@@ -167,7 +248,38 @@ e_eFSS_DB_RES eFSS_DB_GetDBStatus(t_eFSS_DB_Ctx* const p_ptCtx);
 e_eFSS_DB_RES eFSS_DB_FormatToDefault(t_eFSS_DB_Ctx* const p_ptCtx);
 
 /**
- * @brief       Save an element in to the database
+ * @brief       Same as eFSS_DB_GetDBStatus, but execute at most one page operation for every call, so the check
+ *              can be interleaved with other work. The first call start the check, every following call continue
+ *              it. Till the check is not ended e_eFSS_DB_RES_INPROGRESS is returned and the database cannot be used,
+ *              when the check is ended the same value of eFSS_DB_GetDBStatus is returned. Calling
+ *              eFSS_DB_FormatToDefaultStep or a blocking version of the two operations abandon the check.
+ *              The first step complete an interrupted transaction or journal, so it can take more than one page
+ *              operation.
+ *
+ * @param[in]   p_ptCtx          - Database context
+ *
+ * @return      e_eFSS_DB_RES_INPROGRESS       - The check is not ended, call the function again
+ *              Every other value returned by eFSS_DB_GetDBStatus
+ */
+e_eFSS_DB_RES eFSS_DB_GetDBStatusStep(t_eFSS_DB_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Same as eFSS_DB_FormatToDefault, but write at most one page for every call. The first call start the
+ *              format, every following call continue it. Till the format is not ended e_eFSS_DB_RES_INPROGRESS is
+ *              returned and the database cannot be used, when the format is ended the same value of
+ *              eFSS_DB_FormatToDefault is returned. Calling eFSS_DB_GetDBStatusStep or a blocking version of the
+ *              two operations abandon the format.
+ *
+ * @param[in]   p_ptCtx          - Database context
+ *
+ * @return      e_eFSS_DB_RES_INPROGRESS       - The format is not ended, call the function again
+ *              Every other value returned by eFSS_DB_FormatToDefault
+ */
+e_eFSS_DB_RES eFSS_DB_FormatToDefaultStep(t_eFSS_DB_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Save an element in to the database. If the journal is used the element is appended to the journal,
+ *              and only one journal page is written.
  *
  * @param[in]   p_ptCtx       - Database context
  * @param[in]   p_uPos        - Position of the element we want to save in to the database
@@ -220,6 +332,170 @@ e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
 e_eFSS_DB_RES eFSS_DB_GetElement(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPos, const uint16_t p_uRawValL,
                                  uint8_t* const p_puRawVal);
 
+/**
+ * @brief       Start a new transaction. Elements staged with eFSS_DB_SetManyTx are not written in storage till
+ *              eFSS_DB_CommitTx is called, and every modified page is written only once regardless of the numbers of
+ *              element modified in it.
+ *
+ * @param[in]   p_ptCtx       - Database context
+ * @param[in]   p_ptTxBuf     - Array used to keep track of the staged elements, must remain valid till the
+ *                              transaction is committed or aborted
+ * @param[in]   p_uTxBufL     - Numbers of element of p_ptTxBuf, it's the max numbers of different element that can
+ *                              be staged in a single transaction
+ *
+ * @return      e_eFSS_DB_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DB_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_DB_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DB_RES_NOINITLIB        - Need to init lib before calling function
+ *              e_eFSS_DB_RES_DBNOTCHECKED     - The function eFSS_DB_GetDBStatus needs to be called before and
+ *                                               the status of the database need to be ok to proceed
+ *              e_eFSS_DB_RES_TXONGOING        - A transaction is already ongoing
+ *              e_eFSS_DB_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DB_RES eFSS_DB_BeginTx(t_eFSS_DB_Ctx* const p_ptCtx, t_eFSS_DB_DbTxEle* const p_ptTxBuf,
+                              const uint32_t p_uTxBufL);
+
+/**
+ * @brief       Stage a group of elements in the ongoing transaction. If an element is already staged his value is
+ *              replaced. If one of the passed element is not valid or there is not enough space to stage all of them
+ *              no element is staged.
+ *
+ * @param[in]   p_ptCtx       - Database context
+ * @param[in]   p_ptEle       - Array of element to stage, the raw value must remain valid till the transaction is
+ *                              committed or aborted
+ * @param[in]   p_uNEle       - Numbers of element of p_ptEle
+ *
+ * @return      e_eFSS_DB_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DB_RES_BADPARAM         - In case of an invalid parameter passed to the function
+ *		        e_eFSS_DB_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DB_RES_NOINITLIB        - Need to init lib before calling function
+ *              e_eFSS_DB_RES_DBNOTCHECKED     - The function eFSS_DB_GetDBStatus needs to be called before and
+ *                                               the status of the database need to be ok to proceed
+ *              e_eFSS_DB_RES_TXNOTSTARTED     - Need to start a transaction before calling this function
+ *              e_eFSS_DB_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DB_RES eFSS_DB_SetManyTx(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_DB_DbTxEle* const p_ptEle,
+                                const uint32_t p_uNEle);
+
+/**
+ * @brief       Write in storage every element staged in the ongoing transaction and close it. Every modified page is
+ *              first staged in his backup page and after copied in the origin one, so if the operation is
+ *              interrupted the next call of eFSS_DB_GetDBStatus will restore all the staged element or none of them.
+ *              If an error is returned the transaction is closed anyway, and eFSS_DB_GetDBStatus must be called
+ *              before using the database again.
+ *
+ * @param[in]   p_ptCtx       - Database context
+ *
+ * @return      e_eFSS_DB_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DB_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DB_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_DB_RES_CLBCKREADERR     - The read callback reported an error
+ *              e_eFSS_DB_RES_CLBCKCRCERR      - The crc callback reported an error
+ *              e_eFSS_DB_RES_NOTVALIDDB       - Database is invalid
+ *              e_eFSS_DB_RES_NEWVERSIONFOUND  - The database has a new version
+ *              e_eFSS_DB_RES_CLBCKERASEERR    - Error reported from the callback
+ *              e_eFSS_DB_RES_CLBCKWRITEERR    - Error reported from the callback
+ *              e_eFSS_DB_RES_WRITENOMATCHREAD - For some unknow reason data write dosent match data readed
+ *              e_eFSS_DB_RES_OK_BKP_RCVRD     - operation ended successfully recovering a backup or an origin page
+ *              e_eFSS_DB_RES_DBNOTCHECKED     - The function eFSS_DB_GetDBStatus needs to be called before and
+ *                                               the status of the database need to be ok to proceed
+ *              e_eFSS_DB_RES_TXNOTSTARTED     - Need to start a transaction before calling this function
+ *              e_eFSS_DB_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DB_RES eFSS_DB_CommitTx(t_eFSS_DB_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Discard every element staged in the ongoing transaction and close it. Nothing is written in storage.
+ *
+ * @param[in]   p_ptCtx       - Database context
+ *
+ * @return      e_eFSS_DB_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DB_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DB_RES_NOINITLIB        - Need to init lib before calling function
+ *              e_eFSS_DB_RES_TXNOTSTARTED     - Need to start a transaction before calling this function
+ *              e_eFSS_DB_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DB_RES eFSS_DB_AbortTx(t_eFSS_DB_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Copy every element stored in the journal in his page and empty the journal. This operation is done
+ *              automatically when the journal is full, but can be called when the system is idle to avoid doing it
+ *              during a save operation. If the journal is not used nothing is done.
+ *
+ * @param[in]   p_ptCtx       - Database context
+ *
+ * @return      e_eFSS_DB_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DB_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DB_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_DB_RES_CLBCKREADERR     - The read callback reported an error
+ *              e_eFSS_DB_RES_CLBCKCRCERR      - The crc callback reported an error
+ *              e_eFSS_DB_RES_NOTVALIDDB       - Database is invalid
+ *              e_eFSS_DB_RES_NEWVERSIONFOUND  - The database has a new version
+ *              e_eFSS_DB_RES_CLBCKERASEERR    - Error reported from the callback
+ *              e_eFSS_DB_RES_CLBCKWRITEERR    - Error reported from the callback
+ *              e_eFSS_DB_RES_WRITENOMATCHREAD - For some unknow reason data write dosent match data readed
+ *              e_eFSS_DB_RES_OK_BKP_RCVRD     - operation ended successfully recovering a backup or an origin page
+ *              e_eFSS_DB_RES_DBNOTCHECKED     - The function eFSS_DB_GetDBStatus needs to be called before and
+ *                                               the status of the database need to be ok to proceed
+ *              e_eFSS_DB_RES_OK               - Operation ended correctly
+ */
+e_eFSS_DB_RES eFSS_DB_CompactJournal(t_eFSS_DB_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Verify a part of the database pages against their backup, repairing a divergent or corrupted copy.
+ *              Every call continue from the page where the previous one stopped and process pages till the budget
+ *              is exhausted, so this function can be called periodically by an idle task to walk the whole storage
+ *              incrementally. Journal pages have no backup and are not verified.
+ *
+ * @param[in]   p_ptCtx       - Database context
+ * @param[in]   p_tBudget     - Budget of this call, see t_eFSS_TYPE_ScrubBudget
+ *
+ * @return      e_eFSS_DB_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_DB_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_DB_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_DB_RES_CLBCKREADERR     - The read callback reported an error
+ *              e_eFSS_DB_RES_CLBCKCRCERR      - The crc callback reported an error
+ *              e_eFSS_DB_RES_NOTVALIDDB       - Database is invalid, eFSS_DB_GetDBStatus must be called again
+ *              e_eFSS_DB_RES_NEWVERSIONFOUND  - The database has a new version, eFSS_DB_GetDBStatus must be called
+ *                                               again
+ *              e_eFSS_DB_RES_CLBCKERASEERR    - Error reported from the callback
+ *              e_eFSS_DB_RES_CLBCKWRITEERR    - Error reported from the callback
+ *              e_eFSS_DB_RES_WRITENOMATCHREAD - For some unknow reason data write dosent match data readed
+ *              e_eFSS_DB_RES_DBNOTCHECKED     - The function eFSS_DB_GetDBStatus needs to be called before and
+ *                                               the status of the database need to be ok to proceed
+ *              e_eFSS_DB_RES_INPROGRESS       - The budget is exhausted before verifying every page
+ *              e_eFSS_DB_RES_OK_BKP_RCVRD     - Every page is verified and at least one page was repaired in this
+ *                                               pass, the next call start a new pass
+ *              e_eFSS_DB_RES_OK               - Every page is verified, the next call start a new pass
+ */
+e_eFSS_DB_RES eFSS_DB_Scrub(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_TYPE_ScrubBudget p_tBudget);
+
+/**
+ * @brief       Get the statistics of the operations done on the storage area since the init or the last reset,
+ *              see t_eFSS_TYPE_Stats.
+ *
+ * @param[in]   p_ptCtx       - Database context
+ * @param[out]  p_ptStats     - Pointer to a statistics struct that will be filled with the collected counters
+ *
+ * @return      e_eFSS_DB_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_DB_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_DB_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_DB_RES_OK            - Operation ended correctly
+ */
+e_eFSS_DB_RES eFSS_DB_GetStats(t_eFSS_DB_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats);
+
+/**
+ * @brief       Reset to zero every statistics counter
+ *
+ * @param[in]   p_ptCtx       - Database context
+ *
+ * @return      e_eFSS_DB_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_DB_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_DB_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_DB_RES_OK            - Operation ended correctly
+ */
+e_eFSS_DB_RES eFSS_DB_ResetStats(t_eFSS_DB_Ctx* const p_ptCtx);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -22,6 +22,16 @@
 #define EFSS_DB_VEROFF                                                                           ( ( uint32_t )  0x00u )
 #define EFSS_DB_LENOFF                                                                           ( ( uint32_t )  0x02u )
 #define EFSS_DB_RAWOFF                                                                           ( ( uint32_t )  0x04u )
+#define EFSS_DB_JRNSEQOFF                                                                        ( ( uint32_t )  0x00u )
+#define EFSS_DB_JRNRECOFF                                                                        ( ( uint32_t )  0x04u )
+#define EFSS_DB_JRNPOSOFF                                                                        ( ( uint32_t )  0x00u )
+#define EFSS_DB_JRNLENOFF                                                                        ( ( uint32_t )  0x04u )
+#define EFSS_DB_JRNRAWOFF                                                                        ( ( uint32_t )  0x06u )
+#define EFSS_DB_JRNMINPAGES                                                                      ( ( uint32_t )  0x02u )
+#define EFSS_DB_NOJRNOFF                                                                               ( MAX_UINT32VAL )
+#define EFSS_DB_STEPNONE                                                                         ( ( uint32_t )  0x00u )
+#define EFSS_DB_STEPSTATUS                                                                       ( ( uint32_t )  0x01u )
+#define EFSS_DB_STEPFORMAT                                                                       ( ( uint32_t )  0x02u )
 
 
 
@@ -30,7 +40,8 @@
  **********************************************************************************************************************/
 typedef enum
 {
-    e_eFSS_DB_RES_CHECK_ALREADYADDED = 0,
+    e_eFSS_DB_RES_CHECK_RECOVERY = 0,
+    e_eFSS_DB_RES_CHECK_ALREADYADDED,
     e_eFSS_DB_RES_CHECK_NODATA,
     e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED,
     e_eFSS_DB_RES_CHECK_NEWADDED,
@@ -51,7 +62,7 @@ static e_eFSS_DB_RES eFSS_DB_DBCtoDBRes(const e_eFSS_DBC_RES p_eDBCRes);
  *  PRIVATE UTILS STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
 static bool_t eFSS_DB_IsDbDefStructValid(const t_eFSS_DB_DbStruct p_tDefaultDb, const uint32_t p_uNPage,
-                                         const uint32_t p_uPageL);
+                                         const uint32_t p_uPageL, t_eFSS_DB_DbEleLoc* const p_ptEleLoc);
 
 static e_eFSS_DB_RES eFSS_DB_GetEleRawInBuffer(const uint16_t p_uExpEleL, uint8_t* const p_puBuff,
                                                t_eFSS_DB_DbElement* const p_ptEleToGet);
@@ -62,6 +73,45 @@ static e_eFSS_DB_RES eFSS_DB_FindElePageAndPos(const uint32_t p_uPageL, const t_
                                                const uint32_t p_uEleIdx, uint32_t* const p_puPageFound,
                                                uint32_t* const p_puOffSetFound);
 
+static e_eFSS_DB_RES eFSS_DB_GetTxPage(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPageL,
+                                       const uint32_t p_uStartPage, uint32_t* const p_puPageFound,
+                                       uint32_t* const p_puLastPage, bool_t* const p_pbIsFound);
+
+static e_eFSS_DB_RES eFSS_DB_SetTxEleInBuffer(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_DBC_StorBuf p_tBuff,
+                                              const uint32_t p_uPageIdx);
+
+static e_eFSS_DB_RES eFSS_DB_LoadJournal(t_eFSS_DB_Ctx* const p_ptCtx);
+
+static e_eFSS_DB_RES eFSS_DB_ApplyJournal(t_eFSS_DB_Ctx* const p_ptCtx);
+
+static e_eFSS_DB_RES eFSS_DB_ScanJournal(t_eFSS_DB_Ctx* const p_ptCtx, const uint8_t* const p_puJrnBuf,
+                                         const uint32_t p_uBufL, const bool_t p_bIsLocFilled, uint32_t* const p_puUsed);
+
+static e_eFSS_DB_RES eFSS_DB_FlushJournal(t_eFSS_DB_Ctx* const p_ptCtx, const bool_t p_bIsNewPage);
+
+static e_eFSS_DB_RES eFSS_DB_RecoverJournal(t_eFSS_DB_Ctx* const p_ptCtx);
+
+static e_eFSS_DB_RES eFSS_DB_ResetJournal(t_eFSS_DB_Ctx* const p_ptCtx);
+
+static void eFSS_DB_ClearJournal(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uBufL);
+
+static e_eFSS_DB_RES eFSS_DB_SetEleInJournal(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uBufL,
+                                             const uint32_t p_uPos, const uint8_t* const p_puRawVal,
+                                             bool_t* const p_pbIsStored);
+
+static e_eFSS_DB_RES eFSS_DB_SaveEleInJournal(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPos,
+                                              const uint8_t* const p_puRawVal);
+
+static e_eFSS_DB_RES eFSS_DB_CommitTxInJournal(t_eFSS_DB_Ctx* const p_ptCtx, bool_t* const p_pbIsCommitted);
+
+static e_eFSS_DB_RES eFSS_DB_StatusStep(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_DBC_StorBuf p_tBuff,
+                                        const uint32_t p_uTotPage);
+
+static e_eFSS_DB_RES eFSS_DB_FormatStep(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_DBC_StorBuf p_tBuff,
+                                        const uint32_t p_uTotPage);
+
+static e_eFSS_DB_RES eFSS_DB_LoadPageInBuff(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPageIdx);
+
 
 
 /***********************************************************************************************************************
@@ -81,6 +131,7 @@ e_eFSS_DB_RES eFSS_DB_InitCtx(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_TYPE_Cb
 
     /* Local var used for calculation */
     bool_t l_bIsDbStructValid;
+    uint32_t l_uDbcBuffL;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -89,8 +140,19 @@ e_eFSS_DB_RES eFSS_DB_InitCtx(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_TYPE_Cb
 	}
 	else
 	{
+        /* When the journal is used the last page of the buffer is used to keep the journal in RAM */
+        if( ( 0u != p_tDbStruct.uJournalPages ) && ( p_uBuffL >= p_tStorSet.uPagesLen ) )
+        {
+            l_uDbcBuffL = p_uBuffL - p_tStorSet.uPagesLen;
+        }
+        else
+        {
+            l_uDbcBuffL = p_uBuffL;
+        }
+
         /* Can init low level context, and after get the used space and check database validity */
-        l_eDBCRes = eFSS_DBC_InitCtx(&p_ptCtx->tDbcCtx, p_tCtxCb, p_tStorSet, p_puBuff, p_uBuffL);
+        l_eDBCRes = eFSS_DBC_InitCtx(&p_ptCtx->tDbcCtx, p_tCtxCb, p_tStorSet, p_puBuff, l_uDbcBuffL,
+                                     p_tDbStruct.uJournalPages);
         l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
 
         if( e_eFSS_DB_RES_OK == l_eRes )
@@ -112,11 +174,17 @@ e_eFSS_DB_RES eFSS_DB_InitCtx(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_TYPE_Cb
                     (void)memset(&p_ptCtx->tDbcCtx, 0, sizeof(t_eFSS_DBC_Ctx));
                     (void)memset(&p_ptCtx->tDB,     0, sizeof(t_eFSS_DB_DbStruct));
                     p_ptCtx->bIsDbCheked = false;
+                    p_ptCtx->bIsTxOngoing = false;
+                    p_ptCtx->ptTxEle = NULL;
+                    p_ptCtx->uTxEleMax = 0u;
+                    p_ptCtx->uTxNEle = 0u;
+                    p_ptCtx->puJournalBuf = NULL;
                 }
                 else
                 {
                     /* Check validity of the passed db struct */
-                    l_bIsDbStructValid = eFSS_DB_IsDbDefStructValid(p_tDbStruct, l_uTotPage, l_tBuff.uBufL);
+                    l_bIsDbStructValid = eFSS_DB_IsDbDefStructValid(p_tDbStruct, l_uTotPage, l_tBuff.uBufL,
+                                                                    p_tDbStruct.ptEleLoc);
 
                     if( false == l_bIsDbStructValid )
                     {
@@ -127,6 +195,11 @@ e_eFSS_DB_RES eFSS_DB_InitCtx(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_TYPE_Cb
                         (void)memset(&p_ptCtx->tDbcCtx, 0, sizeof(t_eFSS_DBC_Ctx));
                         (void)memset(&p_ptCtx->tDB,     0, sizeof(t_eFSS_DB_DbStruct));
                         p_ptCtx->bIsDbCheked = false;
+                        p_ptCtx->bIsTxOngoing = false;
+                        p_ptCtx->ptTxEle = NULL;
+                        p_ptCtx->uTxEleMax = 0u;
+                        p_ptCtx->uTxNEle = 0u;
+                        p_ptCtx->puJournalBuf = NULL;
                     }
                     else
                     {
@@ -137,6 +210,42 @@ e_eFSS_DB_RES eFSS_DB_InitCtx(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_TYPE_Cb
                            to controll that the stored DB is valid, that new version are updated and to set to default
                            value new parameters */
                         p_ptCtx->bIsDbCheked = false;
+
+                        /* No transaction ongoing */
+                        p_ptCtx->bIsTxOngoing = false;
+                        p_ptCtx->ptTxEle = NULL;
+                        p_ptCtx->uTxEleMax = 0u;
+                        p_ptCtx->uTxNEle = 0u;
+
+                        /* The journal will be loaded when checking the DB */
+                        if( 0u == p_tDbStruct.uJournalPages )
+                        {
+                            p_ptCtx->puJournalBuf = NULL;
+                        }
+                        else
+                        {
+                            p_ptCtx->puJournalBuf = &p_puBuff[l_uDbcBuffL];
+                        }
+                        p_ptCtx->uJournalIdx = 0u;
+                        p_ptCtx->uJournalSeq = 0u;
+                        p_ptCtx->uJournalUsed = 0u;
+
+                        /* With the programmable trailer and the ranged write callback a record is appended to the
+                           journal page in place, and the page is mirrored in the next journal page */
+                        p_ptCtx->bIsJournalApp = ( ( e_eFSS_TYPE_TRAIL_PROG == p_tStorSet.eTrailer ) &&
+                                                   ( NULL != p_tCtxCb.fWriteRange ) );
+                        p_ptCtx->uJournalPad = p_tStorSet.uErasedVal;
+
+                        /* Latency of the public function is measured here, the storage one by the core */
+                        p_ptCtx->ptCtxTime = p_tCtxCb.ptCtxTime;
+                        p_ptCtx->fTime = p_tCtxCb.fTime;
+                        (void)memset(&p_ptCtx->tLatAdd, 0, sizeof(t_eFSS_TYPE_LatHist));
+                        (void)memset(&p_ptCtx->tLatStatus, 0, sizeof(t_eFSS_TYPE_LatHist));
+                        (void)memset(&p_ptCtx->tLatFormat, 0, sizeof(t_eFSS_TYPE_LatHist));
+
+                        /* No stepped operation ongoing, scrubber start from the first page */
+                        (void)memset(&p_ptCtx->tStep, 0, sizeof(t_eFSS_DB_StepCtx));
+                        (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
                     }
                 }
             }
@@ -146,6 +255,11 @@ e_eFSS_DB_RES eFSS_DB_InitCtx(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_TYPE_Cb
                 (void)memset(&p_ptCtx->tDbcCtx, 0, sizeof(t_eFSS_DBC_Ctx));
                 (void)memset(&p_ptCtx->tDB,     0, sizeof(t_eFSS_DB_DbStruct));
                 p_ptCtx->bIsDbCheked = false;
+                p_ptCtx->bIsTxOngoing = false;
+                p_ptCtx->ptTxEle = NULL;
+                p_ptCtx->uTxEleMax = 0u;
+                p_ptCtx->uTxNEle = 0u;
+                p_ptCtx->puJournalBuf = NULL;
             }
         }
     }
@@ -186,31 +300,9 @@ e_eFSS_DB_RES eFSS_DB_GetDBStatus(t_eFSS_DB_Ctx* const p_ptCtx)
     t_eFSS_DBC_StorBuf l_tBuff;
     uint32_t l_uTotPage;
 
-    /* Page and offset local variable */
-    uint32_t l_uPageGlob;
-    uint32_t l_uOffGlob;
-    uint32_t l_uPageLoc;
-    uint32_t l_uOffLoc;
-
-    /* Local variable for element check */
-    uint32_t l_uCheckedElem;
-
-    /* DB element local variable */
-    t_eFSS_DB_DbElement l_tCurEle;
-    t_eFSS_DB_DbElement l_tGettedEle;
-
-    /* Local variable to keep track of DB status */
-    bool_t l_bIsPageModGlob;
-    bool_t l_bIsPageModLoc;
-
-    /* Local variable to keep track of recoveredPage */
-    bool_t l_bIsPageRecFromBkup;
-
-    /* Check status local variable */
-    e_eFSS_DB_PRVSMCHECK_RES l_eCurStatus;
-
-    /* Support buff */
-    uint8_t* l_puSupBuf;
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -239,6 +331,9 @@ e_eFSS_DB_RES eFSS_DB_GetDBStatus(t_eFSS_DB_Ctx* const p_ptCtx)
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     /* Get storage info */
                     l_uTotPage = 0u;
                     l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
@@ -246,406 +341,20 @@ e_eFSS_DB_RES eFSS_DB_GetDBStatus(t_eFSS_DB_Ctx* const p_ptCtx)
 
                     if( e_eFSS_DB_RES_OK == l_eRes )
                     {
-                        /* Now that we have every needed data and that the default database struct seems correct
-                           we need to check that the database actualy stored in storage is correct. Keep in mind
-                           that unused storage area must be set to zero, in this way if anothers entry is added
-                           to the default struct we can set the default value of the entry that are actualy stored
-                           with length of zero byte.
-                           So we must follow this steps:
-                           1 - Read a storage page and check every entry present in the just readed area. For every
-                               entry check that parameter legth match the default vaue stored in the database. If
-                               legth dosent match go to point 2. If parameter legth match check parameter version.
-                               If parameter version dosent match update the stored param with the default value
-                               and save the modified storage page.
-                           2 - Check that every remaining byte stored in all the remainings page are set to zero.
-                               If they differ from zero the database is invalid. If they are all zero we can assume
-                               that every parameter that we need to check are new parameter and they must be stored
-                               in the storage area.
-                            Keep in mind that the pourpose of this function is to: update new parameter version,
-                            update newly added parameter and check if parameter are correct. If the database is
-                            corrupted, we can ripristinate it only calling eFSS_DB_FormatToDefault */
-
-                        /* Init variable */
-                        l_uPageGlob = 0u;
-                        l_uOffGlob = 0u;
-                        l_uCheckedElem = 0u;
-                        l_bIsPageModGlob = false;
-                        l_bIsPageRecFromBkup = false;
-                        l_eCurStatus = e_eFSS_DB_RES_CHECK_ALREADYADDED;
+                        /* Start a new check even if a stepped one is ongoing, and execute it till the end */
+                        p_ptCtx->tStep.uOp = EFSS_DB_STEPNONE;
+                        l_eRes = e_eFSS_DB_RES_INPROGRESS;
 
-                        /* Execute the check till we have finished */
-                        while ( e_eFSS_DB_RES_CHECK_FINISH != l_eCurStatus )
+                        while( e_eFSS_DB_RES_INPROGRESS == l_eRes )
                         {
-                            /* Do check using current status */
-                            switch( l_eCurStatus )
-                            {
-                                case e_eFSS_DB_RES_CHECK_ALREADYADDED:
-                                {
-                                    /* Check every parameter in every page */
-                                    while( ( l_uPageGlob < l_uTotPage ) &&
-                                           ( e_eFSS_DB_RES_CHECK_ALREADYADDED == l_eCurStatus ) )
-                                    {
-                                        /* Init page check, so we know if the page need to be stored after a mod */
-                                        l_bIsPageModLoc = false;
-
-                                        /* Load the current page */
-                                        l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, l_uPageGlob);
-                                        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
-
-                                        if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
-                                        {
-                                            if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
-                                            {
-                                                l_bIsPageRecFromBkup = true;
-                                            }
-
-                                            /* Init variable */
-                                            l_uOffGlob = 0u;
-
-                                            /* Whole page just readed, check the page against the default value */
-                                            while( ( l_uOffGlob < l_tBuff.uBufL ) &&
-                                                   ( e_eFSS_DB_RES_CHECK_ALREADYADDED == l_eCurStatus ) )
-                                            {
-                                                if( l_uCheckedElem < p_ptCtx->tDB.uNEle )
-                                                {
-                                                    /* Get current parameter to check */
-                                                    l_tCurEle = p_ptCtx->tDB.ptDefEle[l_uCheckedElem];
-
-                                                    /* Check parameter */
-                                                    /* Is the checked parameter present in this page? */
-                                                    if( ( l_uOffGlob + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) <=
-                                                        l_tBuff.uBufL )
-                                                    {
-                                                        /* Can retrive the element */
-                                                        l_eRes = eFSS_DB_GetEleRawInBuffer( l_tCurEle.uEleL,
-                                                                                            &l_tBuff.puBuf[l_uOffGlob],
-                                                                                            &l_tGettedEle);
-                                                        if( e_eFSS_DB_RES_OK == l_eRes )
-                                                        {
-                                                            /* Check parameter */
-                                                            if( l_tCurEle.uEleV != l_tGettedEle.uEleV )
-                                                            {
-                                                                /* Need to update this entry */
-                                                                l_puSupBuf = &l_tBuff.puBuf[l_uOffGlob];
-                                                                l_eRes = eFSS_DB_SetEleRawInBuffer( l_tCurEle,
-                                                                                                    l_puSupBuf );
-                                                                if( e_eFSS_DB_RES_OK == l_eRes )
-                                                                {
-                                                                    /* Updated */
-                                                                    l_uCheckedElem++;
-                                                                    l_uOffGlob += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
-                                                                    l_bIsPageModLoc = true;
-                                                                    l_bIsPageModGlob = true;
-                                                                }
-                                                                else
-                                                                {
-                                                                    /* Irreparable error */
-                                                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                                                }
-                                                            }
-                                                            else
-                                                            {
-                                                                /* DB entry is ok, nothing to do */
-                                                                l_uCheckedElem++;
-                                                                l_uOffGlob += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
-                                                            }
-                                                        }
-                                                        else if( e_eFSS_DB_RES_NOTVALIDDB == l_eRes )
-                                                        {
-                                                            /* Current readed parameter has some error, maybe because
-                                                               it is a new parameter? Check for zeros */
-                                                            l_eCurStatus = e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED;
-                                                        }
-                                                        else
-                                                        {
-                                                            /* Some other kind of error */
-                                                            l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                                        }
-                                                    }
-                                                    else
-                                                    {
-                                                        /* No more space in this page for other parameter, check zero */
-                                                        while( l_uOffGlob < l_tBuff.uBufL )
-                                                        {
-                                                            if( 0u == l_tBuff.puBuf[l_uOffGlob] )
-                                                            {
-                                                                l_uOffGlob++;
-                                                            }
-                                                            else
-                                                            {
-                                                                /* unused memory must be set to zero */
-                                                                l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
-                                                                l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                                            }
-                                                        }
-                                                    }
-                                                }
-                                                else
-                                                {
-                                                    /* No more parameter to check */
-                                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_NODATA;
-                                                }
-                                            }
-
-                                            /* If no error found and some change where made, flush the page */
-                                            if( ( e_eFSS_DB_RES_CHECK_ALREADYADDED == l_eCurStatus ) ||
-                                                ( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus ) ||
-                                                ( e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED == l_eCurStatus ) )
-                                            {
-                                                /* If page is modified we need to store the new value */
-                                                if( true == l_bIsPageModLoc )
-                                                {
-                                                    l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx,
-                                                                                         l_uPageGlob);
-                                                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
-
-                                                    if( e_eFSS_DB_RES_OK != l_eRes )
-                                                    {
-                                                        /* Irreparable error */
-                                                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                                    }
-                                                }
-
-                                                if ( e_eFSS_DB_RES_CHECK_ALREADYADDED == l_eCurStatus )
-                                                {
-                                                    /* Increase current page only in this case*/
-                                                    l_uPageGlob++;
-                                                }
-                                            }
-                                        }
-                                        else
-                                        {
-                                            /* Some error during page reading, return */
-                                            l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                        }
-                                    }
-
-                                    if ( e_eFSS_DB_RES_CHECK_ALREADYADDED == l_eCurStatus )
-                                    {
-                                        /* This means that we have finished the check  */
-                                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                    }
-
-                                    break;
-                                }
-
-                                case e_eFSS_DB_RES_CHECK_NODATA:
-                                case e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED:
-                                {
-                                    /* check that every remaining byte is zero, first get global offset */
-                                    l_uPageLoc = l_uPageGlob;
-                                    l_uOffLoc = l_uOffGlob;
-
-                                    while( ( ( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus ) ||
-                                             ( e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED == l_eCurStatus ) ) &&
-                                           ( l_uPageLoc < l_uTotPage ) )
-                                    {
-                                        /* Load the current page */
-                                        l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, l_uPageLoc);
-                                        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
-
-                                        if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
-                                        {
-                                            if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
-                                            {
-                                                l_bIsPageRecFromBkup = true;
-                                            }
-
-                                            /* Check every byte */
-                                            while( ( ( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus ) ||
-                                                     ( e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED == l_eCurStatus ) ) &&
-                                                   ( l_uOffLoc < l_tBuff.uBufL ) )
-                                            {
-                                                if( 0u == l_tBuff.puBuf[l_uOffLoc] )
-                                                {
-                                                    /* Ok continue */
-                                                    l_uOffLoc++;
-                                                }
-                                                else
-                                                {
-                                                    /* Non zero, corrupted database */
-                                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                                    l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
-                                                }
-                                            }
-
-                                            /* Reload offset if everything is ok and increase the page to search */
-                                            if( ( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus ) ||
-                                                ( e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED == l_eCurStatus ) )
-                                            {
-                                                l_uOffLoc = 0u;
-                                                l_uPageLoc++;
-                                            }
-                                        }
-                                        else
-                                        {
-                                            /* Some error during page reading, return */
-                                            l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                        }
-                                    }
-
-                                    /* If everything went ok continue */
-                                    if( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus )
-                                    {
-                                        /* Done */
-                                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                    }
-                                    else if( e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED == l_eCurStatus )
-                                    {
-                                        /* check for new parameter */
-                                        l_eCurStatus = e_eFSS_DB_RES_CHECK_NEWADDED;
-                                    }
-                                    else
-                                    {
-                                        /* Operation ended with an error */
-                                    }
-
-                                    break;
-                                }
-
-                                case e_eFSS_DB_RES_CHECK_NEWADDED:
-                                {
-                                    /* ok now we have to insert in the storage some new parameters */
-                                    while( ( l_uCheckedElem < p_ptCtx->tDB.uNEle ) &&
-                                           ( e_eFSS_DB_RES_CHECK_NEWADDED == l_eCurStatus ) )
-                                    {
-                                        /* Init page check, so we know if the page need to be stored after a mod */
-                                        l_bIsPageModLoc = false;
-
-                                        /* Load the current page */
-                                        l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, l_uPageGlob);
-                                        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
-
-                                        if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
-                                        {
-                                            if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
-                                            {
-                                                l_bIsPageRecFromBkup = true;
-                                            }
-
-                                            /* Whole page just readed, check the page against the default value */
-                                            while( ( l_uOffGlob < l_tBuff.uBufL ) &&
-                                                   ( l_uCheckedElem < p_ptCtx->tDB.uNEle ) &&
-                                                   ( e_eFSS_DB_RES_CHECK_NEWADDED == l_eCurStatus ) )
-                                            {
-                                                /* Get current parameter to check */
-                                                l_tCurEle = p_ptCtx->tDB.ptDefEle[l_uCheckedElem];
-
-                                                /* Check parameter */
-                                                /* Is the checked parameter present in this page? */
-                                                if( ( l_uOffGlob + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) <=
-                                                    l_tBuff.uBufL )
-                                                {
-                                                    /* Need to update this entry */
-                                                    l_eRes = eFSS_DB_SetEleRawInBuffer( l_tCurEle,
-                                                                                        &l_tBuff.puBuf[l_uOffGlob] );
-                                                    if( e_eFSS_DB_RES_OK == l_eRes )
-                                                    {
-                                                        /* Updated */
-                                                        l_uCheckedElem++;
-                                                        l_uOffGlob += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
-                                                        l_bIsPageModLoc = true;
-                                                        l_bIsPageModGlob = true;
-                                                    }
-                                                    else
-                                                    {
-                                                        /* Irreparable error */
-                                                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                                    }
-                                                }
-                                                else
-                                                {
-                                                    /* No more space in this page for other parameter */
-                                                    l_uOffGlob = l_tBuff.uBufL;
-                                                }
-                                            }
-
-                                            /* If no error found and some change where made, flush the page */
-                                            if( e_eFSS_DB_RES_CHECK_NEWADDED == l_eCurStatus )
-                                            {
-                                                /* If page is modified we need to store the new value */
-                                                if( true == l_bIsPageModLoc )
-                                                {
-                                                    l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx,
-                                                                                         l_uPageGlob);
-                                                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
-
-                                                    if( e_eFSS_DB_RES_OK != l_eRes )
-                                                    {
-                                                        /* Error flushing */
-                                                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                                    }
-                                                }
-
-                                                /* current page is full, switch */
-                                                /* Check requested from misra */
-                                                if( l_uPageGlob < l_uTotPage )
-                                                {
-                                                    l_uPageGlob++;
-                                                }
-                                                else
-                                                {
-                                                    /* Some absurd error */
-                                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
-                                                }
-
-                                                l_uOffGlob = 0u;
-                                            }
-                                        }
-                                        else
-                                        {
-                                            /* Some error during page reading, return */
-                                            l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                        }
-                                    }
-
-                                    /* In any cases we have finished now */
-                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-
-                                    break;
-                                }
-
-                                default:
-                                {
-                                    /* Impossible end here */
-                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
-                                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
-                                    break;
-                                }
-                            }
+                            l_eRes = eFSS_DB_StatusStep(p_ptCtx, l_tBuff, l_uTotPage);
                         }
+                    }
 
-                        /* Finaly, if no error occoured update status */
-                        if( ( e_eFSS_DB_RES_OK == l_eRes ) ||
-                            ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
-                        {
-                            /* Whole database checked and it is OK */
-                            p_ptCtx->bIsDbCheked = true;
-
-                            /* Specified the returned value */
-                            if( true == l_bIsPageModGlob )
-                            {
-                                /* In this case we have updated some value */
-                                l_eRes = e_eFSS_DB_RES_PARAM_DEF_RESET;
-                            }
-                            else if( true == l_bIsPageRecFromBkup )
-                            {
-                                /* Signal that a page was recovered from bkup */
-                                l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
-                            }
-                            else
-                            {
-                                /* All ok perfect */
-                                l_eRes = e_eFSS_DB_RES_OK;
-                            }
-                        }
-                        else
-                        {
-                            /* Database is corrupted, signal it as not cheked so we will not allow any other
-                             * modification to this situation */
-                            p_ptCtx->bIsDbCheked = false;
-                        }
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatStatus);
                     }
                 }
             }
@@ -668,10 +377,9 @@ e_eFSS_DB_RES eFSS_DB_FormatToDefault(t_eFSS_DB_Ctx* const p_ptCtx)
     t_eFSS_DBC_StorBuf l_tBuff;
     uint32_t l_uTotPage;
 
-    /* Local variable for calculation */
-    uint32_t l_uCurrPage;
-    uint32_t l_uCurOff;
-    uint32_t l_uCheckedElem;
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -700,6 +408,9 @@ e_eFSS_DB_RES eFSS_DB_FormatToDefault(t_eFSS_DB_Ctx* const p_ptCtx)
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     /* no need to check if database was checked, we are formating anyway */
 
                     /* Get storage info */
@@ -709,71 +420,21 @@ e_eFSS_DB_RES eFSS_DB_FormatToDefault(t_eFSS_DB_Ctx* const p_ptCtx)
 
                     if( e_eFSS_DB_RES_OK == l_eRes )
                     {
-                        /* In order to format to default the DB we can just set to zero the buffer to flush
-                           and copy inside it only the needed parameter. If no parameter are needed, we can
-                           just flush a zero filled buffer. Flushyng zero as data will leave open the possibility
-                           to add new parameter */
-                        l_uCurrPage = 0u;
-                        l_uCheckedElem = 0u;
-
-                        /* Continue till we have setted all pages or an error occours */
-                        while( ( l_uCurrPage < l_uTotPage ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
-                        {
-                            /* Memset the current page to zero */
-                            (void)memset(&l_tBuff.puBuf, 0, l_tBuff.uBufL);
-
-                            /* Set to zero the numbers of byte used */
-                            l_uCurOff = 0u;
-
-                            /* Continue till the page is full, parameter are avaiable, or an error occours */
-                            while( ( l_uCurOff < l_tBuff.uBufL )  &&
-                                   ( l_uCheckedElem < p_ptCtx->tDB.uNEle ) &&
-                                   ( e_eFSS_DB_RES_OK == l_eRes ) )
-                            {
-                                /* We have some element to set, can be placed here? */
-                                if( ( l_uCurOff + p_ptCtx->tDB.ptDefEle[l_uCheckedElem].uEleL +
-                                      EFSS_DB_RAWOFF ) > l_tBuff.uBufL )
-                                {
-                                    /* This element cannot be stored in this buffer. We will store it in the next
-                                     * page */
-                                    l_uCurOff = l_tBuff.uBufL;
-                                }
-                                else
-                                {
-                                    /* This element can be stored in this buffer */
-                                    l_eRes = eFSS_DB_SetEleRawInBuffer(p_ptCtx->tDB.ptDefEle[l_uCheckedElem],
-                                                                       &l_tBuff.puBuf[l_uCurOff] );
-                                    if( e_eFSS_DB_RES_OK == l_eRes )
-                                    {
-                                        /* Element inserted, increase the offset and start elaborating the next
-                                         * element */
-                                        l_uCurOff += ( p_ptCtx->tDB.ptDefEle[l_uCheckedElem].uEleL +
-                                                       EFSS_DB_RAWOFF );
-                                        l_uCheckedElem++;
-                                    }
-                                }
-                            }
-
-                            /* Page is completed, we can flush */
-                            if( e_eFSS_DB_RES_OK == l_eRes )
-                            {
-                                l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx, l_uCurrPage);
-                                l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
-
-                                if( e_eFSS_DB_RES_OK == l_eRes )
-                                {
-                                    l_uCurrPage++;
-                                }
-                            }
-                        }
+                        /* Start a new format even if a stepped one is ongoing, and execute it till the end */
+                        p_ptCtx->tStep.uOp = EFSS_DB_STEPNONE;
+                        l_eRes = e_eFSS_DB_RES_INPROGRESS;
 
-                        if( e_eFSS_DB_RES_OK == l_eRes )
+                        while( e_eFSS_DB_RES_INPROGRESS == l_eRes )
                         {
-                            /* Setted to default every entry, and we are sure that DB is correct. No need to do
-                               additional check */
-                            p_ptCtx->bIsDbCheked = true;
+                            l_eRes = eFSS_DB_FormatStep(p_ptCtx, l_tBuff, l_uTotPage);
                         }
                     }
+
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatFormat);
+                    }
                 }
             }
         }
@@ -782,12 +443,10 @@ e_eFSS_DB_RES eFSS_DB_FormatToDefault(t_eFSS_DB_Ctx* const p_ptCtx)
 	return l_eRes;
 }
 
-e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPos, const uint16_t p_uRawValL,
-                                 uint8_t* const p_puRawVal)
+e_eFSS_DB_RES eFSS_DB_GetDBStatusStep(t_eFSS_DB_Ctx* const p_ptCtx)
 {
 	/* Return local var */
     e_eFSS_DB_RES l_eRes;
-    e_eFSS_DB_RES l_eResLoad;
     e_eFSS_DBC_RES l_eDBCRes;
 
     /* Local var for init */
@@ -797,13 +456,160 @@ e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
     t_eFSS_DBC_StorBuf l_tBuff;
     uint32_t l_uTotPage;
 
-    /* Local variable for calculation */
-    uint32_t l_uPageIdx;
-    uint32_t l_uCurOff;
-    t_eFSS_DB_DbElement l_tCurEle;
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
 
 	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puRawVal ) )
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Measure the latency of the single step */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
+                    /* Get storage info */
+                    l_uTotPage = 0u;
+                    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                    if( e_eFSS_DB_RES_OK == l_eRes )
+                    {
+                        l_eRes = eFSS_DB_StatusStep(p_ptCtx, l_tBuff, l_uTotPage);
+                    }
+
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatStatus);
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DB_RES eFSS_DB_FormatToDefaultStep(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Measure the latency of the single step */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
+                    /* Get storage info */
+                    l_uTotPage = 0u;
+                    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                    if( e_eFSS_DB_RES_OK == l_eRes )
+                    {
+                        l_eRes = eFSS_DB_FormatStep(p_ptCtx, l_tBuff, l_uTotPage);
+                    }
+
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatFormat);
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPos, const uint16_t p_uRawValL,
+                                 uint8_t* const p_puRawVal)
+{
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DB_RES l_eResLoad;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local variable for calculation */
+    uint32_t l_uPageIdx;
+    uint32_t l_uCurOff;
+    uint32_t l_uEleTotL;
+    t_eFSS_DB_DbElement l_tCurEle;
+
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puRawVal ) )
 	{
 		l_eRes = e_eFSS_DB_RES_BADPOINTER;
 	}
@@ -829,6 +635,9 @@ e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     /* First time calling a function we need to check for the whole stored integrity.
                      * We need to do this check to be sure that the DB version is not increased, to be sure that
                      * parameter with updated version are setted to default value and that new parameter are
@@ -845,6 +654,11 @@ e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
                         {
                             l_eRes = e_eFSS_DB_RES_BADPARAM;
                         }
+                        else if( 0u != p_ptCtx->tDB.uJournalPages )
+                        {
+                            /* Append the element to the journal, no need to rewrite his page */
+                            l_eRes = eFSS_DB_SaveEleInJournal(p_ptCtx, p_uPos, p_puRawVal);
+                        }
                         else
                         {
                             /* Get storage info */
@@ -860,8 +674,7 @@ e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
                                 if( e_eFSS_DB_RES_OK == l_eRes )
                                 {
                                     /* Load the page where we can find the needed element */
-                                    l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, l_uPageIdx);
-                                    l_eResLoad = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+                                    l_eResLoad = eFSS_DB_LoadPageInBuff(p_ptCtx, l_uPageIdx);
 
                                     if( ( e_eFSS_DB_RES_OK != l_eResLoad ) &&
                                         ( e_eFSS_DB_RES_OK_BKP_RCVRD != l_eResLoad ) )
@@ -895,15 +708,33 @@ e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
                                                 l_tCurEle.uEleV = p_ptCtx->tDB.ptDefEle[p_uPos].uEleV;
                                                 l_tCurEle.puEleRaw = p_puRawVal;
 
-                                                l_eRes = eFSS_DB_SetEleRawInBuffer(l_tCurEle,
-                                                                                   &l_tBuff.puBuf[l_uCurOff] );
+                                                /* Only the element changes: remove it from the CRC of the
+                                                   page now and add it again once updated, so the flush does
+                                                   not need to calculate the CRC of the whole page */
+                                                l_uEleTotL = EFSS_DB_RAWOFF + (uint32_t)l_tCurEle.uEleL;
+                                                l_eDBCRes = eFSS_DBC_UpdCrcInBuff(&p_ptCtx->tDbcCtx, l_uCurOff,
+                                                                                  l_uEleTotL, true);
+                                                l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                                                if( e_eFSS_DB_RES_OK == l_eRes )
+                                                {
+                                                    l_eRes = eFSS_DB_SetEleRawInBuffer(l_tCurEle,
+                                                                                       &l_tBuff.puBuf[l_uCurOff] );
+                                                }
+
+                                                if( e_eFSS_DB_RES_OK == l_eRes )
+                                                {
+                                                    l_eDBCRes = eFSS_DBC_UpdCrcInBuff(&p_ptCtx->tDbcCtx, l_uCurOff,
+                                                                                      l_uEleTotL, false);
+                                                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+                                                }
 
                                                 if( e_eFSS_DB_RES_OK == l_eRes )
                                                 {
                                                     /* Ok, so we have updated the loaded buffer with
                                                        the needed raw data that we want to save. Flush the page */
                                                     l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx,
-                                                                                         l_uCurOff);
+                                                                                         l_uPageIdx);
                                                     l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
 
                                                     if( e_eFSS_DB_RES_OK == l_eRes )
@@ -922,6 +753,12 @@ e_eFSS_DB_RES eFSS_DB_SaveElemen(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
                             }
                         }
                     }
+
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatAdd);
+                    }
                 }
             }
         }
@@ -993,6 +830,13 @@ e_eFSS_DB_RES eFSS_DB_GetElement(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
                         {
                             l_eRes = e_eFSS_DB_RES_BADPARAM;
                         }
+                        else if( ( 0u != p_ptCtx->tDB.uJournalPages ) &&
+                                 ( EFSS_DB_NOJRNOFF != p_ptCtx->tDB.ptEleLoc[p_uPos].uJournalOff ) )
+                        {
+                            /* The last value of the element is in the journal, no need to read the storage */
+                            l_uCurOff = p_ptCtx->tDB.ptEleLoc[p_uPos].uJournalOff + EFSS_DB_JRNRAWOFF;
+                            (void)memcpy(p_puRawVal, &p_ptCtx->puJournalBuf[l_uCurOff], (uint32_t)p_uRawValL);
+                        }
                         else
                         {
                             /* Get storage info */
@@ -1008,8 +852,7 @@ e_eFSS_DB_RES eFSS_DB_GetElement(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
                                 if( e_eFSS_DB_RES_OK == l_eRes )
                                 {
                                     /* Load the page where we can find the needed element */
-                                    l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, l_uPageIdx);
-                                    l_eResLoad = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+                                    l_eResLoad = eFSS_DB_LoadPageInBuff(p_ptCtx, l_uPageIdx);
 
                                     if( ( e_eFSS_DB_RES_OK != l_eResLoad ) &&
                                         ( e_eFSS_DB_RES_OK_BKP_RCVRD != l_eResLoad ) )
@@ -1063,440 +906,2652 @@ e_eFSS_DB_RES eFSS_DB_GetElement(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_
 
 
 
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eFSS_DB_IsStatusStillCoherent(t_eFSS_DB_Ctx* const p_ptCtx)
+e_eFSS_DB_RES eFSS_DB_BeginTx(t_eFSS_DB_Ctx* const p_ptCtx, t_eFSS_DB_DbTxEle* const p_ptTxBuf,
+                              const uint32_t p_uTxBufL)
 {
-    /* Return local var */
-    bool_t l_eRes;
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
     e_eFSS_DBC_RES l_eDBCRes;
 
-    /* Local variable for storage */
-    t_eFSS_DBC_StorBuf l_tBuff;
-    uint32_t l_uTotPage;
+    /* Local var for init */
+    bool_t l_bIsInit;
 
-    /* Get usable pages and buffer length so we can check database default value validity */
-    l_uTotPage = 0u;
-    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptTxBuf ) )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
 
-    if( e_eFSS_DBC_RES_OK != l_eDBCRes )
-    {
-        l_eRes = false;
-    }
-    else
-    {
-        /* Check data validity */
-        if( ( l_uTotPage <= 0u ) || ( l_tBuff.uBufL < EFSS_DB_MINPAGESIZE ) )
-        {
-            l_eRes = false;
-        }
-        else
+        if( e_eFSS_DB_RES_OK == l_eRes )
         {
-            /* Check validity of the passed db struct */
-            l_eRes = eFSS_DB_IsDbDefStructValid(p_ptCtx->tDB, l_uTotPage, l_tBuff.uBufL);
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    if( false == p_ptCtx->bIsDbCheked )
+                    {
+                        /* Check status before executing action */
+                        l_eRes = e_eFSS_DB_RES_DBNOTCHECKED;
+                    }
+                    else if( true == p_ptCtx->bIsTxOngoing )
+                    {
+                        /* Need to commit or abort the previous transaction */
+                        l_eRes = e_eFSS_DB_RES_TXONGOING;
+                    }
+                    else if( p_uTxBufL <= 0u )
+                    {
+                        l_eRes = e_eFSS_DB_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        /* Start the transaction, nothing is written in storage till the commit */
+                        p_ptCtx->ptTxEle = p_ptTxBuf;
+                        p_ptCtx->uTxEleMax = p_uTxBufL;
+                        p_ptCtx->uTxNEle = 0u;
+                        p_ptCtx->bIsTxOngoing = true;
+                    }
+                }
+            }
         }
-    }
+	}
 
-    return l_eRes;
+	return l_eRes;
 }
 
-static e_eFSS_DB_RES eFSS_DB_DBCtoDBRes(const e_eFSS_DBC_RES p_eDBCRes)
+e_eFSS_DB_RES eFSS_DB_SetManyTx(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_DB_DbTxEle* const p_ptEle,
+                                const uint32_t p_uNEle)
 {
+	/* Return local var */
     e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
 
-    switch(p_eDBCRes)
-    {
-        case e_eFSS_DBC_RES_OK:
-        {
-            l_eRes = e_eFSS_DB_RES_OK;
-            break;
-        }
+    /* Local var for init */
+    bool_t l_bIsInit;
 
-        case e_eFSS_DBC_RES_NOINITLIB:
-        {
-            l_eRes = e_eFSS_DB_RES_NOINITLIB;
-            break;
-        }
+    /* Local variable for calculation */
+    uint32_t l_uEleIdx;
+    uint32_t l_uSrcIdx;
+    uint32_t l_uNewEle;
+    bool_t l_bIsStaged;
+    t_eFSS_DB_DbTxEle l_tCurEle;
 
-        case e_eFSS_DBC_RES_BADPARAM:
-        {
-            l_eRes = e_eFSS_DB_RES_BADPARAM;
-            break;
-        }
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptEle ) )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
 
-        case e_eFSS_DBC_RES_BADPOINTER:
+        if( e_eFSS_DB_RES_OK == l_eRes )
         {
-            l_eRes = e_eFSS_DB_RES_BADPOINTER;
-            break;
-        }
-
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    if( false == p_ptCtx->bIsDbCheked )
+                    {
+                        /* Check status before executing action */
+                        l_eRes = e_eFSS_DB_RES_DBNOTCHECKED;
+                    }
+                    else if( false == p_ptCtx->bIsTxOngoing )
+                    {
+                        /* Need to start a transaction first */
+                        l_eRes = e_eFSS_DB_RES_TXNOTSTARTED;
+                    }
+                    else if( p_uNEle <= 0u )
+                    {
+                        l_eRes = e_eFSS_DB_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        /* Verify every element before staging anything, and count how many of them are not already
+                           staged, so we know if we have enough space to stage all of them */
+                        l_uNewEle = 0u;
+                        l_uSrcIdx = 0u;
+
+                        while( ( l_uSrcIdx < p_uNEle ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
+                        {
+                            l_tCurEle = p_ptEle[l_uSrcIdx];
+
+                            if( NULL == l_tCurEle.puRawVal )
+                            {
+                                l_eRes = e_eFSS_DB_RES_BADPOINTER;
+                            }
+                            else if( ( l_tCurEle.uPos >= p_ptCtx->tDB.uNEle ) ||
+                                     ( l_tCurEle.uRawValL != p_ptCtx->tDB.ptDefEle[l_tCurEle.uPos].uEleL ) )
+                            {
+                                l_eRes = e_eFSS_DB_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                /* Already staged or already present in the passed array? */
+                                l_bIsStaged = false;
+                                l_uEleIdx = 0u;
+                                while( ( l_uEleIdx < p_ptCtx->uTxNEle ) && ( false == l_bIsStaged ) )
+                                {
+                                    if( l_tCurEle.uPos == p_ptCtx->ptTxEle[l_uEleIdx].uPos )
+                                    {
+                                        l_bIsStaged = true;
+                                    }
+                                    l_uEleIdx++;
+                                }
+
+                                l_uEleIdx = 0u;
+                                while( ( l_uEleIdx < l_uSrcIdx ) && ( false == l_bIsStaged ) )
+                                {
+                                    if( l_tCurEle.uPos == p_ptEle[l_uEleIdx].uPos )
+                                    {
+                                        l_bIsStaged = true;
+                                    }
+                                    l_uEleIdx++;
+                                }
+
+                                if( false == l_bIsStaged )
+                                {
+                                    l_uNewEle++;
+                                }
+                            }
+
+                            l_uSrcIdx++;
+                        }
+
+                        if( e_eFSS_DB_RES_OK == l_eRes )
+                        {
+                            if( l_uNewEle > ( p_ptCtx->uTxEleMax - p_ptCtx->uTxNEle ) )
+                            {
+                                /* Not enough space to stage all the element */
+                                l_eRes = e_eFSS_DB_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                /* Stage every element, replacing the value of the already staged one */
+                                for( l_uSrcIdx = 0u; l_uSrcIdx < p_uNEle; l_uSrcIdx++ )
+                                {
+                                    l_tCurEle = p_ptEle[l_uSrcIdx];
+
+                                    l_bIsStaged = false;
+                                    l_uEleIdx = 0u;
+                                    while( ( l_uEleIdx < p_ptCtx->uTxNEle ) && ( false == l_bIsStaged ) )
+                                    {
+                                        if( l_tCurEle.uPos == p_ptCtx->ptTxEle[l_uEleIdx].uPos )
+                                        {
+                                            p_ptCtx->ptTxEle[l_uEleIdx] = l_tCurEle;
+                                            l_bIsStaged = true;
+                                        }
+                                        l_uEleIdx++;
+                                    }
+
+                                    if( false == l_bIsStaged )
+                                    {
+                                        p_ptCtx->ptTxEle[p_ptCtx->uTxNEle] = l_tCurEle;
+                                        p_ptCtx->uTxNEle++;
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DB_RES eFSS_DB_CommitTx(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DB_RES l_eResLoad;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local variable for calculation */
+    uint32_t l_uPageIdx;
+    uint32_t l_uLastPage;
+    uint32_t l_uStartPage;
+    bool_t l_bIsFound;
+    bool_t l_bIsPageRecFromBkup;
+    bool_t l_bIsCommitted;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    if( false == p_ptCtx->bIsDbCheked )
+                    {
+                        /* Check status before executing action */
+                        l_eRes = e_eFSS_DB_RES_DBNOTCHECKED;
+                    }
+                    else if( false == p_ptCtx->bIsTxOngoing )
+                    {
+                        /* Need to start a transaction first */
+                        l_eRes = e_eFSS_DB_RES_TXNOTSTARTED;
+                    }
+                    else
+                    {
+                        /* Get storage info */
+                        l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+                        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                        /* The commit is done in two step:
+                           1 - Every modified page is loaded, updated with all the staged element that it contains
+                               and written only in his backup page. The last page written is the commit marker.
+                           2 - Every staged page is copied in his origin page, and the backup page is marked as a
+                               normal backup page. The commit marker is the last page copied.
+                           If the first step is interrupted no commit marker is present and the old value are still
+                           present in the origin pages. If the second step is interrupted the commit marker is still
+                           present, so we can complete the copy of the staged pages. */
+                        l_bIsPageRecFromBkup = false;
+                        l_bIsCommitted = false;
+                        l_uStartPage = 0u;
+                        l_uLastPage = 0u;
+
+                        /* When the journal is used try to commit the whole transaction with a single journal page */
+                        if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( 0u != p_ptCtx->tDB.uJournalPages ) )
+                        {
+                            l_eRes = eFSS_DB_CommitTxInJournal(p_ptCtx, &l_bIsCommitted);
+
+                            if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+                            {
+                                l_bIsPageRecFromBkup = true;
+                                l_eRes = e_eFSS_DB_RES_OK;
+                            }
+                        }
+
+                        l_bIsFound = ( ( e_eFSS_DB_RES_OK == l_eRes ) && ( false == l_bIsCommitted ) );
+
+                        while( ( true == l_bIsFound ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
+                        {
+                            l_eRes = eFSS_DB_GetTxPage(p_ptCtx, l_tBuff.uBufL, l_uStartPage, &l_uPageIdx, &l_uLastPage,
+                                                       &l_bIsFound);
+
+                            if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( true == l_bIsFound ) )
+                            {
+                                /* Load the page where we can find the staged elements */
+                                l_eResLoad = eFSS_DB_LoadPageInBuff(p_ptCtx, l_uPageIdx);
+
+                                if( ( e_eFSS_DB_RES_OK != l_eResLoad ) &&
+                                    ( e_eFSS_DB_RES_OK_BKP_RCVRD != l_eResLoad ) )
+                                {
+                                    l_eRes = l_eResLoad;
+                                }
+                                else
+                                {
+                                    if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eResLoad )
+                                    {
+                                        l_bIsPageRecFromBkup = true;
+                                    }
+
+                                    /* Update every staged element of this page */
+                                    l_eRes = eFSS_DB_SetTxEleInBuffer(p_ptCtx, l_tBuff, l_uPageIdx);
+
+                                    if( e_eFSS_DB_RES_OK == l_eRes )
+                                    {
+                                        /* Stage the page, the last one is the commit marker */
+                                        l_eDBCRes = eFSS_DBC_FlushBuffInTxPage(&p_ptCtx->tDbcCtx, l_uPageIdx,
+                                                                               ( l_uPageIdx == l_uLastPage ) );
+                                        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+                                    }
+                                }
+
+                                l_uStartPage = l_uPageIdx + 1u;
+                            }
+                        }
+
+                        /* All pages staged, copy them in the origin area */
+                        l_uStartPage = 0u;
+                        l_bIsFound = ( ( e_eFSS_DB_RES_OK == l_eRes ) && ( false == l_bIsCommitted ) );
+
+                        while( ( true == l_bIsFound ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
+                        {
+                            l_eRes = eFSS_DB_GetTxPage(p_ptCtx, l_tBuff.uBufL, l_uStartPage, &l_uPageIdx, &l_uLastPage,
+                                                       &l_bIsFound);
+
+                            if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( true == l_bIsFound ) )
+                            {
+                                l_eDBCRes = eFSS_DBC_LoadTxPageInBuff(&p_ptCtx->tDbcCtx, l_uPageIdx);
+                                l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                                if( e_eFSS_DB_RES_OK == l_eRes )
+                                {
+                                    l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx, l_uPageIdx);
+                                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+                                }
+
+                                l_uStartPage = l_uPageIdx + 1u;
+                            }
+                        }
+
+                        if( e_eFSS_DB_RES_OK == l_eRes )
+                        {
+                            if( true == l_bIsPageRecFromBkup )
+                            {
+                                l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
+                            }
+                        }
+                        else
+                        {
+                            /* Storage could contains an interrupted transaction, force the user to check the
+                             * database again, so the transaction will be completed or discarded */
+                            p_ptCtx->bIsDbCheked = false;
+                        }
+
+                        /* The transaction is closed in any case */
+                        p_ptCtx->bIsTxOngoing = false;
+                        p_ptCtx->ptTxEle = NULL;
+                        p_ptCtx->uTxEleMax = 0u;
+                        p_ptCtx->uTxNEle = 0u;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DB_RES eFSS_DB_AbortTx(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    if( false == p_ptCtx->bIsTxOngoing )
+                    {
+                        l_eRes = e_eFSS_DB_RES_TXNOTSTARTED;
+                    }
+                    else
+                    {
+                        /* Nothing was written in storage, just forget the staged elements */
+                        p_ptCtx->bIsTxOngoing = false;
+                        p_ptCtx->ptTxEle = NULL;
+                        p_ptCtx->uTxEleMax = 0u;
+                        p_ptCtx->uTxNEle = 0u;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DB_RES eFSS_DB_CompactJournal(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local variable to keep track of recoveredPage */
+    bool_t l_bIsPageRecFromBkup;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    if( false == p_ptCtx->bIsDbCheked )
+                    {
+                        /* Check status before executing action */
+                        l_eRes = e_eFSS_DB_RES_DBNOTCHECKED;
+                    }
+                    else if( ( 0u != p_ptCtx->tDB.uJournalPages ) && ( 0u != p_ptCtx->uJournalUsed ) )
+                    {
+                        /* Copy the element in their pages and write an empty journal page */
+                        l_bIsPageRecFromBkup = false;
+                        l_eRes = eFSS_DB_ApplyJournal(p_ptCtx);
+
+                        if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+                        {
+                            l_bIsPageRecFromBkup = true;
+                            l_eRes = e_eFSS_DB_RES_OK;
+                        }
+
+                        if( e_eFSS_DB_RES_OK == l_eRes )
+                        {
+                            l_eRes = eFSS_DB_FlushJournal(p_ptCtx, true);
+                        }
+
+                        if( e_eFSS_DB_RES_OK == l_eRes )
+                        {
+                            if( true == l_bIsPageRecFromBkup )
+                            {
+                                l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
+                            }
+                        }
+                        else
+                        {
+                            /* The journal in RAM could not match the stored one, force the user to check the
+                             * database again */
+                            p_ptCtx->bIsDbCheked = false;
+                        }
+                    }
+                    else
+                    {
+                        /* Nothing to compact */
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DB_RES eFSS_DB_Scrub(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_TYPE_ScrubBudget p_tBudget)
+{
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local variable for the budget */
+    t_eFSS_TYPE_ScrubBudget l_tBudget;
+    uint32_t l_uStartTime;
+    uint32_t l_uPageDone;
+    bool_t l_bIsStop;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* An interrupted transaction leave origin and backup different on purpose, only the status
+                     * check can recover it */
+                    if( false == p_ptCtx->bIsDbCheked )
+                    {
+                        l_eRes = e_eFSS_DB_RES_DBNOTCHECKED;
+                    }
+                    else
+                    {
+                        l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+                        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                        if( e_eFSS_DB_RES_OK == l_eRes )
+                        {
+                            /* Without a start time only the page limit can be used */
+                            l_tBudget = p_tBudget;
+                            if( false == eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime) )
+                            {
+                                l_tBudget.uMaxTime = 0u;
+                                l_uStartTime = 0u;
+                            }
+
+                            /* Loading a page together with his backup repair the divergent or corrupted copy */
+                            l_uPageDone = 0u;
+                            l_bIsStop = false;
+
+                            while( false == l_bIsStop )
+                            {
+                                l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, p_ptCtx->tScrub.uNextIdx);
+                                l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                                if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
+                                {
+                                    if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+                                    {
+                                        p_ptCtx->tScrub.bIsRepaired = true;
+                                    }
+
+                                    l_uPageDone++;
+                                    p_ptCtx->tScrub.uNextIdx++;
+
+                                    if( p_ptCtx->tScrub.uNextIdx >= l_uTotPage )
+                                    {
+                                        /* Pass ended, the next call start a new one */
+                                        if( true == p_ptCtx->tScrub.bIsRepaired )
+                                        {
+                                            l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
+                                        }
+                                        else
+                                        {
+                                            l_eRes = e_eFSS_DB_RES_OK;
+                                        }
+
+                                        (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
+                                        l_bIsStop = true;
+                                    }
+                                    else
+                                    {
+                                        l_eRes = e_eFSS_DB_RES_INPROGRESS;
+                                        l_bIsStop = eFSS_Utils_IsBudgetEnded(p_ptCtx->ptCtxTime, p_ptCtx->fTime,
+                                                                             l_tBudget, l_uStartTime, l_uPageDone);
+                                    }
+                                }
+                                else
+                                {
+                                    /* Restart the pass, and if no valid copy is found force a new check */
+                                    (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
+                                    if( ( e_eFSS_DB_RES_NOTVALIDDB == l_eRes ) ||
+                                        ( e_eFSS_DB_RES_NEWVERSIONFOUND == l_eRes ) )
+                                    {
+                                        p_ptCtx->bIsDbCheked = false;
+                                    }
+                                    l_bIsStop = true;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DB_RES eFSS_DB_GetStats(t_eFSS_DB_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats)
+{
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The counters are kept by the low level core of the storage area */
+                    l_eDBCRes = eFSS_DBC_GetStats(&p_ptCtx->tDbcCtx, p_ptStats);
+                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                    /* The latency of the public functions are kept here */
+                    if( e_eFSS_DB_RES_OK == l_eRes )
+                    {
+                        p_ptStats->tLatAdd = p_ptCtx->tLatAdd;
+                        p_ptStats->tLatStatus = p_ptCtx->tLatStatus;
+                        p_ptStats->tLatFormat = p_ptCtx->tLatFormat;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_DB_RES eFSS_DB_ResetStats(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_DB_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eDBCRes = eFSS_DBC_IsInit(&p_ptCtx->tDbcCtx, &l_bIsInit);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_DB_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Reset the counters of the low level core */
+                    l_eDBCRes = eFSS_DBC_ResetStats(&p_ptCtx->tDbcCtx);
+                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                    if( e_eFSS_DB_RES_OK == l_eRes )
+                    {
+                        (void)memset(&p_ptCtx->tLatAdd, 0, sizeof(t_eFSS_TYPE_LatHist));
+                        (void)memset(&p_ptCtx->tLatStatus, 0, sizeof(t_eFSS_TYPE_LatHist));
+                        (void)memset(&p_ptCtx->tLatFormat, 0, sizeof(t_eFSS_TYPE_LatHist));
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSS_DB_IsStatusStillCoherent(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+    /* Return local var */
+    bool_t l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Get usable pages and buffer length so we can check database default value validity */
+    l_uTotPage = 0u;
+    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+
+    if( e_eFSS_DBC_RES_OK != l_eDBCRes )
+    {
+        l_eRes = false;
+    }
+    else
+    {
+        /* Check data validity */
+        if( ( l_uTotPage <= 0u ) || ( l_tBuff.uBufL < EFSS_DB_MINPAGESIZE ) )
+        {
+            l_eRes = false;
+        }
+        else
+        {
+            if( NULL == p_ptCtx->tDB.ptEleLoc )
+            {
+                /* Check validity of the passed db struct */
+                l_eRes = eFSS_DB_IsDbDefStructValid(p_ptCtx->tDB, l_uTotPage, l_tBuff.uBufL, NULL);
+            }
+            else
+            {
+                /* The whole struct was already checked when the location index was filled, avoid scanning it
+                   again and check only that the last element is still inside the storage area */
+                if( ( NULL == p_ptCtx->tDB.ptDefEle ) || ( p_ptCtx->tDB.uNEle <= 0u ) ||
+                    ( p_ptCtx->tDB.uEleLocL < p_ptCtx->tDB.uNEle ) )
+                {
+                    l_eRes = false;
+                }
+                else if( p_ptCtx->tDB.ptEleLoc[p_ptCtx->tDB.uNEle - 1u].uPageIdx >= l_uTotPage )
+                {
+                    l_eRes = false;
+                }
+                else
+                {
+                    l_eRes = true;
+                }
+            }
+
+            /* Check transaction status */
+            if( ( true == l_eRes ) && ( true == p_ptCtx->bIsTxOngoing ) )
+            {
+                if( ( NULL == p_ptCtx->ptTxEle ) || ( p_ptCtx->uTxEleMax <= 0u ) ||
+                    ( p_ptCtx->uTxNEle > p_ptCtx->uTxEleMax ) )
+                {
+                    l_eRes = false;
+                }
+            }
+
+            /* Check stepped operation and scrubber status */
+            if( ( true == l_eRes ) &&
+                ( ( p_ptCtx->tStep.uOp > EFSS_DB_STEPFORMAT ) || ( p_ptCtx->tScrub.uNextIdx >= l_uTotPage ) ) )
+            {
+                l_eRes = false;
+            }
+
+            /* Check journal status */
+            if( ( true == l_eRes ) && ( 0u != p_ptCtx->tDB.uJournalPages ) )
+            {
+                if( ( NULL == p_ptCtx->puJournalBuf ) || ( NULL == p_ptCtx->tDB.ptEleLoc ) ||
+                    ( p_ptCtx->uJournalIdx >= p_ptCtx->tDB.uJournalPages ) ||
+                    ( p_ptCtx->uJournalUsed > ( l_tBuff.uBufL - EFSS_DB_JRNRECOFF ) ) )
+                {
+                    l_eRes = false;
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_DBCtoDBRes(const e_eFSS_DBC_RES p_eDBCRes)
+{
+    e_eFSS_DB_RES l_eRes;
+
+    switch(p_eDBCRes)
+    {
+        case e_eFSS_DBC_RES_OK:
+        {
+            l_eRes = e_eFSS_DB_RES_OK;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_NOINITLIB:
+        {
+            l_eRes = e_eFSS_DB_RES_NOINITLIB;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_BADPARAM:
+        {
+            l_eRes = e_eFSS_DB_RES_BADPARAM;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_BADPOINTER:
+        {
+            l_eRes = e_eFSS_DB_RES_BADPOINTER;
+            break;
+        }
+
         case e_eFSS_DBC_RES_CORRUPTCTX:
         {
             l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
-            break;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_CLBCKERASEERR:
+        {
+            l_eRes = e_eFSS_DB_RES_CLBCKERASEERR;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_CLBCKWRITEERR:
+        {
+            l_eRes = e_eFSS_DB_RES_CLBCKWRITEERR;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_CLBCKREADERR:
+        {
+            l_eRes = e_eFSS_DB_RES_CLBCKREADERR;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_CLBCKCRCERR:
+        {
+            l_eRes = e_eFSS_DB_RES_CLBCKCRCERR;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_NOTVALIDDB:
+        {
+            l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_NEWVERSIONFOUND:
+        {
+            l_eRes = e_eFSS_DB_RES_NEWVERSIONFOUND;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_WRITENOMATCHREAD:
+        {
+            l_eRes = e_eFSS_DB_RES_WRITENOMATCHREAD;
+            break;
+        }
+
+        case e_eFSS_DBC_RES_OK_BKP_RCVRD:
+        {
+            l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+            break;
+        }
+    }
+
+    return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE UTILS STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static bool_t eFSS_DB_IsDbDefStructValid(const t_eFSS_DB_DbStruct p_tDefaultDb, const uint32_t p_uNPage,
+                                         const uint32_t p_uPageL, t_eFSS_DB_DbEleLoc* const p_ptEleLoc)
+{
+    /* Check db validity:
+       1- DB array must be valid and not NULL
+       2- Numbers of element need to be different from zero
+       3- Each element version and len need to be different from zero
+       4- Element raw data must be different from NULL
+       5- An element length cannot be greater than page length
+       6- All element must be able to be stored in database
+       7- If the journal is used we need the location index, at least two journal pages and every element must
+          be able to be stored in a journal page
+       8- The location index, if present, must have room for every element
+       If p_ptEleLoc is not NULL the location of every checked element is saved in it
+     */
+
+    /* Local variable for return */
+    bool_t l_bRes;
+
+    /* Local variable used for index */
+    uint32_t l_uCurPage;
+    uint32_t l_uCurOff;
+
+    /* Local variable for calculation */
+    uint32_t l_uCurIndex;
+    t_eFSS_DB_DbElement l_tCurEle;
+
+    /* Check pointer validity */
+    if( ( NULL == p_tDefaultDb.ptDefEle ) || ( ( 0u != p_tDefaultDb.uJournalPages ) && ( NULL == p_ptEleLoc ) ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( ( p_tDefaultDb.uNEle <= 0u ) ||
+            ( ( 0u != p_tDefaultDb.uJournalPages ) && ( p_tDefaultDb.uJournalPages < EFSS_DB_JRNMINPAGES ) ) ||
+            ( ( NULL != p_ptEleLoc ) && ( p_tDefaultDb.uEleLocL < p_tDefaultDb.uNEle ) ) )
+        {
+            l_bRes = false;
+        }
+        else
+        {
+            /* Init local */
+            l_uCurIndex = 0u;
+            l_uCurPage = 0u;
+            l_uCurOff = 0u;
+            l_bRes = true;
+
+            /* Check every parameter till an error is found */
+            while( ( l_uCurIndex < p_tDefaultDb.uNEle ) && ( true == l_bRes ) )
+            {
+                /* Get curr ele */
+                l_tCurEle = p_tDefaultDb.ptDefEle[l_uCurIndex];
+
+                /* Element check */
+                if( ( 0u == l_tCurEle.uEleV ) || ( 0u == l_tCurEle.uEleL ) || ( NULL == l_tCurEle.puEleRaw ) ||
+                    ( ( l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL ) ||
+                    ( ( 0u != p_tDefaultDb.uJournalPages ) &&
+                      ( ( l_tCurEle.uEleL + EFSS_DB_JRNRAWOFF + EFSS_DB_JRNRECOFF ) > p_uPageL ) ) )
+                {
+                    /* Cannot be */
+                    l_bRes = false;
+                }
+                else
+                {
+                    /* Check if can be placed in the current "page" */
+                    if( ( l_uCurOff + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
+                    {
+                        /* Cannot be placed in this page */
+                        l_uCurPage++;
+                        l_uCurOff = 0u;
+                    }
+
+                    /* Save the element location if requested */
+                    if( NULL != p_ptEleLoc )
+                    {
+                        p_ptEleLoc[l_uCurIndex].uPageIdx = l_uCurPage;
+                        p_ptEleLoc[l_uCurIndex].uPageOff = l_uCurOff;
+                        p_ptEleLoc[l_uCurIndex].uJournalOff = EFSS_DB_NOJRNOFF;
+                    }
+
+                    /* Element placed */
+                    l_uCurOff += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
+
+                    /* Check if all ok */
+                    if( l_uCurPage >= p_uNPage )
+                    {
+                        /* Cannot be, we don't have space for storing all parameter */
+                        l_bRes = false;
+                    }
+                    else
+                    {
+                        /* Increase index */
+                        l_uCurIndex++;
+                    }
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_GetEleRawInBuffer(const uint16_t p_uExpEleL, uint8_t* const p_puBuff,
+                                               t_eFSS_DB_DbElement* const p_ptEleToGet)
+{
+    /* Local variable for result */
+    e_eFSS_DB_RES l_eRes;
+
+    /* Check null pointer */
+    if( ( NULL == p_puBuff ) || ( NULL == p_ptEleToGet ) )
+    {
+        l_eRes = e_eFSS_DB_RES_BADPOINTER;
+    }
+    else
+    {
+        /* Check parameter */
+        if( 0u == p_uExpEleL )
+        {
+            l_eRes = e_eFSS_DB_RES_BADPARAM;
+        }
+        else
+        {
+            /* can be retrived, for now */
+            p_ptEleToGet->uEleV = 0u;
+            if( true != eFSS_Utils_RetriveU16(&p_puBuff[EFSS_DB_VEROFF], &p_ptEleToGet->uEleV) )
+            {
+                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+            }
+            else
+            {
+                p_ptEleToGet->uEleL = 0u;
+                if( true != eFSS_Utils_RetriveU16(&p_puBuff[EFSS_DB_LENOFF], &p_ptEleToGet->uEleL ) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Check that the element has valid parameter */
+                    if( ( 0u == p_ptEleToGet->uEleV ) || ( p_uExpEleL != p_ptEleToGet->uEleL ) )
+                    {
+                        l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
+                    }
+                    else
+                    {
+                        /* Can be retrived, copy the raw data */
+                        p_ptEleToGet->puEleRaw = &p_puBuff[EFSS_DB_RAWOFF];
+
+                        /* All ok */
+                        l_eRes = e_eFSS_DB_RES_OK;
+                    }
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_SetEleRawInBuffer(const t_eFSS_DB_DbElement p_tEleToSet, uint8_t* const p_puBuff)
+{
+    /* Local variable for result */
+    e_eFSS_DB_RES l_eRes;
+
+    /* Check null pointer */
+    if( ( NULL == p_puBuff ) || ( NULL == p_tEleToSet.puEleRaw ) )
+    {
+        l_eRes = e_eFSS_DB_RES_BADPOINTER;
+    }
+    else
+    {
+        /* Check parameter */
+        if( ( 0u == p_tEleToSet.uEleV ) || ( 0u == p_tEleToSet.uEleL ) )
+        {
+            l_eRes = e_eFSS_DB_RES_BADPARAM;
+        }
+        else
+        {
+            /* can be placed, place */
+            if( true != eFSS_Utils_InsertU16(&p_puBuff[EFSS_DB_VEROFF], p_tEleToSet.uEleV) )
+            {
+                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+            }
+            else
+            {
+                if( true != eFSS_Utils_InsertU16(&p_puBuff[EFSS_DB_LENOFF], p_tEleToSet.uEleL) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Copy the raw data */
+                    (void)memcpy(&p_puBuff[EFSS_DB_RAWOFF], p_tEleToSet.puEleRaw, (uint32_t)p_tEleToSet.uEleL);
+
+                    /* All OK */
+                    l_eRes = e_eFSS_DB_RES_OK;
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_FindElePageAndPos(const uint32_t p_uPageL, const t_eFSS_DB_DbStruct p_tDbDefault,
+                                               const uint32_t p_uEleIdx, uint32_t* const p_puPageFound,
+                                               uint32_t* const p_puOffSetFound)
+{
+    /* Local variable for result */
+    e_eFSS_DB_RES l_eRes;
+
+    /* Local variable used for index */
+    uint32_t l_uCurPage;
+    uint32_t l_uCurOff;
+
+    /* Local variable used for calculation */
+    uint32_t l_uCurIndex;
+    t_eFSS_DB_DbElement l_tCurEle;
+
+    /* Check null pointer */
+    if( ( NULL == p_puPageFound ) || ( NULL == p_puOffSetFound ) || ( NULL == p_tDbDefault.ptDefEle ) )
+    {
+        l_eRes = e_eFSS_DB_RES_BADPOINTER;
+    }
+    else
+    {
+        /* Check element validity */
+        if( ( p_tDbDefault.uNEle <= 0u ) || ( p_uPageL < EFSS_DB_MINPAGESIZE ) || ( p_uEleIdx >= p_tDbDefault.uNEle ) )
+        {
+            l_eRes = e_eFSS_DB_RES_BADPARAM;
+        }
+        else if( NULL != p_tDbDefault.ptEleLoc )
+        {
+            /* Location index avaiable, no need to scan the whole default struct */
+            l_tCurEle = p_tDbDefault.ptDefEle[p_uEleIdx];
+            l_uCurPage = p_tDbDefault.ptEleLoc[p_uEleIdx].uPageIdx;
+            l_uCurOff = p_tDbDefault.ptEleLoc[p_uEleIdx].uPageOff;
+
+            /* Just check index validty, not needed because the index is filled during init, but who knows */
+            if( ( l_uCurOff + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
+            {
+                /* This DB index seems invalid */
+                l_eRes = e_eFSS_DB_RES_BADPARAM;
+            }
+            else
+            {
+                /* Valorize ret value */
+                *p_puPageFound = l_uCurPage;
+                *p_puOffSetFound = l_uCurOff;
+                l_eRes = e_eFSS_DB_RES_OK;
+            }
+        }
+        else
+        {
+            /* Init local variable */
+            l_eRes = e_eFSS_DB_RES_OK;
+
+            /* Init local variable */
+            l_uCurPage = 0u;
+            l_uCurOff = 0u;
+            l_uCurIndex = 0u;
+
+            /* Sum all other parameter of the DB till we reach the wanted one */
+            while( ( l_uCurIndex < p_uEleIdx ) && ( e_eFSS_DB_RES_OK == l_eRes ) && ( l_uCurPage < MAX_UINT32VAL ) )
+            {
+                /* Get current element */
+                l_tCurEle = p_tDbDefault.ptDefEle[l_uCurIndex];
+
+                /* Just check element validty, not needed because we check context validity every time, but
+                   who knows */
+                if( ( l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
+                {
+                    /* This DB struct seems invalid */
+                    l_eRes = e_eFSS_DB_RES_BADPARAM;
+                }
+                else
+                {
+                    /* Check if the current element can be placed in the current "page" */
+                    if( ( l_uCurOff + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
+                    {
+                        /* current element cannot be placed in this page */
+                        l_uCurPage++;
+                        l_uCurOff = ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
+                    }
+                    else
+                    {
+                        /* can be placed in this "page " */
+                        l_uCurOff += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
+                    }
+
+                    /* Increase index */
+                    l_uCurIndex++;
+                }
+            }
+
+            if( l_uCurPage >= MAX_UINT32VAL )
+            {
+                l_eRes = e_eFSS_DB_RES_BADPARAM;
+            }
+            else
+            {
+                if( e_eFSS_DB_RES_OK == l_eRes )
+                {
+                    /* Finded the page and the offset of the index we were looking for. We just need to check if
+                       the findeded element can be present on the current pages, if not increase it */
+                    l_tCurEle = p_tDbDefault.ptDefEle[l_uCurIndex];
+
+                    /* Just check element validty, not needed because we check context validity every time, but
+                       who knows */
+                    if( ( l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
+                    {
+                        /* This DB struct seems invalid */
+                        l_eRes = e_eFSS_DB_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        /* Check if the current element can be placed in the current "page" */
+                        if( ( l_uCurOff + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
+                        {
+                            /* Cannot be placed in this page */
+                            l_uCurPage++;
+                            l_uCurOff = 0u;
+                        }
+
+                        /* Valorize ret value */
+                        *p_puPageFound = l_uCurPage;
+                        *p_puOffSetFound = l_uCurOff;
+                    }
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_GetTxPage(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPageL,
+                                       const uint32_t p_uStartPage, uint32_t* const p_puPageFound,
+                                       uint32_t* const p_puLastPage, bool_t* const p_pbIsFound)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+
+    /* Local variable used for calculation */
+    uint32_t l_uEleIdx;
+    uint32_t l_uCurPage;
+    uint32_t l_uCurOff;
+
+    /* Search the smallest page, starting from p_uStartPage, that contains a staged element. Get also the biggest page
+       that contains a staged element, it will be the commit marker */
+    l_eRes = e_eFSS_DB_RES_OK;
+    *p_pbIsFound = false;
+    *p_puLastPage = 0u;
+    l_uEleIdx = 0u;
+
+    while( ( l_uEleIdx < p_ptCtx->uTxNEle ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
+    {
+        l_eRes = eFSS_DB_FindElePageAndPos(p_uPageL, p_ptCtx->tDB, p_ptCtx->ptTxEle[l_uEleIdx].uPos, &l_uCurPage,
+                                           &l_uCurOff);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            if( l_uCurPage > *p_puLastPage )
+            {
+                *p_puLastPage = l_uCurPage;
+            }
+
+            if( l_uCurPage >= p_uStartPage )
+            {
+                if( ( false == *p_pbIsFound ) || ( l_uCurPage < *p_puPageFound ) )
+                {
+                    *p_puPageFound = l_uCurPage;
+                    *p_pbIsFound = true;
+                }
+            }
+        }
+
+        l_uEleIdx++;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_SetTxEleInBuffer(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_DBC_StorBuf p_tBuff,
+                                              const uint32_t p_uPageIdx)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+
+    /* Local variable used for calculation */
+    uint32_t l_uEleIdx;
+    uint32_t l_uCurPage;
+    uint32_t l_uCurOff;
+    uint32_t l_uPos;
+    t_eFSS_DB_DbElement l_tCurEle;
+
+    l_eRes = e_eFSS_DB_RES_OK;
+    l_uEleIdx = 0u;
+
+    while( ( l_uEleIdx < p_ptCtx->uTxNEle ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
+    {
+        l_uPos = p_ptCtx->ptTxEle[l_uEleIdx].uPos;
+        l_eRes = eFSS_DB_FindElePageAndPos(p_tBuff.uBufL, p_ptCtx->tDB, l_uPos, &l_uCurPage, &l_uCurOff);
+
+        if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( p_uPageIdx == l_uCurPage ) )
+        {
+            /* Verify if the already stored element is correct */
+            (void)memset(&l_tCurEle, 0, sizeof(t_eFSS_DB_DbElement) );
+
+            l_eRes = eFSS_DB_GetEleRawInBuffer( p_ptCtx->tDB.ptDefEle[l_uPos].uEleL, &p_tBuff.puBuf[l_uCurOff],
+                                                &l_tCurEle);
+
+            if( e_eFSS_DB_RES_OK == l_eRes )
+            {
+                if( l_tCurEle.uEleV != p_ptCtx->tDB.ptDefEle[l_uPos].uEleV )
+                {
+                    /* The database is incoherent, the version should match because the function
+                     * eFSS_DB_GetDBStatus was already called */
+                    l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
+                }
+                else
+                {
+                    l_tCurEle.uEleL = p_ptCtx->tDB.ptDefEle[l_uPos].uEleL;
+                    l_tCurEle.uEleV = p_ptCtx->tDB.ptDefEle[l_uPos].uEleV;
+                    l_tCurEle.puEleRaw = p_ptCtx->ptTxEle[l_uEleIdx].puRawVal;
+
+                    l_eRes = eFSS_DB_SetEleRawInBuffer(l_tCurEle, &p_tBuff.puBuf[l_uCurOff] );
+                }
+            }
+        }
+
+        l_uEleIdx++;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_LoadJournal(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local variable used for calculation */
+    uint32_t l_uJrnIdx;
+    uint32_t l_uSeq;
+    uint32_t l_uUsed;
+    bool_t l_bIsFound;
+
+    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+    if( e_eFSS_DB_RES_OK == l_eRes )
+    {
+        /* Start from an empty journal, so if no journal page is found the next one written will be the first */
+        eFSS_DB_ClearJournal(p_ptCtx, l_tBuff.uBufL);
+        p_ptCtx->uJournalIdx = p_ptCtx->tDB.uJournalPages - 1u;
+        p_ptCtx->uJournalSeq = 0u;
+        l_bIsFound = false;
+        l_uJrnIdx = 0u;
+
+        /* Search the newest journal page, the one with the highest sequence number. A page and his mirror have the
+           same sequence number, and the one with more records is the newest, the other could miss the last append */
+        while( ( l_uJrnIdx < p_ptCtx->tDB.uJournalPages ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
+        {
+            l_eDBCRes = eFSS_DBC_LoadJournalPageInBuff(&p_ptCtx->tDbcCtx, l_uJrnIdx);
+            l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+            if( e_eFSS_DB_RES_OK == l_eRes )
+            {
+                l_uSeq = 0u;
+                l_uUsed = 0u;
+                if( true != eFSS_Utils_RetriveU32(&l_tBuff.puBuf[EFSS_DB_JRNSEQOFF], &l_uSeq) )
+                {
+                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_eRes = eFSS_DB_ScanJournal(p_ptCtx, l_tBuff.puBuf, l_tBuff.uBufL, false, &l_uUsed);
+
+                    if( ( e_eFSS_DB_RES_OK == l_eRes ) &&
+                        ( ( false == l_bIsFound ) || ( l_uSeq > p_ptCtx->uJournalSeq ) ||
+                          ( ( l_uSeq == p_ptCtx->uJournalSeq ) && ( l_uUsed > p_ptCtx->uJournalUsed ) ) ) )
+                    {
+                        l_bIsFound = true;
+                        p_ptCtx->uJournalIdx = l_uJrnIdx;
+                        p_ptCtx->uJournalSeq = l_uSeq;
+                        p_ptCtx->uJournalUsed = l_uUsed;
+                        (void)memcpy(p_ptCtx->puJournalBuf, l_tBuff.puBuf, l_tBuff.uBufL);
+                    }
+                }
+            }
+            else if( ( e_eFSS_DB_RES_NOTVALIDDB == l_eRes ) || ( e_eFSS_DB_RES_NEWVERSIONFOUND == l_eRes ) )
+            {
+                /* Not a valid journal page, skip it */
+                l_eRes = e_eFSS_DB_RES_OK;
+            }
+            else
+            {
+                /* Error, the loop will exit */
+            }
+
+            l_uJrnIdx++;
+        }
+
+        if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( true == l_bIsFound ) )
+        {
+            /* Fill the location index with the records of the newest journal page, the last record of an element
+               is his value */
+            l_eRes = eFSS_DB_ScanJournal(p_ptCtx, p_ptCtx->puJournalBuf, l_tBuff.uBufL, true, &l_uUsed);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_ScanJournal(t_eFSS_DB_Ctx* const p_ptCtx, const uint8_t* const p_puJrnBuf,
+                                         const uint32_t p_uBufL, const bool_t p_bIsLocFilled, uint32_t* const p_puUsed)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+
+    /* Local variable used for calculation */
+    uint32_t l_uCurOff;
+    uint32_t l_uPadIdx;
+    uint32_t l_uPos;
+    uint16_t l_uLen;
+    bool_t l_bIsEnd;
+
+    /* Records are stored one after the other, the first record header equal to the pad value end the journal */
+    l_eRes = e_eFSS_DB_RES_OK;
+    l_uCurOff = EFSS_DB_JRNRECOFF;
+    l_bIsEnd = false;
+
+    while( ( false == l_bIsEnd ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
+    {
+        l_uPadIdx = 0u;
+        if( ( l_uCurOff + EFSS_DB_JRNRAWOFF ) <= p_uBufL )
+        {
+            while( ( l_uPadIdx < EFSS_DB_JRNRAWOFF ) && ( p_ptCtx->uJournalPad == p_puJrnBuf[l_uCurOff + l_uPadIdx] ) )
+            {
+                l_uPadIdx++;
+            }
+        }
+
+        if( ( ( l_uCurOff + EFSS_DB_JRNRAWOFF ) > p_uBufL ) || ( EFSS_DB_JRNRAWOFF == l_uPadIdx ) )
+        {
+            l_bIsEnd = true;
+        }
+        else
+        {
+            l_uPos = 0u;
+            l_uLen = 0u;
+
+            if( ( true != eFSS_Utils_RetriveU32(&p_puJrnBuf[l_uCurOff + EFSS_DB_JRNPOSOFF], &l_uPos) ) ||
+                ( true != eFSS_Utils_RetriveU16(&p_puJrnBuf[l_uCurOff + EFSS_DB_JRNLENOFF], &l_uLen) ) )
+            {
+                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+            }
+            else if( ( l_uPos >= p_ptCtx->tDB.uNEle ) || ( l_uLen != p_ptCtx->tDB.ptDefEle[l_uPos].uEleL ) ||
+                     ( ( l_uCurOff + EFSS_DB_JRNRAWOFF + l_uLen ) > p_uBufL ) )
+            {
+                /* The journal doesn't match the database struct */
+                l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
+            }
+            else
+            {
+                if( true == p_bIsLocFilled )
+                {
+                    p_ptCtx->tDB.ptEleLoc[l_uPos].uJournalOff = l_uCurOff;
+                }
+                l_uCurOff += ( EFSS_DB_JRNRAWOFF + l_uLen );
+            }
+        }
+    }
+
+    *p_puUsed = l_uCurOff - EFSS_DB_JRNRECOFF;
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_ApplyJournal(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local variable used for calculation */
+    uint32_t l_uEleIdx;
+    uint32_t l_uCurPage;
+    bool_t l_bIsLoaded;
+    bool_t l_bIsPageRecFromBkup;
+    t_eFSS_DB_DbEleLoc l_tCurLoc;
+    t_eFSS_DB_DbElement l_tCurEle;
+
+    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+    /* Element are stored in ascending page order, so every page is loaded and flushed only once */
+    l_uEleIdx = 0u;
+    l_uCurPage = 0u;
+    l_bIsLoaded = false;
+    l_bIsPageRecFromBkup = false;
+
+    while( ( l_uEleIdx < p_ptCtx->tDB.uNEle ) && ( e_eFSS_DB_RES_OK == l_eRes ) )
+    {
+        l_tCurLoc = p_ptCtx->tDB.ptEleLoc[l_uEleIdx];
+
+        if( EFSS_DB_NOJRNOFF != l_tCurLoc.uJournalOff )
+        {
+            if( ( false == l_bIsLoaded ) || ( l_uCurPage != l_tCurLoc.uPageIdx ) )
+            {
+                /* Flush the previous page before loading the needed one */
+                if( true == l_bIsLoaded )
+                {
+                    l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx, l_uCurPage);
+                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+                }
+
+                if( e_eFSS_DB_RES_OK == l_eRes )
+                {
+                    l_uCurPage = l_tCurLoc.uPageIdx;
+                    l_eRes = eFSS_DB_LoadPageInBuff(p_ptCtx, l_uCurPage);
+
+                    if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+                    {
+                        l_bIsPageRecFromBkup = true;
+                        l_eRes = e_eFSS_DB_RES_OK;
+                    }
+
+                    l_bIsLoaded = ( e_eFSS_DB_RES_OK == l_eRes );
+                }
+            }
+
+            if( e_eFSS_DB_RES_OK == l_eRes )
+            {
+                /* Copy only the raw value, the stored version is checked when the database is checked */
+                (void)memset(&l_tCurEle, 0, sizeof(t_eFSS_DB_DbElement) );
+                l_eRes = eFSS_DB_GetEleRawInBuffer( p_ptCtx->tDB.ptDefEle[l_uEleIdx].uEleL,
+                                                    &l_tBuff.puBuf[l_tCurLoc.uPageOff], &l_tCurEle);
+
+                if( e_eFSS_DB_RES_OK == l_eRes )
+                {
+                    (void)memcpy(l_tCurEle.puEleRaw, &p_ptCtx->puJournalBuf[l_tCurLoc.uJournalOff + EFSS_DB_JRNRAWOFF],
+                                 (uint32_t)l_tCurEle.uEleL);
+                }
+            }
+        }
+
+        l_uEleIdx++;
+    }
+
+    if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( true == l_bIsLoaded ) )
+    {
+        l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx, l_uCurPage);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+    }
+
+    if( e_eFSS_DB_RES_OK == l_eRes )
+    {
+        /* Every element is in his page, the journal in RAM can be emptied */
+        eFSS_DB_ClearJournal(p_ptCtx, l_tBuff.uBufL);
+
+        if( true == l_bIsPageRecFromBkup )
+        {
+            l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_FlushJournal(t_eFSS_DB_Ctx* const p_ptCtx, const bool_t p_bIsNewPage)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local variable used for calculation */
+    uint32_t l_uNextIdx;
+    uint32_t l_uNextSeq;
+
+    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+    if( e_eFSS_DB_RES_OK == l_eRes )
+    {
+        if( ( true == p_bIsNewPage ) || ( false == p_ptCtx->bIsJournalApp ) )
+        {
+            /* Never overwrite the newest journal page, so if the write is interrupted the previous one is still
+               valid */
+            l_uNextIdx = ( p_ptCtx->uJournalIdx + 1u ) % p_ptCtx->tDB.uJournalPages;
+            l_uNextSeq = p_ptCtx->uJournalSeq + 1u;
+        }
+        else
+        {
+            /* Only new records are appended, they are programmed in place in the newest journal page */
+            l_uNextIdx = p_ptCtx->uJournalIdx;
+            l_uNextSeq = p_ptCtx->uJournalSeq;
+        }
+
+        if( true != eFSS_Utils_InsertU32(&p_ptCtx->puJournalBuf[EFSS_DB_JRNSEQOFF], l_uNextSeq) )
+        {
+            l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+        }
+        else
+        {
+            (void)memcpy(l_tBuff.puBuf, p_ptCtx->puJournalBuf, l_tBuff.uBufL);
+
+            l_eDBCRes = eFSS_DBC_FlushBuffInJournalPage(&p_ptCtx->tDbcCtx, l_uNextIdx);
+            l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+            if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( true == p_ptCtx->bIsJournalApp ) )
+            {
+                /* The mirror is written only after the page, so if one of them is interrupted the other one has
+                   every record except, at most, the one that was being appended */
+                (void)memcpy(l_tBuff.puBuf, p_ptCtx->puJournalBuf, l_tBuff.uBufL);
+
+                l_eDBCRes = eFSS_DBC_FlushBuffInJournalPage(&p_ptCtx->tDbcCtx,
+                                                            ( l_uNextIdx + 1u ) % p_ptCtx->tDB.uJournalPages);
+                l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+            }
+
+            if( e_eFSS_DB_RES_OK == l_eRes )
+            {
+                p_ptCtx->uJournalIdx = l_uNextIdx;
+                p_ptCtx->uJournalSeq = l_uNextSeq;
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_RecoverJournal(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+
+    l_eRes = eFSS_DB_LoadJournal(p_ptCtx);
+
+    if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( 0u != p_ptCtx->uJournalUsed ) )
+    {
+        /* Copy the journal in the pages and write an empty journal page */
+        l_eRes = eFSS_DB_ApplyJournal(p_ptCtx);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            l_eRes = eFSS_DB_FlushJournal(p_ptCtx, true);
+        }
+        else if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+        {
+            l_eRes = eFSS_DB_FlushJournal(p_ptCtx, true);
+
+            if( e_eFSS_DB_RES_OK == l_eRes )
+            {
+                l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
+            }
+        }
+        else
+        {
+            /* Error */
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_ResetJournal(t_eFSS_DB_Ctx* const p_ptCtx)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Load the journal only to know the newest journal page, stored element are discarded anyway */
+    l_eRes = eFSS_DB_LoadJournal(p_ptCtx);
+
+    if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_NOTVALIDDB == l_eRes ) )
+    {
+        l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+        l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            eFSS_DB_ClearJournal(p_ptCtx, l_tBuff.uBufL);
+            l_eRes = eFSS_DB_FlushJournal(p_ptCtx, true);
+        }
+    }
+
+    return l_eRes;
+}
+
+static void eFSS_DB_ClearJournal(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uBufL)
+{
+    /* Local variable used for calculation */
+    uint32_t l_uEleIdx;
+
+    (void)memset(&p_ptCtx->puJournalBuf[EFSS_DB_JRNRECOFF], (int)p_ptCtx->uJournalPad,
+                 ( p_uBufL - EFSS_DB_JRNRECOFF ) );
+    p_ptCtx->uJournalUsed = 0u;
+
+    for( l_uEleIdx = 0u; l_uEleIdx < p_ptCtx->tDB.uNEle; l_uEleIdx++ )
+    {
+        p_ptCtx->tDB.ptEleLoc[l_uEleIdx].uJournalOff = EFSS_DB_NOJRNOFF;
+    }
+}
+
+static e_eFSS_DB_RES eFSS_DB_SetEleInJournal(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uBufL,
+                                             const uint32_t p_uPos, const uint8_t* const p_puRawVal,
+                                             bool_t* const p_pbIsStored)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+
+    /* Local variable used for calculation */
+    uint32_t l_uCurOff;
+    uint16_t l_uLen;
+
+    l_eRes = e_eFSS_DB_RES_OK;
+    l_uLen = p_ptCtx->tDB.ptDefEle[p_uPos].uEleL;
+    l_uCurOff = p_ptCtx->tDB.ptEleLoc[p_uPos].uJournalOff;
+
+    if( ( EFSS_DB_NOJRNOFF != l_uCurOff ) && ( false == p_ptCtx->bIsJournalApp ) )
+    {
+        /* Already present in the journal, just update the value. When appending the old record is kept, so the
+           journal page only program erased byte, and the last record is the value of the element */
+        (void)memcpy(&p_ptCtx->puJournalBuf[l_uCurOff + EFSS_DB_JRNRAWOFF], p_puRawVal, (uint32_t)l_uLen);
+        *p_pbIsStored = true;
+    }
+    else
+    {
+        l_uCurOff = EFSS_DB_JRNRECOFF + p_ptCtx->uJournalUsed;
+
+        if( ( l_uCurOff + EFSS_DB_JRNRAWOFF + l_uLen ) > p_uBufL )
+        {
+            /* Journal full */
+            *p_pbIsStored = false;
+        }
+        else if( ( true != eFSS_Utils_InsertU32(&p_ptCtx->puJournalBuf[l_uCurOff + EFSS_DB_JRNPOSOFF], p_uPos) ) ||
+                 ( true != eFSS_Utils_InsertU16(&p_ptCtx->puJournalBuf[l_uCurOff + EFSS_DB_JRNLENOFF], l_uLen) ) )
+        {
+            l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+        }
+        else
+        {
+            /* Append the new record */
+            (void)memcpy(&p_ptCtx->puJournalBuf[l_uCurOff + EFSS_DB_JRNRAWOFF], p_puRawVal, (uint32_t)l_uLen);
+            p_ptCtx->tDB.ptEleLoc[p_uPos].uJournalOff = l_uCurOff;
+            p_ptCtx->uJournalUsed += ( EFSS_DB_JRNRAWOFF + l_uLen );
+            *p_pbIsStored = true;
         }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_SaveEleInJournal(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPos,
+                                              const uint8_t* const p_puRawVal)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local variable used for calculation */
+    bool_t l_bIsStored;
+    bool_t l_bIsApplied;
+    bool_t l_bIsPageRecFromBkup;
+
+    l_bIsStored = false;
+    l_bIsApplied = false;
+    l_bIsPageRecFromBkup = false;
+
+    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+    if( e_eFSS_DB_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_DB_SetEleInJournal(p_ptCtx, l_tBuff.uBufL, p_uPos, p_puRawVal, &l_bIsStored);
+    }
+
+    if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( false == l_bIsStored ) )
+    {
+        /* Journal full, copy it in the pages. The new journal page will contains only the new element */
+        l_eRes = eFSS_DB_ApplyJournal(p_ptCtx);
+        l_bIsApplied = true;
+
+        if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+        {
+            l_bIsPageRecFromBkup = true;
+            l_eRes = e_eFSS_DB_RES_OK;
+        }
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            l_eRes = eFSS_DB_SetEleInJournal(p_ptCtx, l_tBuff.uBufL, p_uPos, p_puRawVal, &l_bIsStored);
+
+            if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( false == l_bIsStored ) )
+            {
+                /* Cannot be, element length is checked during init */
+                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+            }
+        }
+    }
+
+    if( e_eFSS_DB_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_DB_FlushJournal(p_ptCtx, l_bIsApplied);
+    }
+
+    if( e_eFSS_DB_RES_OK == l_eRes )
+    {
+        if( true == l_bIsPageRecFromBkup )
+        {
+            l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
+        }
+    }
+    else
+    {
+        /* The journal in RAM could not match the stored one, force the user to check the database again */
+        p_ptCtx->bIsDbCheked = false;
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_CommitTxInJournal(t_eFSS_DB_Ctx* const p_ptCtx, bool_t* const p_pbIsCommitted)
+{
+    /* Local variable */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Local variable for storage */
+    t_eFSS_DBC_StorBuf l_tBuff;
+    uint32_t l_uTotPage;
+
+    /* Local variable used for calculation */
+    uint32_t l_uEleIdx;
+    uint32_t l_uPos;
+    uint32_t l_uNeeded;
+    bool_t l_bIsStored;
+    bool_t l_bIsApplied;
+    bool_t l_bIsPageRecFromBkup;
+
+    *p_pbIsCommitted = false;
+    l_bIsApplied = false;
+    l_bIsPageRecFromBkup = false;
+
+    l_eDBCRes = eFSS_DBC_GetBuffNUsable(&p_ptCtx->tDbcCtx, &l_tBuff, &l_uTotPage);
+    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
 
-        case e_eFSS_DBC_RES_CLBCKERASEERR:
+    if( e_eFSS_DB_RES_OK == l_eRes )
+    {
+        /* Calculate the space needed by the element not already present in the journal */
+        l_uNeeded = 0u;
+        for( l_uEleIdx = 0u; l_uEleIdx < p_ptCtx->uTxNEle; l_uEleIdx++ )
         {
-            l_eRes = e_eFSS_DB_RES_CLBCKERASEERR;
-            break;
+            l_uPos = p_ptCtx->ptTxEle[l_uEleIdx].uPos;
+            if( ( EFSS_DB_NOJRNOFF == p_ptCtx->tDB.ptEleLoc[l_uPos].uJournalOff ) ||
+                ( true == p_ptCtx->bIsJournalApp ) )
+            {
+                l_uNeeded += ( EFSS_DB_JRNRAWOFF + p_ptCtx->tDB.ptDefEle[l_uPos].uEleL );
+            }
         }
 
-        case e_eFSS_DBC_RES_CLBCKWRITEERR:
+        if( l_uNeeded > ( l_tBuff.uBufL - EFSS_DB_JRNRECOFF - p_ptCtx->uJournalUsed ) )
         {
-            l_eRes = e_eFSS_DB_RES_CLBCKWRITEERR;
-            break;
-        }
+            /* Not enough space, copy the journal in the pages and retry with an empty journal */
+            l_eRes = eFSS_DB_ApplyJournal(p_ptCtx);
+            l_bIsApplied = true;
 
-        case e_eFSS_DBC_RES_CLBCKREADERR:
-        {
-            l_eRes = e_eFSS_DB_RES_CLBCKREADERR;
-            break;
-        }
+            if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+            {
+                l_bIsPageRecFromBkup = true;
+                l_eRes = e_eFSS_DB_RES_OK;
+            }
 
-        case e_eFSS_DBC_RES_CLBCKCRCERR:
-        {
-            l_eRes = e_eFSS_DB_RES_CLBCKCRCERR;
-            break;
+            l_uNeeded = 0u;
+            for( l_uEleIdx = 0u; l_uEleIdx < p_ptCtx->uTxNEle; l_uEleIdx++ )
+            {
+                l_uPos = p_ptCtx->ptTxEle[l_uEleIdx].uPos;
+                l_uNeeded += ( EFSS_DB_JRNRAWOFF + p_ptCtx->tDB.ptDefEle[l_uPos].uEleL );
+            }
         }
+    }
 
-        case e_eFSS_DBC_RES_NOTVALIDDB:
+    if( e_eFSS_DB_RES_OK == l_eRes )
+    {
+        if( l_uNeeded <= ( l_tBuff.uBufL - EFSS_DB_JRNRECOFF - p_ptCtx->uJournalUsed ) )
         {
-            l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
-            break;
-        }
+            /* The whole transaction is written in a single journal page, so it's atomic */
+            l_uEleIdx = 0u;
+            l_bIsStored = true;
 
-        case e_eFSS_DBC_RES_NEWVERSIONFOUND:
-        {
-            l_eRes = e_eFSS_DB_RES_NEWVERSIONFOUND;
-            break;
-        }
+            while( ( l_uEleIdx < p_ptCtx->uTxNEle ) && ( e_eFSS_DB_RES_OK == l_eRes ) && ( true == l_bIsStored ) )
+            {
+                l_eRes = eFSS_DB_SetEleInJournal(p_ptCtx, l_tBuff.uBufL, p_ptCtx->ptTxEle[l_uEleIdx].uPos,
+                                                 p_ptCtx->ptTxEle[l_uEleIdx].puRawVal, &l_bIsStored);
+                l_uEleIdx++;
+            }
 
-        case e_eFSS_DBC_RES_WRITENOMATCHREAD:
-        {
-            l_eRes = e_eFSS_DB_RES_WRITENOMATCHREAD;
-            break;
-        }
+            if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( false == l_bIsStored ) )
+            {
+                /* Cannot be, space is already checked */
+                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+            }
 
-        case e_eFSS_DBC_RES_OK_BKP_RCVRD:
+            if( e_eFSS_DB_RES_OK == l_eRes )
+            {
+                l_eRes = eFSS_DB_FlushJournal(p_ptCtx, l_bIsApplied);
+                *p_pbIsCommitted = ( e_eFSS_DB_RES_OK == l_eRes );
+            }
+        }
+        else if( true == l_bIsApplied )
         {
-            l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
-            break;
+            /* The transaction doesn't fit in the journal and will be written in the pages. The journal element
+             * are already in their pages, write an empty journal page so they will not be applied again */
+            l_eRes = eFSS_DB_FlushJournal(p_ptCtx, true);
         }
-
-        default:
+        else
         {
+            /* Cannot be */
             l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
-            break;
         }
     }
 
+    if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( true == l_bIsPageRecFromBkup ) )
+    {
+        l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
+    }
+
     return l_eRes;
 }
 
-
-
-/***********************************************************************************************************************
- *  PRIVATE UTILS STATIC FUNCTION DECLARATION
- **********************************************************************************************************************/
-static bool_t eFSS_DB_IsDbDefStructValid(const t_eFSS_DB_DbStruct p_tDefaultDb, const uint32_t p_uNPage,
-                                         const uint32_t p_uPageL)
+static e_eFSS_DB_RES eFSS_DB_StatusStep(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_DBC_StorBuf p_tBuff,
+                                        const uint32_t p_uTotPage)
 {
-    /* Check db validity:
-       1- DB array must be valid and not NULL
-       2- Numbers of element need to be different from zero
-       3- Each element version and len need to be different from zero
-       4- Element raw data must be different from NULL
-       5- An element length cannot be greater than page length
-       6- All element must be able to be stored in database
-     */
-
-    /* Local variable for return */
-    bool_t l_bRes;
+    /* Return local var */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
 
-    /* Local variable used for index */
-    uint32_t l_uCurPage;
-    uint32_t l_uCurOff;
+    /* Page and offset local variable, restored from the step context */
+    uint32_t l_uPageGlob;
+    uint32_t l_uOffGlob;
+    uint32_t l_uPageLoc;
+    uint32_t l_uOffLoc;
+    uint32_t l_uCheckedElem;
+    bool_t l_bIsPageModGlob;
+    bool_t l_bIsPageRecFromBkup;
+    e_eFSS_DB_PRVSMCHECK_RES l_eCurStatus;
 
-    /* Local variable for calculation */
-    uint32_t l_uCurIndex;
+    /* DB element local variable */
     t_eFSS_DB_DbElement l_tCurEle;
+    t_eFSS_DB_DbElement l_tGettedEle;
 
-    /* Check pointer validity */
-    if( NULL == p_tDefaultDb.ptDefEle )
+    /* Local variable to keep track of page status */
+    bool_t l_bIsPageModLoc;
+    bool_t l_bIsStepDone;
+
+    /* Support buff */
+    uint8_t* l_puSupBuf;
+
+    /* Now that we have every needed data and that the default database struct seems correct we need to check that
+       the database actualy stored in storage is correct. Keep in mind that unused storage area must be set to zero,
+       in this way if anothers entry is added to the default struct we can set the default value of the entry that
+       are actualy stored with length of zero byte.
+       So we must follow this steps:
+       1 - Read a storage page and check every entry present in the just readed area. For every entry check that
+           parameter legth match the default vaue stored in the database. If legth dosent match go to point 2. If
+           parameter legth match check parameter version. If parameter version dosent match update the stored param
+           with the default value and save the modified storage page.
+       2 - Check that every remaining byte stored in all the remainings page are set to zero. If they differ from
+           zero the database is invalid. If they are all zero we can assume that every parameter that we need to
+           check are new parameter and they must be stored in the storage area.
+       Keep in mind that the pourpose of this function is to: update new parameter version, update newly added
+       parameter and check if parameter are correct. If the database is corrupted, we can ripristinate it only
+       calling eFSS_DB_FormatToDefault.
+       Every call of this function elaborate only one page, and save the reached position in the step context */
+    if( EFSS_DB_STEPSTATUS != p_ptCtx->tStep.uOp )
     {
-        l_bRes = false;
+        /* Start a new check, the database cannot be used till it's ended */
+        (void)memset(&p_ptCtx->tStep, 0, sizeof(t_eFSS_DB_StepCtx));
+        p_ptCtx->tStep.uOp = EFSS_DB_STEPSTATUS;
+        p_ptCtx->tStep.uPhase = ( uint32_t )e_eFSS_DB_RES_CHECK_RECOVERY;
+        p_ptCtx->bIsDbCheked = false;
     }
-    else
+
+    /* Restore the check status */
+    l_uPageGlob = p_ptCtx->tStep.uPage;
+    l_uOffGlob = p_ptCtx->tStep.uOff;
+    l_uPageLoc = p_ptCtx->tStep.uPageChk;
+    l_uOffLoc = p_ptCtx->tStep.uOffChk;
+    l_uCheckedElem = p_ptCtx->tStep.uElem;
+    l_bIsPageModGlob = p_ptCtx->tStep.bIsPageMod;
+    l_bIsPageRecFromBkup = p_ptCtx->tStep.bIsPageRec;
+    l_eCurStatus = ( e_eFSS_DB_PRVSMCHECK_RES )p_ptCtx->tStep.uPhase;
+
+    /* Init variable */
+    l_eRes = e_eFSS_DB_RES_OK;
+    l_bIsStepDone = false;
+
+    /* Execute the check till a page is elaborated or we have finished */
+    while( ( false == l_bIsStepDone ) && ( e_eFSS_DB_RES_CHECK_FINISH != l_eCurStatus ) )
     {
-        if( p_tDefaultDb.uNEle <= 0u )
-        {
-            l_bRes = false;
-        }
-        else
+        /* Do check using current status */
+        switch( l_eCurStatus )
         {
-            /* Init local */
-            l_uCurIndex = 0u;
-            l_uCurPage = 0u;
-            l_uCurOff = 0u;
-            l_bRes = true;
-
-            /* Check every parameter till an error is found */
-            while( ( l_uCurIndex < p_tDefaultDb.uNEle ) && ( true == l_bRes ) )
+            case e_eFSS_DB_RES_CHECK_RECOVERY:
             {
-                /* Get curr ele */
-                l_tCurEle = p_tDefaultDb.ptDefEle[l_uCurIndex];
+                /* Before loading any page we need to complete or discard an interrupted transaction, otherwise the
+                   staged pages will be considered as corrupted backup pages */
+                l_eDBCRes = eFSS_DBC_RecoverTx(&p_ptCtx->tDbcCtx);
+                l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
 
-                /* Element check */
-                if( ( 0u == l_tCurEle.uEleV ) || ( 0u == l_tCurEle.uEleL ) || ( NULL == l_tCurEle.puEleRaw ) ||
-                    ( ( l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL ) )
+                if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
                 {
-                    /* Cannot be */
-                    l_bRes = false;
+                    l_bIsPageRecFromBkup = true;
+                    l_eRes = e_eFSS_DB_RES_OK;
                 }
-                else
+
+                /* Element stored in the journal must be copied in their pages before checking them */
+                if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( 0u != p_ptCtx->tDB.uJournalPages ) )
                 {
-                    /* Check if can be placed in the current "page" */
-                    if( ( l_uCurOff + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
-                    {
-                        /* Cannot be placed in this page */
-                        l_uCurPage++;
-                        l_uCurOff = ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
-                    }
-                    else
+                    l_eRes = eFSS_DB_RecoverJournal(p_ptCtx);
+
+                    if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
                     {
-                        /* can be placed in this "page " */
-                        l_uCurOff += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
+                        l_bIsPageRecFromBkup = true;
+                        l_eRes = e_eFSS_DB_RES_OK;
                     }
+                }
 
-                    /* Check if all ok */
-                    if( l_uCurPage >= p_uNPage )
+                if( e_eFSS_DB_RES_OK == l_eRes )
+                {
+                    /* Nothing to recover or recovered, start checking the pages */
+                    l_eCurStatus = e_eFSS_DB_RES_CHECK_ALREADYADDED;
+                }
+                else
+                {
+                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                }
+
+                l_bIsStepDone = true;
+                break;
+            }
+
+            case e_eFSS_DB_RES_CHECK_ALREADYADDED:
+            {
+                /* Check every parameter in every page */
+                if( l_uPageGlob < p_uTotPage )
+                {
+                    /* Init page check, so we know if the page need to be stored after a mod */
+                    l_bIsPageModLoc = false;
+                    l_bIsStepDone = true;
+
+                    /* Load the current page */
+                    l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, l_uPageGlob);
+                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                    if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
                     {
-                        /* Cannot be, we don't have space for storing all parameter */
-                        l_bRes = false;
+                        if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+                        {
+                            l_bIsPageRecFromBkup = true;
+                        }
+
+                        /* Init variable */
+                        l_uOffGlob = 0u;
+
+                        /* Whole page just readed, check the page against the default value */
+                        while( ( l_uOffGlob < p_tBuff.uBufL ) &&
+                               ( e_eFSS_DB_RES_CHECK_ALREADYADDED == l_eCurStatus ) )
+                        {
+                            if( l_uCheckedElem < p_ptCtx->tDB.uNEle )
+                            {
+                                /* Get current parameter to check */
+                                l_tCurEle = p_ptCtx->tDB.ptDefEle[l_uCheckedElem];
+
+                                /* Check parameter */
+                                /* Is the checked parameter present in this page? */
+                                if( ( l_uOffGlob + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) <= p_tBuff.uBufL )
+                                {
+                                    /* Can retrive the element */
+                                    l_eRes = eFSS_DB_GetEleRawInBuffer( l_tCurEle.uEleL, &p_tBuff.puBuf[l_uOffGlob],
+                                                                        &l_tGettedEle);
+                                    if( e_eFSS_DB_RES_OK == l_eRes )
+                                    {
+                                        /* Check parameter */
+                                        if( l_tCurEle.uEleV != l_tGettedEle.uEleV )
+                                        {
+                                            /* Need to update this entry */
+                                            l_puSupBuf = &p_tBuff.puBuf[l_uOffGlob];
+                                            l_eRes = eFSS_DB_SetEleRawInBuffer( l_tCurEle, l_puSupBuf );
+                                            if( e_eFSS_DB_RES_OK == l_eRes )
+                                            {
+                                                /* Updated */
+                                                l_uCheckedElem++;
+                                                l_uOffGlob += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
+                                                l_bIsPageModLoc = true;
+                                                l_bIsPageModGlob = true;
+                                            }
+                                            else
+                                            {
+                                                /* Irreparable error */
+                                                l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                                            }
+                                        }
+                                        else
+                                        {
+                                            /* DB entry is ok, nothing to do */
+                                            l_uCheckedElem++;
+                                            l_uOffGlob += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
+                                        }
+                                    }
+                                    else if( e_eFSS_DB_RES_NOTVALIDDB == l_eRes )
+                                    {
+                                        /* Current readed parameter has some error, maybe because it is a new
+                                           parameter? Check for zeros */
+                                        l_eCurStatus = e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED;
+                                    }
+                                    else
+                                    {
+                                        /* Some other kind of error */
+                                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                                    }
+                                }
+                                else
+                                {
+                                    /* No more space in this page for other parameter, check zero */
+                                    while( l_uOffGlob < p_tBuff.uBufL )
+                                    {
+                                        if( 0u == p_tBuff.puBuf[l_uOffGlob] )
+                                        {
+                                            l_uOffGlob++;
+                                        }
+                                        else
+                                        {
+                                            /* unused memory must be set to zero */
+                                            l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
+                                            l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                                        }
+                                    }
+                                }
+                            }
+                            else
+                            {
+                                /* No more parameter to check */
+                                l_eCurStatus = e_eFSS_DB_RES_CHECK_NODATA;
+                            }
+                        }
+
+                        /* If no error found and some change where made, flush the page */
+                        if( ( e_eFSS_DB_RES_CHECK_ALREADYADDED == l_eCurStatus ) ||
+                            ( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus ) ||
+                            ( e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED == l_eCurStatus ) )
+                        {
+                            /* If page is modified we need to store the new value */
+                            if( true == l_bIsPageModLoc )
+                            {
+                                l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx, l_uPageGlob);
+                                l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                                if( e_eFSS_DB_RES_OK != l_eRes )
+                                {
+                                    /* Irreparable error */
+                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                                }
+                            }
+
+                            if ( e_eFSS_DB_RES_CHECK_ALREADYADDED == l_eCurStatus )
+                            {
+                                /* Increase current page only in this case*/
+                                l_uPageGlob++;
+                            }
+                            else if( e_eFSS_DB_RES_CHECK_FINISH != l_eCurStatus )
+                            {
+                                /* The zero check start from the current position */
+                                l_uPageLoc = l_uPageGlob;
+                                l_uOffLoc = l_uOffGlob;
+                            }
+                            else
+                            {
+                                /* Error flushing */
+                            }
+                        }
                     }
                     else
                     {
-                        /* Increase index */
-                        l_uCurIndex++;
+                        /* Some error during page reading, return */
+                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
                     }
                 }
+                else
+                {
+                    /* This means that we have finished the check  */
+                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                }
+
+                break;
             }
-        }
-    }
-
-    return l_bRes;
-}
-
-static e_eFSS_DB_RES eFSS_DB_GetEleRawInBuffer(const uint16_t p_uExpEleL, uint8_t* const p_puBuff,
-                                               t_eFSS_DB_DbElement* const p_ptEleToGet)
-{
-    /* Local variable for result */
-    e_eFSS_DB_RES l_eRes;
-
-    /* Check null pointer */
-    if( ( NULL == p_puBuff ) || ( NULL == p_ptEleToGet ) )
-    {
-        l_eRes = e_eFSS_DB_RES_BADPOINTER;
-    }
-    else
-    {
-        /* Check parameter */
-        if( 0u == p_uExpEleL )
-        {
-            l_eRes = e_eFSS_DB_RES_BADPARAM;
-        }
-        else
-        {
-            /* can be retrived, for now */
-            p_ptEleToGet->uEleV = 0u;
-            if( true != eFSS_Utils_RetriveU16(&p_puBuff[EFSS_DB_VEROFF], &p_ptEleToGet->uEleV) )
-            {
-                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
-            }
-            else
+
+            case e_eFSS_DB_RES_CHECK_NODATA:
+            case e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED:
             {
-                p_ptEleToGet->uEleL = 0u;
-                if( true != eFSS_Utils_RetriveU16(&p_puBuff[EFSS_DB_LENOFF], &p_ptEleToGet->uEleL ) )
+                /* check that every remaining byte is zero */
+                if( l_uPageLoc < p_uTotPage )
                 {
-                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                    l_bIsStepDone = true;
+
+                    /* Load the current page */
+                    l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, l_uPageLoc);
+                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                    if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
+                    {
+                        if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+                        {
+                            l_bIsPageRecFromBkup = true;
+                        }
+
+                        /* Check every byte */
+                        while( ( ( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus ) ||
+                                 ( e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED == l_eCurStatus ) ) &&
+                               ( l_uOffLoc < p_tBuff.uBufL ) )
+                        {
+                            if( 0u == p_tBuff.puBuf[l_uOffLoc] )
+                            {
+                                /* Ok continue */
+                                l_uOffLoc++;
+                            }
+                            else
+                            {
+                                /* Non zero, corrupted database */
+                                l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                                l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
+                            }
+                        }
+
+                        /* Reload offset if everything is ok and increase the page to search */
+                        if( ( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus ) ||
+                            ( e_eFSS_DB_RES_CHECK_NODATAANDAFTERNEWADDED == l_eCurStatus ) )
+                        {
+                            l_uOffLoc = 0u;
+                            l_uPageLoc++;
+                        }
+                    }
+                    else
+                    {
+                        /* Some error during page reading, return */
+                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                    }
+                }
+                else if( e_eFSS_DB_RES_CHECK_NODATA == l_eCurStatus )
+                {
+                    /* Done */
+                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
                 }
                 else
                 {
-                    /* Check that the element has valid parameter */
-                    if( ( 0u == p_ptEleToGet->uEleV ) || ( p_uExpEleL != p_ptEleToGet->uEleL ) )
+                    /* check for new parameter */
+                    l_eCurStatus = e_eFSS_DB_RES_CHECK_NEWADDED;
+                }
+
+                break;
+            }
+
+            case e_eFSS_DB_RES_CHECK_NEWADDED:
+            {
+                /* ok now we have to insert in the storage some new parameters */
+                if( l_uCheckedElem < p_ptCtx->tDB.uNEle )
+                {
+                    /* Init page check, so we know if the page need to be stored after a mod */
+                    l_bIsPageModLoc = false;
+                    l_bIsStepDone = true;
+
+                    /* Load the current page */
+                    l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, l_uPageGlob);
+                    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                    if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
                     {
-                        l_eRes = e_eFSS_DB_RES_NOTVALIDDB;
+                        if( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes )
+                        {
+                            l_bIsPageRecFromBkup = true;
+                        }
+
+                        /* Whole page just readed, check the page against the default value */
+                        while( ( l_uOffGlob < p_tBuff.uBufL ) &&
+                               ( l_uCheckedElem < p_ptCtx->tDB.uNEle ) &&
+                               ( e_eFSS_DB_RES_CHECK_NEWADDED == l_eCurStatus ) )
+                        {
+                            /* Get current parameter to check */
+                            l_tCurEle = p_ptCtx->tDB.ptDefEle[l_uCheckedElem];
+
+                            /* Check parameter */
+                            /* Is the checked parameter present in this page? */
+                            if( ( l_uOffGlob + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) <= p_tBuff.uBufL )
+                            {
+                                /* Need to update this entry */
+                                l_eRes = eFSS_DB_SetEleRawInBuffer( l_tCurEle, &p_tBuff.puBuf[l_uOffGlob] );
+                                if( e_eFSS_DB_RES_OK == l_eRes )
+                                {
+                                    /* Updated */
+                                    l_uCheckedElem++;
+                                    l_uOffGlob += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
+                                    l_bIsPageModLoc = true;
+                                    l_bIsPageModGlob = true;
+                                }
+                                else
+                                {
+                                    /* Irreparable error */
+                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                                }
+                            }
+                            else
+                            {
+                                /* No more space in this page for other parameter */
+                                l_uOffGlob = p_tBuff.uBufL;
+                            }
+                        }
+
+                        /* If no error found and some change where made, flush the page */
+                        if( e_eFSS_DB_RES_CHECK_NEWADDED == l_eCurStatus )
+                        {
+                            /* If page is modified we need to store the new value */
+                            if( true == l_bIsPageModLoc )
+                            {
+                                l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx, l_uPageGlob);
+                                l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+                                if( e_eFSS_DB_RES_OK != l_eRes )
+                                {
+                                    /* Error flushing */
+                                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                                }
+                            }
+
+                            /* current page is full, switch */
+                            /* Check requested from misra */
+                            if( l_uPageGlob < p_uTotPage )
+                            {
+                                l_uPageGlob++;
+                            }
+                            else
+                            {
+                                /* Some absurd error */
+                                l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                            }
+
+                            l_uOffGlob = 0u;
+                        }
                     }
                     else
                     {
-                        /* Can be retrived, copy the raw data */
-                        p_ptEleToGet->puEleRaw = &p_puBuff[EFSS_DB_RAWOFF];
-
-                        /* All ok */
-                        l_eRes = e_eFSS_DB_RES_OK;
+                        /* Some error during page reading, return */
+                        l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
                     }
                 }
+                else
+                {
+                    /* In any cases we have finished now */
+                    l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                }
+
+                break;
+            }
+
+            default:
+            {
+                /* Impossible end here */
+                l_eCurStatus = e_eFSS_DB_RES_CHECK_FINISH;
+                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                break;
             }
         }
     }
 
-    return l_eRes;
-}
-
-static e_eFSS_DB_RES eFSS_DB_SetEleRawInBuffer(const t_eFSS_DB_DbElement p_tEleToSet, uint8_t* const p_puBuff)
-{
-    /* Local variable for result */
-    e_eFSS_DB_RES l_eRes;
-
-    /* Check null pointer */
-    if( ( NULL == p_puBuff ) || ( NULL == p_tEleToSet.puEleRaw ) )
+    if( e_eFSS_DB_RES_CHECK_FINISH != l_eCurStatus )
     {
-        l_eRes = e_eFSS_DB_RES_BADPOINTER;
+        /* Save the check status for the next step */
+        p_ptCtx->tStep.uPage = l_uPageGlob;
+        p_ptCtx->tStep.uOff = l_uOffGlob;
+        p_ptCtx->tStep.uPageChk = l_uPageLoc;
+        p_ptCtx->tStep.uOffChk = l_uOffLoc;
+        p_ptCtx->tStep.uElem = l_uCheckedElem;
+        p_ptCtx->tStep.bIsPageMod = l_bIsPageModGlob;
+        p_ptCtx->tStep.bIsPageRec = l_bIsPageRecFromBkup;
+        p_ptCtx->tStep.uPhase = ( uint32_t )l_eCurStatus;
+        l_eRes = e_eFSS_DB_RES_INPROGRESS;
     }
     else
     {
-        /* Check parameter */
-        if( ( 0u == p_tEleToSet.uEleV ) || ( 0u == p_tEleToSet.uEleL ) )
-        {
-            l_eRes = e_eFSS_DB_RES_BADPARAM;
-        }
-        else
+        /* Check ended */
+        p_ptCtx->tStep.uOp = EFSS_DB_STEPNONE;
+
+        /* Finaly, if no error occoured update status */
+        if( ( e_eFSS_DB_RES_OK == l_eRes ) || ( e_eFSS_DB_RES_OK_BKP_RCVRD == l_eRes ) )
         {
-            /* can be placed, place */
-            if( true != eFSS_Utils_InsertU16(&p_puBuff[EFSS_DB_VEROFF], p_tEleToSet.uEleV) )
+            /* Whole database checked and it is OK */
+            p_ptCtx->bIsDbCheked = true;
+
+            /* Specified the returned value */
+            if( true == l_bIsPageModGlob )
             {
-                l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
+                /* In this case we have updated some value */
+                l_eRes = e_eFSS_DB_RES_PARAM_DEF_RESET;
+            }
+            else if( true == l_bIsPageRecFromBkup )
+            {
+                /* Signal that a page was recovered from bkup */
+                l_eRes = e_eFSS_DB_RES_OK_BKP_RCVRD;
             }
             else
             {
-                if( true != eFSS_Utils_InsertU16(&p_puBuff[EFSS_DB_LENOFF], p_tEleToSet.uEleL) )
-                {
-                    l_eRes = e_eFSS_DB_RES_CORRUPTCTX;
-                }
-                else
-                {
-                    /* Copy the raw data */
-                    (void)memcpy(&p_puBuff[EFSS_DB_RAWOFF], p_tEleToSet.puEleRaw, (uint32_t)p_tEleToSet.uEleL);
-
-                    /* All OK */
-                    l_eRes = e_eFSS_DB_RES_OK;
-                }
+                /* All ok perfect */
+                l_eRes = e_eFSS_DB_RES_OK;
             }
         }
+        else
+        {
+            /* Database is corrupted, signal it as not cheked so we will not allow any other modification to this
+             * situation */
+            p_ptCtx->bIsDbCheked = false;
+        }
     }
 
     return l_eRes;
 }
 
-static e_eFSS_DB_RES eFSS_DB_FindElePageAndPos(const uint32_t p_uPageL, const t_eFSS_DB_DbStruct p_tDbDefault,
-                                               const uint32_t p_uEleIdx, uint32_t* const p_puPageFound,
-                                               uint32_t* const p_puOffSetFound)
+static e_eFSS_DB_RES eFSS_DB_FormatStep(t_eFSS_DB_Ctx* const p_ptCtx, const t_eFSS_DBC_StorBuf p_tBuff,
+                                        const uint32_t p_uTotPage)
 {
-    /* Local variable for result */
+    /* Return local var */
     e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
 
-    /* Local variable used for index */
-    uint32_t l_uCurPage;
+    /* Local variable for calculation */
     uint32_t l_uCurOff;
 
-    /* Local variable used for calculation */
-    uint32_t l_uCurIndex;
-    t_eFSS_DB_DbElement l_tCurEle;
+    /* Init variable */
+    l_eRes = e_eFSS_DB_RES_OK;
 
-    /* Check null pointer */
-    if( ( NULL == p_puPageFound ) || ( NULL == p_puOffSetFound ) || ( NULL == p_tDbDefault.ptDefEle ) )
-    {
-        l_eRes = e_eFSS_DB_RES_BADPOINTER;
-    }
-    else
+    if( EFSS_DB_STEPFORMAT != p_ptCtx->tStep.uOp )
     {
-        /* Check element validity */
-        if( ( p_tDbDefault.uNEle <= 0u ) || ( p_uPageL < EFSS_DB_MINPAGESIZE ) || ( p_uEleIdx >= p_tDbDefault.uNEle ) )
-        {
-            l_eRes = e_eFSS_DB_RES_BADPARAM;
-        }
-        else
+        /* Start a new format, the database cannot be used till it's ended */
+        (void)memset(&p_ptCtx->tStep, 0, sizeof(t_eFSS_DB_StepCtx));
+        p_ptCtx->tStep.uOp = EFSS_DB_STEPFORMAT;
+        p_ptCtx->bIsDbCheked = false;
+
+        /* Start with an empty journal, so no element will be copied over the default value. This is a step by
+           itself */
+        if( 0u != p_ptCtx->tDB.uJournalPages )
         {
-            /* Init local variable */
-            l_eRes = e_eFSS_DB_RES_OK;
-
-            /* Init local variable */
-            l_uCurPage = 0u;
-            l_uCurOff = 0u;
-            l_uCurIndex = 0u;
+            l_eRes = eFSS_DB_ResetJournal(p_ptCtx);
 
-            /* Sum all other parameter of the DB till we reach the wanted one */
-            while( ( l_uCurIndex < p_uEleIdx ) && ( e_eFSS_DB_RES_OK == l_eRes ) && ( l_uCurPage < MAX_UINT32VAL ) )
+            if( e_eFSS_DB_RES_OK == l_eRes )
             {
-                /* Get current element */
-                l_tCurEle = p_tDbDefault.ptDefEle[l_uCurIndex];
+                l_eRes = e_eFSS_DB_RES_INPROGRESS;
+            }
+        }
+    }
 
-                /* Just check element validty, not needed because we check context validity every time, but
-                   who knows */
-                if( ( l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
-                {
-                    /* This DB struct seems invalid */
-                    l_eRes = e_eFSS_DB_RES_BADPARAM;
-                }
-                else
-                {
-                    /* Check if the current element can be placed in the current "page" */
-                    if( ( l_uCurOff + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
-                    {
-                        /* current element cannot be placed in this page */
-                        l_uCurPage++;
-                        l_uCurOff = ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
-                    }
-                    else
-                    {
-                        /* can be placed in this "page " */
-                        l_uCurOff += ( l_tCurEle.uEleL + EFSS_DB_RAWOFF );
-                    }
+    /* In order to format to default the DB we can just set to zero the buffer to flush and copy inside it only the
+       needed parameter. If no parameter are needed, we can just flush a zero filled buffer. Flushyng zero as data will
+       leave open the possibility to add new parameter. Only one page is written every step */
+    if( ( e_eFSS_DB_RES_OK == l_eRes ) && ( p_ptCtx->tStep.uPage < p_uTotPage ) )
+    {
+        /* Memset the current page to zero */
+        (void)memset(p_tBuff.puBuf, 0, p_tBuff.uBufL);
 
-                    /* Increase index */
-                    l_uCurIndex++;
-                }
-            }
+        /* Set to zero the numbers of byte used */
+        l_uCurOff = 0u;
 
-            if( l_uCurPage >= MAX_UINT32VAL )
+        /* Continue till the page is full, parameter are avaiable, or an error occours */
+        while( ( l_uCurOff < p_tBuff.uBufL )  &&
+               ( p_ptCtx->tStep.uElem < p_ptCtx->tDB.uNEle ) &&
+               ( e_eFSS_DB_RES_OK == l_eRes ) )
+        {
+            /* We have some element to set, can be placed here? */
+            if( ( l_uCurOff + p_ptCtx->tDB.ptDefEle[p_ptCtx->tStep.uElem].uEleL + EFSS_DB_RAWOFF ) >
+                p_tBuff.uBufL )
             {
-                l_eRes = e_eFSS_DB_RES_BADPARAM;
+                /* This element cannot be stored in this buffer. We will store it in the next page */
+                l_uCurOff = p_tBuff.uBufL;
             }
             else
             {
+                /* This element can be stored in this buffer */
+                l_eRes = eFSS_DB_SetEleRawInBuffer(p_ptCtx->tDB.ptDefEle[p_ptCtx->tStep.uElem],
+                                                   &p_tBuff.puBuf[l_uCurOff] );
                 if( e_eFSS_DB_RES_OK == l_eRes )
                 {
-                    /* Finded the page and the offset of the index we were looking for. We just need to check if
-                       the findeded element can be present on the current pages, if not increase it */
-                    l_tCurEle = p_tDbDefault.ptDefEle[l_uCurIndex];
+                    /* Element inserted, increase the offset and start elaborating the next element */
+                    l_uCurOff += ( p_ptCtx->tDB.ptDefEle[p_ptCtx->tStep.uElem].uEleL + EFSS_DB_RAWOFF );
+                    p_ptCtx->tStep.uElem++;
+                }
+            }
+        }
 
-                    /* Just check element validty, not needed because we check context validity every time, but
-                       who knows */
-                    if( ( l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
-                    {
-                        /* This DB struct seems invalid */
-                        l_eRes = e_eFSS_DB_RES_BADPARAM;
-                    }
-                    else
-                    {
-                        /* Check if the current element can be placed in the current "page" */
-                        if( ( l_uCurOff + l_tCurEle.uEleL + EFSS_DB_RAWOFF ) > p_uPageL )
-                        {
-                            /* Cannot be placed in this page */
-                            l_uCurPage++;
-                            l_uCurOff = 0u;
-                        }
+        /* Every page is rewritten, with erase blocks bigger than a page erase the whole block only once */
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            l_eDBCRes = eFSS_DBC_EraseBlkIfFirst(&p_ptCtx->tDbcCtx, p_ptCtx->tStep.uPage);
+            l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+        }
 
-                        /* Valorize ret value */
-                        *p_puPageFound = l_uCurPage;
-                        *p_puOffSetFound = l_uCurOff;
-                    }
+        /* Page is completed, we can flush */
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            l_eDBCRes = eFSS_DBC_FlushBuffInPage(&p_ptCtx->tDbcCtx, p_ptCtx->tStep.uPage);
+            l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
+            if( e_eFSS_DB_RES_OK == l_eRes )
+            {
+                p_ptCtx->tStep.uPage++;
+
+                if( p_ptCtx->tStep.uPage < p_uTotPage )
+                {
+                    l_eRes = e_eFSS_DB_RES_INPROGRESS;
                 }
             }
         }
     }
 
+    if( e_eFSS_DB_RES_INPROGRESS != l_eRes )
+    {
+        /* Format ended */
+        p_ptCtx->tStep.uOp = EFSS_DB_STEPNONE;
+
+        if( e_eFSS_DB_RES_OK == l_eRes )
+        {
+            /* Setted to default every entry, and we are sure that DB is correct. No need to do additional check */
+            p_ptCtx->bIsDbCheked = true;
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_DB_RES eFSS_DB_LoadPageInBuff(t_eFSS_DB_Ctx* const p_ptCtx, const uint32_t p_uPageIdx)
+{
+    /* Local variable for return */
+    e_eFSS_DB_RES l_eRes;
+    e_eFSS_DBC_RES l_eDBCRes;
+
+    /* Page loaded to read or modify an element, the backup is verified only by status check and scrub */
+    if( true == p_ptCtx->tDB.bTrustOri )
+    {
+        l_eDBCRes = eFSS_DBC_LoadPageInBuffTrustOri(&p_ptCtx->tDbcCtx, p_uPageIdx);
+    }
+    else
+    {
+        l_eDBCRes = eFSS_DBC_LoadPageInBuff(&p_ptCtx->tDbcCtx, p_uPageIdx);
+    }
+    l_eRes = eFSS_DB_DBCtoDBRes(l_eDBCRes);
+
     return l_eRes;
-}
\ No newline at end of file
+}
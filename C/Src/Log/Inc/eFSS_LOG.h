@@ -23,6 +23,14 @@ extern "C" {
  * 2 - We cannot read a single log from this module because the module itself dosent know the struct of the logs
  * 3 - We can only read a page, where log are stored, and it's up to the user to estrapolate the stored log
  * 4 - Logs are stored sequentialy in the page and they cannot be splitted between two pages. 
+ * 5 - If a pending buffer is passed with eFSS_LOG_InitPendingBuff, log that can be appended to the newest page are
+ *     kept in RAM and stored all together with a single flush of the newest page and of his backup. Pending log are
+ *     stored when uSyncByteThr byte or uSyncLogThr log are pending, when eFSS_LOG_Sync is called, or before a log
+ *     that needs a new page is saved. Pending log are lost in case of power outage, so at most uSyncByteThr byte and
+ *     uSyncLogThr - 1 log can be lost.
+ * 6 - If eFSS_LOG_InitFramedLog is called every log is stored with his length and, optionally, with his CRC. In this
+ *     case the module knows where every log starts, and log can be readed one by one using an iterator, see
+ *     eFSS_LOG_IterOpen. Framed and not framed log cannot be mixed in the same storage area.
  */ 
 
 
@@ -52,15 +60,56 @@ typedef enum
     e_eFSS_LOG_RES_NEWVERSIONLOG,
     e_eFSS_LOG_RES_WRITENOMATCHREAD,
     e_eFSS_LOG_RES_OK_BKP_RCVRD,
+    e_eFSS_LOG_RES_NOMORELOG,
+    e_eFSS_LOG_RES_INPROGRESS,
 }e_eFSS_LOG_RES;
 
+/* Log passed to eFSS_LOG_AddLogs */
+typedef struct
+{
+    uint32_t uLogL;
+    uint8_t* puLogRaw;
+}t_eFSS_LOG_LogEle;
+
 typedef struct
 {
     t_eFSS_LOGC_Ctx tLOGCCtx;
     uint32_t uNewPagIdx;
     uint32_t uFullFilledP;
+    uint32_t uNewPagSeq;
+    bool_t bFramedLog;
+    bool_t bRecordCrc;
+    t_eFSS_TYPE_CrcCtx* ptCtxCrc32;
+    f_eFSS_TYPE_CrcCb fCrc32;
+    uint8_t* puPendBuf;
+    uint32_t uPendBufL;
+    uint32_t uSyncByteThr;
+    uint32_t uSyncLogThr;
+    uint32_t uPendByte;
+    uint32_t uPendLogN;
+    uint32_t uPendPageIdx;
+    uint32_t uPendPageByte;
+    t_eFSS_TYPE_TimeCtx* ptCtxTime;
+    f_eFSS_TYPE_TimeCb fTime;
+    t_eFSS_TYPE_LatHist tLatAdd;
+    t_eFSS_TYPE_LatHist tLatStatus;
+    t_eFSS_TYPE_LatHist tLatFormat;
+    uint32_t uFormatPhase;
+    t_eFSS_TYPE_ScrubCtx tScrub;
 }t_eFSS_LOG_Ctx;
 
+/* Iterator used to read framed log, see eFSS_LOG_IterOpen */
+typedef struct
+{
+    uint8_t* puPageBuf;
+    uint32_t uPageBufL;
+    uint32_t uOldPageIdx;
+    uint32_t uNewPageIdx;
+    uint32_t uPageIdx;
+    uint32_t uPageByte;
+    uint32_t uRecOff;
+}t_eFSS_LOG_Iter;
+
 
 
 /***********************************************************************************************************************
@@ -167,7 +216,22 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogInfo(t_eFSS_LOG_Ctx* const p_ptCtx, uint32_t* cons
 e_eFSS_LOG_RES eFSS_LOG_Format(t_eFSS_LOG_Ctx* const p_ptCtx);
 
 /**
- * @brief       Add a log inside the storage area. 
+ * @brief       Same as eFSS_LOG_Format, but write at most one page for every call. The first call start the format,
+ *              every following call continue it. Till the format is not ended e_eFSS_LOG_RES_INPROGRESS is returned.
+ *              The storage is invalidated before the newest page is written, so between two steps the log is valid
+ *              and empty or not valid at all, like after a power loss during the format. The first step search the
+ *              newest page, so without the flash cache it can read the whole storage area.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ *
+ * @return      e_eFSS_LOG_RES_INPROGRESS         - The format is not ended, call the function again
+ *              Every other value returned by eFSS_LOG_Format
+ */
+e_eFSS_LOG_RES eFSS_LOG_FormatStep(t_eFSS_LOG_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Add a log inside the storage area. If the pending buffer is used the log could be only copied in the
+ *              pending buffer, and will be stored later. See eFSS_LOG_InitPendingBuff.
  *
  * @param[in]   p_ptCtx       - Log context
  * @param[in]   p_puRawVal    - Raw value of the element we want to save
@@ -188,6 +252,32 @@ e_eFSS_LOG_RES eFSS_LOG_Format(t_eFSS_LOG_Ctx* const p_ptCtx);
  */
 e_eFSS_LOG_RES eFSS_LOG_AddLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puRawVal, const uint32_t p_uElemL);
 
+/**
+ * @brief       Add many log inside the storage area. Log are stored in the passed order, the newest page is loaded
+ *              once and every log that fits in it is saved with a single flush of the newest page and of his backup.
+ *              Only log that need a new page cause an additional flush. Pending log, if any, are stored before.
+ *              If an error is returned some of the passed log could be already stored.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[in]   p_ptLogs      - Array of log to save
+ * @param[in]   p_uNLogs      - Number of log in p_ptLogs
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_BADPARAM           - In case of an invalid parameter passed to the function
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ *              e_eFSS_LOG_RES_NOTVALIDLOG        - No valid log founded
+ *              e_eFSS_LOG_RES_NEWVERSIONLOG      - New version of the blob requested
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_CLBCKERASEERR      - Erase callback returned error
+ *              e_eFSS_LOG_RES_CLBCKWRITEERR      - Write callback returned error
+ *              e_eFSS_LOG_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_LOG_RES_CLBCKCRCERR        - Crc callback returned error
+ *              e_eFSS_LOG_RES_WRITENOMATCHREAD   - After Write operation the Read operation readed different data
+ */
+e_eFSS_LOG_RES eFSS_LOG_AddLogs(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_LOG_LogEle* const p_ptLogs,
+                                const uint32_t p_uNLogs);
+
 /**
  * @brief       Get all the data present on a specifi pages. The meaning of the data in unknow for this module.
  *
@@ -213,6 +303,250 @@ e_eFSS_LOG_RES eFSS_LOG_AddLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_p
 e_eFSS_LOG_RES eFSS_LOG_GetLogOfAPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uindx, uint8_t* const p_puBuf,
                                       const uint32_t p_uBufL, uint32_t* const p_puValorByte);
 
+/**
+ * @brief       Use a RAM buffer to keep log pending, so many log can be stored with a single flush of the newest page
+ *              and of his backup. Pending log are not stored in case of power outage, so the user must choose the
+ *              threshold considering how many log can be lost.
+ *
+ * @param[in]   p_ptCtx         - Log context
+ * @param[in]   p_puPendBuf     - Pointer to a buffer used to keep pending log, must be valid until the context is used
+ * @param[in]   p_uPendBufL     - Size of p_puPendBuf
+ * @param[in]   p_uSyncByteThr  - Pending log are stored when at least p_uSyncByteThr byte are pending. Must be greater
+ *                                than zero and not greater than p_uPendBufL
+ * @param[in]   p_uSyncLogThr   - Pending log are stored when at least p_uSyncLogThr log are pending. Must be greater
+ *                                than zero
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_BADPARAM           - In case of an invalid parameter passed to the function, or if
+ *                                                  some log are still pending
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ */
+e_eFSS_LOG_RES eFSS_LOG_InitPendingBuff(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puPendBuf,
+                                        const uint32_t p_uPendBufL, const uint32_t p_uSyncByteThr,
+                                        const uint32_t p_uSyncLogThr);
+
+/**
+ * @brief       Store every pending log with a single flush of the newest page and of his backup. If no log is pending
+ *              nothing is done. In case of error pending log are lost.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ *              e_eFSS_LOG_RES_NOTVALIDLOG        - No valid log founded
+ *              e_eFSS_LOG_RES_NEWVERSIONLOG      - New version of the blob requested
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_CLBCKERASEERR      - Erase callback returned error
+ *              e_eFSS_LOG_RES_CLBCKWRITEERR      - Write callback returned error
+ *              e_eFSS_LOG_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_LOG_RES_CLBCKCRCERR        - Crc callback returned error
+ *              e_eFSS_LOG_RES_WRITENOMATCHREAD   - After Write operation the Read operation readed different data
+ */
+e_eFSS_LOG_RES eFSS_LOG_Sync(t_eFSS_LOG_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Get the number of byte that are pending and not stored yet
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[out]  p_puPendByte  - Pointer to a uint32_t that will be filled with the number of pending byte
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ */
+e_eFSS_LOG_RES eFSS_LOG_GetPendingByte(t_eFSS_LOG_Ctx* const p_ptCtx, uint32_t* const p_puPendByte);
+
+/**
+ * @brief       Store every log added from now on with his length and, if p_bRecordCrc is true, with a CRC calculated
+ *              using the CRC callback. The space used by every log is increased by 4 byte, or 8 byte with the CRC.
+ *              The choice must be the same used for the log already present in the storage area, so call this
+ *              function just after eFSS_LOG_InitCtx and before any other operation.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[in]   p_bRecordCrc  - Store and verify a CRC for every log
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_BADPARAM           - Some log are still pending
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ */
+e_eFSS_LOG_RES eFSS_LOG_InitFramedLog(t_eFSS_LOG_Ctx* const p_ptCtx, const bool_t p_bRecordCrc);
+
+/**
+ * @brief       When the full backup is used, read only the original page of every log page loaded from now on. The
+ *              backup page is read, and repaired, only if the original page is not valid, halving the read done by
+ *              the module. A corrupted backup page of a valid original one is repaired only by eFSS_LOG_Scrub.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ */
+e_eFSS_LOG_RES eFSS_LOG_InitTrustOrigin(t_eFSS_LOG_Ctx* const p_ptCtx);
+
+/**
+ * @brief       Open an iterator over framed log, positioned before the oldest log or after the newest one. The
+ *              iterator moves between pages by itself, and only the page where the current log is stored is loaded in
+ *              p_puPageBuf. Pending log are part of the newest page. Any operation that adds or removes log
+ *              invalidate the iterator, that must be opened again.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[out]  p_ptIter      - Iterator to open
+ * @param[in]   p_puPageBuf   - Pointer to a buffer used to load a page, must be valid until the iterator is used
+ * @param[in]   p_uPageBufL   - Size of p_puPageBuf, cannot be smaller than the size of a page plus the pending buffer
+ * @param[in]   p_bAtNewest   - Position the iterator after the newest log if true, before the oldest log if false
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_BADPARAM           - In case of an invalid parameter passed to the function, or if log
+ *                                                  are not framed
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ *              e_eFSS_LOG_RES_NOTVALIDLOG        - No valid log founded
+ *              e_eFSS_LOG_RES_NEWVERSIONLOG      - New version of the blob requested
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_CLBCKERASEERR      - Erase callback returned error
+ *              e_eFSS_LOG_RES_CLBCKWRITEERR      - Write callback returned error
+ *              e_eFSS_LOG_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_LOG_RES_CLBCKCRCERR        - Crc callback returned error
+ *              e_eFSS_LOG_RES_WRITENOMATCHREAD   - After Write operation the Read operation readed different data
+ */
+e_eFSS_LOG_RES eFSS_LOG_IterOpen(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                 uint8_t* const p_puPageBuf, const uint32_t p_uPageBufL, const bool_t p_bAtNewest);
+
+/**
+ * @brief       Get the log after the iterator position and move the iterator after it. No data is copied, the
+ *              returned pointer refers to the page buffer of the iterator and is valid until the iterator is moved.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[in]   p_ptIter      - Opened iterator
+ * @param[out]  p_ppuLog      - Pointer that will point to the log
+ * @param[out]  p_puLogL      - Pointer to a uint32_t that will be filled with the length of the log
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ *              e_eFSS_LOG_RES_NOMORELOG          - The iterator is after the newest log
+ *              e_eFSS_LOG_RES_NOTVALIDLOG        - The log or his CRC are not valid
+ *              e_eFSS_LOG_RES_NEWVERSIONLOG      - New version of the blob requested
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_CLBCKERASEERR      - Erase callback returned error
+ *              e_eFSS_LOG_RES_CLBCKWRITEERR      - Write callback returned error
+ *              e_eFSS_LOG_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_LOG_RES_CLBCKCRCERR        - Crc callback returned error
+ *              e_eFSS_LOG_RES_WRITENOMATCHREAD   - After Write operation the Read operation readed different data
+ */
+e_eFSS_LOG_RES eFSS_LOG_IterNext(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                 uint8_t** const p_ppuLog, uint32_t* const p_puLogL);
+
+/**
+ * @brief       Get the log before the iterator position and move the iterator before it. No data is copied, the
+ *              returned pointer refers to the page buffer of the iterator and is valid until the iterator is moved.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[in]   p_ptIter      - Opened iterator
+ * @param[out]  p_ppuLog      - Pointer that will point to the log
+ * @param[out]  p_puLogL      - Pointer to a uint32_t that will be filled with the length of the log
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ *              e_eFSS_LOG_RES_NOMORELOG          - The iterator is before the oldest log
+ *              e_eFSS_LOG_RES_NOTVALIDLOG        - The log or his CRC are not valid
+ *              e_eFSS_LOG_RES_NEWVERSIONLOG      - New version of the blob requested
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_CLBCKERASEERR      - Erase callback returned error
+ *              e_eFSS_LOG_RES_CLBCKWRITEERR      - Write callback returned error
+ *              e_eFSS_LOG_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_LOG_RES_CLBCKCRCERR        - Crc callback returned error
+ *              e_eFSS_LOG_RES_WRITENOMATCHREAD   - After Write operation the Read operation readed different data
+ */
+e_eFSS_LOG_RES eFSS_LOG_IterPrev(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                 uint8_t** const p_ppuLog, uint32_t* const p_puLogL);
+
+/**
+ * @brief       Position the iterator before the log number p_uLogN, where zero is the oldest log. Only the length of
+ *              the skipped log is readed, CRC are not verified.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[in]   p_ptIter      - Opened iterator
+ * @param[in]   p_uLogN       - Number of log to skip starting from the oldest one
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER         - In case of bad pointer passed to the function
+ *              e_eFSS_LOG_RES_OK                 - Operation ended correctly
+ *              e_eFSS_LOG_RES_NOMORELOG          - Less than p_uLogN log are stored
+ *              e_eFSS_LOG_RES_NOTVALIDLOG        - A log is not valid
+ *              e_eFSS_LOG_RES_NEWVERSIONLOG      - New version of the blob requested
+ *              e_eFSS_LOG_RES_NOINITLIB          - Need to init the lib before calling this function
+ *              e_eFSS_LOG_RES_CORRUPTCTX         - Context is corrupted
+ *              e_eFSS_LOG_RES_CLBCKERASEERR      - Erase callback returned error
+ *              e_eFSS_LOG_RES_CLBCKWRITEERR      - Write callback returned error
+ *              e_eFSS_LOG_RES_CLBCKREADERR       - Read callback returned error
+ *              e_eFSS_LOG_RES_CLBCKCRCERR        - Crc callback returned error
+ *              e_eFSS_LOG_RES_WRITENOMATCHREAD   - After Write operation the Read operation readed different data
+ */
+e_eFSS_LOG_RES eFSS_LOG_IterSeek(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                 const uint32_t p_uLogN);
+
+/**
+ * @brief       Verify a part of the log pages against their backup, repairing a divergent or corrupted copy.
+ *              Every call continue from the pair where the previous one stopped and process pairs till the budget
+ *              is exhausted, so this function can be called periodically by an idle task to walk the whole storage
+ *              incrementally. Log pages have a backup only when the full backup is used, the flash cache pages
+ *              always have it. If no page has a backup nothing is done.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[in]   p_tBudget     - Budget of this call, see t_eFSS_TYPE_ScrubBudget
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER       - In case of bad pointer passed to the function
+ *		        e_eFSS_LOG_RES_CORRUPTCTX       - Context is corrupted
+ *		        e_eFSS_LOG_RES_NOINITLIB        - Need to init lib before calling function
+ *		        e_eFSS_LOG_RES_CLBCKREADERR     - The read callback reported an error
+ *              e_eFSS_LOG_RES_CLBCKCRCERR      - The crc callback reported an error
+ *              e_eFSS_LOG_RES_NOTVALIDLOG      - Both the pages of a pair are not valid
+ *              e_eFSS_LOG_RES_NEWVERSIONLOG    - A pair has a new version
+ *              e_eFSS_LOG_RES_CLBCKERASEERR    - Error reported from the callback
+ *              e_eFSS_LOG_RES_CLBCKWRITEERR    - Error reported from the callback
+ *              e_eFSS_LOG_RES_WRITENOMATCHREAD - For some unknow reason data write dosent match data readed
+ *              e_eFSS_LOG_RES_INPROGRESS       - The budget is exhausted before verifying every pair
+ *              e_eFSS_LOG_RES_OK_BKP_RCVRD     - Every pair is verified and at least one page was repaired in this
+ *                                                pass, the next call start a new pass
+ *              e_eFSS_LOG_RES_OK               - Every pair is verified, the next call start a new pass
+ */
+e_eFSS_LOG_RES eFSS_LOG_Scrub(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_TYPE_ScrubBudget p_tBudget);
+
+/**
+ * @brief       Get the statistics of the operations done on the storage area since the init or the last reset,
+ *              see t_eFSS_TYPE_Stats.
+ *
+ * @param[in]   p_ptCtx       - Log context
+ * @param[out]  p_ptStats     - Pointer to a statistics struct that will be filled with the collected counters
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_LOG_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_LOG_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_LOG_RES_OK            - Operation ended correctly
+ */
+e_eFSS_LOG_RES eFSS_LOG_GetStats(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats);
+
+/**
+ * @brief       Reset to zero every statistics counter
+ *
+ * @param[in]   p_ptCtx       - Log context
+ *
+ * @return      e_eFSS_LOG_RES_BADPOINTER    - In case of bad pointer passed to the function
+ *		        e_eFSS_LOG_RES_CORRUPTCTX    - Context is corrupted
+ *		        e_eFSS_LOG_RES_NOINITLIB     - Need to init lib before calling function
+ *              e_eFSS_LOG_RES_OK            - Operation ended correctly
+ */
+e_eFSS_LOG_RES eFSS_LOG_ResetStats(t_eFSS_LOG_Ctx* const p_ptCtx);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -46,6 +46,13 @@
  * ES:
  * LOG | NEWEST PAGE | NEWEST PAGE BLUP | FREE PAGE | OLDEST LOG | LOG
  * uPageUseSpec2 = 3
+ *
+ *  --> FRAMED LOG (only when eFSS_LOG_InitFramedLog is called), every log stored in the user data area is:
+ * ------------------------------------------------------------------ Log
+ * - uint32_t  - Log length         -> Length of the user log        |
+ * - [uint8_t] -                    -> N byte of user log            |
+ * - uint32_t  - Log CRC            -> CRC of the user log, optional |
+ * ------------------------------------------------------------------ Next log
  */
 
 
@@ -56,6 +63,12 @@
 #define EFSS_LOG_MINPAGESIZE                                                              ( ( uint32_t )         0x05u )
 #define EFSS_LOG_FILLPOFF                                                                 ( ( uint32_t )         0x04u )
 #define EFSS_LOG_NEWBKPEMPY_P                                                             ( ( uint32_t )         0x03u )
+#define EFSS_LOG_RECHEADL                                                                 ( ( uint32_t )         0x04u )
+#define EFSS_LOG_RECCRCL                                                                  ( ( uint32_t )         0x04u )
+#define EFSS_LOG_SEED                                                                     ( ( uint32_t )  0xFFFFFFFFu )
+#define EFSS_LOG_FMTNONE                                                                  ( ( uint32_t )         0x00u )
+#define EFSS_LOG_FMTNEWEST                                                                ( ( uint32_t )         0x01u )
+#define EFSS_LOG_FMTCACHE                                                                 ( ( uint32_t )         0x02u )
 
 
 
@@ -73,10 +86,12 @@ static e_eFSS_LOG_RES eFSS_LOG_LOGCtoLOGRes(const e_eFSS_LOGC_RES p_eLOGCRes);
 static e_eFSS_LOG_RES eFSS_LOG_LoadIndexNRepair(t_eFSS_LOG_Ctx* const p_ptCtx);
 static e_eFSS_LOG_RES eFSS_LOG_LoadIndexFromCache(t_eFSS_LOG_Ctx* const p_ptCtx);
 static e_eFSS_LOG_RES eFSS_LOG_LoadIndxBySearch(t_eFSS_LOG_Ctx* const p_ptCtx);
+static e_eFSS_LOG_RES eFSS_LOG_GuessNewestBySeq(t_eFSS_LOG_Ctx* const p_ptCtx, uint32_t* const p_puIdx);
 static e_eFSS_LOG_RES eFSS_LOG_GetNextIndex(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uCurIdx,
                                             uint32_t* const p_uNextIdx);
 static e_eFSS_LOG_RES eFSS_LOG_GetPrevIndex(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uCurIdx,
                                             uint32_t* const p_puPrevIdx);
+static e_eFSS_LOG_RES eFSS_LOG_FormatNextPage(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_LOGC_StorBuf* p_ptBuff);
 
 
 
@@ -93,8 +108,39 @@ static e_eFSS_LOG_RES eFSS_LOG_LoadBufferAsNewestNBkpPage(t_eFSS_LOG_Ctx* const
 /***********************************************************************************************************************
  *  PRIVATE UTILS FOR SAVING LOG ON NEXT PAGE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
-static e_eFSS_LOG_RES eFSS_LOG_SaveLogOnNextPage(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puRawVal,
-                                                 const uint32_t p_uElemL);
+static e_eFSS_LOG_RES eFSS_LOG_SaveLogOnNextPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uByteInPage,
+                                                 uint8_t* const p_puRawVal, const uint32_t p_uElemL,
+                                                 uint32_t* const p_puNewByteInPage);
+static e_eFSS_LOG_RES eFSS_LOG_SaveLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puRawVal,
+                                       const uint32_t p_uElemL);
+static e_eFSS_LOG_RES eFSS_LOG_SaveLogInNewest(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uByteInPage,
+                                               uint8_t* const p_puRawVal, const uint32_t p_uElemL,
+                                               uint32_t* const p_puNewByteInPage);
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE UTILS FOR PENDING LOG STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static e_eFSS_LOG_RES eFSS_LOG_PendLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puRawVal,
+                                        const uint32_t p_uElemL, bool_t* const p_pbIsPending);
+static e_eFSS_LOG_RES eFSS_LOG_SyncPending(t_eFSS_LOG_Ctx* const p_ptCtx);
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE UTILS FOR FRAMED LOG STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static uint32_t eFSS_LOG_GetStoredL(const t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uElemL);
+static e_eFSS_LOG_RES eFSS_LOG_AppendLog(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_LOGC_StorBuf* p_ptBuff,
+                                         const uint32_t p_uByteInPage, const uint8_t* p_puRawVal,
+                                         const uint32_t p_uElemL);
+static e_eFSS_LOG_RES eFSS_LOG_CopyLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puDest,
+                                       const uint8_t* p_puRawVal, const uint32_t p_uElemL);
+static e_eFSS_LOG_RES eFSS_LOG_ParseLog(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_LOG_Iter* const p_ptIter,
+                                        const uint32_t p_uOff, const bool_t p_bCheckCrc, uint32_t* const p_puElemL);
+static e_eFSS_LOG_RES eFSS_LOG_IterLoadPage(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                            const uint32_t p_uIdx);
 
 
 
@@ -148,6 +194,34 @@ e_eFSS_LOG_RES eFSS_LOG_InitCtx(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_TYPE
                     /* All ok, fill context */
                     p_ptCtx->uNewPagIdx = 0;
                     p_ptCtx->uFullFilledP = 0;
+                    p_ptCtx->uNewPagSeq = 0u;
+
+                    /* Log are stored raw until eFSS_LOG_InitFramedLog is called */
+                    p_ptCtx->bFramedLog = false;
+                    p_ptCtx->bRecordCrc = false;
+                    p_ptCtx->ptCtxCrc32 = p_tCtxCb.ptCtxCrc32;
+                    p_ptCtx->fCrc32 = p_tCtxCb.fCrc32;
+
+                    /* Pending buffer is not used until eFSS_LOG_InitPendingBuff is called */
+                    p_ptCtx->puPendBuf = NULL;
+                    p_ptCtx->uPendBufL = 0u;
+                    p_ptCtx->uSyncByteThr = 0u;
+                    p_ptCtx->uSyncLogThr = 0u;
+                    p_ptCtx->uPendByte = 0u;
+                    p_ptCtx->uPendLogN = 0u;
+                    p_ptCtx->uPendPageIdx = 0u;
+                    p_ptCtx->uPendPageByte = 0u;
+
+                    /* Latency of the public function is measured here, the storage one by the core */
+                    p_ptCtx->ptCtxTime = p_tCtxCb.ptCtxTime;
+                    p_ptCtx->fTime = p_tCtxCb.fTime;
+                    (void)memset(&p_ptCtx->tLatAdd, 0, sizeof(t_eFSS_TYPE_LatHist));
+                    (void)memset(&p_ptCtx->tLatStatus, 0, sizeof(t_eFSS_TYPE_LatHist));
+                    (void)memset(&p_ptCtx->tLatFormat, 0, sizeof(t_eFSS_TYPE_LatHist));
+
+                    /* No stepped format ongoing, scrubber start from the first pair */
+                    p_ptCtx->uFormatPhase = EFSS_LOG_FMTNONE;
+                    (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
                 }
             }
             else
@@ -190,6 +264,10 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogStatus(t_eFSS_LOG_Ctx* const p_ptCtx)
     /* Local var used for calculation */
     bool_t l_bIsInit;
 
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
 	{
@@ -217,9 +295,18 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogStatus(t_eFSS_LOG_Ctx* const p_ptCtx)
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     /* How to know the status of the storage? Load storage index, if they are not found the storage
                        is corrupted or non initialized */
                     l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
+
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatStatus);
+                    }
                 }
             }
         }
@@ -274,14 +361,17 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogInfo(t_eFSS_LOG_Ctx* const p_ptCtx, uint32_t* cons
                 {
                     /* Verify storage integrity and load in the context the log index */
                     l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
-                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
                     {
                         /* Calculate n page */
                         l_uUsePages = 0u;
                         l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
-                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
-                        if( e_eFSS_LOG_RES_OK == l_eRes )
+                        if( e_eFSS_LOGC_RES_OK != l_eResC )
+                        {
+                            l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                        }
+                        else
                         {
                             /* New log index fill */
                             *p_puNewLogI = p_ptCtx->uNewPagIdx;
@@ -325,9 +415,9 @@ e_eFSS_LOG_RES eFSS_LOG_Format(t_eFSS_LOG_Ctx* const p_ptCtx)
     /* Local var used for calculation */
     bool_t l_bIsInit;
 
-    /* Local variable for decision making */
-    bool_t l_bInvalidateCurrent;
-    bool_t l_bIsFlashCacheUsed;
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
 
 	/* Check pointer validity */
 	if( NULL == p_ptCtx )
@@ -356,99 +446,98 @@ e_eFSS_LOG_RES eFSS_LOG_Format(t_eFSS_LOG_Ctx* const p_ptCtx)
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     l_uUsePages = 0u;
                     l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
                     l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
                     if( e_eFSS_LOG_RES_OK == l_eRes )
                     {
-                        /* Load index if possible, why? Because if we start formatting and a power outage occour
-                           we need that the log must remain recoverable or must be totaly formatted (or corrupted
-                           also). We dont want that a power outage could leave the area in state where wrong data
-                           could be readed */
-                        l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
+                        /* Start a new format even if a stepped one is ongoing, and execute it till the end */
+                        p_ptCtx->uFormatPhase = EFSS_LOG_FMTNONE;
+                        l_eRes = e_eFSS_LOG_RES_INPROGRESS;
 
-                        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                        while( e_eFSS_LOG_RES_INPROGRESS == l_eRes )
                         {
-                            /* Flash cache, so we find a valid newest page pointed by cache.
-                               1 - If the newest page is at index zero just format that page at index zero, withouth
-                                   modifyng the caches
-                               2 - If the newest page is not at index zero invalidate the current page (during a power
-                                   outage the state of the storage will be invalid) write newest page on index zero,
-                                   and finaly update the flash cache (even if a power outage occours, and the state of
-                                   the storage will be invalid, no problem: we were formatting the storage anyway.. ) */
-
-                            /* No flash cache, so we find a valid newest page.
-                               1 - If the newest page is at index zero just format that page otherwise invalidate
-                               2 - If the newest page is not at index zero invalidate the current page and just after
-                                   write newest on index zero */
-
-                            if( 0u != p_ptCtx->uNewPagIdx )
-                            {
-                                l_bInvalidateCurrent = true;
-                            }
-                            else
-                            {
-                                l_bInvalidateCurrent = false;
-                            }
+                            l_eRes = eFSS_LOG_FormatNextPage(p_ptCtx, &l_tBuff);
                         }
-                        else if( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes )
-                        {
-                            /* Flash cache: We could be in the cases where chache has bad index.
-                               first write newest page in index zero and after update caches */
+                    }
 
-                            /* No flash cache: no newest found. just write newest page in index 0 */
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatFormat);
+                    }
+                }
+            }
+        }
+	}
 
-                            l_bInvalidateCurrent = false;
-                        }
-                        else
-                        {
-                            /* Found some strange error, cannot continue */
-                            l_bInvalidateCurrent = true;
-                        }
+	return l_eRes;
+}
 
-                        /* Start the procedure */
-                        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) ||
-                            ( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes ) )
-                        {
-                            /* Invalidate the current pages if needed */
-                            if( true == l_bInvalidateCurrent )
-                            {
-                                /* Clear buffer  */
-                                memset(l_tBuff.puBuf, 0u, l_tBuff.uBufL);
+e_eFSS_LOG_RES eFSS_LOG_FormatStep(t_eFSS_LOG_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
 
-                                /* Flush */
-                                l_eRes = eFSS_LOG_FlushBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx, 0u);
-                            }
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
 
-                            if( e_eFSS_LOG_RES_OK == l_eRes )
-                            {
-                                /* Write newest in first index */
-                                p_ptCtx->uNewPagIdx = 0u;
-                                p_ptCtx->uFullFilledP = 0u;
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
-                                /* Clear buffer  */
-                                memset(l_tBuff.puBuf, 0u, l_tBuff.uBufL);
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Measure the latency of the single step */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
 
-                                /* Flush */
-                                l_eRes = eFSS_LOG_FlushBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx, 0u);
+                    l_uUsePages = 0u;
+                    l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
-                                if( e_eFSS_LOG_RES_OK == l_eRes )
-                                {
-                                    /* write cache, if needed */
-                                    l_eResC =  eFSS_LOGC_IsFlashCacheUsed(&p_ptCtx->tLOGCCtx, &l_bIsFlashCacheUsed);
-                                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
-                                    if( e_eFSS_LOG_RES_OK == l_eRes )
-                                    {
-                                        if( true == l_bIsFlashCacheUsed )
-                                        {
-                                            l_eResC = eFSS_LOGC_WriteCache(&p_ptCtx->tLOGCCtx, 0u, 0u);
-                                            l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
-                                        }
-                                    }
-                                }
-                            }
-                        }
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        l_eRes = eFSS_LOG_FormatNextPage(p_ptCtx, &l_tBuff);
+                    }
+
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatFormat);
                     }
                 }
             }
@@ -470,11 +559,11 @@ e_eFSS_LOG_RES eFSS_LOG_AddLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_p
 
     /* Local var used for calculation */
     bool_t l_bIsInit;
-    uint32_t l_uByteInPage;
+    bool_t l_bIsPending;
 
-    /* Decision making flag */
-    bool_t l_bNextBeforeSave;
-    bool_t l_bNextAfterSave;
+    /* Local var for the latency */
+    bool_t l_bIsTimed;
+    uint32_t l_uStartTime;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_puRawVal ) )
@@ -503,145 +592,187 @@ e_eFSS_LOG_RES eFSS_LOG_AddLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_p
                 }
                 else
                 {
+                    /* Measure the latency of the whole operation */
+                    l_bIsTimed = eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime);
+
                     l_uUsePages = 0u;
                     l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
                     l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
                     if( e_eFSS_LOG_RES_OK == l_eRes )
                     {
-                        /* Check data validity */
-                        if( (p_uElemL <= 0u ) || ( p_uElemL > l_tBuff.uBufL ) )
+                        /* Check data validity, the log must fit in an empty newest page */
+                        if( (p_uElemL <= 0u ) || ( p_uElemL > l_tBuff.uBufL ) ||
+                            ( eFSS_LOG_GetStoredL(p_ptCtx, p_uElemL) >= ( l_tBuff.uBufL - EFSS_LOG_FILLPOFF ) ) )
                         {
                             l_eRes = e_eFSS_LOG_RES_BADPARAM;
                         }
                         else
                         {
-                            /* Need to load latest index in order to do this */
-                            l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
-                            if( e_eFSS_LOG_RES_OK == l_eRes )
+                            /* Save the log in the pending buffer if used, or directly in the storage */
+                            l_bIsPending = false;
+                            if( NULL != p_ptCtx->puPendBuf )
                             {
-                                /* Read current newest page:
-                                 *    We have no space: Go next, and save log in next page
-                                 *    We have space: Save log in the current page, and if the avaiable space after
-                                 *                   saving is less than the size of filled page go next page
-                                 */
-                                l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx,
-                                                                             &l_uByteInPage);
+                                l_eRes = eFSS_LOG_PendLog(p_ptCtx, p_puRawVal, p_uElemL, &l_bIsPending);
+                            }
 
-                                if( e_eFSS_LOG_RES_OK == l_eRes )
-                                {
-                                    /* Choose what we have to do */
-                                    if( p_uElemL > ( l_tBuff.uBufL - l_uByteInPage ) )
-                                    {
-                                        /* Need to save the element on the next page */
-                                        l_bNextBeforeSave = true;
+                            if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( false == l_bIsPending ) )
+                            {
+                                l_eRes = eFSS_LOG_SaveLog(p_ptCtx, p_puRawVal, p_uElemL);
+                            }
+                        }
+                    }
 
-                                        /* Need to skip even after the saving? */
-                                        if( p_uElemL > ( l_tBuff.uBufL - EFSS_LOG_FILLPOFF ) )
-                                        {
-                                            /* Next page even after the save */
-                                            l_bNextAfterSave = true;
-                                        }
-                                        else
-                                        {
-                                            l_bNextAfterSave = false;
-                                        }
-                                    }
-                                    else
-                                    {
-                                        /* can save the element on the current page, need to choose if we need to go
-                                           next page after saving */
-                                           l_bNextBeforeSave = false;
-
-                                           if( ( l_tBuff.uBufL - l_uByteInPage - p_uElemL ) <= EFSS_LOG_FILLPOFF )
-                                           {
-                                                l_bNextAfterSave = true;
-                                           }
-                                           else
-                                           {
-                                                l_bNextAfterSave = false;
-                                           }
-                                    }
+                    if( true == l_bIsTimed )
+                    {
+                        (void)eFSS_Utils_AddLatency(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_uStartTime,
+                                                    &p_ptCtx->tLatAdd);
+                    }
+                }
+            }
+        }
+	}
 
-                                    /* Ok, so now we have al cases and we can proceed with reading and writing pages */
-                                    if( ( true == l_bNextBeforeSave ) && ( true == l_bNextAfterSave ) )
-                                    {
-                                        /* We have space to append the log but just after we need to increase log
-                                         * page:
-                                         *   1 - Append the log and flush the page as LOG page
-                                         *   2 - Save an empty pge just after
-                                         */
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_AddLogs(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_LOG_LogEle* const p_ptLogs,
+                                const uint32_t p_uNLogs)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
 
-                                        memcpy(&l_tBuff.puBuf[l_uByteInPage], p_puRawVal, p_uElemL);
-                                        l_uByteInPage += p_uElemL;
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
 
-                                        l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_LOG,
-                                                                          p_ptCtx->uNewPagIdx, l_uByteInPage);
-                                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+    bool_t l_bIsToFlush;
+    uint32_t l_uLogIdx;
+    uint32_t l_uByteInPage;
+    uint32_t l_uFreeByte;
+    uint32_t l_uStoredL;
 
-                                        if( e_eFSS_LOG_RES_OK == l_eRes )
-                                        {
-                                            l_eRes = eFSS_LOG_SaveLogOnNextPage(p_ptCtx,  p_puRawVal, 0u);
-                                        }
-                                    }
-                                    else if( ( true == l_bNextBeforeSave ) && ( false == l_bNextAfterSave ) )
-                                    {
-                                        /* We have space to append the log but just after we need to increase log
-                                         * page:
-                                         *   1 - Append the log and flush the page as LOG page
-                                         *   2 - Save an empty pge just after
-                                         */
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptLogs ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
-                                        memcpy(&l_tBuff.puBuf[l_uByteInPage], p_puRawVal, p_uElemL);
-                                        l_uByteInPage += p_uElemL;
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_uUsePages = 0u;
+                    l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
-                                        l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_LOG,
-                                                                          p_ptCtx->uNewPagIdx, l_uByteInPage);
-                                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        /* Check data validity of every log before saving anything */
+                        if( p_uNLogs <= 0u )
+                        {
+                            l_eRes = e_eFSS_LOG_RES_BADPARAM;
+                        }
 
-                                        if( e_eFSS_LOG_RES_OK == l_eRes )
-                                        {
-                                            l_eRes = eFSS_LOG_SaveLogOnNextPage(p_ptCtx,  p_puRawVal, 0u);
-                                        }
-                                    }
-                                    /* Ok, so now we have al cases and we can proceed with reading and writing pages */
-                                    else if( ( false == l_bNextBeforeSave ) && ( true == l_bNextAfterSave ) )
-                                    {
-                                        /* We have space to append the log but just after we need to increase log
-                                         * page:
-                                         *   1 - Append the log and flush the page as LOG page
-                                         *   2 - Save an empty pge just after
-                                         */
+                        l_uLogIdx = 0u;
+                        while( ( l_uLogIdx < p_uNLogs ) && ( e_eFSS_LOG_RES_OK == l_eRes ) )
+                        {
+                            if( NULL == p_ptLogs[l_uLogIdx].puLogRaw )
+                            {
+                                l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+                            }
+                            else if( ( p_ptLogs[l_uLogIdx].uLogL <= 0u ) ||
+                                     ( p_ptLogs[l_uLogIdx].uLogL > l_tBuff.uBufL ) ||
+                                     ( eFSS_LOG_GetStoredL(p_ptCtx, p_ptLogs[l_uLogIdx].uLogL) >=
+                                       ( l_tBuff.uBufL - EFSS_LOG_FILLPOFF ) ) )
+                            {
+                                l_eRes = e_eFSS_LOG_RES_BADPARAM;
+                            }
+                            else
+                            {
+                                /* Log ok */
+                            }
 
-                                        memcpy(&l_tBuff.puBuf[l_uByteInPage], p_puRawVal, p_uElemL);
-                                        l_uByteInPage += p_uElemL;
+                            l_uLogIdx++;
+                        }
 
-                                        l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_LOG,
-                                                                          p_ptCtx->uNewPagIdx, l_uByteInPage);
-                                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                        if( e_eFSS_LOG_RES_OK == l_eRes )
+                        {
+                            /* Pending log are older than the passed one, store them first */
+                            l_eRes = eFSS_LOG_SyncPending(p_ptCtx);
+                        }
 
-                                        if( e_eFSS_LOG_RES_OK == l_eRes )
-                                        {
-                                            l_eRes = eFSS_LOG_SaveLogOnNextPage(p_ptCtx,  p_puRawVal, 0u);
-                                        }
-                                    }
-                                    else
-                                    {
-                                        /* Simpliest cases, no new page before adding log, and no new page after
-                                           saving the log, not even needed to update the flash cache */
+                        if( e_eFSS_LOG_RES_OK == l_eRes )
+                        {
+                            /* Load the newest page only once, every log that fits in it is just copied in the buffer */
+                            l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
+
+                            if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                            {
+                                l_uByteInPage = 0u;
+                                l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx,
+                                                                             &l_uByteInPage);
+                            }
 
-                                        /* Add log in to the buffer */
-                                        memcpy(&l_tBuff.puBuf[l_uByteInPage], p_puRawVal, p_uElemL);
+                            if( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes )
+                            {
+                                /* The newest page is repaired and loaded, go on */
+                                l_eRes = e_eFSS_LOG_RES_OK;
+                            }
+                        }
 
-                                        /* Increase the byte in page counter */
-                                        l_uByteInPage += p_uElemL;
+                        l_bIsToFlush = false;
+                        l_uLogIdx = 0u;
+                        while( ( l_uLogIdx < p_uNLogs ) && ( e_eFSS_LOG_RES_OK == l_eRes ) )
+                        {
+                            l_uFreeByte = l_tBuff.uBufL - l_uByteInPage;
+                            l_uStoredL = eFSS_LOG_GetStoredL(p_ptCtx, p_ptLogs[l_uLogIdx].uLogL);
 
-                                        /* Save */
-                                        l_eRes = eFSS_LOG_FlushBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx,
-                                                                                      l_uByteInPage);
-                                    }
-                                }
+                            if( ( l_uStoredL < l_uFreeByte ) && ( ( l_uFreeByte - l_uStoredL ) > EFSS_LOG_FILLPOFF ) )
+                            {
+                                /* Can stay in the newest page, flush it later */
+                                l_eRes = eFSS_LOG_AppendLog(p_ptCtx, &l_tBuff, l_uByteInPage,
+                                                            p_ptLogs[l_uLogIdx].puLogRaw, p_ptLogs[l_uLogIdx].uLogL);
+                                l_uByteInPage += l_uStoredL;
+                                l_bIsToFlush = true;
+                            }
+                            else
+                            {
+                                /* The log needs a new page. The newest page, with the log not flushed yet, is
+                                 * finalized together with this log. After that the buffer holds the new newest
+                                 * page, so there is no need to load it again */
+                                l_eRes = eFSS_LOG_SaveLogInNewest(p_ptCtx, l_uByteInPage, p_ptLogs[l_uLogIdx].puLogRaw,
+                                                                  p_ptLogs[l_uLogIdx].uLogL, &l_uByteInPage);
+                                l_bIsToFlush = false;
                             }
+
+                            l_uLogIdx++;
+                        }
+
+                        if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( true == l_bIsToFlush ) )
+                        {
+                            /* Single flush of the newest page and of his backup for the remaining log */
+                            l_eRes = eFSS_LOG_FlushBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx, l_uByteInPage);
                         }
                     }
                 }
@@ -666,6 +797,7 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogOfAPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint3
     /* Local var used for calculation */
     bool_t l_bIsInit;
     uint32_t l_uByteInPages;
+    uint32_t l_uSeqN;
 
 	/* Check pointer validity */
 	if( ( NULL == p_ptCtx ) || ( NULL == p_puBuf ) || ( NULL == p_puValorByte ) )
@@ -709,7 +841,7 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogOfAPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint3
                         {
                             /* Repair and load index */
                             l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
-                            if( e_eFSS_LOG_RES_OK == l_eRes )
+                            if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
                             {
                                 /* Can now retrive data, before doing this check if it's the newest */
                                 if( p_uindx == p_ptCtx->uNewPagIdx )
@@ -717,9 +849,10 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogOfAPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint3
                                     /* Newest page, load using proper function */
                                     l_eRes =  eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, p_uindx, &l_uByteInPages);
 
-                                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                                    if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
                                     {
-                                        if( l_uByteInPages > p_uBufL )
+                                        if( ( l_uByteInPages > p_uBufL ) ||
+                                            ( ( p_uBufL - l_uByteInPages ) < p_ptCtx->uPendByte ) )
                                         {
                                             /* Not possible */
                                             l_eRes = e_eFSS_LOG_RES_BADPARAM;
@@ -727,6 +860,16 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogOfAPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint3
                                         else
                                         {
                                             memcpy(p_puBuf, l_tBuff.puBuf, l_uByteInPages);
+
+                                            /* Pending log are not stored yet, but they are part of this page */
+                                            if( ( 0u != p_ptCtx->uPendLogN ) && ( p_uindx == p_ptCtx->uPendPageIdx ) )
+                                            {
+                                                memcpy(&p_puBuf[l_uByteInPages], p_ptCtx->puPendBuf,
+                                                       p_ptCtx->uPendByte);
+                                                l_uByteInPages += p_ptCtx->uPendByte;
+                                            }
+
+                                            *p_puValorByte = l_uByteInPages;
                                         }
                                     }
                                 }
@@ -736,9 +879,9 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogOfAPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint3
 
                                     /* Read the log page */
                                     l_eResC =  eFSS_LOGC_LoadBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_LOG,
-                                                                      p_uindx, &l_uByteInPages);
+                                                                      p_uindx, &l_uByteInPages, &l_uSeqN);
                                     l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
-                                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                                    if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
                                     {
                                         if( l_uByteInPages > p_uBufL )
                                         {
@@ -747,6 +890,7 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogOfAPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint3
                                         else
                                         {
                                             memcpy(p_puBuf, l_tBuff.puBuf, l_uByteInPages);
+                                            *p_puValorByte = l_uByteInPages;
                                         }
                                     }
                                 }
@@ -762,27 +906,892 @@ e_eFSS_LOG_RES eFSS_LOG_GetLogOfAPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint3
 }
 
 
-
-/***********************************************************************************************************************
- *  PRIVATE FUNCTION
- **********************************************************************************************************************/
-static bool_t eFSS_LOG_IsStatusStillCoherent(t_eFSS_LOG_Ctx* const p_ptCtx)
+e_eFSS_LOG_RES eFSS_LOG_InitPendingBuff(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puPendBuf,
+                                        const uint32_t p_uPendBufL, const uint32_t p_uSyncByteThr,
+                                        const uint32_t p_uSyncLogThr)
 {
-    bool_t l_eRes;
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
 
-	/* Check context validity */
-	if( NULL == p_ptCtx )
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puPendBuf ) )
 	{
-		l_eRes = false;
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
 	}
 	else
 	{
-        l_eRes = true;
-//            /* Che New index validity */
-//            if( ( ( false == p_ptCtx->bFullBckup ) && ( false == p_ptCtx->bFlashCache ) &&
-//                  ( p_ptCtx->uNewPagIdx >= l_uNPage ) ) ||
-//                ( ( false == p_ptCtx->bFullBckup ) && ( true  == p_ptCtx->bFlashCache ) &&
-//                  ( p_ptCtx->uNewPagIdx >= ( l_uNPage - 2u ) ) ) ||
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Check data validity, and never drop log already pending in the previous buffer */
+                    if( ( p_uPendBufL <= 0u ) || ( p_uSyncByteThr <= 0u ) || ( p_uSyncByteThr > p_uPendBufL ) ||
+                        ( p_uSyncLogThr <= 0u ) || ( 0u != p_ptCtx->uPendLogN ) )
+                    {
+                        l_eRes = e_eFSS_LOG_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        p_ptCtx->puPendBuf = p_puPendBuf;
+                        p_ptCtx->uPendBufL = p_uPendBufL;
+                        p_ptCtx->uSyncByteThr = p_uSyncByteThr;
+                        p_ptCtx->uSyncLogThr = p_uSyncLogThr;
+                        p_ptCtx->uPendByte = 0u;
+                        p_ptCtx->uPendLogN = 0u;
+                        p_ptCtx->uPendPageIdx = 0u;
+                        p_ptCtx->uPendPageByte = 0u;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_Sync(t_eFSS_LOG_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Store every pending log, if any */
+                    l_eRes = eFSS_LOG_SyncPending(p_ptCtx);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_GetPendingByte(t_eFSS_LOG_Ctx* const p_ptCtx, uint32_t* const p_puPendByte)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puPendByte ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    *p_puPendByte = p_ptCtx->uPendByte;
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_InitFramedLog(t_eFSS_LOG_Ctx* const p_ptCtx, const bool_t p_bRecordCrc)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Pending log are already stored in the pending buffer with the previous format */
+                    if( 0u != p_ptCtx->uPendLogN )
+                    {
+                        l_eRes = e_eFSS_LOG_RES_BADPARAM;
+                    }
+                    else
+                    {
+                        p_ptCtx->bFramedLog = true;
+                        p_ptCtx->bRecordCrc = p_bRecordCrc;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_InitTrustOrigin(t_eFSS_LOG_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The page are loaded by the low level core */
+                    l_eResC = eFSS_LOGC_SetTrustOri(&p_ptCtx->tLOGCCtx, true);
+                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_IterOpen(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                 uint8_t* const p_puPageBuf, const uint32_t p_uPageBufL, const bool_t p_bAtNewest)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+    uint32_t l_uNewIdx;
+    uint32_t l_uOldIdx;
+    uint32_t l_uPageUsed;
+    uint32_t l_uPageTot;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptIter ) || ( NULL == p_puPageBuf ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_uUsePages = 0u;
+                    l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        /* Only framed log can be splitted, and the page buffer must contain a whole page */
+                        if( ( false == p_ptCtx->bFramedLog ) || ( p_uPageBufL < l_tBuff.uBufL ) )
+                        {
+                            l_eRes = e_eFSS_LOG_RES_BADPARAM;
+                        }
+                        else
+                        {
+                            /* Get the range of page that contains log */
+                            l_eRes = eFSS_LOG_GetLogInfo(p_ptCtx, &l_uNewIdx, &l_uOldIdx, &l_uPageUsed, &l_uPageTot);
+
+                            if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                            {
+                                p_ptIter->puPageBuf = p_puPageBuf;
+                                p_ptIter->uPageBufL = p_uPageBufL;
+                                p_ptIter->uOldPageIdx = l_uOldIdx;
+                                p_ptIter->uNewPageIdx = l_uNewIdx;
+
+                                if( true == p_bAtNewest )
+                                {
+                                    /* Position after the newest log */
+                                    l_eRes = eFSS_LOG_IterLoadPage(p_ptCtx, p_ptIter, l_uNewIdx);
+                                    p_ptIter->uRecOff = p_ptIter->uPageByte;
+                                }
+                                else
+                                {
+                                    /* Position before the oldest log */
+                                    l_eRes = eFSS_LOG_IterLoadPage(p_ptCtx, p_ptIter, l_uOldIdx);
+                                    p_ptIter->uRecOff = 0u;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_IterNext(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                 uint8_t** const p_ppuLog, uint32_t* const p_puLogL)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+    uint32_t l_uNextIdx;
+    uint32_t l_uElemL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptIter ) || ( NULL == p_ppuLog ) || ( NULL == p_puLogL ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Move to the next page until a log is found */
+                    while( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( p_ptIter->uRecOff >= p_ptIter->uPageByte ) )
+                    {
+                        if( p_ptIter->uPageIdx == p_ptIter->uNewPageIdx )
+                        {
+                            l_eRes = e_eFSS_LOG_RES_NOMORELOG;
+                        }
+                        else
+                        {
+                            l_uNextIdx = 0u;
+                            l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, p_ptIter->uPageIdx, &l_uNextIdx);
+
+                            if( e_eFSS_LOG_RES_OK == l_eRes )
+                            {
+                                l_eRes = eFSS_LOG_IterLoadPage(p_ptCtx, p_ptIter, l_uNextIdx);
+                                p_ptIter->uRecOff = 0u;
+                            }
+                        }
+                    }
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        l_uElemL = 0u;
+                        l_eRes = eFSS_LOG_ParseLog(p_ptCtx, p_ptIter, p_ptIter->uRecOff, true, &l_uElemL);
+
+                        if( e_eFSS_LOG_RES_OK == l_eRes )
+                        {
+                            *p_ppuLog = &p_ptIter->puPageBuf[p_ptIter->uRecOff + EFSS_LOG_RECHEADL];
+                            *p_puLogL = l_uElemL;
+                            p_ptIter->uRecOff += eFSS_LOG_GetStoredL(p_ptCtx, l_uElemL);
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_IterPrev(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                 uint8_t** const p_ppuLog, uint32_t* const p_puLogL)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+    bool_t l_bIsFound;
+    uint32_t l_uPrevIdx;
+    uint32_t l_uOff;
+    uint32_t l_uNextOff;
+    uint32_t l_uElemL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptIter ) || ( NULL == p_ppuLog ) || ( NULL == p_puLogL ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Move to the previous page until a log is found */
+                    while( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( 0u == p_ptIter->uRecOff ) )
+                    {
+                        if( p_ptIter->uPageIdx == p_ptIter->uOldPageIdx )
+                        {
+                            l_eRes = e_eFSS_LOG_RES_NOMORELOG;
+                        }
+                        else
+                        {
+                            l_uPrevIdx = 0u;
+                            l_eRes = eFSS_LOG_GetPrevIndex(p_ptCtx, p_ptIter->uPageIdx, &l_uPrevIdx);
+
+                            if( e_eFSS_LOG_RES_OK == l_eRes )
+                            {
+                                l_eRes = eFSS_LOG_IterLoadPage(p_ptCtx, p_ptIter, l_uPrevIdx);
+                                p_ptIter->uRecOff = p_ptIter->uPageByte;
+                            }
+                        }
+                    }
+
+                    /* Log length is stored only before the log, so search the log that ends at the current position
+                       starting from the begin of the page */
+                    l_bIsFound = false;
+                    l_uOff = 0u;
+                    while( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( false == l_bIsFound ) )
+                    {
+                        l_uElemL = 0u;
+                        l_eRes = eFSS_LOG_ParseLog(p_ptCtx, p_ptIter, l_uOff, false, &l_uElemL);
+
+                        if( e_eFSS_LOG_RES_OK == l_eRes )
+                        {
+                            l_uNextOff = l_uOff + eFSS_LOG_GetStoredL(p_ptCtx, l_uElemL);
+
+                            if( l_uNextOff == p_ptIter->uRecOff )
+                            {
+                                l_bIsFound = true;
+                            }
+                            else if( l_uNextOff > p_ptIter->uRecOff )
+                            {
+                                l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+                            }
+                            else
+                            {
+                                l_uOff = l_uNextOff;
+                            }
+                        }
+                    }
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        /* Found, now verify it */
+                        l_eRes = eFSS_LOG_ParseLog(p_ptCtx, p_ptIter, l_uOff, true, &l_uElemL);
+
+                        if( e_eFSS_LOG_RES_OK == l_eRes )
+                        {
+                            *p_ppuLog = &p_ptIter->puPageBuf[l_uOff + EFSS_LOG_RECHEADL];
+                            *p_puLogL = l_uElemL;
+                            p_ptIter->uRecOff = l_uOff;
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_IterSeek(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                 const uint32_t p_uLogN)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+    uint32_t l_uNextIdx;
+    uint32_t l_uToSkip;
+    uint32_t l_uElemL;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_ptIter ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Start from the oldest log, only the log length is read while skipping */
+                    l_eRes = eFSS_LOG_IterLoadPage(p_ptCtx, p_ptIter, p_ptIter->uOldPageIdx);
+                    p_ptIter->uRecOff = 0u;
+                    l_uToSkip = p_uLogN;
+
+                    while( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( l_uToSkip > 0u ) )
+                    {
+                        if( p_ptIter->uRecOff >= p_ptIter->uPageByte )
+                        {
+                            if( p_ptIter->uPageIdx == p_ptIter->uNewPageIdx )
+                            {
+                                l_eRes = e_eFSS_LOG_RES_NOMORELOG;
+                            }
+                            else
+                            {
+                                l_uNextIdx = 0u;
+                                l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, p_ptIter->uPageIdx, &l_uNextIdx);
+
+                                if( e_eFSS_LOG_RES_OK == l_eRes )
+                                {
+                                    l_eRes = eFSS_LOG_IterLoadPage(p_ptCtx, p_ptIter, l_uNextIdx);
+                                    p_ptIter->uRecOff = 0u;
+                                }
+                            }
+                        }
+                        else
+                        {
+                            l_uElemL = 0u;
+                            l_eRes = eFSS_LOG_ParseLog(p_ptCtx, p_ptIter, p_ptIter->uRecOff, false, &l_uElemL);
+
+                            if( e_eFSS_LOG_RES_OK == l_eRes )
+                            {
+                                p_ptIter->uRecOff += eFSS_LOG_GetStoredL(p_ptCtx, l_uElemL);
+                                l_uToSkip--;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_Scrub(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_TYPE_ScrubBudget p_tBudget)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var used for calculation */
+    bool_t l_bIsInit;
+    uint32_t l_uNPair;
+
+    /* Local variable for the budget */
+    t_eFSS_TYPE_ScrubBudget l_tBudget;
+    uint32_t l_uStartTime;
+    uint32_t l_uPageDone;
+    bool_t l_bIsStop;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Without a start time only the page limit can be used */
+                    l_tBudget = p_tBudget;
+                    if( false == eFSS_Utils_GetTime(p_ptCtx->ptCtxTime, p_ptCtx->fTime, &l_uStartTime) )
+                    {
+                        l_tBudget.uMaxTime = 0u;
+                        l_uStartTime = 0u;
+                    }
+
+                    l_uPageDone = 0u;
+                    l_bIsStop = false;
+
+                    while( false == l_bIsStop )
+                    {
+                        l_uNPair = 0u;
+                        l_eResC = eFSS_LOGC_ScrubPair(&p_ptCtx->tLOGCCtx, p_ptCtx->tScrub.uNextIdx, &l_uNPair);
+                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                        {
+                            if( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes )
+                            {
+                                p_ptCtx->tScrub.bIsRepaired = true;
+                            }
+
+                            l_uPageDone++;
+                            p_ptCtx->tScrub.uNextIdx++;
+
+                            if( p_ptCtx->tScrub.uNextIdx >= l_uNPair )
+                            {
+                                /* Pass ended, the next call start a new one */
+                                if( true == p_ptCtx->tScrub.bIsRepaired )
+                                {
+                                    l_eRes = e_eFSS_LOG_RES_OK_BKP_RCVRD;
+                                }
+                                else
+                                {
+                                    l_eRes = e_eFSS_LOG_RES_OK;
+                                }
+
+                                (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
+                                l_bIsStop = true;
+                            }
+                            else
+                            {
+                                l_eRes = e_eFSS_LOG_RES_INPROGRESS;
+                                l_bIsStop = eFSS_Utils_IsBudgetEnded(p_ptCtx->ptCtxTime, p_ptCtx->fTime, l_tBudget,
+                                                                     l_uStartTime, l_uPageDone);
+                            }
+                        }
+                        else
+                        {
+                            /* Restart the pass from the first pair */
+                            (void)memset(&p_ptCtx->tScrub, 0, sizeof(t_eFSS_TYPE_ScrubCtx));
+                            l_bIsStop = true;
+                        }
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_GetStats(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_TYPE_Stats* const p_ptStats)
+{
+	/* Return local var */
+    e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* The counters are kept by the low level core of the storage area */
+                    l_eResC = eFSS_LOGC_GetStats(&p_ptCtx->tLOGCCtx, p_ptStats);
+                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                    /* The latency of the public functions are kept here */
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        p_ptStats->tLatAdd = p_ptCtx->tLatAdd;
+                        p_ptStats->tLatStatus = p_ptCtx->tLatStatus;
+                        p_ptStats->tLatFormat = p_ptCtx->tLatFormat;
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+e_eFSS_LOG_RES eFSS_LOG_ResetStats(t_eFSS_LOG_Ctx* const p_ptCtx)
+{
+	/* Return local var */
+    e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local var for init */
+    bool_t l_bIsInit;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+		/* Check Init */
+        l_bIsInit = false;
+        l_eResC = eFSS_LOGC_IsInit(&p_ptCtx->tLOGCCtx, &l_bIsInit);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            if( false == l_bIsInit )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            }
+            else
+            {
+                /* Check internal status validity */
+                if( false == eFSS_LOG_IsStatusStillCoherent(p_ptCtx) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    /* Reset the counters of the low level core */
+                    l_eResC = eFSS_LOGC_ResetStats(&p_ptCtx->tLOGCCtx);
+                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        (void)memset(&p_ptCtx->tLatAdd, 0, sizeof(t_eFSS_TYPE_LatHist));
+                        (void)memset(&p_ptCtx->tLatStatus, 0, sizeof(t_eFSS_TYPE_LatHist));
+                        (void)memset(&p_ptCtx->tLatFormat, 0, sizeof(t_eFSS_TYPE_LatHist));
+                    }
+                }
+            }
+        }
+	}
+
+	return l_eRes;
+}
+
+
+/***********************************************************************************************************************
+ *  PRIVATE FUNCTION
+ **********************************************************************************************************************/
+static bool_t eFSS_LOG_IsStatusStillCoherent(t_eFSS_LOG_Ctx* const p_ptCtx)
+{
+    bool_t l_eRes;
+
+	/* Check context validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = false;
+	}
+	else
+	{
+        /* Check framed log validity */
+        if( ( NULL == p_ptCtx->fCrc32 ) || ( ( false == p_ptCtx->bFramedLog ) && ( true == p_ptCtx->bRecordCrc ) ) )
+        {
+            l_eRes = false;
+        }
+        /* Check pending buffer validity */
+        else if( NULL == p_ptCtx->puPendBuf )
+        {
+            if( ( 0u != p_ptCtx->uPendByte ) || ( 0u != p_ptCtx->uPendLogN ) )
+            {
+                l_eRes = false;
+            }
+            else
+            {
+                l_eRes = true;
+            }
+        }
+        else
+        {
+            if( ( p_ptCtx->uPendByte > p_ptCtx->uPendBufL ) || ( p_ptCtx->uSyncByteThr <= 0u ) ||
+                ( p_ptCtx->uSyncByteThr > p_ptCtx->uPendBufL ) || ( p_ptCtx->uSyncLogThr <= 0u ) ||
+                ( ( 0u == p_ptCtx->uPendLogN ) && ( 0u != p_ptCtx->uPendByte ) ) )
+            {
+                l_eRes = false;
+            }
+            else
+            {
+                l_eRes = true;
+            }
+        }
+//            /* Che New index validity */
+//            if( ( ( false == p_ptCtx->bFullBckup ) && ( false == p_ptCtx->bFlashCache ) &&
+//                  ( p_ptCtx->uNewPagIdx >= l_uNPage ) ) ||
+//                ( ( false == p_ptCtx->bFullBckup ) && ( true  == p_ptCtx->bFlashCache ) &&
+//                  ( p_ptCtx->uNewPagIdx >= ( l_uNPage - 2u ) ) ) ||
 //                ( ( true  == p_ptCtx->bFullBckup ) && ( false == p_ptCtx->bFlashCache ) &&
 //                  ( p_ptCtx->uNewPagIdx >= ( l_uNPage / 2u ) ) ) ||
 //                ( ( true  == p_ptCtx->bFullBckup ) && ( true  == p_ptCtx->bFlashCache ) &&
@@ -811,246 +1820,956 @@ static bool_t eFSS_LOG_IsStatusStillCoherent(t_eFSS_LOG_Ctx* const p_ptCtx)
 //            }
 	}
 
-    return l_eRes;
+    return l_eRes;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_LOGCtoLOGRes(const e_eFSS_LOGC_RES p_eLOGCRes)
+{
+    e_eFSS_LOG_RES l_eRes;
+
+    switch(p_eLOGCRes)
+    {
+        case e_eFSS_LOGC_RES_OK:
+        {
+            l_eRes = e_eFSS_LOG_RES_OK;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_NOINITLIB:
+        {
+            l_eRes = e_eFSS_LOG_RES_NOINITLIB;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_BADPARAM:
+        {
+            l_eRes = e_eFSS_LOG_RES_BADPARAM;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_BADPOINTER:
+        {
+            l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_CORRUPTCTX:
+        {
+            l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_CLBCKERASEERR:
+        {
+            l_eRes = e_eFSS_LOG_RES_CLBCKERASEERR;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_CLBCKWRITEERR:
+        {
+            l_eRes = e_eFSS_LOG_RES_CLBCKWRITEERR;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_CLBCKREADERR:
+        {
+            l_eRes = e_eFSS_LOG_RES_CLBCKREADERR;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_CLBCKCRCERR:
+        {
+            l_eRes = e_eFSS_LOG_RES_CLBCKCRCERR;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_NOTVALIDLOG:
+        {
+            l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_NEWVERSIONFOUND:
+        {
+            l_eRes = e_eFSS_LOG_RES_NEWVERSIONLOG;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_WRITENOMATCHREAD:
+        {
+            l_eRes = e_eFSS_LOG_RES_WRITENOMATCHREAD;
+            break;
+        }
+
+        case e_eFSS_LOGC_RES_OK_BKP_RCVRD:
+        {
+            l_eRes = e_eFSS_LOG_RES_OK_BKP_RCVRD;
+            break;
+        }
+
+        default:
+        {
+            l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+            break;
+        }
+    }
+
+    return l_eRes;
+}
+
+
+
+/***********************************************************************************************************************
+ *  PRIVATE UTILS STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static e_eFSS_LOG_RES eFSS_LOG_LoadIndexNRepair(t_eFSS_LOG_Ctx* const p_ptCtx)
+{
+    /* Local variable for return */
+    e_eFSS_LOG_RES  l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local variable used for support */
+    bool_t l_bIsFlashCacheUsed;
+
+    /* Search for index in the flash cache if present */
+    l_eResC = eFSS_LOGC_IsFlashCacheUsed(&p_ptCtx->tLOGCCtx, &l_bIsFlashCacheUsed);
+    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        if( true == l_bIsFlashCacheUsed )
+        {
+            /* Load index from cache, and verify index validity of course */
+            l_eRes = eFSS_LOG_LoadIndexFromCache(p_ptCtx);
+        }
+        else
+        {
+            /* Search for index reading all logs */
+            l_eRes = eFSS_LOG_LoadIndxBySearch(p_ptCtx);
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_LoadIndexFromCache(t_eFSS_LOG_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+    /* Local variable used for calculation */
+    uint32_t l_uIdxN;
+    uint32_t l_uIFlP;
+    uint32_t l_uByteInPage;
+
+    /* Load index from cache, first load the basic data, read cache and verify cache validity */
+    l_uUsePages = 0u;
+    l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        /* Read cache */
+        l_eResC = eFSS_LOGC_ReadCache(&p_ptCtx->tLOGCCtx, &l_uIdxN, &l_uIFlP);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+        {
+            /* Ok, index are readed, verify just readed data coherence */
+            if( ( l_uIdxN >= l_uUsePages ) || ( l_uIFlP > ( l_uUsePages - EFSS_LOG_NEWBKPEMPY_P ) ) )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+            }
+            else
+            {
+                /* Can now read the specified page and verify if it's the newest or not */
+                l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, l_uIdxN, &l_uByteInPage);
+
+                if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                {
+                    /* Seems fine, check data validity  */
+                    if( ( l_uByteInPage > l_tBuff.uBufL ) || ( ( l_tBuff.uBufL - l_uByteInPage ) <= EFSS_LOG_FILLPOFF ) )
+                    {
+                        l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+                    }
+                    else
+                    {
+                        /* All ok, update index */
+                        p_ptCtx->uNewPagIdx = l_uIdxN;
+                        p_ptCtx->uFullFilledP = l_uIFlP;
+                    }
+                }
+            }
+        }
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_LoadIndxBySearch(t_eFSS_LOG_Ctx* const p_ptCtx)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+    /* Local var used for search */
+    uint32_t l_uNSearched;
+    uint32_t l_uIdxSearch;
+    uint32_t l_uNewstIdx;
+    uint32_t l_uByteInPage;
+    uint32_t l_uFilled;
+    bool_t   l_bIsNewest;
+
+    /* Load page index by searching. We will start searching from the index guessed using the sequence number of the
+       pages, or from the last cached index if no guess can be done, in order to speed up operation */
+    l_uUsePages = 0u;
+    l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        /* Verify cached index validity */
+        if( ( p_ptCtx->uNewPagIdx >= l_uUsePages ) || ( p_ptCtx->uFullFilledP > ( l_uUsePages - EFSS_LOG_NEWBKPEMPY_P ) ) )
+        {
+            /* Very very strange, and quite impossible */
+            l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+        }
+        else
+        {
+            /* Init variable */
+            l_uNSearched = 0u;
+
+            /* Start searching from the guessed page */
+            l_uIdxSearch = p_ptCtx->uNewPagIdx;
+            l_eRes = eFSS_LOG_GuessNewestBySeq(p_ptCtx, &l_uIdxSearch);
+
+            if( e_eFSS_LOG_RES_OK == l_eRes )
+            {
+                /* Guess done, nothing is found untill the guessed page is verified */
+                l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+            }
+
+            while( ( l_uNSearched < l_uUsePages ) && ( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes )  )
+            {
+                /* Is the current page the newest or the newest backup? */
+                l_eResC = eFSS_LOGC_IsPageNewOrBkup(&p_ptCtx->tLOGCCtx, l_uIdxSearch, &l_bIsNewest);
+                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                {
+                    l_eRes = e_eFSS_LOG_RES_OK;
+
+                    /* Founded the newest or the newest backup */
+                    if( true == l_bIsNewest )
+                    {
+                        l_uNewstIdx = l_uIdxSearch;
+                    }
+                    else
+                    {
+                        /* Find newest index also */
+                        l_eRes = eFSS_LOG_GetPrevIndex(p_ptCtx, l_uIdxSearch, &l_uNewstIdx);
+                    }
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        /* All index founded, verify all the two pages validity */
+                        l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, l_uNewstIdx, &l_uByteInPage);
+
+                        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                        {
+                            if( true != eFSS_Utils_RetriveU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOG_FILLPOFF], &l_uFilled) )
+                            {
+                                l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                            }
+                            else
+                            {
+                                /* Need to verify parameter before confirm the validity of the page */
+                                if( ( l_uByteInPage > l_tBuff.uBufL ) || ( ( l_tBuff.uBufL - l_uByteInPage ) <= EFSS_LOG_FILLPOFF ) ||
+                                    ( l_uFilled > ( l_uUsePages - EFSS_LOG_NEWBKPEMPY_P ) ) )
+                                {
+                                    l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+                                }
+                                else
+                                {
+                                    /* All ok, update index */
+                                    p_ptCtx->uNewPagIdx = l_uNewstIdx;
+                                    p_ptCtx->uFullFilledP = l_uFilled;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                if( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes )
+                {
+                    /* Not this one, go to the next index */
+                    l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, l_uIdxSearch, &l_uIdxSearch);
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        l_uNSearched++;
+                        l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+                    }
+                }
+            }
+        }
+    }
+
+	return l_eRes;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_GuessNewestBySeq(t_eFSS_LOG_Ctx* const p_ptCtx, uint32_t* const p_puIdx)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+    /* Local var used for search */
+    uint32_t l_uFirstSeq;
+    uint32_t l_uSeqN;
+    uint32_t l_uDelta;
+    uint32_t l_uLow;
+    uint32_t l_uHigh;
+    uint32_t l_uMid;
+
+    /* Every time the newest page is moved the sequence number is increased, so starting from index zero, every page
+     * up to the newest backup page has a sequence number equals to the one of the first page plus his index (the
+     * newest backup page has the same sequence number of the newest one). Older or corrupted pages does not respect
+     * this rule. Do a binary search of the last page respecting the rule, so only log2(N) page are readed.
+     * The guess is always verified by the caller, if no guess can be done p_puIdx is not modified */
+    l_uUsePages = 0u;
+    l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        l_uFirstSeq = 0u;
+        l_eResC = eFSS_LOGC_GetPageSeqN(&p_ptCtx->tLOGCCtx, 0u, &l_uFirstSeq);
+
+        if( e_eFSS_LOGC_RES_OK == l_eResC )
+        {
+            l_uLow = 0u;
+            l_uHigh = l_uUsePages - 1u;
+
+            while( ( l_uLow < l_uHigh ) && ( e_eFSS_LOG_RES_OK == l_eRes ) )
+            {
+                l_uMid = l_uLow + ( ( l_uHigh - l_uLow + 1u ) / 2u );
+
+                l_uSeqN = 0u;
+                l_eResC = eFSS_LOGC_GetPageSeqN(&p_ptCtx->tLOGCCtx, l_uMid, &l_uSeqN);
+
+                if( e_eFSS_LOGC_RES_OK == l_eResC )
+                {
+                    l_uDelta = l_uSeqN - l_uFirstSeq;
+
+                    if( ( l_uMid == l_uDelta ) || ( l_uMid == ( l_uDelta + 1u ) ) )
+                    {
+                        l_uLow = l_uMid;
+                    }
+                    else
+                    {
+                        l_uHigh = l_uMid - 1u;
+                    }
+                }
+                else if( ( e_eFSS_LOGC_RES_NOTVALIDLOG == l_eResC ) ||
+                         ( e_eFSS_LOGC_RES_NEWVERSIONFOUND == l_eResC ) )
+                {
+                    /* Not a valid log page, the newest one is before this index */
+                    l_uHigh = l_uMid - 1u;
+                }
+                else
+                {
+                    /* Unreparable error */
+                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                }
+            }
+
+            if( e_eFSS_LOG_RES_OK == l_eRes )
+            {
+                *p_puIdx = l_uLow;
+            }
+        }
+        else if( ( e_eFSS_LOGC_RES_NOTVALIDLOG == l_eResC ) || ( e_eFSS_LOGC_RES_NEWVERSIONFOUND == l_eResC ) )
+        {
+            /* First page not usable, no guess can be done */
+            l_eRes = e_eFSS_LOG_RES_OK;
+        }
+        else
+        {
+            /* Unreparable error */
+            l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+        }
+    }
+
+	return l_eRes;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_GetNextIndex(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uCurIdx,
+                                            uint32_t* const p_uNextIdx)
+{
+	/* Local variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_uNextIdx ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Get basic storage info in order to verify passed parameter */
+        l_uUsePages = 0u;
+        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            /* Verify parameter */
+            if( p_uCurIdx >= l_uUsePages )
+            {
+                l_eRes = e_eFSS_LOG_RES_BADPARAM;
+            }
+            else
+            {
+                if( p_uCurIdx >= ( l_uUsePages - 1u ) )
+                {
+                    *p_uNextIdx = 0u;
+                }
+                else
+                {
+                    *p_uNextIdx = p_uCurIdx + 1u;
+                }
+            }
+        }
+    }
+
+	return l_eRes;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_GetPrevIndex(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uCurIdx,
+                                            uint32_t* const p_puPrevIdx)
+{
+	/* Local variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puPrevIdx ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Get basic storage info in order to verify passed parameter */
+        l_uUsePages = 0u;
+        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            /* Verify parameter */
+            if( p_uCurIdx >= l_uUsePages )
+            {
+                l_eRes = e_eFSS_LOG_RES_BADPARAM;
+            }
+            else
+            {
+                if( p_uCurIdx <= 0u )
+                {
+                    *p_puPrevIdx = l_uUsePages - 1u;
+                }
+                else
+                {
+                    *p_puPrevIdx = p_uCurIdx - 1u;
+                }
+            }
+        }
+    }
+
+	return l_eRes;
 }
 
-static e_eFSS_LOG_RES eFSS_LOG_LOGCtoLOGRes(const e_eFSS_LOGC_RES p_eLOGCRes)
+
+
+/***********************************************************************************************************************
+ *  PRIVATE UTILS FOR BKUP PAGE STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static e_eFSS_LOG_RES eFSS_LOG_FlushBufferAsNewestNBkpPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uIdx,
+                                                           const uint32_t p_uByteInPage)
 {
-    e_eFSS_LOG_RES l_eRes;
+	/* Local variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
 
-    switch(p_eLOGCRes)
-    {
-        case e_eFSS_LOG_RES_OK:
-        {
-            l_eRes = e_eFSS_LOG_RES_OK;
-            break;
-        }
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+    /* Local var used for calculation */
+    uint32_t l_uNextIdx;
+
+	/* Check pointer validity */
+	if( NULL == p_ptCtx )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Get basic storage info in order to verify passed parameter */
+        l_uUsePages = 0u;
+        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
-        case e_eFSS_LOG_RES_BADPARAM:
+        if( e_eFSS_LOG_RES_OK == l_eRes )
         {
-            l_eRes = e_eFSS_LOG_RES_BADPARAM;
-            break;
+            /* Verify parameter */
+            if( ( p_uIdx >= l_uUsePages ) || ( p_uByteInPage > l_tBuff.uBufL ) )
+            {
+                l_eRes = e_eFSS_LOG_RES_BADPARAM;
+            }
+            else
+            {
+                /* First, flush the first page as newest one */
+                l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, p_uIdx,
+                                                  p_uByteInPage, p_ptCtx->uNewPagSeq);
+                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                if( e_eFSS_LOG_RES_OK == l_eRes )
+                {
+                    /* Search for the next page that will be used as */
+                    l_uNextIdx = 0u;
+                    l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, p_uIdx, &l_uNextIdx);
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        /* Flush the backup page */
+                        l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP,
+                                                          l_uNextIdx, p_uByteInPage, p_ptCtx->uNewPagSeq);
+                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                    }
+                }
+            }
         }
+	}
 
-        default:
+	return l_eRes;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_LoadBufferAsNewestNBkpPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uIdx,
+                                                          uint32_t* const p_puByteInPage)
+{
+	/* Local variable */
+	e_eFSS_LOG_RES l_eRes;
+    e_eFSS_LOGC_RES l_eResC;
+
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
+
+    /* Local var used for calculation */
+    uint32_t l_uBkupPageIdx;
+    uint32_t l_uByteInOri;
+    uint32_t l_uByteInBkp;
+    uint32_t l_uSeqOri;
+    uint32_t l_uSeqBkp;
+
+    /* page status local var */
+    bool_t l_bIsOrigValid;
+    bool_t l_bIsBkupValid;
+
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puByteInPage ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+        /* Get basic storage info in order to verify passed parameter */
+        l_uUsePages = 0u;
+        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
         {
-            l_eRes = e_eFSS_LOG_RES_BADPARAM;
-            break;
+            /* Verify parameter */
+            if( p_uIdx >= l_uUsePages )
+            {
+                l_eRes = e_eFSS_LOG_RES_BADPARAM;
+            }
+            else
+            {
+                /* Now we can try to load the newest page */
+                l_uByteInOri = 0u;
+                l_uSeqOri = 0u;
+                l_eResC =  eFSS_LOGC_LoadBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, p_uIdx,
+                                                  &l_uByteInOri, &l_uSeqOri);
+                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                l_bIsOrigValid = ( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) );
+
+                if( ( true == l_bIsOrigValid ) || ( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes ) )
+                {
+                    /* Find the next index */
+                    l_uBkupPageIdx = 0u;
+                    l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, p_uIdx, &l_uBkupPageIdx);
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        /* Now we can try to load the newest backup page */
+                        l_uByteInBkp = 0u;
+                        l_uSeqBkp = 0u;
+                        l_eResC =  eFSS_LOGC_LoadBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP,
+                                                          l_uBkupPageIdx, &l_uByteInBkp, &l_uSeqBkp);
+                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                        l_bIsBkupValid = ( ( e_eFSS_LOG_RES_OK == l_eRes ) ||
+                                           ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) );
+
+                        if( ( true == l_bIsBkupValid ) || ( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes ) )
+                        {
+                            /* We have all the data needed to make a decision. The newest page is always flushed
+                             * before his backup, and the data of the pair can only grow keeping the same sequence
+                             * number, so two valid pages with the same valorized byte and sequence number are
+                             * equals. Otherwise the newest page, if valid, is the right one and the backup is
+                             * rewritten. If only the backup is valid the newest page is restored from it */
+                            if( ( true == l_bIsOrigValid ) && ( true == l_bIsBkupValid ) &&
+                                ( l_uByteInOri == l_uByteInBkp ) && ( l_uSeqOri == l_uSeqBkp ) )
+                            {
+                                /* Pages are equals, the buffer already holds the newest one */
+                                l_eRes = e_eFSS_LOG_RES_OK;
+                            }
+                            else if( true == l_bIsOrigValid )
+                            {
+                                /* Reload the newest page and copy it in the backup one */
+                                l_eResC =  eFSS_LOGC_LoadBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST,
+                                                                  p_uIdx, &l_uByteInOri, &l_uSeqOri);
+                                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                                if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                                {
+                                    l_uByteInBkp = l_uByteInOri;
+                                    l_uSeqBkp = l_uSeqOri;
+                                    l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx,
+                                                                      e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP,
+                                                                      l_uBkupPageIdx, l_uByteInBkp, l_uSeqBkp);
+                                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                                }
+
+                                if( e_eFSS_LOG_RES_OK == l_eRes )
+                                {
+                                    l_eRes = e_eFSS_LOG_RES_OK_BKP_RCVRD;
+                                }
+                            }
+                            else if( true == l_bIsBkupValid )
+                            {
+                                /* The buffer holds the backup page, restore the newest one */
+                                l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST,
+                                                                  p_uIdx, l_uByteInBkp, l_uSeqBkp);
+                                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                                if( e_eFSS_LOG_RES_OK == l_eRes )
+                                {
+                                    l_eRes = e_eFSS_LOG_RES_OK_BKP_RCVRD;
+                                }
+                            }
+                            else
+                            {
+                                /* No a single valid pages found */
+                                l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+                            }
+
+                            if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+                            {
+                                *p_puByteInPage = l_uByteInBkp;
+                                p_ptCtx->uNewPagSeq = l_uSeqBkp;
+                            }
+                        }
+                    }
+                }
+            }
         }
-    }
+	}
 
-    return l_eRes;
+	return l_eRes;
 }
 
 
 
 /***********************************************************************************************************************
- *  PRIVATE UTILS STATIC FUNCTION DECLARATION
+ *  PRIVATE UTILS FOR SAVING LOG ON NEXT PAGE STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
-static e_eFSS_LOG_RES eFSS_LOG_LoadIndexNRepair(t_eFSS_LOG_Ctx* const p_ptCtx)
+static e_eFSS_LOG_RES eFSS_LOG_SaveLogOnNextPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uByteInPage,
+                                                 uint8_t* const p_puRawVal, const uint32_t p_uElemL,
+                                                 uint32_t* const p_puNewByteInPage)
 {
-    /* Local variable for return */
-    e_eFSS_LOG_RES  l_eRes;
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
     e_eFSS_LOGC_RES l_eResC;
 
-    /* Local variable used for support */
-    bool_t l_bIsFlashCacheUsed;
+    /* Local storage variable */
+    t_eFSS_LOGC_StorBuf l_tBuff;
+    uint32_t l_uUsePages;
 
-    /* Search for index in the flash cache if present */
-    l_eResC = eFSS_LOGC_IsFlashCacheUsed(&p_ptCtx->tLOGCCtx, &l_bIsFlashCacheUsed);
-    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    /* Local var used for calculation */
+    bool_t l_bIsFlashC;
+    uint32_t l_uByteInPage;
+    uint32_t l_uFilledP;
+    uint32_t l_uNextIdx;
+    uint32_t l_uNextNextIdx;
 
-    if( e_eFSS_LOG_RES_OK == l_eRes )
-    {
-        if( true == l_bIsFlashCacheUsed )
-        {
-            /* Load index from cache, and verify index validity of course */
-            l_eRes = eFSS_LOG_LoadIndexFromCache(p_ptCtx);
-        }
-        else
+	/* Check pointer validity */
+	if( ( NULL == p_ptCtx ) || ( NULL == p_puRawVal ) || ( NULL == p_puNewByteInPage ) )
+	{
+		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
+	}
+	else
+	{
+        l_uUsePages = 0u;
+        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
         {
-            /* Search for index reading all logs */
-            l_eRes = eFSS_LOG_LoadIndxBySearch(p_ptCtx);
+            /* Check data validity, the log must fit in an empty newest page */
+            l_uByteInPage = eFSS_LOG_GetStoredL(p_ptCtx, p_uElemL);
+
+            if( ( p_uByteInPage > l_tBuff.uBufL ) || ( l_uByteInPage >= ( l_tBuff.uBufL - EFSS_LOG_FILLPOFF ) ) )
+            {
+                l_eRes = e_eFSS_LOG_RES_BADPARAM;
+            }
+            else
+            {
+                /* The buffer holds the current newest page with p_uByteInPage valorized byte. We need to save the
+                 * passed log on the next page:
+                 *   1 - Transform the current newest page in a log page
+                 *   2 - Add a Newest backup page after the current newest bkp page ( so in the currently unused
+                 *       page )
+                 *   3 - If cache is present update the newest index and the filled page number
+                 *   4 - Transform the old newest page bkup in to the newest page
+                 * A power loss between the steps leave a newest page or a newest backup page that can be
+                 * recovered, see eFSS_LOG_LoadBufferAsNewestNBkpPage */
+                l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_LOG,
+                                                  p_ptCtx->uNewPagIdx, p_uByteInPage, p_ptCtx->uNewPagSeq);
+                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                if( e_eFSS_LOG_RES_OK == l_eRes )
+                {
+                    l_uNextIdx = 0u;
+                    l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, p_ptCtx->uNewPagIdx, &l_uNextIdx);
+                }
+
+                if( e_eFSS_LOG_RES_OK == l_eRes )
+                {
+                    l_uNextNextIdx = 0u;
+                    l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, l_uNextIdx, &l_uNextNextIdx);
+                }
+
+                if( e_eFSS_LOG_RES_OK == l_eRes )
+                {
+                    /* When the storage is full the oldest page is overwritten, so the number of filled page does
+                       not grow anymore */
+                    l_uFilledP = p_ptCtx->uFullFilledP + 1u;
+                    if( l_uFilledP > ( l_uUsePages - EFSS_LOG_NEWBKPEMPY_P ) )
+                    {
+                        l_uFilledP = l_uUsePages - EFSS_LOG_NEWBKPEMPY_P;
+                    }
+
+                    /* Step 2 - prepare the new newest page, with the passed log only, and add his backup page
+                       after the current bkup page. No CRC is stored for this data, the flush will calculate it */
+                    (void)memset(l_tBuff.puBuf, 0, l_tBuff.uBufL);
+
+                    if( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOG_FILLPOFF], l_uFilledP) )
+                    {
+                        l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+                    }
+                    else
+                    {
+                        l_eRes = eFSS_LOG_CopyLog(p_ptCtx, l_tBuff.puBuf, p_puRawVal, p_uElemL);
+                    }
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP,
+                                                          l_uNextNextIdx, l_uByteInPage,
+                                                          ( p_ptCtx->uNewPagSeq + 1u ) );
+                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                    }
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        l_eResC = eFSS_LOGC_IsFlashCacheUsed(&p_ptCtx->tLOGCCtx, &l_bIsFlashC);
+                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+                        /* Step 3 - If cache is present update cache with the new index */
+                        if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( true == l_bIsFlashC ) )
+                        {
+                            l_eResC = eFSS_LOGC_WriteCache(&p_ptCtx->tLOGCCtx, l_uNextIdx, l_uFilledP);
+                            l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                        }
+                    }
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        /* Step 4 - Trasform the backup page in the newest page */
+                        l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST,
+                                                          l_uNextIdx, l_uByteInPage, ( p_ptCtx->uNewPagSeq + 1u ) );
+                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                    }
+
+                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    {
+                        /* All ok, the buffer holds the new newest page */
+                        p_ptCtx->uNewPagIdx = l_uNextIdx;
+                        p_ptCtx->uFullFilledP = l_uFilledP;
+                        p_ptCtx->uNewPagSeq++;
+                        *p_puNewByteInPage = l_uByteInPage;
+                    }
+                }
+            }
         }
-    }
+	}
 
-    return l_eRes;
+	return l_eRes;
 }
 
-static e_eFSS_LOG_RES eFSS_LOG_LoadIndexFromCache(t_eFSS_LOG_Ctx* const p_ptCtx)
+static e_eFSS_LOG_RES eFSS_LOG_SaveLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puRawVal,
+                                       const uint32_t p_uElemL)
 {
 	/* Local return variable */
 	e_eFSS_LOG_RES l_eRes;
-    e_eFSS_LOGC_RES l_eResC;
-
-    /* Local storage variable */
-    t_eFSS_LOGC_StorBuf l_tBuff;
-    uint32_t l_uUsePages;
 
-    /* Local variable used for calculation */
-    uint32_t l_uIdxN;
-    uint32_t l_uIFlP;
+    /* Local var used for calculation */
     uint32_t l_uByteInPage;
 
-    /* Load index from cache, first load the basic data, read cache and verify cache validity */
-    l_uUsePages = 0u;
-    l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
-    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
-
-    if( e_eFSS_LOG_RES_OK == l_eRes )
+    /* Need to load latest index in order to do this */
+    l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
+    if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
     {
-        /* Read cache */
-        l_eResC = eFSS_LOGC_ReadCache(&p_ptCtx->tLOGCCtx, &l_uIdxN, &l_uIFlP);
-        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+        /* Read current newest page:
+         *    We have no space: Go next, and save log in next page
+         *    We have space: Save log in the current page, and if the avaiable space after
+         *                   saving is less than the size of filled page go next page
+         */
+        l_uByteInPage = 0u;
+        l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx,
+                                                     &l_uByteInPage);
 
         if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
         {
-            /* Ok, index are readed, verify just readed data coherence */
-            if( ( l_uIdxN >= l_uUsePages ) || ( l_uIFlP >= ( l_uUsePages - EFSS_LOG_NEWBKPEMPY_P ) ) )
-            {
-                l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
-            }
-            else
-            {
-                /* Can now read the specified page and verify if it's the newest or not */
-                l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, l_uIdxN, &l_uByteInPage);
-
-                if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
-                {
-                    /* Seems fine, check data validity  */
-                    if( ( l_uByteInPage > l_tBuff.uBufL ) || ( ( l_tBuff.uBufL - l_uByteInPage ) < EFSS_LOG_NEWBKPEMPY_P ) )
-                    {
-                        l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
-                    }
-                    else
-                    {
-                        /* All ok, update index */
-                        p_ptCtx->uNewPagIdx = l_uIdxN;
-                        p_ptCtx->uFullFilledP = l_uIFlP;
-                    }
-                }
-            }
+            l_eRes = eFSS_LOG_SaveLogInNewest(p_ptCtx, l_uByteInPage, p_puRawVal, p_uElemL, &l_uByteInPage);
         }
     }
 
-    return l_eRes;
+	return l_eRes;
 }
 
-static e_eFSS_LOG_RES eFSS_LOG_LoadIndxBySearch(t_eFSS_LOG_Ctx* const p_ptCtx)
+static e_eFSS_LOG_RES eFSS_LOG_SaveLogInNewest(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uByteInPage,
+                                               uint8_t* const p_puRawVal, const uint32_t p_uElemL,
+                                               uint32_t* const p_puNewByteInPage)
 {
 	/* Local return variable */
 	e_eFSS_LOG_RES l_eRes;
     e_eFSS_LOGC_RES l_eResC;
 
-
     /* Local storage variable */
     t_eFSS_LOGC_StorBuf l_tBuff;
     uint32_t l_uUsePages;
 
-    /* Local var used for search */
-    uint32_t l_uNSearched;
-    uint32_t l_uIdxSearch;
-    uint32_t l_uNewstIdx;
+    /* Local var used for calculation */
     uint32_t l_uByteInPage;
-    uint32_t l_uFilled;
-    bool_t   l_bIsNewest;
+    uint32_t l_uFreeByte;
+    uint32_t l_uStoredL;
+
+    /* The newest page is already loaded in the buffer */
+    l_uByteInPage = p_uByteInPage;
+    l_uStoredL = eFSS_LOG_GetStoredL(p_ptCtx, p_uElemL);
 
-    /* Load page index by searching. We will start searching from the last cached index in order to speed up
-       operation */
     l_uUsePages = 0u;
     l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
     l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
     if( e_eFSS_LOG_RES_OK == l_eRes )
     {
-        /* Verify cached index validity */
-        if( ( p_ptCtx->uNewPagIdx >= l_uUsePages ) || ( p_ptCtx->uFullFilledP >= ( l_uUsePages - EFSS_LOG_NEWBKPEMPY_P ) ) )
+        if( l_uByteInPage > l_tBuff.uBufL )
         {
-            /* Very very strange, and quite impossible */
-            l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+            l_eRes = e_eFSS_LOG_RES_BADPARAM;
         }
         else
         {
-            /* Init variable */
-            l_uNSearched = 0u;
-            l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
-
-            /* Start searching from the cached page */
-            l_uIdxSearch = p_ptCtx->uNewPagIdx;
-
+            /* Choose what we have to do */
+            l_uFreeByte = l_tBuff.uBufL - l_uByteInPage;
 
-            while( ( l_uNSearched < l_uUsePages ) && ( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes )  )
+            if( ( l_uStoredL < l_uFreeByte ) && ( ( l_uFreeByte - l_uStoredL ) > EFSS_LOG_FILLPOFF ) )
             {
-                /* Is the current page the newest or the newest backup? */
-                l_eResC = eFSS_LOGC_IsPageNewOrBkup(&p_ptCtx->tLOGCCtx, l_uIdxSearch, &l_bIsNewest);
-                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                /* Simpliest cases, the log fits in the newest page and the number of filled page can still be
+                   stored after it, not even needed to update the flash cache */
+                l_eRes = eFSS_LOG_AppendLog(p_ptCtx, &l_tBuff, l_uByteInPage, p_puRawVal, p_uElemL);
+                l_uByteInPage += l_uStoredL;
 
                 if( e_eFSS_LOG_RES_OK == l_eRes )
                 {
-                    /* Founded the newest or the newest backup */
-                    if( true == l_bIsNewest )
-                    {
-                        l_uNewstIdx = l_uIdxSearch;
-                    }
-                    else
-                    {
-                        /* Find newest index also */
-                        l_eRes = eFSS_LOG_GetPrevIndex(p_ptCtx, l_uIdxSearch, &l_uNewstIdx);
-                    }
-
-                    if( e_eFSS_LOG_RES_OK == l_eRes )
-                    {
-                        /* All index founded, verify all the two pages validity */
-                        l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, l_uNewstIdx, &l_uByteInPage);
-
-                        if( e_eFSS_LOG_RES_OK == l_eRes )
-                        {
-                            if( true != eFSS_Utils_RetriveU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOG_FILLPOFF], &l_uFilled) )
-                            {
-                                l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
-                            }
-                            else
-                            {
-                                /* Need to verify parameter before confirm the validity of the page */
-                                if( ( l_uByteInPage > l_tBuff.uBufL ) || ( ( l_tBuff.uBufL - l_uByteInPage ) < EFSS_LOG_NEWBKPEMPY_P ) )
-                                {
-                                    l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
-                                }
-                                else
-                                {
-                                    /* All ok, update index */
-                                    p_ptCtx->uNewPagIdx = l_uNewstIdx;
-                                    p_ptCtx->uFullFilledP = l_uFilled;
-                                }
-                            }
-                        }
-                    }
+                    l_eRes = eFSS_LOG_FlushBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx, l_uByteInPage);
                 }
-                else if( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes )
-                {
-                    /* Not this one, go to the next index */
-                    l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, l_uIdxSearch, &l_uIdxSearch);
 
-                    if( e_eFSS_LOG_RES_OK == l_eRes )
-                    {
-                        l_uNSearched++;
-                    }
+                if( e_eFSS_LOG_RES_OK == l_eRes )
+                {
+                    *p_puNewByteInPage = l_uByteInPage;
                 }
-                else
+            }
+            else if( l_uStoredL <= l_uFreeByte )
+            {
+                /* The log fits in the newest page but nothing else can be added, append it and flush the page as
+                   a log page. The next newest page will be empty */
+                l_eRes = eFSS_LOG_AppendLog(p_ptCtx, &l_tBuff, l_uByteInPage, p_puRawVal, p_uElemL);
+                l_uByteInPage += l_uStoredL;
+
+                if( e_eFSS_LOG_RES_OK == l_eRes )
                 {
-                    /* Unreparable error */
+                    l_eRes = eFSS_LOG_SaveLogOnNextPage(p_ptCtx, l_uByteInPage, p_puRawVal, 0u, p_puNewByteInPage);
                 }
             }
+            else
+            {
+                /* No space for the log, flush the newest page as a log page and save the log on the next one */
+                l_eRes = eFSS_LOG_SaveLogOnNextPage(p_ptCtx, l_uByteInPage, p_puRawVal, p_uElemL,
+                                                    p_puNewByteInPage);
+            }
         }
     }
 
 	return l_eRes;
 }
 
-static e_eFSS_LOG_RES eFSS_LOG_GetNextIndex(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uCurIdx,
-                                            uint32_t* const p_uNextIdx)
+
+
+/***********************************************************************************************************************
+ *  PRIVATE UTILS FOR PENDING LOG STATIC FUNCTION DECLARATION
+ **********************************************************************************************************************/
+static e_eFSS_LOG_RES eFSS_LOG_PendLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puRawVal,
+                                       const uint32_t p_uElemL, bool_t* const p_pbIsPending)
 {
-	/* Local variable */
+	/* Local return variable */
 	e_eFSS_LOG_RES l_eRes;
     e_eFSS_LOGC_RES l_eResC;
 
@@ -1058,46 +2777,83 @@ static e_eFSS_LOG_RES eFSS_LOG_GetNextIndex(t_eFSS_LOG_Ctx* const p_ptCtx, const
     t_eFSS_LOGC_StorBuf l_tBuff;
     uint32_t l_uUsePages;
 
-	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_uNextIdx ) )
-	{
-		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
-	}
-	else
-	{
-        /* Get basic storage info in order to verify passed parameter */
-        l_uUsePages = 0u;
-        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
-        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    /* Local var used for calculation */
+    uint32_t l_uByteInPage;
+    uint32_t l_uFreeByte;
+    uint32_t l_uStoredL;
 
-        if( e_eFSS_LOG_RES_OK == l_eRes )
+    *p_pbIsPending = false;
+
+    l_uUsePages = 0u;
+    l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
+    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+
+    if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( 0u == p_ptCtx->uPendLogN ) )
+    {
+        /* Nothing is pending, find out where the pending log will be appended. Only read are needed, except when
+           a page must be repaired */
+        l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
+
+        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
         {
-            /* Verify parameter */
-            if( p_uCurIdx >= l_uUsePages )
-            {
-                l_eRes = e_eFSS_LOG_RES_BADPARAM;
-            }
-            else
+            l_uByteInPage = 0u;
+            l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx, &l_uByteInPage);
+
+            if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
             {
-                if( p_uCurIdx >= ( l_uUsePages - 1u ) )
+                if( l_uByteInPage > l_tBuff.uBufL )
                 {
-                    *p_uNextIdx = 0u;
+                    l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
                 }
                 else
                 {
-                    *p_uNextIdx = p_uCurIdx + 1u;
+                    p_ptCtx->uPendPageIdx = p_ptCtx->uNewPagIdx;
+                    p_ptCtx->uPendPageByte = l_uByteInPage;
+                    l_eRes = e_eFSS_LOG_RES_OK;
                 }
             }
         }
     }
 
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        /* The log can stay pending only if it can be appended to the newest page without changing page, so the
+         * pending buffer is always stored with a single flush of the newest page and of his backup */
+        l_uFreeByte = l_tBuff.uBufL - p_ptCtx->uPendPageByte - p_ptCtx->uPendByte;
+        l_uStoredL = eFSS_LOG_GetStoredL(p_ptCtx, p_uElemL);
+
+        if( ( l_uStoredL <= ( p_ptCtx->uPendBufL - p_ptCtx->uPendByte ) ) && ( l_uStoredL < l_uFreeByte ) &&
+            ( ( l_uFreeByte - l_uStoredL ) > EFSS_LOG_FILLPOFF ) )
+        {
+            l_eRes = eFSS_LOG_CopyLog(p_ptCtx, &p_ptCtx->puPendBuf[p_ptCtx->uPendByte], p_puRawVal, p_uElemL);
+
+            if( e_eFSS_LOG_RES_OK == l_eRes )
+            {
+                p_ptCtx->uPendByte += l_uStoredL;
+                p_ptCtx->uPendLogN++;
+                *p_pbIsPending = true;
+            }
+
+            /* Store the pending log if one of the threshold is reached */
+            if( ( e_eFSS_LOG_RES_OK == l_eRes ) &&
+                ( ( p_ptCtx->uPendByte >= p_ptCtx->uSyncByteThr ) || ( p_ptCtx->uPendLogN >= p_ptCtx->uSyncLogThr ) ) )
+            {
+                l_eRes = eFSS_LOG_SyncPending(p_ptCtx);
+            }
+        }
+        else
+        {
+            /* The log must be saved directly, store the pending one before so the log order is preserved */
+            l_eRes = eFSS_LOG_SyncPending(p_ptCtx);
+        }
+    }
+
 	return l_eRes;
 }
 
-static e_eFSS_LOG_RES eFSS_LOG_GetPrevIndex(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uCurIdx,
-                                            uint32_t* const p_puPrevIdx)
+static e_eFSS_LOG_RES eFSS_LOG_SyncPending(t_eFSS_LOG_Ctx* const p_ptCtx)
 {
-	/* Local variable */
+	/* Local return variable */
 	e_eFSS_LOG_RES l_eRes;
     e_eFSS_LOGC_RES l_eResC;
 
@@ -1105,330 +2861,391 @@ static e_eFSS_LOG_RES eFSS_LOG_GetPrevIndex(t_eFSS_LOG_Ctx* const p_ptCtx, const
     t_eFSS_LOGC_StorBuf l_tBuff;
     uint32_t l_uUsePages;
 
-	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puPrevIdx ) )
-	{
-		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
-	}
-	else
-	{
-        /* Get basic storage info in order to verify passed parameter */
+    /* Local var used for calculation */
+    uint32_t l_uByteInPage;
+
+    l_eRes = e_eFSS_LOG_RES_OK;
+
+    if( 0u != p_ptCtx->uPendLogN )
+    {
         l_uUsePages = 0u;
         l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
         l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
         if( e_eFSS_LOG_RES_OK == l_eRes )
         {
-            /* Verify parameter */
-            if( p_uCurIdx >= l_uUsePages )
-            {
-                l_eRes = e_eFSS_LOG_RES_BADPARAM;
-            }
-            else
+            /* Reload the newest page, the pending log are appended after the data already present */
+            l_uByteInPage = 0u;
+            l_eRes = eFSS_LOG_LoadBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uPendPageIdx, &l_uByteInPage);
+
+            if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
             {
-                if( p_uCurIdx <= 0u )
+                if( l_uByteInPage != p_ptCtx->uPendPageByte )
                 {
-                    *p_puPrevIdx = l_uUsePages - 1u;
+                    /* The newest page was modified while log where pending, cannot be */
+                    l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
                 }
                 else
                 {
-                    *p_puPrevIdx = p_uCurIdx - 1u;
+                    (void)memcpy(&l_tBuff.puBuf[l_uByteInPage], p_ptCtx->puPendBuf, p_ptCtx->uPendByte);
+                    l_uByteInPage += p_ptCtx->uPendByte;
+
+                    /* A single flush of the newest page and of his backup for every pending log */
+                    l_eRes = eFSS_LOG_FlushBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uPendPageIdx, l_uByteInPage);
                 }
             }
         }
+
+        /* Pending log are released even if an error occurred, the caller is informed with the returned value */
+        p_ptCtx->uPendByte = 0u;
+        p_ptCtx->uPendLogN = 0u;
     }
 
 	return l_eRes;
 }
 
 
-
 /***********************************************************************************************************************
- *  PRIVATE UTILS FOR BKUP PAGE STATIC FUNCTION DECLARATION
+ *  PRIVATE UTILS FOR FRAMED LOG STATIC FUNCTION DECLARATION
  **********************************************************************************************************************/
-static e_eFSS_LOG_RES eFSS_LOG_FlushBufferAsNewestNBkpPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uIdx,
-                                                           const uint32_t p_uByteInPage)
+static uint32_t eFSS_LOG_GetStoredL(const t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uElemL)
 {
-	/* Local variable */
+    uint32_t l_uStoredL;
+
+    /* A log of zero byte is never framed, nothing is stored */
+    if( ( false == p_ptCtx->bFramedLog ) || ( 0u == p_uElemL ) )
+    {
+        l_uStoredL = p_uElemL;
+    }
+    else if( false == p_ptCtx->bRecordCrc )
+    {
+        l_uStoredL = p_uElemL + EFSS_LOG_RECHEADL;
+    }
+    else
+    {
+        l_uStoredL = p_uElemL + EFSS_LOG_RECHEADL + EFSS_LOG_RECCRCL;
+    }
+
+    return l_uStoredL;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_AppendLog(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_LOGC_StorBuf* p_ptBuff,
+                                         const uint32_t p_uByteInPage, const uint8_t* p_puRawVal,
+                                         const uint32_t p_uElemL)
+{
+	/* Local return variable */
 	e_eFSS_LOG_RES l_eRes;
     e_eFSS_LOGC_RES l_eResC;
 
-    /* Local storage variable */
-    t_eFSS_LOGC_StorBuf l_tBuff;
-    uint32_t l_uUsePages;
+    /* Local var used for calculation */
+    uint32_t l_uStoredL;
+
+    /* Only the appended record changes: remove the old content of the range from the CRC of the loaded page and
+       add the new one, so the flush does not need to calculate the CRC of the whole page */
+    l_uStoredL = eFSS_LOG_GetStoredL(p_ptCtx, p_uElemL);
+    l_eRes = e_eFSS_LOG_RES_OK;
+
+    if( 0u != l_uStoredL )
+    {
+        l_eResC = eFSS_LOGC_UpdCrcInBuff(&p_ptCtx->tLOGCCtx, p_uByteInPage, l_uStoredL, true);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    }
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_LOG_CopyLog(p_ptCtx, &p_ptBuff->puBuf[p_uByteInPage], p_puRawVal, p_uElemL);
+    }
+
+    if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( 0u != l_uStoredL ) )
+    {
+        l_eResC = eFSS_LOGC_UpdCrcInBuff(&p_ptCtx->tLOGCCtx, p_uByteInPage, l_uStoredL, false);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    }
+
+    return l_eRes;
+}
+
+static e_eFSS_LOG_RES eFSS_LOG_CopyLog(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puDest,
+                                       const uint8_t* p_puRawVal, const uint32_t p_uElemL)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
 
     /* Local var used for calculation */
-    uint32_t l_uNextIdx;
+    uint32_t l_uCrc;
 
-	/* Check pointer validity */
-	if( NULL == p_ptCtx )
-	{
-		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
-	}
-	else
-	{
-        /* Get basic storage info in order to verify passed parameter */
-        l_uUsePages = 0u;
-        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
-        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    l_eRes = e_eFSS_LOG_RES_OK;
 
-        if( e_eFSS_LOG_RES_OK == l_eRes )
+    if( ( false == p_ptCtx->bFramedLog ) || ( 0u == p_uElemL ) )
+    {
+        (void)memcpy(p_puDest, p_puRawVal, p_uElemL);
+    }
+    else
+    {
+        /* Length, log and optional CRC */
+        if( true != eFSS_Utils_InsertU32(p_puDest, p_uElemL) )
         {
-            /* Verify parameter */
-            if( ( p_uIdx >= l_uUsePages ) || ( p_uByteInPage > l_tBuff.uBufL ) )
-            {
-                l_eRes = e_eFSS_LOG_RES_BADPARAM;
-            }
-            else
-            {
-                /* First, flush the first page as newest one */
-                l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, p_uIdx,
-                                                  p_uByteInPage);
-                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+            l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+        }
+        else
+        {
+            (void)memcpy(&p_puDest[EFSS_LOG_RECHEADL], p_puRawVal, p_uElemL);
 
-                if( e_eFSS_LOG_RES_OK == l_eRes )
+            if( true == p_ptCtx->bRecordCrc )
+            {
+                l_uCrc = 0u;
+                if( true != p_ptCtx->fCrc32(p_ptCtx->ptCtxCrc32, EFSS_LOG_SEED, p_puRawVal, p_uElemL, &l_uCrc) )
                 {
-                    /* Search for the next page that will be used as */
-                    l_uNextIdx = 0u;
-                    l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, p_uIdx, &l_uNextIdx);
-
-                    if( e_eFSS_LOG_RES_OK == l_eRes )
+                    l_eRes = e_eFSS_LOG_RES_CLBCKCRCERR;
+                }
+                else
+                {
+                    if( true != eFSS_Utils_InsertU32(&p_puDest[EFSS_LOG_RECHEADL + p_uElemL], l_uCrc) )
                     {
-                        /* Flush the backup page */
-                        l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP,
-                                                          l_uNextIdx, p_uByteInPage);
-                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+                        l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
                     }
                 }
             }
         }
-	}
+    }
 
-	return l_eRes;
+    return l_eRes;
 }
 
-static e_eFSS_LOG_RES eFSS_LOG_LoadBufferAsNewestNBkpPage(t_eFSS_LOG_Ctx* const p_ptCtx, const uint32_t p_uIdx,
-                                                          uint32_t* const p_puByteInPage)
+static e_eFSS_LOG_RES eFSS_LOG_ParseLog(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_LOG_Iter* const p_ptIter,
+                                        const uint32_t p_uOff, const bool_t p_bCheckCrc, uint32_t* const p_puElemL)
 {
-	/* Local variable */
+	/* Local return variable */
 	e_eFSS_LOG_RES l_eRes;
-    e_eFSS_LOGC_RES l_eResC;
-
-    /* Local storage variable */
-    t_eFSS_LOGC_StorBuf l_tBuff;
-    uint32_t l_uUsePages;
 
     /* Local var used for calculation */
-    uint32_t l_uBkupPageIdx;
+    uint32_t l_uRemain;
+    uint32_t l_uCrc;
+    uint32_t l_uCrcStored;
 
-    /* page status local var */
-    bool_t l_bIsOrigValid;
-    bool_t l_bIsBkupValid;
+    l_eRes = e_eFSS_LOG_RES_OK;
 
-	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puByteInPage ) )
-	{
-		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
-	}
-	else
-	{
-        /* Get basic storage info in order to verify passed parameter */
-        l_uUsePages = 0u;
-        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
-        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    if( ( p_uOff > p_ptIter->uPageByte ) || ( ( p_ptIter->uPageByte - p_uOff ) < EFSS_LOG_RECHEADL ) )
+    {
+        l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+    }
+    else
+    {
+        l_uRemain = p_ptIter->uPageByte - p_uOff;
 
-        if( e_eFSS_LOG_RES_OK == l_eRes )
+        if( true != eFSS_Utils_RetriveU32(&p_ptIter->puPageBuf[p_uOff], p_puElemL) )
         {
-            /* Verify parameter */
-            if( p_uIdx >= l_uUsePages )
+            l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+        }
+        else if( ( 0u == *p_puElemL ) || ( *p_puElemL > l_uRemain ) ||
+                 ( eFSS_LOG_GetStoredL(p_ptCtx, *p_puElemL) > l_uRemain ) )
+        {
+            /* Length not coherent with the page */
+            l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
+        }
+        else if( ( true == p_bCheckCrc ) && ( true == p_ptCtx->bRecordCrc ) )
+        {
+            l_uCrc = 0u;
+            l_uCrcStored = 0u;
+            if( true != p_ptCtx->fCrc32(p_ptCtx->ptCtxCrc32, EFSS_LOG_SEED,
+                                        &p_ptIter->puPageBuf[p_uOff + EFSS_LOG_RECHEADL], *p_puElemL, &l_uCrc) )
             {
-                l_eRes = e_eFSS_LOG_RES_BADPARAM;
+                l_eRes = e_eFSS_LOG_RES_CLBCKCRCERR;
+            }
+            else if( true != eFSS_Utils_RetriveU32(&p_ptIter->puPageBuf[p_uOff + EFSS_LOG_RECHEADL + *p_puElemL],
+                                                   &l_uCrcStored) )
+            {
+                l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
+            }
+            else if( l_uCrc != l_uCrcStored )
+            {
+                l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
             }
             else
             {
-                /* Now we can try to load the newest page */
-                l_eResC =  eFSS_LOGC_LoadBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, p_uIdx,
-                                                  p_puByteInPage);
-                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
-
-                if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) ||
-                    ( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes ) )
-                {
-                    /* Page readed, is valid? */
-                    if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
-                    {
-                        l_bIsOrigValid = true;
-                    }
-                    else
-                    {
-                        l_bIsOrigValid = false;
-                    }
-
-                    /* Find the next index */
-                    l_uBkupPageIdx = 0u;
-                    l_eRes = eFSS_LOG_GetNextIndex(p_ptCtx, p_uIdx, &l_uBkupPageIdx);
+                /* Log ok */
+            }
+        }
+        else
+        {
+            /* Log ok */
+        }
+    }
 
-                    if( e_eFSS_LOG_RES_OK == l_eRes )
-                    {
-                        /* Now we can try to load the newest nackup page */
-                        l_eResC =  eFSS_LOGC_LoadBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP,
-                                                          l_uBkupPageIdx, p_puByteInPage);
-                        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    return l_eRes;
+}
 
-                        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) ||
-                            ( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes ) )
-                        {
-                            /* Page readed, is valid? */
-                            if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
-                            {
-                                l_bIsBkupValid = true;
-                            }
-                            else
-                            {
-                                l_bIsBkupValid = false;
-                            }
+static e_eFSS_LOG_RES eFSS_LOG_IterLoadPage(t_eFSS_LOG_Ctx* const p_ptCtx, t_eFSS_LOG_Iter* const p_ptIter,
+                                            const uint32_t p_uIdx)
+{
+	/* Local return variable */
+	e_eFSS_LOG_RES l_eRes;
 
-                            /* We have all the data needed to make a decision */
-                            if( ( true == l_bIsOrigValid ) && ( true == l_bIsBkupValid ) )
-                            {
-                                /* No a single valid pages found */
-                                l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
-                            }
-                            else if( ( true == l_bIsOrigValid ) && ( false == l_bIsBkupValid ) )
-                            {
+    /* Local var used for calculation */
+    uint32_t l_uValorByte;
 
-                            }
-                            else if( ( false == l_bIsOrigValid ) && ( true == l_bIsBkupValid ) )
-                            {
+    /* Every page is readed in the same buffer, so log of only one page are avaiable at time */
+    l_uValorByte = 0u;
+    l_eRes = eFSS_LOG_GetLogOfAPage(p_ptCtx, p_uIdx, p_ptIter->puPageBuf, p_ptIter->uPageBufL, &l_uValorByte);
 
-                            }
-                            else
-                            {
-                                /* No a single valid pages found */
-                                l_eRes = e_eFSS_LOG_RES_NOTVALIDLOG;
-                            }
-                        }
-                    }
-                }
-            }
-        }
-	}
+    if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
+    {
+        /* A repaired page is a valid one */
+        p_ptIter->uPageIdx = p_uIdx;
+        p_ptIter->uPageByte = l_uValorByte;
+        l_eRes = e_eFSS_LOG_RES_OK;
+    }
+    else
+    {
+        /* No valid page loaded */
+        p_ptIter->uPageIdx = p_uIdx;
+        p_ptIter->uPageByte = 0u;
+    }
 
-	return l_eRes;	/* Local variable */
+    return l_eRes;
 }
 
-
-
-/***********************************************************************************************************************
- *  PRIVATE UTILS FOR SAVING LOG ON NEXT PAGE STATIC FUNCTION DECLARATION
- **********************************************************************************************************************/
-static e_eFSS_LOG_RES eFSS_LOG_SaveLogOnNextPage(t_eFSS_LOG_Ctx* const p_ptCtx, uint8_t* const p_puRawVal,
-                                                 const uint32_t p_uElemL)
+static e_eFSS_LOG_RES eFSS_LOG_FormatNextPage(t_eFSS_LOG_Ctx* const p_ptCtx, const t_eFSS_LOGC_StorBuf* p_ptBuff)
 {
-	/* Local return variable */
-	e_eFSS_LOG_RES l_eRes;
+    /* Local variable for return */
+    e_eFSS_LOG_RES  l_eRes;
     e_eFSS_LOGC_RES l_eResC;
 
-    /* Local storage variable */
-    t_eFSS_LOGC_StorBuf l_tBuff;
-    uint32_t l_uUsePages;
-
-    /* Local var used for calculation */
-    bool_t l_bIsFlashC;
-    uint32_t l_uByteInPage;
-    uint32_t l_uNextIdx;
-    uint32_t l_uNextNextIdx;
+    /* Local variable for decision making */
+    bool_t l_bInvalidateCurrent;
+    bool_t l_bIsFlashCacheUsed;
 
-    /* To fix */
-    l_uByteInPage = 0u;
+    /* Init return value */
+    l_eRes = e_eFSS_LOG_RES_OK;
 
+    if( EFSS_LOG_FMTNONE == p_ptCtx->uFormatPhase )
+    {
+        /* Pending log are discarded, the storage is going to be formatted anyway */
+        p_ptCtx->uPendByte = 0u;
+        p_ptCtx->uPendLogN = 0u;
 
-	/* Check pointer validity */
-	if( ( NULL == p_ptCtx ) || ( NULL == p_puRawVal ) )
-	{
-		l_eRes = e_eFSS_LOG_RES_BADPOINTER;
-	}
-	else
-	{
-        l_uUsePages = 0u;
-        l_eResC = eFSS_LOGC_GetBuffNUsable(&p_ptCtx->tLOGCCtx, &l_tBuff, &l_uUsePages);
-        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+        /* Load index if possible, why? Because if we start formatting and a power outage occour we need that the log
+           must remain recoverable or must be totaly formatted (or corrupted also). We dont want that a power outage
+           could leave the area in state where wrong data could be readed. The same is true if the format is done a
+           step at a time and other functions are called between two steps */
+        l_eRes = eFSS_LOG_LoadIndexNRepair(p_ptCtx);
 
-        if( e_eFSS_LOG_RES_OK == l_eRes )
+        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) )
         {
-            /* Check data validity */
-            if( p_uElemL > l_tBuff.uBufL )
+            /* Flash cache, so we find a valid newest page pointed by cache.
+               1 - If the newest page is at index zero just format that page at index zero, withouth modifyng the
+                   caches
+               2 - If the newest page is not at index zero invalidate the current page (during a power outage the
+                   state of the storage will be invalid) write newest page on index zero, and finaly update the flash
+                   cache (even if a power outage occours, and the state of the storage will be invalid, no problem: we
+                   were formatting the storage anyway.. ) */
+
+            /* No flash cache, so we find a valid newest page.
+               1 - If the newest page is at index zero just format that page otherwise invalidate
+               2 - If the newest page is not at index zero invalidate the current page and just after write newest on
+                   index zero */
+
+            if( 0u != p_ptCtx->uNewPagIdx )
             {
-                l_eRes = e_eFSS_LOG_RES_BADPARAM;
+                l_bInvalidateCurrent = true;
             }
             else
             {
-                /* We need to save this log on the next page
-                 *   1 - Add a Newest backup page after the current newest bkp page ( so in the
-                 *       currently unused page )
-                 *   2 - If cache is present update the newest index and the filled page number
-                 *   3 - Transform the old newest page bkup in to the newest page only
-                 */
+                l_bInvalidateCurrent = false;
+            }
+        }
+        else if( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes )
+        {
+            /* Flash cache: We could be in the cases where chache has bad index. first write newest page in index zero
+               and after update caches */
 
-                memcpy(&l_tBuff.puBuf[l_uByteInPage], p_puRawVal, p_uElemL);
-                l_uByteInPage += p_uElemL;
+            /* No flash cache: no newest found. just write newest page in index 0 */
 
-                l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_LOG,
-                                                  p_ptCtx->uNewPagIdx, l_uByteInPage);
-                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+            l_bInvalidateCurrent = false;
+        }
+        else
+        {
+            /* Found some strange error, cannot continue */
+            l_bInvalidateCurrent = true;
+        }
+
+        /* Start the procedure */
+        if( ( e_eFSS_LOG_RES_OK == l_eRes ) || ( e_eFSS_LOG_RES_OK_BKP_RCVRD == l_eRes ) ||
+            ( e_eFSS_LOG_RES_NOTVALIDLOG == l_eRes ) )
+        {
+            /* Invalidate the current pages if needed */
+            if( true == l_bInvalidateCurrent )
+            {
+                /* Clear buffer  */
+                memset(p_ptBuff->puBuf, 0u, p_ptBuff->uBufL);
+
+                /* Flush */
+                l_eRes = eFSS_LOG_FlushBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx, 0u);
 
                 if( e_eFSS_LOG_RES_OK == l_eRes )
                 {
-                    /* Step 2 - add the new bkup page after the current bkup page */
-                    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetNextIndex(p_ptCtx, p_ptCtx->uNewPagIdx,
-                                                                   &l_uNextIdx) )
-                    {
-                        if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetNextIndex(p_ptCtx, l_uNextIdx,
-                                                                       &l_uNextNextIdx) )
-                        {
-                            memset(l_tBuff.puBuf, 0u, l_tBuff.uBufL);
-                            l_uByteInPage = 0u;
+                    /* A page is written, the newest one will be written in the next step */
+                    p_ptCtx->uFormatPhase = EFSS_LOG_FMTNEWEST;
+                    l_eRes = e_eFSS_LOG_RES_INPROGRESS;
+                }
+            }
+            else
+            {
+                /* Nothing written, the newest page can be written now */
+                p_ptCtx->uFormatPhase = EFSS_LOG_FMTNEWEST;
+                l_eRes = e_eFSS_LOG_RES_OK;
+            }
+        }
+    }
 
-                            if( true != eFSS_Utils_InsertU32(&l_tBuff.puBuf[l_tBuff.uBufL - EFSS_LOG_FILLPOFF], p_ptCtx->uFullFilledP) )
-                            {
-                                l_eRes = e_eFSS_LOG_RES_CORRUPTCTX;
-                            }
-                            else
-                            {
-                                l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP,
-                                                                  l_uNextNextIdx, l_uByteInPage);
-                                l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( EFSS_LOG_FMTNEWEST == p_ptCtx->uFormatPhase ) )
+    {
+        /* Write newest in first index, with a sequence number greater than the one of any page already present */
+        p_ptCtx->uNewPagIdx = 0u;
+        p_ptCtx->uFullFilledP = 0u;
+        p_ptCtx->uNewPagSeq++;
 
-                                if( e_eFSS_LOG_RES_OK == l_eRes )
-                                {
-                                    l_eResC = eFSS_LOGC_IsFlashCacheUsed(&p_ptCtx->tLOGCCtx, &l_bIsFlashC);
-                                    l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+        /* Clear buffer  */
+        memset(p_ptBuff->puBuf, 0u, p_ptBuff->uBufL);
 
-                                    if( e_eFSS_LOG_RES_OK == l_eRes )
-                                    {
-                                        /* Step 3 - If cache is present update cache with the new index */
-                                        if( true == l_bIsFlashC )
-                                        {
-                                            l_eResC = eFSS_LOGC_WriteCache(&p_ptCtx->tLOGCCtx, l_uNextIdx, p_ptCtx->uFullFilledP + 1u);
-                                            l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
-                                        }
+        /* The old logs are already invalid, erase the whole first block once so the next log pages of the block
+           are programmed without rewriting it */
+        l_eResC = eFSS_LOGC_EraseBlkIfFirst(&p_ptCtx->tLOGCCtx, p_ptCtx->uNewPagIdx);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
 
-                                        if( e_eFSS_LOG_RES_OK == l_eRes )
-                                        {
-                                            /* Step 4 - Trasform the backup page in the original pages */
-                                            l_eResC = eFSS_LOGC_FlushBufferAs(&p_ptCtx->tLOGCCtx, e_eFSS_LOGC_PAGETYPE_NEWEST,
-                                                                              l_uNextIdx, l_uByteInPage);
-                                            l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                }
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            /* Flush */
+            l_eRes = eFSS_LOG_FlushBufferAsNewestNBkpPage(p_ptCtx, p_ptCtx->uNewPagIdx, 0u);
+        }
+
+        if( e_eFSS_LOG_RES_OK == l_eRes )
+        {
+            /* write cache, if needed, in the next step */
+            l_eResC =  eFSS_LOGC_IsFlashCacheUsed(&p_ptCtx->tLOGCCtx, &l_bIsFlashCacheUsed);
+            l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+            if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( true == l_bIsFlashCacheUsed ) )
+            {
+                p_ptCtx->uFormatPhase = EFSS_LOG_FMTCACHE;
+                l_eRes = e_eFSS_LOG_RES_INPROGRESS;
             }
         }
-	}
+    }
+    else if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( EFSS_LOG_FMTCACHE == p_ptCtx->uFormatPhase ) )
+    {
+        l_eResC = eFSS_LOGC_WriteCache(&p_ptCtx->tLOGCCtx, 0u, 0u);
+        l_eRes = eFSS_LOG_LOGCtoLOGRes(l_eResC);
+    }
+    else
+    {
+        /* Step already done or error */
+    }
 
-	return l_eRes;
-}
\ No newline at end of file
+    if( e_eFSS_LOG_RES_INPROGRESS != l_eRes )
+    {
+        /* Format ended */
+        p_ptCtx->uFormatPhase = EFSS_LOG_FMTNONE;
+    }
+
+    return l_eRes;
+}
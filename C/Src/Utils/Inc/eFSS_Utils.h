@@ -21,7 +21,27 @@ extern "C" {
 /***********************************************************************************************************************
  *      INCLUDES
  **********************************************************************************************************************/
-#include "eFSS_STANDARDTYPE.h"
+#include "eFSS_TYPE.h"
+
+
+
+/***********************************************************************************************************************
+ *      CONFIG DEFINE
+ **********************************************************************************************************************/
+/* CRC32 engine used by eFSS_Utils_Crc32Cb: byte-wise table (1KB of const data), slicing-by-8 (8KB of const data) or
+   carry-less multiplication. The last one is avaiable only on x86-64 host built with PCLMUL and SSE4.1 support,
+   otherwise the slicing-by-8 engine is used instead */
+#define EFSS_UTILS_CRC32_TABLE                                                                                     ( 1 )
+#define EFSS_UTILS_CRC32_SLICE8                                                                                    ( 2 )
+#define EFSS_UTILS_CRC32_CLMUL                                                                                     ( 3 )
+
+#ifndef EFSS_UTILS_CRC32_ENGINE
+  #define EFSS_UTILS_CRC32_ENGINE                                                                ( EFSS_UTILS_CRC32_TABLE )
+#endif
+
+#if defined(__x86_64__) && defined(__PCLMUL__) && defined(__SSE4_1__)
+  #define EFSS_UTILS_CRC32_HASCLMUL
+#endif
 
 
 
@@ -94,6 +114,123 @@ bool_t eFSS_Utils_RetriveU16(const uint8_t* p_puBuf, uint16_t* const p_puToRetri
  */
 bool_t eFSS_Utils_RetriveU8(const uint8_t* p_puBuf, uint8_t* const p_puToRetrive);
 
+/**
+ * @brief       Calculate the CRC32 (reflected, polynomial 0x04C11DB7) of the passed data using a 256 entry table.
+ *              No final xor is applied, so the returned value can be used as seed to continue the calculation on the
+ *              next chunk of data.
+ *
+ * @param[in]   p_uSeed       - Seed of the CRC, MAX_UINT32VAL for a new calculation
+ * @param[in]   p_puData      - Pointer to the data to process
+ * @param[in]   p_uDataL      - Length of the data to process
+ * @param[out]  p_puCrc       - Pointer to a uint32_t that will be filled with the calculated CRC
+ *
+ * @return      Return true if the p_puData and the p_puCrc are not NULL, otherwise return false
+ */
+bool_t eFSS_Utils_Crc32Table(const uint32_t p_uSeed, const uint8_t* p_puData, const uint32_t p_uDataL,
+                             uint32_t* const p_puCrc);
+
+/**
+ * @brief       Same as eFSS_Utils_Crc32Table, but process eight byte for every step using eight tables.
+ *
+ * @param[in]   p_uSeed       - Seed of the CRC, MAX_UINT32VAL for a new calculation
+ * @param[in]   p_puData      - Pointer to the data to process
+ * @param[in]   p_uDataL      - Length of the data to process
+ * @param[out]  p_puCrc       - Pointer to a uint32_t that will be filled with the calculated CRC
+ *
+ * @return      Return true if the p_puData and the p_puCrc are not NULL, otherwise return false
+ */
+bool_t eFSS_Utils_Crc32Slice8(const uint32_t p_uSeed, const uint8_t* p_puData, const uint32_t p_uDataL,
+                              uint32_t* const p_puCrc);
+
+#ifdef EFSS_UTILS_CRC32_HASCLMUL
+/**
+ * @brief       Same as eFSS_Utils_Crc32Table, but fold sixty-four byte for every step using carry-less
+ *              multiplication. Data shorter than sixty-four byte and the tail are processed using the table.
+ *
+ * @param[in]   p_uSeed       - Seed of the CRC, MAX_UINT32VAL for a new calculation
+ * @param[in]   p_puData      - Pointer to the data to process
+ * @param[in]   p_uDataL      - Length of the data to process
+ * @param[out]  p_puCrc       - Pointer to a uint32_t that will be filled with the calculated CRC
+ *
+ * @return      Return true if the p_puData and the p_puCrc are not NULL, otherwise return false
+ */
+bool_t eFSS_Utils_Crc32Clmul(const uint32_t p_uSeed, const uint8_t* p_puData, const uint32_t p_uDataL,
+                             uint32_t* const p_puCrc);
+#endif
+
+/**
+ * @brief       CRC32 callback ready to be used as f_eFSS_TYPE_CrcCb, using the engine selected with
+ *              EFSS_UTILS_CRC32_ENGINE. The context is not used, but the modules still require a valid pointer.
+ *
+ * @param[in]   p_ptCtx       - Crc context, not used
+ * @param[in]   p_uUseed      - Seed of the CRC, MAX_UINT32VAL for a new calculation
+ * @param[in]   p_puData      - Pointer to the data to process
+ * @param[in]   p_uDataL      - Length of the data to process
+ * @param[out]  p_puCrc32Val  - Pointer to a uint32_t that will be filled with the calculated CRC
+ *
+ * @return      Return true if the p_puData and the p_puCrc32Val are not NULL, otherwise return false
+ */
+bool_t eFSS_Utils_Crc32Cb(t_eFSS_TYPE_CrcCtx* const p_ptCtx, const uint32_t p_uUseed, const uint8_t* p_puData,
+                          const uint32_t p_uDataL, uint32_t* const p_puCrc32Val);
+
+
+/**
+ * @brief       Combine the CRC32 of two consecutive block of data without reading them again. Data of the block B
+ *              are added to the CRC A as if the block A was followed by p_uLenB zero byte, so changing a range of
+ *              an already checked buffer can be done adding the CRC of the old data xor the new data (zero seed)
+ *              shifted by the number of byte that follow the range.
+ *
+ * @param[in]   p_uCrcA       - CRC of the first block, calculated with any seed
+ * @param[in]   p_uCrcB       - CRC of the second block, calculated with a zero seed
+ * @param[in]   p_uLenB       - Length of the second block
+ * @param[out]  p_puCrc       - Pointer to a uint32_t that will be filled with the CRC of the two block
+ *
+ * @return      Return true if the p_puCrc is not NULL, otherwise return false
+ */
+bool_t eFSS_Utils_Crc32Combine(const uint32_t p_uCrcA, const uint32_t p_uCrcB, const uint32_t p_uLenB,
+                               uint32_t* const p_puCrc);
+
+/**
+ * @brief       Read the timestamp using the optional time callback.
+ *
+ * @param[in]   p_ptCtx       - Time context
+ * @param[in]   p_fTime       - Time callback, can be NULL
+ * @param[out]  p_puTime      - Pointer to a uint32_t that will be filled with the timestamp
+ *
+ * @return      Return true if the callback is present and reported a valid timestamp, otherwise return false
+ */
+bool_t eFSS_Utils_GetTime(t_eFSS_TYPE_TimeCtx* const p_ptCtx, const f_eFSS_TYPE_TimeCb p_fTime,
+                          uint32_t* const p_puTime);
+
+/**
+ * @brief       Read the timestamp using the optional time callback and add the time elapsed from p_uStartTime to
+ *              a log2 latency histogram.
+ *
+ * @param[in]   p_ptCtx       - Time context
+ * @param[in]   p_fTime       - Time callback, can be NULL
+ * @param[in]   p_uStartTime  - Timestamp readed with eFSS_Utils_GetTime when the measure was started
+ * @param[in]   p_ptHist      - Pointer to the histogram to update
+ *
+ * @return      Return true if the latency was added, otherwise return false
+ */
+bool_t eFSS_Utils_AddLatency(t_eFSS_TYPE_TimeCtx* const p_ptCtx, const f_eFSS_TYPE_TimeCb p_fTime,
+                             const uint32_t p_uStartTime, t_eFSS_TYPE_LatHist* const p_ptHist);
+
+/**
+ * @brief       Check if the budget of a scrubber call is exhausted. The time is readed using the optional time
+ *              callback only if a time limit is present.
+ *
+ * @param[in]   p_ptCtx       - Time context
+ * @param[in]   p_fTime       - Time callback, can be NULL
+ * @param[in]   p_tBudget     - Budget of the call, pass a zero uMaxTime if the start time was not readed
+ * @param[in]   p_uStartTime  - Timestamp readed with eFSS_Utils_GetTime when the call was started
+ * @param[in]   p_uPageDone   - Numbers of pages already processed in the call
+ *
+ * @return      Return true if the page or the time limit is reached, otherwise return false
+ */
+bool_t eFSS_Utils_IsBudgetEnded(t_eFSS_TYPE_TimeCtx* const p_ptCtx, const f_eFSS_TYPE_TimeCb p_fTime,
+                                const t_eFSS_TYPE_ScrubBudget p_tBudget, const uint32_t p_uStartTime,
+                                const uint32_t p_uPageDone);
 
 
 #ifdef __cplusplus
@@ -25,6 +25,17 @@ extern "C" {
 
 
 
+/***********************************************************************************************************************
+ *      CONFIG DEFINE
+ **********************************************************************************************************************/
+/* Number of bucket of every latency histogram, the bucket n count latency in the [2^(n-1), 2^n) range of the time
+   callback unit and the last one count every latency that does not fit the previous buckets */
+#ifndef EFSS_TYPE_LATBUCKET
+  #define EFSS_TYPE_LATBUCKET                                                             ( ( uint32_t )           20u )
+#endif
+
+
+
 /***********************************************************************************************************************
  *      TYPEDEFS CALLBACK
  **********************************************************************************************************************/
@@ -34,7 +45,8 @@ typedef struct t_eFSS_TYPE_EraseCtxUser t_eFSS_TYPE_EraseCtx;
 
 /* Call back of a function that will erase a specified page of the storage area
  * the p_ptCtx parameter is a custom context pointer that can be used by the creator of this ERASE callback,
- * and will not be used by the LIB */
+ * and will not be used by the LIB. When the storage settings has more than one page for erase block the page passed
+ * is the first page of the block, and the whole block must be erased */
 typedef bool_t (*f_eFSS_TYPE_EraseCb) ( t_eFSS_TYPE_EraseCtx* const p_ptCtx,
                                         const uint32_t p_uPageToErase );
 
@@ -68,6 +80,46 @@ typedef bool_t (*f_eFSS_TYPE_CrcCb) ( t_eFSS_TYPE_CrcCtx* const p_ptCtx, const u
                                       const uint8_t* p_puData, const uint32_t p_uDataL,
                                       uint32_t* const p_puCrc32Val );
 
+/* Define a generic blank check callback context that can be implemented by the user */
+typedef struct t_eFSS_TYPE_IsErasedCtxUser t_eFSS_TYPE_IsErasedCtx;
+
+/* Call back of a function that will report if a specified page of the storage area is already in the erased state,
+ * the p_ptCtx parameter is a custom context pointer that can be used by the creator of this IS ERASED callback,
+ * and will not be used by the LIB. This callback is optional: when not present the LIB will read the page and
+ * compare every byte with the configured erased value */
+typedef bool_t (*f_eFSS_TYPE_IsErasedCb) ( t_eFSS_TYPE_IsErasedCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToCheck, bool_t* const p_pbIsErased );
+
+/* Define a generic storage ranged read function callback context that can be implemented by the user */
+typedef struct t_eFSS_TYPE_ReadRangeCtxUser t_eFSS_TYPE_ReadRangeCtx;
+
+/* Call back of a function that will read p_uReadBufferL byte starting from p_uOffset of a specified page of the
+ * storage area, the p_ptCtx parameter is a custom context pointer that can be used by the creator of this READ RANGE
+ * callback, and will not be used by the LIB. This callback is optional: when not present the LIB will read the whole
+ * page */
+typedef bool_t (*f_eFSS_TYPE_ReadRangeCb) ( t_eFSS_TYPE_ReadRangeCtx* const p_ptCtx,
+                                            const uint32_t p_uPageToRead, const uint32_t p_uOffset,
+                                            uint8_t* const p_puReadBuffer, const uint32_t p_uReadBufferL );
+
+/* Define a generic storage ranged write function callback context that can be implemented by the user */
+typedef struct t_eFSS_TYPE_WriteRangeCtxUser t_eFSS_TYPE_WriteRangeCtx;
+
+/* Call back of a function that will write p_uDataToWriteL byte starting from p_uOffset of a specified page of the
+ * storage area, without erasing it. The p_ptCtx parameter is a custom context pointer that can be used by the creator
+ * of this WRITE RANGE callback, and will not be used by the LIB. This callback is optional: when not present the LIB
+ * will write the whole page */
+typedef bool_t (*f_eFSS_TYPE_WriteRangeCb) ( t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                             const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                             const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL );
+
+/* Define a generic timestamp callback context that can be implemented by the user */
+typedef struct t_eFSS_TYPE_TimeCtxUser t_eFSS_TYPE_TimeCtx;
+
+/* Call back of a function that will return a monotonic timestamp, in any unit, that can wrap around at 2^32. The
+ * p_ptCtx parameter is a custom context pointer that can be used by the creator of this TIME callback, and will not
+ * be used by the LIB. This callback is optional: when not present no latency is recorded */
+typedef bool_t (*f_eFSS_TYPE_TimeCb) ( t_eFSS_TYPE_TimeCtx* const p_ptCtx, uint32_t* const p_puTime );
+
 
 
 /***********************************************************************************************************************
@@ -84,16 +136,98 @@ typedef struct
     f_eFSS_TYPE_ReadCb    fRead;
 	t_eFSS_TYPE_CrcCtx*   ptCtxCrc32;
     f_eFSS_TYPE_CrcCb     fCrc32;
+	t_eFSS_TYPE_IsErasedCtx* ptCtxIsErased;
+    f_eFSS_TYPE_IsErasedCb   fIsErased;
+	t_eFSS_TYPE_ReadRangeCtx*  ptCtxReadRange;
+    f_eFSS_TYPE_ReadRangeCb    fReadRange;
+	t_eFSS_TYPE_WriteRangeCtx* ptCtxWriteRange;
+    f_eFSS_TYPE_WriteRangeCb   fWriteRange;
+	t_eFSS_TYPE_TimeCtx*       ptCtxTime;
+    f_eFSS_TYPE_TimeCb         fTime;
 }t_eFSS_TYPE_CbStorCtx;
 
+/* Format of the private metadata written at the end of every page by the LIB. The full one (19 byte) has no limits,
+ * the compact ones (8 byte, or 6 byte with a 16 bit CRC made of the low half of the CRC callback result) leave more
+ * room to the user data of small pages, but need no more than 65535 pages and a page version lower than 16. The
+ * programmable one (31 byte) is the full one with four CRC slots written only once: when the ranged write callback
+ * is present a page whose new content only moves bits away from the erased value is programmed in place, writing
+ * the new CRC in the next free slot, and erased only when every slot is used. A page written with a different
+ * format is not valid */
+typedef enum
+{
+    e_eFSS_TYPE_TRAIL_FULL = 0,
+    e_eFSS_TYPE_TRAIL_COMPACT,
+    e_eFSS_TYPE_TRAIL_COMPACT_CRC16,
+    e_eFSS_TYPE_TRAIL_PROG
+}e_eFSS_TYPE_TRAIL;
+
+/* uPagesPerBlk is the number of page erased together by the erase callback, zero or one when every page can be
+ * erased alone. With bigger erase block a page is written without erasing it only when it is blank, otherwise the
+ * whole block is rewritten using a spare block placed just after the last page, so the storage area must have
+ * ( uTotPages + uPagesPerBlk ) pages and uTotPages must be a multiple of uPagesPerBlk */
 typedef struct
 {
     uint32_t    uTotPages;
     uint32_t    uPagesLen;
     uint32_t    uRWERetry;
     uint16_t    uPageVersion;
+    bool_t      bBlankCheck;
+    uint8_t     uErasedVal;
+    e_eFSS_TYPE_TRAIL eTrailer;
+    uint32_t    uPagesPerBlk;
 }t_eFSS_TYPE_StorSet;
 
+typedef struct
+{
+    uint32_t    auBucket[EFSS_TYPE_LATBUCKET];
+}t_eFSS_TYPE_LatHist;
+
+/* Counters of what the LIB did on the storage area: read, write and erase callback calls and byte read or written
+ * (retry included), extra tries done after a failed one, byte passed to the CRC callback, pages recovered from the
+ * backup and writes that did not match the readback. Every counter wrap around on overflow. When the time callback
+ * is present the latency of every erase, write, read and CRC callback call is recorded too, together with the
+ * latency of the public function that add data (eFSS_DB_SaveElemen, eFSS_LOG_AddLog, eFSS_BLOB_AppendData), of
+ * the one that check the storage status (eFSS_DB_GetDBStatus, eFSS_LOG_GetLogStatus, eFSS_BLOB_GetStorageStatus)
+ * and of the one that format it (eFSS_DB_FormatToDefault, eFSS_LOG_Format, eFSS_BLOB_Format). Every call of a step
+ * wise version (eFSS_DB_GetDBStatusStep, eFSS_DB_FormatToDefaultStep, eFSS_LOG_FormatStep, eFSS_BLOB_FormatStep) is
+ * recorded in the same histogram of his blocking version as a single measure */
+typedef struct
+{
+    uint32_t    uReadCnt;
+    uint32_t    uReadByte;
+    uint32_t    uWriteCnt;
+    uint32_t    uWriteByte;
+    uint32_t    uEraseCnt;
+    uint32_t    uRetryCnt;
+    uint32_t    uCrcByte;
+    uint32_t    uBkpRcvrdCnt;
+    uint32_t    uRbMismatchCnt;
+    t_eFSS_TYPE_LatHist tLatErase;
+    t_eFSS_TYPE_LatHist tLatWrite;
+    t_eFSS_TYPE_LatHist tLatRead;
+    t_eFSS_TYPE_LatHist tLatCrc;
+    t_eFSS_TYPE_LatHist tLatAdd;
+    t_eFSS_TYPE_LatHist tLatStatus;
+    t_eFSS_TYPE_LatHist tLatFormat;
+}t_eFSS_TYPE_Stats;
+
+/* Budget of a single call of a scrubber function (eFSS_DB_Scrub, eFSS_LOG_Scrub, eFSS_BLOB_Scrub). uMaxPage is the
+ * max numbers of origin/backup pairs to verify, uMaxTime is the max time to spend, in the unit of the time callback,
+ * and is ignored when the time callback is not present. A zero field means no limit, at least one pair is verified
+ * for every call anyway */
+typedef struct
+{
+    uint32_t    uMaxPage;
+    uint32_t    uMaxTime;
+}t_eFSS_TYPE_ScrubBudget;
+
+/* Progress of a scrubber: index of the next pair to verify and if something was repaired in the current pass */
+typedef struct
+{
+    uint32_t    uNextIdx;
+    bool_t      bIsRepaired;
+}t_eFSS_TYPE_ScrubCtx;
+
 
 
 #ifdef __cplusplus
@@ -18,6 +18,7 @@ int main(void)
     // eFSS_LOGTST_ExeTest();
 
     // eFSS_UtilsTST_ExeTest();
+    // eFSS_UtilsTST_ExeCrc32Bench();
     // eFSS_CORELLTST_ExeTest();
     // eFSS_COREHLTST_ExeTest();
     // eFSS_DBCTST_ExeTest();
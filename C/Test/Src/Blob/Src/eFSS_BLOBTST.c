@@ -11,31 +11,108 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eFSS_BLOBTST.h"
+#include "eFSS_BLOB.h"
 #include <stdio.h>
 
 
 
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+#define EFSS_BLOBTST_NPAGE                                                                ( ( uint32_t )         0x08u )
+#define EFSS_BLOBTST_PAGEL                                                                ( ( uint32_t )         0x30u )
+#define EFSS_BLOBTST_FULLDATAL                                                            ( ( uint32_t )         0x18u )
+#define EFSS_BLOBTST_FULLAREAL                                                            ( ( uint32_t )         0x60u )
+
+
+
 /***********************************************************************************************************************
  *   PRIVATE TEST VARIABLE DECLARATION
  **********************************************************************************************************************/
+static uint8_t m_auStorArea[EFSS_BLOBTST_NPAGE][EFSS_BLOBTST_PAGEL];
+static uint32_t m_uWriteLeft = MAX_UINT32VAL;
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE TEST STRUCT DECLARATION
  **********************************************************************************************************************/
+struct t_eFSS_TYPE_EraseCtxUser
+{
+    e_eFSS_BLOB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_WriteCtxUser
+{
+    e_eFSS_BLOB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_ReadCtxUser
+{
+    e_eFSS_BLOB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_CrcCtxUser
+{
+    e_eFSS_BLOB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_WriteRangeCtxUser
+{
+    e_eFSS_BLOB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE TEST FUNCTION DECLARATION
  **********************************************************************************************************************/
+static bool_t eFSS_BLOBTST_EraseTst1Adapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase);
+
+static bool_t eFSS_BLOBTST_WriteTst1Adapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                          const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                          const uint32_t p_uDataToWriteL );
+
+static bool_t eFSS_BLOBTST_ReadTst1Adapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                         const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                         const uint32_t p_uReadBufferL );
+
+static bool_t eFSS_BLOBTST_CrcTst1Adapt(t_eFSS_TYPE_CrcCtx* const p_ptCtx, const uint32_t p_uUseed,
+                                        const uint8_t* p_puData, const uint32_t p_uDataL,
+                                        uint32_t* const p_puCrc32Val );
+
+static bool_t eFSS_BLOBTST_WriteRangeTst1Adapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                               const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                               const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL );
+
+static void eFSS_BLOBTST_InitCb(t_eFSS_TYPE_CbStorCtx* const p_ptCtxCb, t_eFSS_TYPE_EraseCtx* const p_ptCtxErase,
+                                t_eFSS_TYPE_WriteCtx* const p_ptCtxWrite, t_eFSS_TYPE_ReadCtx* const p_ptCtxRead,
+                                t_eFSS_TYPE_CrcCtx* const p_ptCtxCrc32,
+                                t_eFSS_TYPE_WriteRangeCtx* const p_ptCtxWriteRange);
+
+static void eFSS_BLOBTST_InitStorSet(t_eFSS_TYPE_StorSet* const p_ptStorSet, const e_eFSS_TYPE_TRAIL p_eTrailer);
+
+static void eFSS_BLOBTST_GetOriData(uint8_t* const p_puData);
+
+static bool_t eFSS_BLOBTST_IsEqToOneAppend(t_eFSS_BLOB_Ctx* const p_ptCtx, uint8_t* const p_puTailBuf,
+                                           uint8_t* const p_puData, const uint32_t* const p_puChunkL,
+                                           const uint32_t p_uNChunk);
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION DECLARATION
  **********************************************************************************************************************/
+static void eFSS_BLOBTST_ProgTest(void);
+static void eFSS_BLOBTST_AbSlotTest(void);
+static void eFSS_BLOBTST_CrcPartTest(void);
+static void eFSS_BLOBTST_TailBufTest(void);
+static void eFSS_BLOBTST_ReaderTest(void);
 
 
 
@@ -46,6 +123,11 @@ void eFSS_BLOBTST_ExeTest(void)
 {
 	(void)printf("\n\nBLOB TEST START \n\n");
 
+    eFSS_BLOBTST_ProgTest();
+    eFSS_BLOBTST_AbSlotTest();
+    eFSS_BLOBTST_CrcPartTest();
+    eFSS_BLOBTST_TailBufTest();
+    eFSS_BLOBTST_ReaderTest();
 
     (void)printf("\n\nBLOB TEST END \n\n");
 }
@@ -55,11 +137,1090 @@ void eFSS_BLOBTST_ExeTest(void)
 /***********************************************************************************************************************
  *   PRIVATE TEST FUNCTION IMPLEMENTATION
  **********************************************************************************************************************/
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "MISRAC2012-Rule-8.13", "MISRAC2012-Rule-10.5"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+static bool_t eFSS_BLOBTST_EraseTst1Adapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase)
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( p_uPageToErase >= EFSS_BLOBTST_NPAGE )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_BLOB_RES_BADPARAM;
+        }
+        else
+        {
+            p_ptCtx->uTimeUsed++;
+            (void)memset(m_auStorArea[p_uPageToErase], 0xFF, sizeof(m_auStorArea[p_uPageToErase]));
+            l_bRes = true;
+            p_ptCtx->eLastEr = e_eFSS_BLOB_RES_OK;
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_BLOBTST_WriteTst1Adapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                          const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                          const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( NULL == p_puDataToWrite )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_BLOB_RES_BADPOINTER;
+        }
+        else
+        {
+            if( ( p_uPageToWrite >= EFSS_BLOBTST_NPAGE ) || ( EFSS_BLOBTST_PAGEL != p_uDataToWriteL ) )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_BLOB_RES_BADPARAM;
+            }
+            else if( 0u == m_uWriteLeft )
+            {
+                /* Simulate a power loss, nothing can be written anymore */
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_BLOB_RES_CLBCKWRITEERR;
+            }
+            else
+            {
+                p_ptCtx->uTimeUsed++;
+                l_bRes = true;
+                p_ptCtx->eLastEr = e_eFSS_BLOB_RES_OK;
+
+                if( MAX_UINT32VAL != m_uWriteLeft )
+                {
+                    m_uWriteLeft--;
+                }
+
+                /* A NOR flash can only clear bits */
+                for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+                {
+                    m_auStorArea[p_uPageToWrite][l_uCnt] &= p_puDataToWrite[l_uCnt];
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_BLOBTST_ReadTst1Adapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                         const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                         const uint32_t p_uReadBufferL )
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( NULL == p_puReadBuffer )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_BLOB_RES_BADPOINTER;
+        }
+        else
+        {
+            if( ( p_uPageToRead >= EFSS_BLOBTST_NPAGE ) || ( EFSS_BLOBTST_PAGEL != p_uReadBufferL ) )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_BLOB_RES_BADPARAM;
+            }
+            else
+            {
+                p_ptCtx->uTimeUsed++;
+                l_bRes = true;
+                p_ptCtx->eLastEr = e_eFSS_BLOB_RES_OK;
+                (void)memcpy(p_puReadBuffer, m_auStorArea[p_uPageToRead], p_uReadBufferL);
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_BLOBTST_CrcTst1Adapt(t_eFSS_TYPE_CrcCtx* const p_ptCtx, const uint32_t p_uUseed,
+                                        const uint8_t* p_puData, const uint32_t p_uDataL,
+                                        uint32_t* const p_puCrc32Val )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTimeUsed++;
+
+        if( ( NULL == p_puData ) || ( NULL == p_puCrc32Val ) )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_BLOB_RES_BADPOINTER;
+        }
+        else
+        {
+            if( 0u == p_uDataL )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_BLOB_RES_BADPARAM;
+            }
+            else
+            {
+                l_bRes = true;
+                p_ptCtx->eLastEr = e_eFSS_BLOB_RES_OK;
+                *p_puCrc32Val = p_uUseed;
+
+                for(l_uCnt = 0u; l_uCnt < p_uDataL; l_uCnt++ )
+                {
+                    *p_puCrc32Val = ( (*p_puCrc32Val) + (p_puData[l_uCnt]) );
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_BLOBTST_WriteRangeTst1Adapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                               const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                               const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToWrite ) || ( p_uPageToWrite >= EFSS_BLOBTST_NPAGE ) ||
+        ( ( p_uOffset + p_uDataToWriteL ) > EFSS_BLOBTST_PAGEL ) )
+    {
+        l_bRes = false;
+    }
+    else if( 0u == m_uWriteLeft )
+    {
+        /* Simulate a power loss, nothing can be written anymore */
+        l_bRes = false;
+        p_ptCtx->eLastEr = e_eFSS_BLOB_RES_CLBCKWRITEERR;
+    }
+    else
+    {
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_BLOB_RES_OK;
+
+        if( MAX_UINT32VAL != m_uWriteLeft )
+        {
+            m_uWriteLeft--;
+        }
+
+        /* A NOR flash can only clear bits */
+        for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+        {
+            m_auStorArea[p_uPageToWrite][p_uOffset + l_uCnt] &= p_puDataToWrite[l_uCnt];
+        }
+    }
+
+    return l_bRes;
+}
+
+static void eFSS_BLOBTST_InitCb(t_eFSS_TYPE_CbStorCtx* const p_ptCtxCb, t_eFSS_TYPE_EraseCtx* const p_ptCtxErase,
+                                t_eFSS_TYPE_WriteCtx* const p_ptCtxWrite, t_eFSS_TYPE_ReadCtx* const p_ptCtxRead,
+                                t_eFSS_TYPE_CrcCtx* const p_ptCtxCrc32,
+                                t_eFSS_TYPE_WriteRangeCtx* const p_ptCtxWriteRange)
+{
+    /* Init callback var, the ranged write is used only when its context is present */
+    p_ptCtxCb->ptCtxErase = p_ptCtxErase;
+    p_ptCtxCb->fErase = &eFSS_BLOBTST_EraseTst1Adapt;
+	p_ptCtxCb->ptCtxWrite = p_ptCtxWrite;
+    p_ptCtxCb->fWrite = &eFSS_BLOBTST_WriteTst1Adapt;
+	p_ptCtxCb->ptCtxRead = p_ptCtxRead;
+    p_ptCtxCb->fRead = &eFSS_BLOBTST_ReadTst1Adapt;
+	p_ptCtxCb->ptCtxCrc32 = p_ptCtxCrc32;
+    p_ptCtxCb->fCrc32 = &eFSS_BLOBTST_CrcTst1Adapt;
+	p_ptCtxCb->ptCtxIsErased = NULL;
+    p_ptCtxCb->fIsErased = NULL;
+	p_ptCtxCb->ptCtxReadRange = NULL;
+    p_ptCtxCb->fReadRange = NULL;
+	p_ptCtxCb->ptCtxWriteRange = p_ptCtxWriteRange;
+    p_ptCtxCb->fWriteRange = NULL;
+	p_ptCtxCb->ptCtxTime = NULL;
+    p_ptCtxCb->fTime = NULL;
+
+    if( NULL != p_ptCtxWriteRange )
+    {
+        p_ptCtxCb->fWriteRange = &eFSS_BLOBTST_WriteRangeTst1Adapt;
+        p_ptCtxWriteRange->uTimeUsed = 0u;
+        p_ptCtxWriteRange->eLastEr = e_eFSS_BLOB_RES_OK;
+    }
+
+    p_ptCtxErase->uTimeUsed = 0u;
+    p_ptCtxErase->eLastEr = e_eFSS_BLOB_RES_OK;
+    p_ptCtxWrite->uTimeUsed = 0u;
+    p_ptCtxWrite->eLastEr = e_eFSS_BLOB_RES_OK;
+    p_ptCtxRead->uTimeUsed = 0u;
+    p_ptCtxRead->eLastEr = e_eFSS_BLOB_RES_OK;
+    p_ptCtxCrc32->uTimeUsed = 0u;
+    p_ptCtxCrc32->eLastEr = e_eFSS_BLOB_RES_OK;
+}
+
+static void eFSS_BLOBTST_InitStorSet(t_eFSS_TYPE_StorSet* const p_ptStorSet, const e_eFSS_TYPE_TRAIL p_eTrailer)
+{
+    /* Four original pages and four backup pages */
+    p_ptStorSet->uTotPages = EFSS_BLOBTST_NPAGE;
+    p_ptStorSet->uPagesLen = EFSS_BLOBTST_PAGEL;
+    p_ptStorSet->uRWERetry = 3u;
+    p_ptStorSet->uPageVersion = 1u;
+    p_ptStorSet->bBlankCheck = false;
+    p_ptStorSet->uErasedVal = 0xFFu;
+    p_ptStorSet->eTrailer = p_eTrailer;
+    p_ptStorSet->uPagesPerBlk = 1u;
+
+    /* Every test start from an erased storage and without power loss */
+    (void)memset(m_auStorArea, 0xFF, sizeof(m_auStorArea));
+    m_uWriteLeft = MAX_UINT32VAL;
+}
+
+static void eFSS_BLOBTST_GetOriData(uint8_t* const p_puData)
+{
+    uint32_t l_uPage;
+
+    /* With the full trailer the blob use the first 24 byte of every original page, the last page end with the
+       blob size and CRC */
+    l_uPage = 0u;
+    while( l_uPage < ( EFSS_BLOBTST_NPAGE / 2u ) )
+    {
+        (void)memcpy(&p_puData[l_uPage * EFSS_BLOBTST_FULLDATAL], m_auStorArea[l_uPage], EFSS_BLOBTST_FULLDATAL);
+        l_uPage++;
+    }
+}
+
+static bool_t eFSS_BLOBTST_IsEqToOneAppend(t_eFSS_BLOB_Ctx* const p_ptCtx, uint8_t* const p_puTailBuf,
+                                           uint8_t* const p_puData, const uint32_t* const p_puChunkL,
+                                           const uint32_t p_uNChunk)
+{
+    bool_t l_bRes;
+    e_eFSS_BLOB_RES l_eRes;
+    uint8_t l_auRef[EFSS_BLOBTST_FULLAREAL];
+    uint8_t l_auNew[EFSS_BLOBTST_FULLAREAL];
+    uint8_t l_auRead[EFSS_BLOBTST_FULLAREAL];
+    uint32_t l_uBlobL;
+    uint32_t l_uChunk;
+    uint32_t l_uWritten;
+    uint32_t l_uBlobSize;
+
+    /* Reference blob, written with only one append */
+    l_uBlobL = 0u;
+    l_uChunk = 0u;
+    while( l_uChunk < p_uNChunk )
+    {
+        l_uBlobL += p_puChunkL[l_uChunk];
+        l_uChunk++;
+    }
+
+    l_bRes = ( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(p_ptCtx) ) &&
+               ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(p_ptCtx, p_puData, l_uBlobL) ) &&
+               ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(p_ptCtx) ) );
+    eFSS_BLOBTST_GetOriData(l_auRef);
+
+    /* Same blob written in chunks, keeping the tail page in RAM if requested */
+    if( ( true == l_bRes ) && ( NULL != p_puTailBuf ) )
+    {
+        l_bRes = ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitTailBuff(p_ptCtx, p_puTailBuf, EFSS_BLOBTST_FULLDATAL) );
+    }
+
+    if( true == l_bRes )
+    {
+        l_bRes = ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(p_ptCtx) );
+    }
+
+    l_uWritten = 0u;
+    l_uChunk = 0u;
+    while( ( true == l_bRes ) && ( l_uChunk < p_uNChunk ) )
+    {
+        l_bRes = ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(p_ptCtx, &p_puData[l_uWritten],
+                                                              p_puChunkL[l_uChunk]) );
+        l_uWritten += p_puChunkL[l_uChunk];
+        l_uChunk++;
+    }
+
+    if( true == l_bRes )
+    {
+        l_bRes = ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(p_ptCtx) );
+    }
+    eFSS_BLOBTST_GetOriData(l_auNew);
+
+    /* Same data, padding, size and blob CRC of the reference, and a valid blob */
+    if( true == l_bRes )
+    {
+        l_uBlobSize = 0u;
+        l_eRes = eFSS_BLOB_GetStorageStatus(p_ptCtx);
+        l_bRes = ( ( ( e_eFSS_BLOB_RES_OK == l_eRes ) || ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == l_eRes ) ) &&
+                   ( 0 == memcmp(l_auRef, l_auNew, sizeof(l_auRef)) ) &&
+                   ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(p_ptCtx, &l_uBlobSize) ) &&
+                   ( l_uBlobL == l_uBlobSize ) &&
+                   ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(p_ptCtx, 0u, l_uBlobL, l_auRead) ) &&
+                   ( 0 == memcmp(p_puData, l_auRead, l_uBlobL) ) );
+    }
+
+    return l_bRes;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "MISRAC2012-Rule-8.13", "MISRAC2012-Rule-10.5"
+#endif
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION
  **********************************************************************************************************************/
+static void eFSS_BLOBTST_ProgTest(void)
+{
+    /* Local variable */
+    t_eFSS_BLOB_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_TYPE_Stats l_tStats;
+    uint8_t l_auStor[96u];
+    uint8_t l_auData[16u];
+    uint8_t l_auRead[16u];
+    uint32_t l_uBlobSize;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+	t_eFSS_TYPE_WriteRangeCtx l_tCtxWriteRange;
+
+    /* Every page of 48 byte hold 12 byte of the blob with the programmable trailer */
+    eFSS_BLOBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, &l_tCtxWriteRange);
+    eFSS_BLOBTST_InitStorSet(&l_tStorSet, e_eFSS_TYPE_TRAIL_PROG);
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tStats, 0, sizeof(l_tStats));
+    (void)memset(l_auData, 0x5A, sizeof(l_auData));
+    (void)memset(l_auRead, 0, sizeof(l_auRead));
+    l_uBlobSize = 0u;
+
+    /* A formatted storage pad the blob with the erased value, and is valid */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_Format(&l_tCtx) ) &&
+        ( 0xFFu == m_auStorArea[0u][0u] ) && ( 0xFFu == m_auStorArea[3u][0u] ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 0u == l_uBlobSize ) )
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 1  -- FAIL \n");
+    }
+
+    /* The first append of a write erase the page, it hold a different sequence number */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ResetStats(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 5u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStats(&l_tCtx, &l_tStats) ) && ( 1u == l_tStats.uEraseCnt ) )
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 2  -- FAIL \n");
+    }
+
+    /* Appending to the partially filled page only program its padding, nothing is erased */
+    l_tCtxWriteRange.uTimeUsed = 0u;
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ResetStats(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, &l_auData[5u], 5u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStats(&l_tCtx, &l_tStats) ) && ( 0u == l_tStats.uEraseCnt ) &&
+        ( 2u == l_tCtxWriteRange.uTimeUsed ) )
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 3  -- FAIL \n");
+    }
 
+    /* The blob is valid and can be read back after a new init, the old backup is aligned to it */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 10u == l_uBlobSize ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+        ( 0 == memcmp(l_auData, l_auRead, 10u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 4  -- FAIL \n");
+    }
 
+    /* A blob that end in the last page is completed programming only its size and CRC in place */
+    (void)memset(l_auRead, 0, sizeof(l_auRead));
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 16u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 16u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 8u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ResetStats(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStats(&l_tCtx, &l_tStats) ) && ( 0u == l_tStats.uEraseCnt ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 40u == l_uBlobSize ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 36u, 4u, l_auRead) ) &&
+        ( 0 == memcmp(l_auData, l_auRead, 4u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 5  -- FAIL \n");
+    }
+
+    /* With the full trailer the padding is zero, and every append erase the page again */
+    eFSS_BLOBTST_InitStorSet(&l_tStorSet, e_eFSS_TYPE_TRAIL_FULL);
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_Format(&l_tCtx) ) && ( 0x00u == m_auStorArea[0u][0u] ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 5u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ResetStats(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, &l_auData[5u], 5u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStats(&l_tCtx, &l_tStats) ) && ( 1u == l_tStats.uEraseCnt ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 10u == l_uBlobSize ) )
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 6  -- FAIL \n");
+    }
+
+    /* A write aborted after a completed one restore the last complete blob, not the one before it */
+    l_uBlobSize = 0u;
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 16u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AbortWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 10u == l_uBlobSize ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+        ( 0 == memcmp(l_auData, l_auRead, 10u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ProgTest 7  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxWriteRange.eLastEr;
+}
+
+static void eFSS_BLOBTST_AbSlotTest(void)
+{
+    /* Local variable */
+    t_eFSS_BLOB_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    uint8_t l_auData[30u];
+    uint8_t l_auRead[10u];
+    uint8_t l_auExp[10u];
+    uint8_t l_auOldPage[EFSS_BLOBTST_PAGEL];
+    uint32_t l_uBlobSize;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Every page of 48 byte hold 24 byte of the blob, the origin slot is in the first four pages and the backup
+       slot in the last four */
+    eFSS_BLOBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, NULL);
+    eFSS_BLOBTST_InitStorSet(&l_tStorSet, e_eFSS_TYPE_TRAIL_FULL);
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auRead, 0, sizeof(l_auRead));
+    l_uBlobSize = 0u;
+
+    /* After the format both slots are valid and equals */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitAbSlot(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_Format(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 0u == l_uBlobSize ) )
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 1  -- FAIL \n");
+    }
+
+    /* The first blob is written in the backup slot, the origin one is not touched */
+    (void)memset(l_auData, 0x11, sizeof(l_auData));
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 10u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( 0x11u == m_auStorArea[4u][0u] ) && ( 0x00u == m_auStorArea[0u][0u] ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 10u == l_uBlobSize ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+        ( 0 == memcmp(l_auData, l_auRead, 10u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 2  -- FAIL \n");
+    }
+
+    /* The next write go in the not active slot, and till his end the old blob is still readed from the active
+       one */
+    (void)memset(l_auExp, 0x11, sizeof(l_auExp));
+    (void)memset(l_auData, 0x22, sizeof(l_auData));
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 10u) ) &&
+        ( 0x22u == m_auStorArea[0u][0u] ) && ( 0x11u == m_auStorArea[4u][0u] ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+        ( 0 == memcmp(l_auExp, l_auRead, 10u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( 0x11u == m_auStorArea[4u][0u] ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+        ( 0 == memcmp(l_auData, l_auRead, 10u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 3  -- FAIL \n");
+    }
+
+    /* A power loss before the last page is written leave in the written slot pages with different sequence
+       number, that slot is not valid and the old blob is kept */
+    (void)memset(l_auExp, 0x22, sizeof(l_auExp));
+    (void)memset(l_auData, 0x33, sizeof(l_auData));
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 30u) ) )
+    {
+        m_uWriteLeft = 0u;
+        if( e_eFSS_BLOB_RES_OK != eFSS_BLOB_EndWrite(&l_tCtx) )
+        {
+            m_uWriteLeft = MAX_UINT32VAL;
+            if( ( 0x33u == m_auStorArea[4u][0u] ) && ( 0x33u == m_auStorArea[5u][0u] ) &&
+                ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor,
+                                                          sizeof(l_auStor)) ) &&
+                ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitAbSlot(&l_tCtx) ) &&
+                ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+                ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 10u == l_uBlobSize ) &&
+                ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+                ( 0 == memcmp(l_auExp, l_auRead, 10u) ) )
+            {
+                (void)printf("eFSS_BLOBTST_AbSlotTest 4  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_BLOBTST_AbSlotTest 4  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_BLOBTST_AbSlotTest 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 4  -- FAIL \n");
+    }
+
+    /* Every page of the written slot is valid, but the last one still has the sequence number of an old blob, the
+       slot is not valid and the old blob is kept */
+    (void)memset(l_auData, 0x77, sizeof(l_auData));
+    (void)memcpy(l_auOldPage, m_auStorArea[7u], sizeof(l_auOldPage));
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 30u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( 0 != memcmp(l_auOldPage, m_auStorArea[7u], sizeof(l_auOldPage)) ) )
+    {
+        (void)memcpy(m_auStorArea[7u], l_auOldPage, sizeof(l_auOldPage));
+        if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitAbSlot(&l_tCtx) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetInfo(&l_tCtx, &l_uBlobSize) ) && ( 10u == l_uBlobSize ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+            ( 0 == memcmp(l_auExp, l_auRead, 10u) ) )
+        {
+            (void)printf("eFSS_BLOBTST_AbSlotTest 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_BLOBTST_AbSlotTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 5  -- FAIL \n");
+    }
+
+    /* An aborted write does not need to restore anything, the old blob is still the active one */
+    (void)memset(l_auData, 0x44, sizeof(l_auData));
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 10u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AbortWrite(&l_tCtx) ) &&
+        ( 0x44u == m_auStorArea[4u][0u] ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+        ( 0 == memcmp(l_auExp, l_auRead, 10u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitAbSlot(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+        ( 0 == memcmp(l_auExp, l_auRead, 10u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 6  -- FAIL \n");
+    }
+
+    /* When both slots are valid the init choose the one with the newest sequence number */
+    (void)memset(l_auData, 0x55, sizeof(l_auData));
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 10u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( 0x22u == m_auStorArea[0u][0u] ) && ( 0x55u == m_auStorArea[4u][0u] ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitAbSlot(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+        ( 0 == memcmp(l_auData, l_auRead, 10u) ) )
+    {
+        (void)memset(l_auData, 0x66, sizeof(l_auData));
+        if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 10u) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+            ( 0x66u == m_auStorArea[0u][0u] ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor,
+                                                      sizeof(l_auStor)) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitAbSlot(&l_tCtx) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReadBlob(&l_tCtx, 0u, 10u, l_auRead) ) &&
+            ( 0 == memcmp(l_auData, l_auRead, 10u) ) )
+        {
+            (void)printf("eFSS_BLOBTST_AbSlotTest 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_BLOBTST_AbSlotTest 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_AbSlotTest 7  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+}
+
+static void eFSS_BLOBTST_ReaderTest(void)
+{
+    /* Local variable */
+    t_eFSS_BLOB_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_BLOB_Reader l_tReader;
+    e_eFSS_BLOB_RES l_eRes;
+    uint8_t l_auStor[96u];
+    uint8_t l_auCache[48u];
+    uint8_t l_auData[88u];
+    uint8_t l_auNewData[88u];
+    uint8_t l_auRead[16u];
+    uint32_t l_uIdx;
+    uint32_t l_uPageLoad;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Every page of 48 byte hold 24 byte of the blob, so a blob of 88 byte use all the four pages of the area,
+       and the last one keep also his size and CRC. The cache has two slot */
+    eFSS_BLOBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, NULL);
+    eFSS_BLOBTST_InitStorSet(&l_tStorSet, e_eFSS_TYPE_TRAIL_FULL);
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tReader, 0, sizeof(l_tReader));
+    (void)memset(l_auRead, 0, sizeof(l_auRead));
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auData); l_uIdx++ )
+    {
+        l_auData[l_uIdx] = (uint8_t)l_uIdx;
+        l_auNewData[l_uIdx] = (uint8_t)( 0x80u + l_uIdx );
+    }
+
+    /* The cache must hold at least one page */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_Format(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, sizeof(l_auData)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_BADPARAM == eFSS_BLOB_ReaderOpen(&l_tCtx, &l_tReader, l_auCache, 23u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderOpen(&l_tCtx, &l_tReader, l_auCache, sizeof(l_auCache)) ) )
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 1  -- FAIL \n");
+    }
+
+    /* A read can cross the page boundary */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 16u, 16u, l_auRead) ) &&
+        ( 0 == memcmp(&l_auData[16u], l_auRead, 16u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 2  -- FAIL \n");
+    }
+
+    /* A page already in the cache is not readed again */
+    l_tCtxRead.uTimeUsed = 0u;
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 26u, 4u, l_auRead) ) &&
+        ( 0 == memcmp(&l_auData[26u], l_auRead, 4u) ) && ( 0u == l_tCtxRead.uTimeUsed ) )
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 3  -- FAIL \n");
+    }
+
+    /* Loading the last page evict the least recently used one, the first page, and keep the second one */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 72u, 16u, l_auRead) ) &&
+        ( 0 == memcmp(&l_auData[72u], l_auRead, 16u) ) && ( 0u != l_tCtxRead.uTimeUsed ) )
+    {
+        l_uPageLoad = l_tCtxRead.uTimeUsed;
+        l_tCtxRead.uTimeUsed = 0u;
+        if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 24u, 4u, l_auRead) ) &&
+            ( 0 == memcmp(&l_auData[24u], l_auRead, 4u) ) && ( 0u == l_tCtxRead.uTimeUsed ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 0u, 4u, l_auRead) ) &&
+            ( 0 == memcmp(l_auData, l_auRead, 4u) ) && ( l_uPageLoad == l_tCtxRead.uTimeUsed ) )
+        {
+            (void)printf("eFSS_BLOBTST_ReaderTest 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_BLOBTST_ReaderTest 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 4  -- FAIL \n");
+    }
+
+    /* Without A/B slots the blob change as soon as a write is started, the reader is no more valid */
+    l_eRes = eFSS_BLOB_StartWrite(&l_tCtx);
+    if( ( ( e_eFSS_BLOB_RES_OK == l_eRes ) || ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == l_eRes ) ) &&
+        ( e_eFSS_BLOB_RES_WRITEONGOING == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 0u, 4u, l_auRead) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AbortWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_READERNOTVALID == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 0u, 4u, l_auRead) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderOpen(&l_tCtx, &l_tReader, l_auCache, sizeof(l_auCache)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 0u, 4u, l_auRead) ) &&
+        ( 0 == memcmp(l_auData, l_auRead, 4u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 5  -- FAIL \n");
+    }
+
+    /* The aligner that repair the area invalidate the reader */
+    m_auStorArea[0u][0u] ^= 0xFFu;
+    l_eRes = eFSS_BLOB_GetStorageStatus(&l_tCtx);
+    if( ( ( e_eFSS_BLOB_RES_OK == l_eRes ) || ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == l_eRes ) ) &&
+        ( l_auData[0u] == m_auStorArea[0u][0u] ) &&
+        ( e_eFSS_BLOB_RES_READERNOTVALID == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 0u, 4u, l_auRead) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderOpen(&l_tCtx, &l_tReader, l_auCache, sizeof(l_auCache)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 0u, 4u, l_auRead) ) &&
+        ( 0 == memcmp(l_auData, l_auRead, 4u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 6  -- FAIL \n");
+    }
+
+    /* Using A/B slots the reader is still valid during the write, and is invalidated only by his end */
+    l_eRes = eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor));
+    if( ( e_eFSS_BLOB_RES_OK == l_eRes ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitAbSlot(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderOpen(&l_tCtx, &l_tReader, l_auCache, sizeof(l_auCache)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auNewData, sizeof(l_auNewData)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 20u, 16u, l_auRead) ) &&
+        ( 0 == memcmp(&l_auData[20u], l_auRead, 16u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_READERNOTVALID == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 20u, 16u, l_auRead) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderOpen(&l_tCtx, &l_tReader, l_auCache, sizeof(l_auCache)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_ReaderRead(&l_tCtx, &l_tReader, 20u, 16u, l_auRead) ) &&
+        ( 0 == memcmp(&l_auNewData[20u], l_auRead, 16u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_ReaderTest 7  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+}
+
+static void eFSS_BLOBTST_CrcPartTest(void)
+{
+    /* Local variable */
+    t_eFSS_BLOB_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    uint8_t l_auData[88u];
+    uint32_t l_auPartL[5u] = { 5u, 7u, 10u, 3u, 25u };
+    uint32_t l_auExactL[2u] = { 24u, 24u };
+    uint32_t l_auLastL[5u] = { 24u, 24u, 24u, 5u, 7u };
+    uint32_t l_uIdx;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Every page of 48 byte hold 24 byte of the blob, the blob written in chunks must be equal to the one written
+       with a single append */
+    eFSS_BLOBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, NULL);
+    eFSS_BLOBTST_InitStorSet(&l_tStorSet, e_eFSS_TYPE_TRAIL_FULL);
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auData); l_uIdx++ )
+    {
+        l_auData[l_uIdx] = (uint8_t)( ( 3u * l_uIdx ) + 1u );
+    }
+
+    /* Appends that end in the middle of a page that is not the last one */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_Format(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( true == eFSS_BLOBTST_IsEqToOneAppend(&l_tCtx, NULL, l_auData, l_auPartL, 5u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_CrcPartTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_CrcPartTest 1  -- FAIL \n");
+    }
+
+    /* The partially filled page is already padded and his CRC known, the end of the write only flush the last
+       page, every flush is verified with a read */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 30u) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, &l_auData[30u], 20u) ) )
+    {
+        l_tCtxWrite.uTimeUsed = 0u;
+        l_tCtxRead.uTimeUsed = 0u;
+        if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+            ( 1u == l_tCtxWrite.uTimeUsed ) && ( 1u == l_tCtxRead.uTimeUsed ) )
+        {
+            (void)printf("eFSS_BLOBTST_CrcPartTest 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_BLOBTST_CrcPartTest 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_CrcPartTest 2  -- FAIL \n");
+    }
+
+    /* Appends that fill exactly the pages */
+    if( ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( true == eFSS_BLOBTST_IsEqToOneAppend(&l_tCtx, NULL, l_auData, l_auExactL, 2u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_CrcPartTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_CrcPartTest 3  -- FAIL \n");
+    }
+
+    /* Appends that end in the last page, where the blob size and CRC are stored */
+    if( true == eFSS_BLOBTST_IsEqToOneAppend(&l_tCtx, NULL, l_auData, l_auLastL, 5u) )
+    {
+        (void)printf("eFSS_BLOBTST_CrcPartTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_CrcPartTest 4  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+}
+
+static void eFSS_BLOBTST_TailBufTest(void)
+{
+    /* Local variable */
+    t_eFSS_BLOB_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    e_eFSS_BLOB_RES l_eRes;
+    uint8_t l_auStor[96u];
+    uint8_t l_auTail[EFSS_BLOBTST_FULLDATAL];
+    uint8_t l_auData[88u];
+    uint32_t l_auPartL[5u] = { 5u, 7u, 10u, 3u, 25u };
+    uint32_t l_auExactL[2u] = { 24u, 24u };
+    uint32_t l_auLastL[5u] = { 24u, 24u, 24u, 5u, 7u };
+    uint32_t l_uIdx;
+    bool_t l_bIsOk;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Every page of 48 byte hold 24 byte of the blob, the blob written in chunks keeping the tail page in RAM
+       must be equal to the one written with a single append */
+    eFSS_BLOBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, NULL);
+    eFSS_BLOBTST_InitStorSet(&l_tStorSet, e_eFSS_TYPE_TRAIL_FULL);
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    for( l_uIdx = 0u; l_uIdx < sizeof(l_auData); l_uIdx++ )
+    {
+        l_auData[l_uIdx] = (uint8_t)( ( 5u * l_uIdx ) + 2u );
+    }
+
+    /* The tail buffer must hold a page, appends that end in the middle of a page that is not the last one */
+    if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor)) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_Format(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_BADPARAM == eFSS_BLOB_InitTailBuff(&l_tCtx, l_auTail, EFSS_BLOBTST_FULLDATAL - 1u) ) &&
+        ( true == eFSS_BLOBTST_IsEqToOneAppend(&l_tCtx, l_auTail, l_auData, l_auPartL, 5u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 1  -- FAIL \n");
+    }
+
+    /* Appends that fill exactly the pages */
+    l_eRes = eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor));
+    if( ( e_eFSS_BLOB_RES_OK == l_eRes ) && ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( true == eFSS_BLOBTST_IsEqToOneAppend(&l_tCtx, l_auTail, l_auData, l_auExactL, 2u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 2  -- FAIL \n");
+    }
+
+    /* Appends that end in the last page, where the blob size and CRC are stored */
+    l_eRes = eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor));
+    if( ( e_eFSS_BLOB_RES_OK == l_eRes ) && ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( true == eFSS_BLOBTST_IsEqToOneAppend(&l_tCtx, l_auTail, l_auData, l_auLastL, 5u) ) )
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 3  -- FAIL \n");
+    }
+
+    /* With the tail buffer every page is written only once and never loaded, every flush is verified with a
+       read */
+    l_bIsOk = ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) );
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxRead.uTimeUsed = 0u;
+    for( l_uIdx = 0u; l_uIdx < 5u; l_uIdx++ )
+    {
+        if( e_eFSS_BLOB_RES_OK != eFSS_BLOB_AppendData(&l_tCtx, l_auData, l_auPartL[l_uIdx]) )
+        {
+            l_bIsOk = false;
+        }
+    }
+
+    if( ( true == l_bIsOk ) && ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) &&
+        ( 4u == l_tCtxWrite.uTimeUsed ) && ( 4u == l_tCtxRead.uTimeUsed ) )
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 4  -- FAIL \n");
+    }
+
+    /* Without the tail buffer a page where the append start from the beginning is written blind, without
+       loading it */
+    l_eRes = eFSS_BLOB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor));
+    if( ( e_eFSS_BLOB_RES_OK == l_eRes ) &&
+        ( e_eFSS_BLOB_RES_OK_BKP_RCVRD == eFSS_BLOB_GetStorageStatus(&l_tCtx) ) &&
+        ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_StartWrite(&l_tCtx) ) )
+    {
+        l_tCtxWrite.uTimeUsed = 0u;
+        l_tCtxRead.uTimeUsed = 0u;
+        if( ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, l_auData, 24u) ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, &l_auData[24u], 5u) ) &&
+            ( 2u == l_tCtxWrite.uTimeUsed ) && ( 2u == l_tCtxRead.uTimeUsed ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_AppendData(&l_tCtx, &l_auData[29u], 5u) ) &&
+            ( 3u == l_tCtxWrite.uTimeUsed ) && ( 4u == l_tCtxRead.uTimeUsed ) &&
+            ( e_eFSS_BLOB_RES_OK == eFSS_BLOB_EndWrite(&l_tCtx) ) )
+        {
+            (void)printf("eFSS_BLOBTST_TailBufTest 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_BLOBTST_TailBufTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBTST_TailBufTest 5  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+}
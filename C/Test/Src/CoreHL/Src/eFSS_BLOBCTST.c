@@ -947,12 +947,24 @@ void eFSS_BLOBCTST_BadPointer(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPages = 0u;
     l_uSeqNumb = 0u;
 
@@ -1254,6 +1266,36 @@ void eFSS_BLOBCTST_BadPointer(void)
         (void)printf("eFSS_BLOBCTST_BadPointer 27 -- FAIL \n");
     }
 
+    /* Function */
+    if( e_eFSS_BLOBC_RES_BADPOINTER == eFSS_BLOBC_CloneAreaStep(NULL, true, &l_uTotPages) )
+    {
+        (void)printf("eFSS_BLOBCTST_BadPointer 28 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBCTST_BadPointer 28 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_BLOBC_RES_BADPOINTER == eFSS_BLOBC_CloneAreaStep(&l_tCtx, true, NULL) )
+    {
+        (void)printf("eFSS_BLOBCTST_BadPointer 29 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBCTST_BadPointer 29 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_BLOBC_RES_BADPOINTER == eFSS_BLOBC_CloneOriPageInBkpIfNotEq(NULL, 0u) )
+    {
+        (void)printf("eFSS_BLOBCTST_BadPointer 30 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBCTST_BadPointer 30 -- FAIL \n");
+    }
+
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
     (void)l_tCtxErase.uTimeUsed;
@@ -1357,6 +1399,26 @@ void eFSS_BLOBCTST_BadInit(void)
     {
         (void)printf("eFSS_BLOBCTST_BadInit 7  -- FAIL \n");
     }
+
+    /* Function */
+    if( e_eFSS_BLOBC_RES_NOINITLIB == eFSS_BLOBC_CloneAreaStep(&l_tCtx, true, &l_uTotPages) )
+    {
+        (void)printf("eFSS_BLOBCTST_BadInit 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBCTST_BadInit 8  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_BLOBC_RES_NOINITLIB == eFSS_BLOBC_CloneOriPageInBkpIfNotEq(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSS_BLOBCTST_BadInit 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_BLOBCTST_BadInit 9  -- FAIL \n");
+    }
 }
 
 void eFSS_BLOBCTST_BadParamEntr(void)
@@ -1382,6 +1444,14 @@ void eFSS_BLOBCTST_BadParamEntr(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -1398,6 +1468,10 @@ void eFSS_BLOBCTST_BadParamEntr(void)
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uSeqNumb = 0u;
 
 
@@ -1701,12 +1775,24 @@ void eFSS_BLOBCTST_CorruptedCtx(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPages = 0u;
 
     /* Function */
@@ -2341,6 +2427,14 @@ void eFSS_BLOBCTST_Basic(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -2357,6 +2451,10 @@ void eFSS_BLOBCTST_Basic(void)
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPages = 0u;
 
     /* Function */
@@ -2447,12 +2545,24 @@ void eFSS_BLOBCTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPages = 0u;
     l_uSeqNumb = 0u;
 
@@ -2935,6 +3045,14 @@ void eFSS_BLOBCTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     if( e_eFSS_BLOBC_RES_OK == eFSS_BLOBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
     {
@@ -3048,6 +3166,14 @@ void eFSS_BLOBCTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadErrSecAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     if( e_eFSS_BLOBC_RES_OK == eFSS_BLOBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
     {
@@ -3161,6 +3287,14 @@ void eFSS_BLOBCTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     if( e_eFSS_BLOBC_RES_OK == eFSS_BLOBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
     {
@@ -3221,6 +3355,14 @@ void eFSS_BLOBCTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     if( e_eFSS_BLOBC_RES_OK == eFSS_BLOBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
     {
@@ -3334,6 +3476,14 @@ void eFSS_BLOBCTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     if( e_eFSS_BLOBC_RES_OK == eFSS_BLOBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
     {
@@ -3418,12 +3568,24 @@ static void eFSS_BLOBCTST_CrcTest(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPages = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -3868,12 +4030,24 @@ static void eFSS_BLOBCTST_LoadTest(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPages = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -4914,12 +5088,24 @@ static void eFSS_BLOBCTST_FlushTest(void)
     l_tCtxCb.fRead = &eFSS_BLOBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_BLOBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
     /* Function */
@@ -5216,12 +5402,24 @@ static void eFSS_BLOBCTST_CloneTest(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadTstAAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTstAAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 6u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
     /* Function */
@@ -5959,12 +6157,24 @@ static void eFSS_BLOBCTST_CloneIfNeededTest(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadTstAAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTstAAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 6u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
     /* Function */
@@ -6949,12 +7159,24 @@ static void eFSS_BLOBCTST_GenTest(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadTstAAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTstAAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 6u;
     l_tStorSet.uPagesLen = 28u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
     /* Function */
@@ -129,6 +129,8 @@ static void eFSS_DBCTST_LoadBkupTest(void);
 static void eFSS_DBCTST_FlushBkupTest(void);
 static void eFSS_DBCTST_GenTest(void);
 static void eFSS_DBCTST_CodeCoverage(void);
+static void eFSS_DBCTST_JournalTest(void);
+static void eFSS_DBCTST_TxTest(void);
 
 
 
@@ -149,6 +151,8 @@ void eFSS_DBCTST_ExeTest(void)
     eFSS_DBCTST_FlushBkupTest();
     eFSS_DBCTST_GenTest();
     eFSS_DBCTST_CodeCoverage();
+    eFSS_DBCTST_JournalTest();
+    eFSS_DBCTST_TxTest();
 
     (void)printf("\n\nDB CORE TEST END \n\n");
 }
@@ -1028,16 +1032,28 @@ void eFSS_DBCTST_BadPointer(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPage = 0u;
 
     /* Function */
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(NULL, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(NULL, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 1  -- OK \n");
     }
@@ -1047,7 +1063,7 @@ void eFSS_DBCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, NULL, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, NULL, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 2  -- OK \n");
     }
@@ -1058,7 +1074,7 @@ void eFSS_DBCTST_BadPointer(void)
 
     /* Function */
     l_tCtxCb.ptCtxErase = NULL;
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 3  -- OK \n");
         l_tCtxCb.ptCtxErase = &l_tCtxErase;
@@ -1071,7 +1087,7 @@ void eFSS_DBCTST_BadPointer(void)
 
     /* Function */
     l_tCtxCb.fErase = NULL;
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 4  -- OK \n");
         l_tCtxCb.fErase = &eFSS_DBCTST_EraseAdapt;
@@ -1084,7 +1100,7 @@ void eFSS_DBCTST_BadPointer(void)
 
     /* Function */
     l_tCtxCb.ptCtxWrite = NULL;
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 5  -- OK \n");
         l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
@@ -1097,7 +1113,7 @@ void eFSS_DBCTST_BadPointer(void)
 
     /* Function */
     l_tCtxCb.fWrite = NULL;
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 6  -- OK \n");
         l_tCtxCb.fWrite = &eFSS_DBCTST_WriteAdapt;
@@ -1110,7 +1126,7 @@ void eFSS_DBCTST_BadPointer(void)
 
     /* Function */
     l_tCtxCb.ptCtxRead = NULL;
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 7  -- OK \n");
         l_tCtxCb.ptCtxRead = &l_tCtxRead;
@@ -1123,7 +1139,7 @@ void eFSS_DBCTST_BadPointer(void)
 
     /* Function */
     l_tCtxCb.fRead = NULL;
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 8  -- OK \n");
         l_tCtxCb.fRead = &eFSS_DBCTST_ReadAdapt;
@@ -1136,7 +1152,7 @@ void eFSS_DBCTST_BadPointer(void)
 
     /* Function */
     l_tCtxCb.ptCtxCrc32 = NULL;
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 9  -- OK \n");
         l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
@@ -1149,7 +1165,7 @@ void eFSS_DBCTST_BadPointer(void)
 
     /* Function */
     l_tCtxCb.fCrc32 = NULL;
-    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 10 -- OK \n");
         l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcAdapt;
@@ -1181,7 +1197,7 @@ void eFSS_DBCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 13 -- OK \n");
     }
@@ -1203,7 +1219,7 @@ void eFSS_DBCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 15 -- OK \n");
     }
@@ -1225,7 +1241,7 @@ void eFSS_DBCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 17 -- OK \n");
     }
@@ -1247,7 +1263,7 @@ void eFSS_DBCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 19 -- OK \n");
     }
@@ -1267,7 +1283,7 @@ void eFSS_DBCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadPointer 21 -- OK \n");
     }
@@ -1286,6 +1302,16 @@ void eFSS_DBCTST_BadPointer(void)
         (void)printf("eFSS_DBCTST_BadPointer 22 -- FAIL \n");
     }
 
+    /* Function */
+    if( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_LoadPageInBuffTrustOri(NULL, 0u) )
+    {
+        (void)printf("eFSS_DBCTST_BadPointer 23 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_BadPointer 23 -- FAIL \n");
+    }
+
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
     (void)l_tCtxErase.uTimeUsed;
@@ -1354,6 +1380,16 @@ void eFSS_DBCTST_BadInit(void)
     {
         (void)printf("eFSS_DBCTST_BadInit 4  -- FAIL \n");
     }
+
+    /* Function */
+    if( e_eFSS_DBC_RES_NOINITLIB == eFSS_DBC_LoadPageInBuffTrustOri(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSS_DBCTST_BadInit 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_BadInit 5  -- FAIL \n");
+    }
 }
 
 void eFSS_DBCTST_BadParamEntr(void)
@@ -1377,6 +1413,14 @@ void eFSS_DBCTST_BadParamEntr(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -1393,11 +1437,15 @@ void eFSS_DBCTST_BadParamEntr(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
 
     /* Function */
     l_tStorSet.uPagesLen = 25u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 1  -- OK \n");
         l_tStorSet.uPagesLen = 24u;
@@ -1410,7 +1458,7 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uPagesLen = 23u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 2  -- OK \n");
         l_tStorSet.uPagesLen = 24u;
@@ -1423,7 +1471,7 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uTotPages = 0u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 3  -- OK \n");
         l_tStorSet.uTotPages = 2u;
@@ -1436,7 +1484,8 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uPagesLen = 19u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u,
+                                                    0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 4  -- OK \n");
         l_tStorSet.uPagesLen = 24u;
@@ -1449,7 +1498,8 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uPagesLen = 18u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u,
+                                                    0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 5  -- OK \n");
         l_tStorSet.uPagesLen = 24u;
@@ -1462,7 +1512,7 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uRWERetry = 0u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 6  -- OK \n");
         l_tStorSet.uRWERetry = 1u;
@@ -1475,7 +1525,8 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uPagesLen = 20u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u,
+                                                    0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 7  -- OK \n");
         l_tStorSet.uPagesLen = 24u;
@@ -1487,7 +1538,7 @@ void eFSS_DBCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 8  -- OK \n");
     }
@@ -1498,7 +1549,7 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uTotPages = 1u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 9  -- OK \n");
         l_tStorSet.uTotPages = 2u;
@@ -1511,7 +1562,7 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uTotPages = 3u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 10 -- OK \n");
         l_tStorSet.uTotPages = 2u;
@@ -1524,7 +1575,7 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uTotPages = 5u;
-    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 11 -- OK \n");
         l_tStorSet.uTotPages = 2u;
@@ -1537,7 +1588,7 @@ void eFSS_DBCTST_BadParamEntr(void)
 
     /* Function */
     l_tStorSet.uTotPages = 4u;
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadParamEntr 12 -- OK \n");
     }
@@ -1631,16 +1682,28 @@ void eFSS_DBCTST_CorruptedCtx(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 4u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPage = 0u;
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 1  -- OK \n");
     }
@@ -1673,7 +1736,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 4  -- OK \n");
     }
@@ -1696,7 +1759,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 6  -- OK \n");
     }
@@ -1719,7 +1782,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 8  -- OK \n");
     }
@@ -1742,7 +1805,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 10 -- OK \n");
     }
@@ -1765,7 +1828,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 12 -- OK \n");
     }
@@ -1788,7 +1851,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 14 -- OK \n");
     }
@@ -1811,7 +1874,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 16 -- OK \n");
     }
@@ -1834,7 +1897,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 18 -- OK \n");
     }
@@ -1855,7 +1918,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 20 -- OK \n");
     }
@@ -1876,7 +1939,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 22 -- OK \n");
     }
@@ -1897,7 +1960,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 24 -- OK \n");
     }
@@ -1918,7 +1981,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 26 -- OK \n");
     }
@@ -1939,7 +2002,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 28 -- OK \n");
     }
@@ -1960,7 +2023,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 30 -- OK \n");
     }
@@ -1981,7 +2044,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 32 -- OK \n");
     }
@@ -2004,7 +2067,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 34 -- OK \n");
     }
@@ -2025,7 +2088,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 36 -- OK \n");
     }
@@ -2046,7 +2109,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 38 -- OK \n");
     }
@@ -2067,7 +2130,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 40 -- OK \n");
     }
@@ -2088,7 +2151,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 42 -- OK \n");
     }
@@ -2109,7 +2172,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 44 -- OK \n");
     }
@@ -2130,7 +2193,7 @@ void eFSS_DBCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CorruptedCtx 46 -- OK \n");
     }
@@ -2185,6 +2248,14 @@ void eFSS_DBCTST_Basic(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -2201,9 +2272,13 @@ void eFSS_DBCTST_Basic(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_Basic 1  -- OK \n");
     }
@@ -2277,7 +2352,7 @@ void eFSS_DBCTST_Basic(void)
     l_tStorSet.uTotPages = 10u;
 
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_Basic 6  -- OK \n");
     }
@@ -2333,6 +2408,14 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -2349,11 +2432,15 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPage = 0u;
 
     /* ------------------------------------------------------------------------------------------ TEST READ CALL BACK */
     /* Function */
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadClBckNRetry 1  -- OK \n");
     }
@@ -2428,7 +2515,7 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadClBckNRetry 5  -- OK \n");
     }
@@ -2497,7 +2584,7 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadClBckNRetry 8  -- OK \n");
     }
@@ -2566,7 +2653,7 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadClBckNRetry 11 -- OK \n");
     }
@@ -2635,7 +2722,7 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadClBckNRetry 14 -- OK \n");
     }
@@ -2707,7 +2794,7 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadClBckNRetry 17 -- OK \n");
     }
@@ -2831,7 +2918,7 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadClBckNRetry 20 -- OK \n");
     }
@@ -2869,7 +2956,7 @@ void eFSS_DBCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_BadClBckNRetry 26 -- OK \n");
     }
@@ -2999,12 +3086,24 @@ static void eFSS_DBCTST_LoadBkupTest(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPage = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -3023,7 +3122,7 @@ static void eFSS_DBCTST_LoadBkupTest(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_LoadBkupTest 1  -- OK \n");
     }
@@ -3701,12 +3800,24 @@ static void eFSS_DBCTST_FlushBkupTest(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
     /* Function */
@@ -3724,7 +3835,7 @@ static void eFSS_DBCTST_FlushBkupTest(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_FlushBkupTest 1  -- OK \n");
     }
@@ -3833,12 +3944,24 @@ static void eFSS_DBCTST_GenTest(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadTstAAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTstAAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 6u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uTotPage = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -3860,7 +3983,7 @@ static void eFSS_DBCTST_GenTest(void)
     /* Setup storage area */
     (void)memset(m_auStorAreaA, 0, sizeof(m_auStorAreaA));
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_GenTest 1  -- OK \n");
     }
@@ -4318,7 +4441,7 @@ static void eFSS_DBCTST_GenTest(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_GenTest 36 -- OK \n");
     }
@@ -5033,12 +5156,24 @@ static void eFSS_DBCTST_CodeCoverage(void)
     l_tCtxCb.fRead = &eFSS_DBCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
     /* Function */
@@ -5071,7 +5206,7 @@ static void eFSS_DBCTST_CodeCoverage(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
 
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CodeCoverage 1  -- OK \n");
     }
@@ -5124,7 +5259,7 @@ static void eFSS_DBCTST_CodeCoverage(void)
     l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcErrAdapt;
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CodeCoverage 4  -- OK \n");
     }
@@ -5186,7 +5321,7 @@ static void eFSS_DBCTST_CodeCoverage(void)
     l_tCtxRead.eLastEr = e_eFSS_DBC_RES_OK;
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
-    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor) ) )
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) )
     {
         (void)printf("eFSS_DBCTST_CodeCoverage 7  -- OK \n");
     }
@@ -5251,3 +5386,400 @@ static void eFSS_DBCTST_CodeCoverage(void)
     (void)l_tCtxCrc32.uTimeUsed;
     (void)l_ltUseBuff2.puBuf;
 }
+
+static void eFSS_DBCTST_JournalTest(void)
+{
+    /* Local variable */
+    t_eFSS_DBC_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[48u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    t_eFSS_DBC_StorBuf l_ltUseBuff;
+    uint32_t l_uTotPage;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_DBCTST_EraseTstAAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_DBCTST_WriteTstAAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_DBCTST_ReadTstAAdapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTstAAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 6u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uTotPage = 0u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_DBC_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_DBC_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_DBC_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
+
+    /* Setup storage area */
+    (void)memset(m_auStorAreaA, 0, sizeof(m_auStorAreaA));
+
+    /* The pages not reserved to the journal must be an even number of at least two pages */
+    if( ( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                      6u ) ) &&
+        ( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                      7u ) ) &&
+        ( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                      5u ) ) &&
+        ( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                      1u ) ) )
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 1  -- FAIL \n");
+    }
+
+    /* Two journal pages, two origin and two backup pages */
+    if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 2u ) ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uTotPage) ) && ( 2u == l_uTotPage ) )
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 2  -- FAIL \n");
+    }
+
+    /* Journal index out of bounds */
+    if( ( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_LoadJournalPageInBuff(NULL, 0u) ) &&
+        ( e_eFSS_DBC_RES_BADPOINTER == eFSS_DBC_FlushBuffInJournalPage(NULL, 0u) ) &&
+        ( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_LoadJournalPageInBuff(&l_tCtx, 2u) ) &&
+        ( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_FlushBuffInJournalPage(&l_tCtx, 2u) ) &&
+        ( e_eFSS_DBC_RES_BADPARAM == eFSS_DBC_FlushBuffInPage(&l_tCtx, 2u) ) )
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 3  -- FAIL \n");
+    }
+
+    /* A journal page never written is not valid */
+    if( e_eFSS_DBC_RES_NOTVALIDDB == eFSS_DBC_LoadJournalPageInBuff(&l_tCtx, 0u) )
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 4  -- FAIL \n");
+    }
+
+    /* Write the two journal pages, they are placed after the origin and backup pages */
+    (void)memset(l_ltUseBuff.puBuf, 0x11, l_ltUseBuff.uBufL);
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInJournalPage(&l_tCtx, 0u) )
+    {
+        (void)memset(l_ltUseBuff.puBuf, 0x22, l_ltUseBuff.uBufL);
+        if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInJournalPage(&l_tCtx, 1u) ) &&
+            ( 0x11u == m_auStorAreaA[4u][0u] ) && ( 0x11u == m_auStorAreaA[4u][3u] ) &&
+            ( 0x22u == m_auStorAreaA[5u][0u] ) && ( 0x22u == m_auStorAreaA[5u][3u] ) &&
+            ( 0x00u == m_auStorAreaA[0u][0u] ) && ( 0x00u == m_auStorAreaA[1u][0u] ) &&
+            ( 0x00u == m_auStorAreaA[2u][0u] ) && ( 0x00u == m_auStorAreaA[3u][0u] ) )
+        {
+            (void)printf("eFSS_DBCTST_JournalTest 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_DBCTST_JournalTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 5  -- FAIL \n");
+    }
+
+    /* Read back the journal pages */
+    (void)memset(l_ltUseBuff.puBuf, 0, l_ltUseBuff.uBufL);
+    if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadJournalPageInBuff(&l_tCtx, 0u) ) &&
+        ( 0x11u == l_ltUseBuff.puBuf[0u] ) && ( 0x11u == l_ltUseBuff.puBuf[l_ltUseBuff.uBufL - 1u] ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadJournalPageInBuff(&l_tCtx, 1u) ) &&
+        ( 0x22u == l_ltUseBuff.puBuf[0u] ) && ( 0x22u == l_ltUseBuff.puBuf[l_ltUseBuff.uBufL - 1u] ) )
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 6  -- FAIL \n");
+    }
+
+    /* Database pages and journal pages do not overlap */
+    (void)memset(l_ltUseBuff.puBuf, 0x33, l_ltUseBuff.uBufL);
+    if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInPage(&l_tCtx, 1u) ) &&
+        ( 0x22u == m_auStorAreaA[5u][0u] ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadJournalPageInBuff(&l_tCtx, 1u) ) &&
+        ( 0x22u == l_ltUseBuff.puBuf[0u] ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 1u) ) &&
+        ( 0x33u == l_ltUseBuff.puBuf[0u] ) )
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_JournalTest 7  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_DBCTST_TxTest(void)
+{
+    /* Local variable */
+    t_eFSS_DBC_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[48u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    t_eFSS_DBC_StorBuf l_ltUseBuff;
+    uint32_t l_uTotPage;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_DBCTST_EraseTstAAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_DBCTST_WriteTstAAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_DBCTST_ReadTstAAdapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_DBCTST_CrcTstAAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 6u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uTotPage = 0u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_DBC_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_DBC_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_DBC_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_DBC_RES_OK;
+
+    /* Setup storage area */
+    (void)memset(m_auStorAreaA, 0, sizeof(m_auStorAreaA));
+
+    /* Three origin pages and three backup pages */
+    if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), 0u ) ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uTotPage) ) && ( 3u == l_uTotPage ) )
+    {
+        (void)printf("eFSS_DBCTST_TxTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 1  -- FAIL \n");
+    }
+
+    /* Write the database, no transaction to recover */
+    (void)memset(l_ltUseBuff.puBuf, 0x10, l_ltUseBuff.uBufL);
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInPage(&l_tCtx, 0u) )
+    {
+        (void)memset(l_ltUseBuff.puBuf, 0x20, l_ltUseBuff.uBufL);
+        if( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInPage(&l_tCtx, 1u) )
+        {
+            (void)memset(l_ltUseBuff.puBuf, 0x30, l_ltUseBuff.uBufL);
+            if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInPage(&l_tCtx, 2u) ) &&
+                ( e_eFSS_DBC_RES_OK == eFSS_DBC_RecoverTx(&l_tCtx) ) )
+            {
+                (void)printf("eFSS_DBCTST_TxTest 2  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_DBCTST_TxTest 2  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_DBCTST_TxTest 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 2  -- FAIL \n");
+    }
+
+    /* Stage two pages without the commit marker, the origin pages are not written */
+    (void)memset(l_ltUseBuff.puBuf, 0xA0, l_ltUseBuff.uBufL);
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInTxPage(&l_tCtx, 0u, false) )
+    {
+        (void)memset(l_ltUseBuff.puBuf, 0xA1, l_ltUseBuff.uBufL);
+        if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInTxPage(&l_tCtx, 1u, false) ) &&
+            ( 0x10u == m_auStorAreaA[0u][0u] ) && ( 0x20u == m_auStorAreaA[1u][0u] ) &&
+            ( 0xA0u == m_auStorAreaA[3u][0u] ) && ( 0xA1u == m_auStorAreaA[4u][0u] ) &&
+            ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadTxPageInBuff(&l_tCtx, 0u) ) && ( 0xA0u == l_ltUseBuff.puBuf[0u] ) &&
+            ( e_eFSS_DBC_RES_NOTVALIDDB == eFSS_DBC_LoadTxPageInBuff(&l_tCtx, 2u) ) )
+        {
+            (void)printf("eFSS_DBCTST_TxTest 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_DBCTST_TxTest 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 3  -- FAIL \n");
+    }
+
+    /* Transaction not committed: it is discarded and the backup pages are restored from the origin pages */
+    if( ( e_eFSS_DBC_RES_OK_BKP_RCVRD == eFSS_DBC_RecoverTx(&l_tCtx) ) &&
+        ( 0x10u == m_auStorAreaA[3u][0u] ) && ( 0x20u == m_auStorAreaA[4u][0u] ) &&
+        ( e_eFSS_DBC_RES_NOTVALIDDB == eFSS_DBC_LoadTxPageInBuff(&l_tCtx, 0u) ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_RecoverTx(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_DBCTST_TxTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 4  -- FAIL \n");
+    }
+
+    if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 0u) ) && ( 0x10u == l_ltUseBuff.puBuf[0u] ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 1u) ) && ( 0x20u == l_ltUseBuff.puBuf[0u] ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 2u) ) && ( 0x30u == l_ltUseBuff.puBuf[0u] ) )
+    {
+        (void)printf("eFSS_DBCTST_TxTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 5  -- FAIL \n");
+    }
+
+    /* Stage two pages and the commit marker, the origin pages are not written */
+    (void)memset(l_ltUseBuff.puBuf, 0xB0, l_ltUseBuff.uBufL);
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInTxPage(&l_tCtx, 0u, false) )
+    {
+        (void)memset(l_ltUseBuff.puBuf, 0xB2, l_ltUseBuff.uBufL);
+        if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInTxPage(&l_tCtx, 2u, true) ) &&
+            ( 0x10u == m_auStorAreaA[0u][0u] ) && ( 0x30u == m_auStorAreaA[2u][0u] ) &&
+            ( 0xB0u == m_auStorAreaA[3u][0u] ) && ( 0xB2u == m_auStorAreaA[5u][0u] ) )
+        {
+            (void)printf("eFSS_DBCTST_TxTest 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_DBCTST_TxTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 6  -- FAIL \n");
+    }
+
+    /* Transaction committed: it is rolled forward, origin and backup pages get the staged values */
+    if( ( e_eFSS_DBC_RES_OK_BKP_RCVRD == eFSS_DBC_RecoverTx(&l_tCtx) ) &&
+        ( 0xB0u == m_auStorAreaA[0u][0u] ) && ( 0x20u == m_auStorAreaA[1u][0u] ) &&
+        ( 0xB2u == m_auStorAreaA[2u][0u] ) && ( 0xB0u == m_auStorAreaA[3u][0u] ) &&
+        ( 0x20u == m_auStorAreaA[4u][0u] ) && ( 0xB2u == m_auStorAreaA[5u][0u] ) &&
+        ( e_eFSS_DBC_RES_NOTVALIDDB == eFSS_DBC_LoadTxPageInBuff(&l_tCtx, 2u) ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_RecoverTx(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_DBCTST_TxTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 7  -- FAIL \n");
+    }
+
+    if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 0u) ) && ( 0xB0u == l_ltUseBuff.puBuf[0u] ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 1u) ) && ( 0x20u == l_ltUseBuff.puBuf[0u] ) &&
+        ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 2u) ) && ( 0xB2u == l_ltUseBuff.puBuf[0u] ) )
+    {
+        (void)printf("eFSS_DBCTST_TxTest 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 8  -- FAIL \n");
+    }
+
+    /* Committed transaction interrupted while it was copied in the origin pages, the copy is completed */
+    (void)memset(l_ltUseBuff.puBuf, 0xC0, l_ltUseBuff.uBufL);
+    if( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInTxPage(&l_tCtx, 0u, false) )
+    {
+        (void)memset(l_ltUseBuff.puBuf, 0xC1, l_ltUseBuff.uBufL);
+        if( ( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInTxPage(&l_tCtx, 1u, true) ) &&
+            ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadTxPageInBuff(&l_tCtx, 0u) ) &&
+            ( e_eFSS_DBC_RES_OK == eFSS_DBC_FlushBuffInPage(&l_tCtx, 0u) ) &&
+            ( 0xC0u == m_auStorAreaA[0u][0u] ) && ( 0xC1u == m_auStorAreaA[4u][0u] ) &&
+            ( 0x20u == m_auStorAreaA[1u][0u] ) &&
+            ( e_eFSS_DBC_RES_OK_BKP_RCVRD == eFSS_DBC_RecoverTx(&l_tCtx) ) &&
+            ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 0u) ) && ( 0xC0u == l_ltUseBuff.puBuf[0u] ) &&
+            ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 1u) ) && ( 0xC1u == l_ltUseBuff.puBuf[0u] ) &&
+            ( e_eFSS_DBC_RES_OK == eFSS_DBC_LoadPageInBuff(&l_tCtx, 2u) ) && ( 0xB2u == l_ltUseBuff.puBuf[0u] ) )
+        {
+            (void)printf("eFSS_DBCTST_TxTest 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_DBCTST_TxTest 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBCTST_TxTest 9  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
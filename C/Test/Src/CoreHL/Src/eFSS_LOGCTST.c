@@ -119,6 +119,7 @@ static void eFSS_LOGCTST_FlushTest(void);
 static void eFSS_LOGCTST_IsPageNewOrBkup(void);
 static void eFSS_LOGCTST_FlushBuffIfNotEquals(void);
 static void eFSS_LOGCTST_GenTest(void);
+static void eFSS_LOGCTST_GetPageSeqNTest(void);
 
 
 
@@ -142,6 +143,7 @@ void eFSS_LOGCTST_ExeTest(void)
     eFSS_LOGCTST_IsPageNewOrBkup();
     eFSS_LOGCTST_FlushBuffIfNotEquals();
     eFSS_LOGCTST_GenTest();
+    eFSS_LOGCTST_GetPageSeqNTest();
 
     (void)printf("\n\nLOG CORE TEST END \n\n");
 }
@@ -149,8 +151,8 @@ void eFSS_LOGCTST_ExeTest(void)
 /***********************************************************************************************************************
  *   PRIVATE MODULES VARIABLE DECLARATION
  **********************************************************************************************************************/
-static bool_t  m_bIsErased[14u] = false;
-static uint8_t m_auStorArea[14][32u];
+static bool_t  m_bIsErased[14u] = {false};
+static uint8_t m_auStorArea[14][40u];
 
 
 
@@ -317,7 +319,7 @@ static bool_t eFSS_LOGCTST_WriteErrSecAdapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
             }
             else
             {
-                if( 32u != p_uDataToWriteL )
+                if( 36u != p_uDataToWriteL )
                 {
                     l_bRes = false;
                     p_ptCtx->eLastEr = e_eFSS_LOGC_RES_BADPARAM;
@@ -381,7 +383,7 @@ static bool_t eFSS_LOGCTST_WriteTst1Adapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
             }
             else
             {
-                if( 32u != p_uDataToWriteL )
+                if( 36u != p_uDataToWriteL )
                 {
                     l_bRes = false;
                     p_ptCtx->eLastEr = e_eFSS_LOGC_RES_BADPARAM;
@@ -499,7 +501,7 @@ static bool_t eFSS_LOGCTST_ReadErrSecAdapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
             }
             else
             {
-                if( 32u != p_uReadBufferL )
+                if( 36u != p_uReadBufferL )
                 {
                     l_bRes = false;
                     p_ptCtx->eLastEr = e_eFSS_LOGC_RES_BADPARAM;
@@ -553,7 +555,7 @@ static bool_t eFSS_LOGCTST_ReadTst1Adapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
             }
             else
             {
-                if( 32u != p_uReadBufferL )
+                if( 36u != p_uReadBufferL )
                 {
                     l_bRes = false;
                     p_ptCtx->eLastEr = e_eFSS_LOGC_RES_BADPARAM;
@@ -599,7 +601,7 @@ static bool_t eFSS_LOGCTST_ReadTst2Adapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
             }
             else
             {
-                if( 32u != p_uReadBufferL )
+                if( 36u != p_uReadBufferL )
                 {
                     l_bRes = false;
                     p_ptCtx->eLastEr = e_eFSS_LOGC_RES_BADPARAM;
@@ -737,7 +739,7 @@ void eFSS_LOGCTST_BadPointer(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[56u];
+    uint8_t l_auStor[64u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -746,6 +748,7 @@ void eFSS_LOGCTST_BadPointer(void)
     t_eFSS_LOGC_StorBuf l_ltUseBuff;
     bool_t l_bIsNewest;
     uint32_t l_uByteInPage;
+    uint32_t l_uSeqN;
     uint32_t l_uPageUsable;
     uint32_t l_uNewPIx;
     uint32_t l_uFillPIdx;
@@ -769,12 +772,24 @@ void eFSS_LOGCTST_BadPointer(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 28u;
+    l_tStorSet.uPagesLen = 32u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     l_bIsNewest = false;
     l_uByteInPage = 0u;
@@ -1109,7 +1124,7 @@ void eFSS_LOGCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_FlushBufferAs(NULL, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_FlushBufferAs(NULL, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadPointer 30 -- OK \n");
     }
@@ -1119,7 +1134,7 @@ void eFSS_LOGCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_LoadBufferAs(NULL, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_LoadBufferAs(NULL, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uByteInPage, &l_uSeqN) )
     {
         (void)printf("eFSS_LOGCTST_BadPointer 31 -- OK \n");
     }
@@ -1129,7 +1144,7 @@ void eFSS_LOGCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, NULL) )
+    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, NULL, &l_uSeqN) )
     {
         (void)printf("eFSS_LOGCTST_BadPointer 32 -- OK \n");
     }
@@ -1159,7 +1174,7 @@ void eFSS_LOGCTST_BadPointer(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_FlushBuffIfNotEquals(NULL, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_FlushBuffIfNotEquals(NULL, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadPointer 35 -- OK \n");
     }
@@ -1168,6 +1183,46 @@ void eFSS_LOGCTST_BadPointer(void)
         (void)printf("eFSS_LOGCTST_BadPointer 35 -- FAIL \n");
     }
 
+    /* Function */
+    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uByteInPage, NULL) )
+    {
+        (void)printf("eFSS_LOGCTST_BadPointer 36 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_BadPointer 36 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_GetPageSeqN(NULL, 0u, &l_uSeqN) )
+    {
+        (void)printf("eFSS_LOGCTST_BadPointer 37 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_BadPointer 37 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_GetPageSeqN(&l_tCtx, 0u, NULL) )
+    {
+        (void)printf("eFSS_LOGCTST_BadPointer 38 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_BadPointer 38 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_SetTrustOri(NULL, true) )
+    {
+        (void)printf("eFSS_LOGCTST_BadPointer 39 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_BadPointer 39 -- FAIL \n");
+    }
+
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
     (void)l_tCtxErase.uTimeUsed;
@@ -1188,6 +1243,7 @@ void eFSS_LOGCTST_BadInit(void)
     bool_t l_bIsNewest;
     bool_t l_bIsFlashCacheUsed;
     uint32_t l_uByteInPage;
+    uint32_t l_uSeqN;
     uint32_t l_uPageUsable;
     uint32_t l_uNewPIx;
     uint32_t l_uFillPIdx;
@@ -1243,7 +1299,7 @@ void eFSS_LOGCTST_BadInit(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_NOINITLIB == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_NOINITLIB == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadInit 5  -- OK \n");
     }
@@ -1253,7 +1309,7 @@ void eFSS_LOGCTST_BadInit(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_NOINITLIB == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOINITLIB == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uByteInPage, &l_uSeqN) )
     {
         (void)printf("eFSS_LOGCTST_BadInit 6  -- OK \n");
     }
@@ -1290,7 +1346,7 @@ void eFSS_LOGCTST_BadInit(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_NOINITLIB == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_NOINITLIB == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadInit 9  -- OK \n");
     }
@@ -1306,14 +1362,15 @@ void eFSS_LOGCTST_BadParamEntr(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[56u];
-    uint8_t l_auStorL[64u];
+    uint8_t l_auStor[64u];
+    uint8_t l_auStorL[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
 	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
     bool_t l_bIsNewest;
     uint32_t l_uByteInPage;
+    uint32_t l_uSeqN;
     uint32_t l_uNewPIx;
     uint32_t l_uFillPIdx;
 
@@ -1326,6 +1383,14 @@ void eFSS_LOGCTST_BadParamEntr(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -1339,9 +1404,13 @@ void eFSS_LOGCTST_BadParamEntr(void)
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 28u;
+    l_tStorSet.uPagesLen = 32u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     l_bIsNewest = false;
     l_uByteInPage = 0u;
@@ -1349,29 +1418,29 @@ void eFSS_LOGCTST_BadParamEntr(void)
     l_uFillPIdx = 0u;
 
     /* Function */
-    l_tStorSet.uPagesLen = 25u;
+    l_tStorSet.uPagesLen = 29u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false, false ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 1  -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 1  -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 23u;
+    l_tStorSet.uPagesLen = 27u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false, false ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 2  -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 2  -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
@@ -1392,12 +1461,12 @@ void eFSS_LOGCTST_BadParamEntr(void)
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 4  -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 4  -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
@@ -1405,64 +1474,64 @@ void eFSS_LOGCTST_BadParamEntr(void)
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 5  -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 5  -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uPagesLen = 28u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 6  -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 6  -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 25u;
+    l_tStorSet.uPagesLen = 29u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 7  -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 7  -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 31u;
+    l_tStorSet.uPagesLen = 35u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, false  ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 8  -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 8  -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, false  ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 8  -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 8  -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
@@ -1483,12 +1552,12 @@ void eFSS_LOGCTST_BadParamEntr(void)
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false ) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 10 -- OK \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
     else
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 10 -- FAIL \n");
-        l_tStorSet.uPagesLen = 28u;
+        l_tStorSet.uPagesLen = 32u;
     }
 
     /* Function */
@@ -1502,7 +1571,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 3u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
@@ -1514,7 +1583,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 4u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
@@ -1526,7 +1595,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 5u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
@@ -1538,7 +1607,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 5u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, false  ) )
     {
@@ -1550,7 +1619,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 6u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, false  ) )
     {
@@ -1562,7 +1631,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 7u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, false  ) )
     {
@@ -1574,7 +1643,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 7u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, true  ) )
     {
@@ -1586,7 +1655,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 6u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, true  ) )
     {
@@ -1598,7 +1667,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 11u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, true  ) )
     {
@@ -1610,7 +1679,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 8u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, true  ) )
     {
@@ -1622,7 +1691,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 10u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, true  ) )
     {
@@ -1634,7 +1703,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 7u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, true  ) )
     {
@@ -1646,7 +1715,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 6u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, true  ) )
     {
@@ -1658,7 +1727,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 11u;
     if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, true  ) )
     {
@@ -1670,7 +1739,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 10u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, true  ) )
     {
@@ -1682,7 +1751,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 12u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, true  ) )
     {
@@ -1694,7 +1763,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 5u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
@@ -1706,7 +1775,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_WriteCache(&l_tCtx, 0u, 0u ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_WriteCache(&l_tCtx, 0u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 29 -- OK \n");
     }
@@ -1716,7 +1785,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 6u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, false  ) )
     {
@@ -1728,7 +1797,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_WriteCache(&l_tCtx, 4u, 0u ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_WriteCache(&l_tCtx, 4u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 31 -- OK \n");
     }
@@ -1748,7 +1817,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 12u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, true  ) )
     {
@@ -1760,7 +1829,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_WriteCache(&l_tCtx, 5u, 0u ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_WriteCache(&l_tCtx, 5u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 31 -- OK \n");
     }
@@ -1780,7 +1849,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 5u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, false, false  ) )
     {
@@ -1802,7 +1871,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 5u, 0u ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 5u, 0u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 34 -- OK \n");
     }
@@ -1812,7 +1881,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, (e_eFSS_LOGC_PAGETYPE)4u, 0u, 0u ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, (e_eFSS_LOGC_PAGETYPE)4u, 0u, 0u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 35 -- OK \n");
     }
@@ -1822,7 +1891,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u, 9u ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u, 9u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 36 -- OK \n");
     }
@@ -1832,7 +1901,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 5u, &l_uByteInPage ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 5u, &l_uByteInPage, &l_uSeqN) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 37 -- OK \n");
     }
@@ -1842,7 +1911,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_LoadBufferAs(&l_tCtx, (e_eFSS_LOGC_PAGETYPE)4u, 0u, &l_uByteInPage ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_LoadBufferAs(&l_tCtx, (e_eFSS_LOGC_PAGETYPE)4u, 0u, &l_uByteInPage, &l_uSeqN) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 38 -- OK \n");
     }
@@ -1862,7 +1931,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 12u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, l_tStorSet.uPagesLen * 2u, true, true  ) )
     {
@@ -1885,7 +1954,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
 
     /* Function */
     (void)memset(l_auStorL, 0, sizeof(l_auStorL));
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 5u, 0u, e_eFSS_LOGC_PAGETYPE_LOG ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 5u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 42 -- OK \n");
     }
@@ -1895,7 +1964,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     }
 
     /* Function */
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uTotPages = 12u;
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStorL, sizeof(l_auStorL), true, true  ) )
     {
@@ -1908,7 +1977,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
 
     /* Function */
     (void)memset(l_auStorL, 0, sizeof(l_auStorL));
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 5u, 0u, e_eFSS_LOGC_PAGETYPE_LOG ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 5u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 44 -- OK \n");
     }
@@ -1919,7 +1988,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
 
     /* Function */
     (void)memset(l_auStorL, 0, sizeof(l_auStorL));
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, (e_eFSS_LOGC_PAGETYPE)4u ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, (e_eFSS_LOGC_PAGETYPE)4u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 45 -- OK \n");
     }
@@ -1931,7 +2000,7 @@ void eFSS_LOGCTST_BadParamEntr(void)
     /* Function */
     (void)memset(l_auStorL, 0, sizeof(l_auStorL));
 
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 9u, e_eFSS_LOGC_PAGETYPE_LOG ) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 9u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         (void)printf("eFSS_LOGCTST_BadParamEntr 46 -- OK \n");
     }
@@ -1947,7 +2016,7 @@ void eFSS_LOGCTST_CorruptedCtx(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -1955,6 +2024,7 @@ void eFSS_LOGCTST_CorruptedCtx(void)
     t_eFSS_LOGC_StorBuf l_ltUseBuff;
     bool_t l_bIsNewest;
     uint32_t l_uPageUsable;
+    uint32_t l_uSeqN;
     uint32_t l_uNewPIx;
     uint32_t l_uFillPIdx;
 
@@ -1967,12 +2037,24 @@ void eFSS_LOGCTST_CorruptedCtx(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_bIsNewest = false;
     l_uPageUsable = 0u;
     l_uNewPIx = 0u;
@@ -2374,9 +2456,9 @@ void eFSS_LOGCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    l_tCtx.tCOREHLCtx.tCORELLCtx.tStorSett.uPagesLen = 24u;
-    l_tCtx.tCOREHLCtx.tCORELLCtx.tBuff1.uBufL = 24u;
-    l_tCtx.tCOREHLCtx.tCORELLCtx.tBuff2.uBufL = 24u;
+    l_tCtx.tCOREHLCtx.tCORELLCtx.tStorSett.uPagesLen = 28u;
+    l_tCtx.tCOREHLCtx.tCORELLCtx.tBuff1.uBufL = 28u;
+    l_tCtx.tCOREHLCtx.tCORELLCtx.tBuff2.uBufL = 28u;
     if( e_eFSS_LOGC_RES_CORRUPTCTX == eFSS_LOGC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uPageUsable) )
     {
         (void)printf("eFSS_LOGCTST_CorruptedCtx 37 -- OK \n");
@@ -2397,9 +2479,9 @@ void eFSS_LOGCTST_CorruptedCtx(void)
     }
 
     /* Function */
-    l_tCtx.tCOREHLCtx.tCORELLCtx.tStorSett.uPagesLen = 31u;
-    l_tCtx.tCOREHLCtx.tCORELLCtx.tBuff1.uBufL = 31u;
-    l_tCtx.tCOREHLCtx.tCORELLCtx.tBuff2.uBufL = 31u;
+    l_tCtx.tCOREHLCtx.tCORELLCtx.tStorSett.uPagesLen = 35u;
+    l_tCtx.tCOREHLCtx.tCORELLCtx.tBuff1.uBufL = 35u;
+    l_tCtx.tCOREHLCtx.tCORELLCtx.tBuff2.uBufL = 35u;
     if( e_eFSS_LOGC_RES_CORRUPTCTX == eFSS_LOGC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uPageUsable) )
     {
         (void)printf("eFSS_LOGCTST_CorruptedCtx 39 -- OK \n");
@@ -2590,7 +2672,7 @@ void eFSS_LOGCTST_CorruptedCtx(void)
 
     /* Function */
     l_tCtx.tCOREHLCtx.tCORELLCtx.tStorSett.uTotPages = 9u;
-    if( e_eFSS_LOGC_RES_CORRUPTCTX == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_CORRUPTCTX == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_CorruptedCtx 57 -- OK \n");
     }
@@ -2611,7 +2693,7 @@ void eFSS_LOGCTST_CorruptedCtx(void)
 
     /* Function */
     l_tCtx.tCOREHLCtx.tCORELLCtx.tStorSett.uTotPages = 9u;
-    if( e_eFSS_LOGC_RES_CORRUPTCTX == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx) )
+    if( e_eFSS_LOGC_RES_CORRUPTCTX == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx, &l_uSeqN) )
     {
         (void)printf("eFSS_LOGCTST_CorruptedCtx 59 -- OK \n");
     }
@@ -2653,7 +2735,7 @@ void eFSS_LOGCTST_CorruptedCtx(void)
 
     /* Function */
     l_tCtx.tCOREHLCtx.tCORELLCtx.tStorSett.uTotPages = 9u;
-    if( e_eFSS_LOGC_RES_CORRUPTCTX == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_CORRUPTCTX == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         (void)printf("eFSS_LOGCTST_CorruptedCtx 63 -- OK \n");
     }
@@ -2679,7 +2761,7 @@ void eFSS_LOGCTST_Basic(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -2697,6 +2779,14 @@ void eFSS_LOGCTST_Basic(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -2710,9 +2800,13 @@ void eFSS_LOGCTST_Basic(void)
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uPageUsable = 0u;
 
     /* Function */
@@ -2809,7 +2903,7 @@ void eFSS_LOGCTST_Basic(void)
     /* Function */
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uPageUsable) )
     {
-        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (28u-20u) == l_ltUseBuff.uBufL ) &&
+        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (36u-28u) == l_ltUseBuff.uBufL ) &&
             ( (14u) == l_uPageUsable ))
         {
             (void)printf("eFSS_LOGCTST_Basic 8  -- OK \n");
@@ -2837,7 +2931,7 @@ void eFSS_LOGCTST_Basic(void)
     /* Function */
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uPageUsable) )
     {
-        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (28u-20u) == l_ltUseBuff.uBufL ) &&
+        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (36u-28u) == l_ltUseBuff.uBufL ) &&
             ( (12u) == l_uPageUsable ))
         {
             (void)printf("eFSS_LOGCTST_Basic 10 -- OK \n");
@@ -2865,7 +2959,7 @@ void eFSS_LOGCTST_Basic(void)
     /* Function */
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uPageUsable) )
     {
-        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (28u-20u) == l_ltUseBuff.uBufL ) &&
+        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (36u-28u) == l_ltUseBuff.uBufL ) &&
             ( (7u) == l_uPageUsable ))
         {
             (void)printf("eFSS_LOGCTST_Basic 12 -- OK \n");
@@ -2893,7 +2987,7 @@ void eFSS_LOGCTST_Basic(void)
     /* Function */
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uPageUsable) )
     {
-        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (28u-20u) == l_ltUseBuff.uBufL ) &&
+        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (36u-28u) == l_ltUseBuff.uBufL ) &&
             ( (6u) == l_uPageUsable ))
         {
             (void)printf("eFSS_LOGCTST_Basic 14 -- OK \n");
@@ -2920,7 +3014,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -2929,6 +3023,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     t_eFSS_LOGC_StorBuf l_ltUseBuff;
     bool_t l_bIsNewest;
     uint32_t l_uPageUsable;
+    uint32_t l_uSeqN;
     uint32_t l_uNewPIx;
     uint32_t l_uFillPIdx;
 
@@ -2941,6 +3036,14 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -2954,9 +3057,13 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_bIsNewest = false;
     l_uPageUsable = 0u;
     l_uNewPIx = 0u;
@@ -2993,7 +3100,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     /* Function */
     if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uPageUsable) )
     {
-        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (32u-24u) == l_ltUseBuff.uBufL ) && ( 12u == l_uPageUsable ) )
+        if( ( l_auStor == l_ltUseBuff.puBuf ) && ( (36u-28u) == l_ltUseBuff.uBufL ) && ( 12u == l_uPageUsable ) )
         {
             (void)printf("eFSS_LOGCTST_BadClBckNRetry 3  -- OK \n");
         }
@@ -3311,7 +3418,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKCRCERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_CLBCKCRCERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         if( ( 0u == l_tCtxErase.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
             ( 0u == l_tCtxWrite.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxWrite.eLastEr ) &&
@@ -3370,7 +3477,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKERASEERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_CLBCKERASEERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         if( ( 1u == l_tCtxCrc32.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 0u == l_tCtxWrite.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxWrite.eLastEr ) &&
@@ -3429,7 +3536,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         if( ( 1u == l_tCtxCrc32.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 3u == l_tCtxErase.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -3498,7 +3605,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         if( ( 1u == l_tCtxCrc32.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 3u == l_tCtxErase.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -3568,7 +3675,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         if( ( 1u == l_tCtxCrc32.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 3u == l_tCtxErase.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -3637,7 +3744,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u) )
+    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, 0u, 0u) )
     {
         if( ( 2u == l_tCtxCrc32.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 4u == l_tCtxErase.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -3707,7 +3814,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKCRCERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx) )
+    if( e_eFSS_LOGC_RES_CLBCKCRCERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx, &l_uSeqN) )
     {
         if( ( 0u == l_tCtxErase.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
             ( 0u == l_tCtxWrite.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxWrite.eLastEr ) &&
@@ -3766,7 +3873,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx) )
+    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx, &l_uSeqN) )
     {
         if( ( 0u == l_tCtxCrc32.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 0u == l_tCtxWrite.uTimeUsed ) && ( e_eFSS_LOGC_RES_OK == l_tCtxWrite.eLastEr ) &&
@@ -3838,7 +3945,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx) )
+    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx, &l_uSeqN) )
     {
         if( ( 0u == l_tCtxCrc32.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 0u == l_tCtxErase.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -3907,7 +4014,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx) )
+    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx, &l_uSeqN) )
     {
         if( ( 1u == l_tCtxCrc32.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 0u == l_tCtxErase.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -3978,48 +4085,48 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
 
     /* Setup storage area */
     (void)memset(m_auStorArea[0u], 0, sizeof(m_auStorArea[0u]));
-    m_auStorArea[0u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA4u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA4u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0x00u;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
-    m_auStorArea[7u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xF5u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xF5u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -4031,7 +4138,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx) )
+    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uFillPIdx, &l_uSeqN) )
     {
         if( ( 3u == l_tCtxCrc32.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 3u == l_tCtxErase.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -4103,48 +4210,48 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
 
     /* Setup storage area */
     (void)memset(m_auStorArea[0u], 0, sizeof(m_auStorArea[0u]));
-    m_auStorArea[0u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA4u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA4u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0x00u;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
-    m_auStorArea[7u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xF5u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xF5u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -4229,48 +4336,48 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
 
     /* Setup storage area */
     (void)memset(m_auStorArea[0u], 0, sizeof(m_auStorArea[0u]));
-    m_auStorArea[0u][12u] = 0x03u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA6u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][16u] = 0x03u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA6u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0x00u;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
-    m_auStorArea[7u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xF5u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xF5u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -4354,48 +4461,48 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
 
     /* Setup storage area */
     (void)memset(m_auStorArea[0u], 0, sizeof(m_auStorArea[0u]));
-    m_auStorArea[0u][12u] = 0x03u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA6u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][16u] = 0x03u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA6u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0x00u;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
-    m_auStorArea[7u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xF5u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xF5u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -4483,52 +4590,60 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     m_auStorArea[0u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[0u][12u] = 0x04u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA6u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0xFFu;  /* CRC */
+    m_auStorArea[0u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][16u] = 0x04u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA6u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0xFFu;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
     m_auStorArea[7u][8u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[7u][12u] = 0x04u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xA6u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x0Au;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][16u] = 0x04u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xA6u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x0Au;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -4615,52 +4730,60 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     m_auStorArea[0u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[0u][12u] = 0x04u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA6u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0xFFu;  /* CRC */
+    m_auStorArea[0u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][16u] = 0x04u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA6u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0xFFu;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
     m_auStorArea[7u][8u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[7u][12u] = 0x04u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xA6u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x0Au;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][16u] = 0x04u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xA6u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x0Au;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -4748,52 +4871,60 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     m_auStorArea[0u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[0u][12u] = 0x03u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA6u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][16u] = 0x03u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA6u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0x00u;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
     m_auStorArea[7u][8u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[7u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xF5u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xF5u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -4805,7 +4936,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0u == l_tCtxCrc32.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 0u == l_tCtxErase.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -4880,52 +5011,60 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     m_auStorArea[0u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[0u][12u] = 0x03u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA6u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][16u] = 0x03u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA6u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0x00u;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
     m_auStorArea[7u][8u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[7u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xF5u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xF5u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -4943,7 +5082,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_auStor[10u] = 0x00u;
     l_auStor[11u] = 0x00u;
 
-    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 2u == l_tCtxCrc32.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 3u == l_tCtxErase.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -5018,52 +5157,60 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     m_auStorArea[0u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[0u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA4u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA4u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0x00u;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
     m_auStorArea[7u][8u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[7u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xF5u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xF5u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -5077,7 +5224,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
 
     (void)memset(l_auStor, 0x00, sizeof(l_auStor));
 
-    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_CLBCKWRITEERR == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 3u == l_tCtxCrc32.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 3u == l_tCtxErase.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -5152,52 +5299,60 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     m_auStorArea[0u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[0u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[0u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[0u][13u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[0u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[0u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[0u][20u] = 0x0Eu;  /* Total page */
-    m_auStorArea[0u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[0u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[0u][28u] = 0xA4u;  /* CRC */
-    m_auStorArea[0u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[0u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[0u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[0u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[0u][17u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[0u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[0u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[0u][24u] = 0x0Eu;  /* Total page */
+    m_auStorArea[0u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[0u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[0u][32u] = 0xA4u;  /* CRC */
+    m_auStorArea[0u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[0u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[0u][35u] = 0x00u;  /* CRC */
 
     (void)memset(m_auStorArea[1u], 0x10, sizeof(m_auStorArea[1u]));
     m_auStorArea[7u][8u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][9u]  = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][10u] = 0x00u;  /* BYTE IN PAGE */
     m_auStorArea[7u][11u] = 0x00u;  /* BYTE IN PAGE */
-    m_auStorArea[7u][12u] = 0x01u;  /* Page SUBTYPE */
-    m_auStorArea[7u][13u] = 0x07u;  /* Page index */
-    m_auStorArea[7u][14u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][15u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][16u] = 0x00u;  /* Page index */
-    m_auStorArea[7u][17u] = 0x02u;  /* Page type */
-    m_auStorArea[7u][18u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][19u] = 0x00u;  /* Page version */
-    m_auStorArea[7u][20u] = 0x0eu;  /* Total page */
-    m_auStorArea[7u][21u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][22u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][23u] = 0x00u;  /* Total page */
-    m_auStorArea[7u][24u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][25u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][26u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][27u] = 0xA5u;  /* Magic number */
-    m_auStorArea[7u][28u] = 0xF5u;  /* CRC */
-    m_auStorArea[7u][29u] = 0x02u;  /* CRC */
-    m_auStorArea[7u][30u] = 0x00u;  /* CRC */
-    m_auStorArea[7u][31u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][12u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][13u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][14u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][15u] = 0x00u;  /* PAGE SEQ NUMBER */
+    m_auStorArea[7u][16u] = 0x01u;  /* Page SUBTYPE */
+    m_auStorArea[7u][17u] = 0x07u;  /* Page index */
+    m_auStorArea[7u][18u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][19u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][20u] = 0x00u;  /* Page index */
+    m_auStorArea[7u][21u] = 0x02u;  /* Page type */
+    m_auStorArea[7u][22u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][23u] = 0x00u;  /* Page version */
+    m_auStorArea[7u][24u] = 0x0eu;  /* Total page */
+    m_auStorArea[7u][25u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][26u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][27u] = 0x00u;  /* Total page */
+    m_auStorArea[7u][28u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][29u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][30u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][31u] = 0xA5u;  /* Magic number */
+    m_auStorArea[7u][32u] = 0xF5u;  /* CRC */
+    m_auStorArea[7u][33u] = 0x02u;  /* CRC */
+    m_auStorArea[7u][34u] = 0x00u;  /* CRC */
+    m_auStorArea[7u][35u] = 0x00u;  /* CRC */
 
     /* Test FLUSH */
     l_tCtxErase.uTimeUsed = 0u;
@@ -5209,7 +5364,7 @@ void eFSS_LOGCTST_BadClBckNRetry(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
 
-    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_CLBCKREADERR == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 0u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 1u == l_tCtxCrc32.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxCrc32.eLastEr ) &&
             ( 0u == l_tCtxErase.uTimeUsed ) &&  ( e_eFSS_LOGC_RES_OK == l_tCtxErase.eLastEr ) &&
@@ -5241,7 +5396,7 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -5261,12 +5416,24 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uPageUsable = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -5306,7 +5473,7 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* --------------------------------------------- All OK no backup generation */
     /* Setup storage area */
@@ -5323,26 +5490,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x01u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xBFu; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x01u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xBFu; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x00u; /* New index */
@@ -5357,26 +5528,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x08u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xC1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x08u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xC1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -5489,7 +5664,7 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* --------------------------------------------- All OK no backup generation */
     /* Setup storage area */
@@ -5506,26 +5681,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x01u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xBFu; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x01u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xBFu; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x00u; /* New index */
@@ -5540,26 +5719,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x08u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xC3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x08u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xC3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -5672,7 +5855,7 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* --------------------------------------------- All OK no backup generation */
     /* Setup storage area */
@@ -5689,26 +5872,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x01u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xBCu; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x01u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xBCu; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x00u; /* New index */
@@ -5723,26 +5910,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x08u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xC1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x08u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xC1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -5834,26 +6025,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x01u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xC0u; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x01u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xC0u; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x00u; /* New index */
@@ -5868,26 +6063,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x08u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xC1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x08u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xC1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -5978,26 +6177,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x01u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xBEu; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x01u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xBEu; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x00u; /* New index */
@@ -6012,26 +6215,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x08u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xC1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x08u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xC1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -6122,26 +6329,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x01u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xCBu; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x01u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xCBu; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x0Cu; /* New index */
@@ -6156,26 +6367,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x08u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCDu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x08u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCDu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -6266,26 +6481,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x01u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xC9u; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x01u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xC9u; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x00u; /* New index */
@@ -6300,26 +6519,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x08u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCBu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x08u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCBu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -6410,26 +6633,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x01u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xBEu; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x01u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xBEu; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x00u; /* New index */
@@ -6444,26 +6671,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBEu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBEu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -6554,26 +6785,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[12u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[12u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[12u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[12u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[12u][13u] = 0x0Cu; /* Page index */
-    m_auStorArea[12u][14u] = 0x00u; /* Page index */
-    m_auStorArea[12u][15u] = 0x00u; /* Page index */
-    m_auStorArea[12u][16u] = 0x00u; /* Page index */
-    m_auStorArea[12u][17u] = 0x02u; /* Page type */
-    m_auStorArea[12u][18u] = 0x02u; /* Page version */
-    m_auStorArea[12u][19u] = 0x00u; /* Page version */
-    m_auStorArea[12u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[12u][21u] = 0x00u; /* Total page */
-    m_auStorArea[12u][22u] = 0x00u; /* Total page */
-    m_auStorArea[12u][23u] = 0x00u; /* Total page */
-    m_auStorArea[12u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[12u][28u] = 0xC0u; /* CRC */
-    m_auStorArea[12u][29u] = 0x02u; /* CRC */
-    m_auStorArea[12u][30u] = 0x00u; /* CRC */
-    m_auStorArea[12u][31u] = 0x00u; /* CRC */
+    m_auStorArea[12u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[12u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[12u][17u] = 0x0Cu; /* Page index */
+    m_auStorArea[12u][18u] = 0x00u; /* Page index */
+    m_auStorArea[12u][19u] = 0x00u; /* Page index */
+    m_auStorArea[12u][20u] = 0x00u; /* Page index */
+    m_auStorArea[12u][21u] = 0x02u; /* Page type */
+    m_auStorArea[12u][22u] = 0x02u; /* Page version */
+    m_auStorArea[12u][23u] = 0x00u; /* Page version */
+    m_auStorArea[12u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[12u][25u] = 0x00u; /* Total page */
+    m_auStorArea[12u][26u] = 0x00u; /* Total page */
+    m_auStorArea[12u][27u] = 0x00u; /* Total page */
+    m_auStorArea[12u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[12u][32u] = 0xC0u; /* CRC */
+    m_auStorArea[12u][33u] = 0x02u; /* CRC */
+    m_auStorArea[12u][34u] = 0x00u; /* CRC */
+    m_auStorArea[12u][35u] = 0x00u; /* CRC */
 
     (void)memset(m_auStorArea[13u], 0, sizeof(m_auStorArea[13u]));
     m_auStorArea[13u][0u]  = 0x00u; /* New index */
@@ -6588,26 +6823,30 @@ static void eFSS_LOGCTST_ReadCacheTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x08u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x02u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xC2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x08u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x02u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xC2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u; /* New index */
@@ -6702,7 +6941,7 @@ static void eFSS_LOGCTST_WriteCacheTest(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -6720,12 +6959,24 @@ static void eFSS_LOGCTST_WriteCacheTest(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uPageUsable = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -6765,7 +7016,7 @@ static void eFSS_LOGCTST_WriteCacheTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* Setup storage area */
     (void)memset(m_auStorArea[12u], 0, sizeof(m_auStorArea[12u]));
@@ -6783,19 +7034,19 @@ static void eFSS_LOGCTST_WriteCacheTest(void)
             if( ( m_auStorArea[12u][0u]  == 0x00u ) && ( m_auStorArea[12u][1u]  == 0x00u ) && ( m_auStorArea[12u][2u]  == 0x00u ) && ( m_auStorArea[12u][3u]  == 0x00u ) &&
                 ( m_auStorArea[12u][4u]  == 0x00u ) && ( m_auStorArea[12u][5u]  == 0x00u ) && ( m_auStorArea[12u][6u]  == 0x00u ) && ( m_auStorArea[12u][7u]  == 0x00u ) &&
                 ( m_auStorArea[12u][8u]  == 0x08u ) && ( m_auStorArea[12u][9u]  == 0x00u ) && ( m_auStorArea[12u][10u] == 0x00u ) && ( m_auStorArea[12u][11u] == 0x00u ) &&
-                ( m_auStorArea[12u][12u] == 0x07u ) && ( m_auStorArea[12u][13u] == 0x0Cu ) && ( m_auStorArea[12u][14u] == 0x00u ) && ( m_auStorArea[12u][15u] == 0x00u ) &&
-                ( m_auStorArea[12u][16u] == 0x00u ) && ( m_auStorArea[12u][17u] == 0x02u ) && ( m_auStorArea[12u][18u] == 0x01u ) && ( m_auStorArea[12u][19u] == 0x00u ) &&
-                ( m_auStorArea[12u][20u] == 0x0Eu ) && ( m_auStorArea[12u][21u] == 0x00u ) && ( m_auStorArea[12u][22u] == 0x00u ) && ( m_auStorArea[12u][23u] == 0x00u ) &&
-                ( m_auStorArea[12u][24u] == 0xA5u ) && ( m_auStorArea[12u][25u] == 0xA5u ) && ( m_auStorArea[12u][26u] == 0xA5u ) && ( m_auStorArea[12u][27u] == 0xA5u ) &&
-                ( m_auStorArea[12u][28u] == 0xBFu ) && ( m_auStorArea[12u][29u] == 0x02u ) && ( m_auStorArea[12u][30u] == 0x00u ) && ( m_auStorArea[12u][31u] == 0x00u ) &&
+                ( m_auStorArea[12u][16u] == 0x07u ) && ( m_auStorArea[12u][17u] == 0x0Cu ) && ( m_auStorArea[12u][18u] == 0x00u ) && ( m_auStorArea[12u][19u] == 0x00u ) &&
+                ( m_auStorArea[12u][20u] == 0x00u ) && ( m_auStorArea[12u][21u] == 0x02u ) && ( m_auStorArea[12u][22u] == 0x01u ) && ( m_auStorArea[12u][23u] == 0x00u ) &&
+                ( m_auStorArea[12u][24u] == 0x0Eu ) && ( m_auStorArea[12u][25u] == 0x00u ) && ( m_auStorArea[12u][26u] == 0x00u ) && ( m_auStorArea[12u][27u] == 0x00u ) &&
+                ( m_auStorArea[12u][28u] == 0xA5u ) && ( m_auStorArea[12u][29u] == 0xA5u ) && ( m_auStorArea[12u][30u] == 0xA5u ) && ( m_auStorArea[12u][31u] == 0xA5u ) &&
+                ( m_auStorArea[12u][32u] == 0xBFu ) && ( m_auStorArea[12u][33u] == 0x02u ) && ( m_auStorArea[12u][34u] == 0x00u ) && ( m_auStorArea[12u][35u] == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x08u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x08u ) && ( m_auStorArea[13u][13u] == 0x0Du ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
-                ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x02u ) && ( m_auStorArea[13u][18u] == 0x01u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
-                ( m_auStorArea[13u][20u] == 0x0Eu ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
-                ( m_auStorArea[13u][24u] == 0xA5u ) && ( m_auStorArea[13u][25u] == 0xA5u ) && ( m_auStorArea[13u][26u] == 0xA5u ) && ( m_auStorArea[13u][27u] == 0xA5u ) &&
-                ( m_auStorArea[13u][28u] == 0xC1u ) && ( m_auStorArea[13u][29u] == 0x02u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][16u] == 0x08u ) && ( m_auStorArea[13u][17u] == 0x0Du ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
+                ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x02u ) && ( m_auStorArea[13u][22u] == 0x01u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
+                ( m_auStorArea[13u][24u] == 0x0Eu ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
+                ( m_auStorArea[13u][28u] == 0xA5u ) && ( m_auStorArea[13u][29u] == 0xA5u ) && ( m_auStorArea[13u][30u] == 0xA5u ) && ( m_auStorArea[13u][31u] == 0xA5u ) &&
+                ( m_auStorArea[13u][32u] == 0xC1u ) && ( m_auStorArea[13u][33u] == 0x02u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_WriteCacheTest 3  -- OK \n");
               }
@@ -6830,19 +7081,19 @@ static void eFSS_LOGCTST_WriteCacheTest(void)
             if( ( m_auStorArea[12u][0u]  == 0x00u ) && ( m_auStorArea[12u][1u]  == 0x00u ) && ( m_auStorArea[12u][2u]  == 0x00u ) && ( m_auStorArea[12u][3u]  == 0x00u ) &&
                 ( m_auStorArea[12u][4u]  == 0x00u ) && ( m_auStorArea[12u][5u]  == 0x00u ) && ( m_auStorArea[12u][6u]  == 0x00u ) && ( m_auStorArea[12u][7u]  == 0x00u ) &&
                 ( m_auStorArea[12u][8u]  == 0x00u ) && ( m_auStorArea[12u][9u]  == 0x00u ) && ( m_auStorArea[12u][10u] == 0x00u ) && ( m_auStorArea[12u][11u] == 0x00u ) &&
-                ( m_auStorArea[12u][12u] == 0x00u ) && ( m_auStorArea[12u][13u] == 0x00u ) && ( m_auStorArea[12u][14u] == 0x00u ) && ( m_auStorArea[12u][15u] == 0x00u ) &&
                 ( m_auStorArea[12u][16u] == 0x00u ) && ( m_auStorArea[12u][17u] == 0x00u ) && ( m_auStorArea[12u][18u] == 0x00u ) && ( m_auStorArea[12u][19u] == 0x00u ) &&
                 ( m_auStorArea[12u][20u] == 0x00u ) && ( m_auStorArea[12u][21u] == 0x00u ) && ( m_auStorArea[12u][22u] == 0x00u ) && ( m_auStorArea[12u][23u] == 0x00u ) &&
                 ( m_auStorArea[12u][24u] == 0x00u ) && ( m_auStorArea[12u][25u] == 0x00u ) && ( m_auStorArea[12u][26u] == 0x00u ) && ( m_auStorArea[12u][27u] == 0x00u ) &&
                 ( m_auStorArea[12u][28u] == 0x00u ) && ( m_auStorArea[12u][29u] == 0x00u ) && ( m_auStorArea[12u][30u] == 0x00u ) && ( m_auStorArea[12u][31u] == 0x00u ) &&
+                ( m_auStorArea[12u][32u] == 0x00u ) && ( m_auStorArea[12u][33u] == 0x00u ) && ( m_auStorArea[12u][34u] == 0x00u ) && ( m_auStorArea[12u][35u] == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x00u ) && ( m_auStorArea[13u][13u] == 0x00u ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
                 ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x00u ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
                 ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
                 ( m_auStorArea[13u][24u] == 0x00u ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
-                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) &&
+                ( m_auStorArea[13u][32u] == 0x00u ) && ( m_auStorArea[13u][33u] == 0x00u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_WriteCacheTest 4  -- OK \n");
               }
@@ -6877,19 +7128,19 @@ static void eFSS_LOGCTST_WriteCacheTest(void)
             if( ( m_auStorArea[12u][0u]  == 0x00u ) && ( m_auStorArea[12u][1u]  == 0x00u ) && ( m_auStorArea[12u][2u]  == 0x00u ) && ( m_auStorArea[12u][3u]  == 0x00u ) &&
                 ( m_auStorArea[12u][4u]  == 0x00u ) && ( m_auStorArea[12u][5u]  == 0x00u ) && ( m_auStorArea[12u][6u]  == 0x00u ) && ( m_auStorArea[12u][7u]  == 0x00u ) &&
                 ( m_auStorArea[12u][8u]  == 0x00u ) && ( m_auStorArea[12u][9u]  == 0x00u ) && ( m_auStorArea[12u][10u] == 0x00u ) && ( m_auStorArea[12u][11u] == 0x00u ) &&
-                ( m_auStorArea[12u][12u] == 0x00u ) && ( m_auStorArea[12u][13u] == 0x00u ) && ( m_auStorArea[12u][14u] == 0x00u ) && ( m_auStorArea[12u][15u] == 0x00u ) &&
                 ( m_auStorArea[12u][16u] == 0x00u ) && ( m_auStorArea[12u][17u] == 0x00u ) && ( m_auStorArea[12u][18u] == 0x00u ) && ( m_auStorArea[12u][19u] == 0x00u ) &&
                 ( m_auStorArea[12u][20u] == 0x00u ) && ( m_auStorArea[12u][21u] == 0x00u ) && ( m_auStorArea[12u][22u] == 0x00u ) && ( m_auStorArea[12u][23u] == 0x00u ) &&
                 ( m_auStorArea[12u][24u] == 0x00u ) && ( m_auStorArea[12u][25u] == 0x00u ) && ( m_auStorArea[12u][26u] == 0x00u ) && ( m_auStorArea[12u][27u] == 0x00u ) &&
                 ( m_auStorArea[12u][28u] == 0x00u ) && ( m_auStorArea[12u][29u] == 0x00u ) && ( m_auStorArea[12u][30u] == 0x00u ) && ( m_auStorArea[12u][31u] == 0x00u ) &&
+                ( m_auStorArea[12u][32u] == 0x00u ) && ( m_auStorArea[12u][33u] == 0x00u ) && ( m_auStorArea[12u][34u] == 0x00u ) && ( m_auStorArea[12u][35u] == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x00u ) && ( m_auStorArea[13u][13u] == 0x00u ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
                 ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x00u ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
                 ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
                 ( m_auStorArea[13u][24u] == 0x00u ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
-                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) &&
+                ( m_auStorArea[13u][32u] == 0x00u ) && ( m_auStorArea[13u][33u] == 0x00u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_WriteCacheTest 5  -- OK \n");
               }
@@ -6924,19 +7175,19 @@ static void eFSS_LOGCTST_WriteCacheTest(void)
             if( ( m_auStorArea[12u][0u]  == 0x01u ) && ( m_auStorArea[12u][1u]  == 0x00u ) && ( m_auStorArea[12u][2u]  == 0x00u ) && ( m_auStorArea[12u][3u]  == 0x00u ) &&
                 ( m_auStorArea[12u][4u]  == 0x02u ) && ( m_auStorArea[12u][5u]  == 0x00u ) && ( m_auStorArea[12u][6u]  == 0x00u ) && ( m_auStorArea[12u][7u]  == 0x00u ) &&
                 ( m_auStorArea[12u][8u]  == 0x08u ) && ( m_auStorArea[12u][9u]  == 0x00u ) && ( m_auStorArea[12u][10u] == 0x00u ) && ( m_auStorArea[12u][11u] == 0x00u ) &&
-                ( m_auStorArea[12u][12u] == 0x07u ) && ( m_auStorArea[12u][13u] == 0x0Cu ) && ( m_auStorArea[12u][14u] == 0x00u ) && ( m_auStorArea[12u][15u] == 0x00u ) &&
-                ( m_auStorArea[12u][16u] == 0x00u ) && ( m_auStorArea[12u][17u] == 0x02u ) && ( m_auStorArea[12u][18u] == 0x01u ) && ( m_auStorArea[12u][19u] == 0x00u ) &&
-                ( m_auStorArea[12u][20u] == 0x0Eu ) && ( m_auStorArea[12u][21u] == 0x00u ) && ( m_auStorArea[12u][22u] == 0x00u ) && ( m_auStorArea[12u][23u] == 0x00u ) &&
-                ( m_auStorArea[12u][24u] == 0xA5u ) && ( m_auStorArea[12u][25u] == 0xA5u ) && ( m_auStorArea[12u][26u] == 0xA5u ) && ( m_auStorArea[12u][27u] == 0xA5u ) &&
-                ( m_auStorArea[12u][28u] == 0xC2u ) && ( m_auStorArea[12u][29u] == 0x02u ) && ( m_auStorArea[12u][30u] == 0x00u ) && ( m_auStorArea[12u][31u] == 0x00u ) &&
+                ( m_auStorArea[12u][16u] == 0x07u ) && ( m_auStorArea[12u][17u] == 0x0Cu ) && ( m_auStorArea[12u][18u] == 0x00u ) && ( m_auStorArea[12u][19u] == 0x00u ) &&
+                ( m_auStorArea[12u][20u] == 0x00u ) && ( m_auStorArea[12u][21u] == 0x02u ) && ( m_auStorArea[12u][22u] == 0x01u ) && ( m_auStorArea[12u][23u] == 0x00u ) &&
+                ( m_auStorArea[12u][24u] == 0x0Eu ) && ( m_auStorArea[12u][25u] == 0x00u ) && ( m_auStorArea[12u][26u] == 0x00u ) && ( m_auStorArea[12u][27u] == 0x00u ) &&
+                ( m_auStorArea[12u][28u] == 0xA5u ) && ( m_auStorArea[12u][29u] == 0xA5u ) && ( m_auStorArea[12u][30u] == 0xA5u ) && ( m_auStorArea[12u][31u] == 0xA5u ) &&
+                ( m_auStorArea[12u][32u] == 0xC2u ) && ( m_auStorArea[12u][33u] == 0x02u ) && ( m_auStorArea[12u][34u] == 0x00u ) && ( m_auStorArea[12u][35u] == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x01u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x02u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x08u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x08u ) && ( m_auStorArea[13u][13u] == 0x0Du ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
-                ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x02u ) && ( m_auStorArea[13u][18u] == 0x01u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
-                ( m_auStorArea[13u][20u] == 0x0Eu ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
-                ( m_auStorArea[13u][24u] == 0xA5u ) && ( m_auStorArea[13u][25u] == 0xA5u ) && ( m_auStorArea[13u][26u] == 0xA5u ) && ( m_auStorArea[13u][27u] == 0xA5u ) &&
-                ( m_auStorArea[13u][28u] == 0xC4u ) && ( m_auStorArea[13u][29u] == 0x02u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][16u] == 0x08u ) && ( m_auStorArea[13u][17u] == 0x0Du ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
+                ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x02u ) && ( m_auStorArea[13u][22u] == 0x01u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
+                ( m_auStorArea[13u][24u] == 0x0Eu ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
+                ( m_auStorArea[13u][28u] == 0xA5u ) && ( m_auStorArea[13u][29u] == 0xA5u ) && ( m_auStorArea[13u][30u] == 0xA5u ) && ( m_auStorArea[13u][31u] == 0xA5u ) &&
+                ( m_auStorArea[13u][32u] == 0xC4u ) && ( m_auStorArea[13u][33u] == 0x02u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_WriteCacheTest 6  -- OK \n");
               }
@@ -6974,13 +7225,14 @@ static void eFSS_LOGCTST_LoadTest(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
 	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
     t_eFSS_LOGC_StorBuf l_ltUseBuff;
     uint32_t l_uByteInPage;
+    uint32_t l_uSeqN;
     uint32_t l_uPageUsable;
 
     /* Init callback var */
@@ -6992,12 +7244,24 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uPageUsable = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -7052,26 +7316,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBAu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBAu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7084,7 +7352,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7103,7 +7371,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7122,7 +7390,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7155,26 +7423,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBAu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBAu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7187,7 +7459,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0xFFu == l_ltUseBuff.puBuf[0u] ) && ( 0xFFu == l_ltUseBuff.puBuf[1u] ) && ( 0xFFu == l_ltUseBuff.puBuf[2u] ) && ( 0xFFu == l_ltUseBuff.puBuf[3u] ) &&
@@ -7206,7 +7478,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0xFFu == l_ltUseBuff.puBuf[0u] ) && ( 0xFFu == l_ltUseBuff.puBuf[1u] ) && ( 0xFFu == l_ltUseBuff.puBuf[2u] ) && ( 0xFFu == l_ltUseBuff.puBuf[3u] ) &&
@@ -7225,7 +7497,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0xFFu == l_ltUseBuff.puBuf[0u] ) && ( 0xFFu == l_ltUseBuff.puBuf[1u] ) && ( 0xFFu == l_ltUseBuff.puBuf[2u] ) && ( 0xFFu == l_ltUseBuff.puBuf[3u] ) &&
@@ -7258,26 +7530,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBBu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBBu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7290,7 +7566,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x09u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7309,7 +7585,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7328,7 +7604,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7361,26 +7637,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBDu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBDu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7393,7 +7673,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7412,7 +7692,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7431,7 +7711,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7464,26 +7744,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7496,7 +7780,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7515,7 +7799,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7534,7 +7818,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7567,26 +7851,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBEu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBEu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7599,7 +7887,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7618,7 +7906,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7637,7 +7925,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7670,26 +7958,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Eu; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBEu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Eu; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBEu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7702,7 +7994,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7721,7 +8013,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7740,7 +8032,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7773,26 +8065,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x02u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBBu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x02u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBBu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7805,7 +8101,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NEWVERSIONFOUND == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NEWVERSIONFOUND == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7824,7 +8120,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NEWVERSIONFOUND == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NEWVERSIONFOUND == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7843,7 +8139,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NEWVERSIONFOUND == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NEWVERSIONFOUND == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 13u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7900,26 +8196,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xB3u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xB3u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x00u; /* User data */
     m_auStorArea[13u][1u]  = 0x00u; /* User data */
@@ -7933,26 +8233,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBBu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBBu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -7965,7 +8269,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -7984,7 +8288,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8003,7 +8307,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8037,26 +8341,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xB3u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xB3u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x00u; /* User data */
     m_auStorArea[13u][1u]  = 0x00u; /* User data */
@@ -8070,26 +8378,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x07u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xC0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x07u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xC0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -8102,7 +8414,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8121,7 +8433,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8140,7 +8452,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8175,26 +8487,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x07u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xB4u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x07u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xB4u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x00u; /* User data */
     m_auStorArea[13u][1u]  = 0x00u; /* User data */
@@ -8208,26 +8524,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBBu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBBu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -8240,7 +8560,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8259,7 +8579,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8278,7 +8598,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8297,7 +8617,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8332,26 +8652,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][35u] = 0xCCu; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x00u; /* User data */
     m_auStorArea[13u][1u]  = 0x00u; /* User data */
@@ -8365,26 +8689,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -8397,7 +8725,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8416,7 +8744,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8435,7 +8763,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8470,26 +8798,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xB4u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xB4u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x00u; /* User data */
     m_auStorArea[13u][1u]  = 0x00u; /* User data */
@@ -8503,26 +8835,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBBu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBBu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -8535,7 +8871,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x09u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8554,7 +8890,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8573,7 +8909,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8607,26 +8943,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xB5u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xB5u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x00u; /* User data */
     m_auStorArea[13u][1u]  = 0x00u; /* User data */
@@ -8640,26 +8980,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBDu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBDu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -8672,7 +9016,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8691,7 +9035,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8710,7 +9054,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8744,26 +9088,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xB7u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xB7u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x00u; /* User data */
     m_auStorArea[13u][1u]  = 0x00u; /* User data */
@@ -8777,26 +9125,30 @@ static void eFSS_LOGCTST_LoadTest(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xBFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xBFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -8809,7 +9161,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8828,7 +9180,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x00u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8847,7 +9199,7 @@ static void eFSS_LOGCTST_LoadTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, &l_uByteInPage, &l_uSeqN) )
     {
         if( ( 0x08u == l_uByteInPage ) &&
             ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] ) && ( 0x00u == l_ltUseBuff.puBuf[2u] ) && ( 0x00u == l_ltUseBuff.puBuf[3u] ) &&
@@ -8882,7 +9234,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -8900,12 +9252,24 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uPageUsable = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -8947,7 +9311,7 @@ static void eFSS_LOGCTST_FlushTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* Setup storage area */
     (void)memset(m_auStorArea[6u], 0, sizeof(m_auStorArea[6u]));
@@ -8963,7 +9327,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 0u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 0u, 0u) )
     {
         if( ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] )  && ( 0x00u == l_ltUseBuff.puBuf[2u] ) &&
             ( 0x00u == l_ltUseBuff.puBuf[3u] ) && ( 0x00u == l_ltUseBuff.puBuf[4u] )  && ( 0x00u == l_ltUseBuff.puBuf[5u] ) &&
@@ -8973,19 +9337,19 @@ static void eFSS_LOGCTST_FlushTest(void)
             if( ( m_auStorArea[6u][0u]   == 0x00u ) && ( m_auStorArea[6u][1u]   == 0x00u ) && ( m_auStorArea[6u][2u]   == 0x00u ) && ( m_auStorArea[6u][3u]   == 0x00u ) &&
                 ( m_auStorArea[6u][4u]   == 0x00u ) && ( m_auStorArea[6u][5u]   == 0x00u ) && ( m_auStorArea[6u][6u]   == 0x00u ) && ( m_auStorArea[6u][7u]   == 0x00u ) &&
                 ( m_auStorArea[6u][8u]   == 0x00u ) && ( m_auStorArea[6u][9u]   == 0x00u ) && ( m_auStorArea[6u][10u]  == 0x00u ) && ( m_auStorArea[6u][11u]  == 0x00u ) &&
-                ( m_auStorArea[6u][12u]  == 0x01u ) && ( m_auStorArea[6u][13u]  == 0x06u ) && ( m_auStorArea[6u][14u]  == 0x00u ) && ( m_auStorArea[6u][15u]  == 0x00u ) &&
-                ( m_auStorArea[6u][16u]  == 0x00u ) && ( m_auStorArea[6u][17u]  == 0x02u ) && ( m_auStorArea[6u][18u]  == 0x01u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
-                ( m_auStorArea[6u][20u]  == 0x0Eu ) && ( m_auStorArea[6u][21u]  == 0x00u ) && ( m_auStorArea[6u][22u]  == 0x00u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
-                ( m_auStorArea[6u][24u]  == 0xA5u ) && ( m_auStorArea[6u][25u]  == 0xA5u ) && ( m_auStorArea[6u][26u]  == 0xA5u ) && ( m_auStorArea[6u][27u]  == 0xA5u ) &&
-                ( m_auStorArea[6u][28u]  == 0xABu ) && ( m_auStorArea[6u][29u]  == 0x02u ) && ( m_auStorArea[6u][30u]  == 0x00u ) && ( m_auStorArea[6u][31u]  == 0x00u ) &&
+                ( m_auStorArea[6u][16u]  == 0x01u ) && ( m_auStorArea[6u][17u]  == 0x06u ) && ( m_auStorArea[6u][18u]  == 0x00u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
+                ( m_auStorArea[6u][20u]  == 0x00u ) && ( m_auStorArea[6u][21u]  == 0x02u ) && ( m_auStorArea[6u][22u]  == 0x01u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
+                ( m_auStorArea[6u][24u]  == 0x0Eu ) && ( m_auStorArea[6u][25u]  == 0x00u ) && ( m_auStorArea[6u][26u]  == 0x00u ) && ( m_auStorArea[6u][27u]  == 0x00u ) &&
+                ( m_auStorArea[6u][28u]  == 0xA5u ) && ( m_auStorArea[6u][29u]  == 0xA5u ) && ( m_auStorArea[6u][30u]  == 0xA5u ) && ( m_auStorArea[6u][31u]  == 0xA5u ) &&
+                ( m_auStorArea[6u][32u]  == 0xABu ) && ( m_auStorArea[6u][33u]  == 0x02u ) && ( m_auStorArea[6u][34u]  == 0x00u ) && ( m_auStorArea[6u][35u]  == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x02u ) && ( m_auStorArea[13u][13u] == 0x0Du ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
-                ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x02u ) && ( m_auStorArea[13u][18u] == 0x01u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
-                ( m_auStorArea[13u][20u] == 0x0Eu ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
-                ( m_auStorArea[13u][24u] == 0xA5u ) && ( m_auStorArea[13u][25u] == 0xA5u ) && ( m_auStorArea[13u][26u] == 0xA5u ) && ( m_auStorArea[13u][27u] == 0xA5u ) &&
-                ( m_auStorArea[13u][28u] == 0xB3u ) && ( m_auStorArea[13u][29u] == 0x02u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][16u] == 0x02u ) && ( m_auStorArea[13u][17u] == 0x0Du ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
+                ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x02u ) && ( m_auStorArea[13u][22u] == 0x01u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
+                ( m_auStorArea[13u][24u] == 0x0Eu ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
+                ( m_auStorArea[13u][28u] == 0xA5u ) && ( m_auStorArea[13u][29u] == 0xA5u ) && ( m_auStorArea[13u][30u] == 0xA5u ) && ( m_auStorArea[13u][31u] == 0xA5u ) &&
+                ( m_auStorArea[13u][32u] == 0xB3u ) && ( m_auStorArea[13u][33u] == 0x02u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_FlushTest 3  -- OK \n");
               }
@@ -9006,7 +9370,7 @@ static void eFSS_LOGCTST_FlushTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* Setup storage area */
     (void)memset(m_auStorArea[6u], 0, sizeof(m_auStorArea[6u]));
@@ -9022,7 +9386,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, 0u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, 0u, 0u) )
     {
         if( ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] )  && ( 0x00u == l_ltUseBuff.puBuf[2u] ) &&
             ( 0x00u == l_ltUseBuff.puBuf[3u] ) && ( 0x00u == l_ltUseBuff.puBuf[4u] )  && ( 0x00u == l_ltUseBuff.puBuf[5u] ) &&
@@ -9032,19 +9396,19 @@ static void eFSS_LOGCTST_FlushTest(void)
             if( ( m_auStorArea[6u][0u]   == 0x00u ) && ( m_auStorArea[6u][1u]   == 0x00u ) && ( m_auStorArea[6u][2u]   == 0x00u ) && ( m_auStorArea[6u][3u]   == 0x00u ) &&
                 ( m_auStorArea[6u][4u]   == 0x00u ) && ( m_auStorArea[6u][5u]   == 0x00u ) && ( m_auStorArea[6u][6u]   == 0x00u ) && ( m_auStorArea[6u][7u]   == 0x00u ) &&
                 ( m_auStorArea[6u][8u]   == 0x00u ) && ( m_auStorArea[6u][9u]   == 0x00u ) && ( m_auStorArea[6u][10u]  == 0x00u ) && ( m_auStorArea[6u][11u]  == 0x00u ) &&
-                ( m_auStorArea[6u][12u]  == 0x03u ) && ( m_auStorArea[6u][13u]  == 0x06u ) && ( m_auStorArea[6u][14u]  == 0x00u ) && ( m_auStorArea[6u][15u]  == 0x00u ) &&
-                ( m_auStorArea[6u][16u]  == 0x00u ) && ( m_auStorArea[6u][17u]  == 0x02u ) && ( m_auStorArea[6u][18u]  == 0x01u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
-                ( m_auStorArea[6u][20u]  == 0x0Eu ) && ( m_auStorArea[6u][21u]  == 0x00u ) && ( m_auStorArea[6u][22u]  == 0x00u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
-                ( m_auStorArea[6u][24u]  == 0xA5u ) && ( m_auStorArea[6u][25u]  == 0xA5u ) && ( m_auStorArea[6u][26u]  == 0xA5u ) && ( m_auStorArea[6u][27u]  == 0xA5u ) &&
-                ( m_auStorArea[6u][28u]  == 0xADu ) && ( m_auStorArea[6u][29u]  == 0x02u ) && ( m_auStorArea[6u][30u]  == 0x00u ) && ( m_auStorArea[6u][31u]  == 0x00u ) &&
+                ( m_auStorArea[6u][16u]  == 0x03u ) && ( m_auStorArea[6u][17u]  == 0x06u ) && ( m_auStorArea[6u][18u]  == 0x00u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
+                ( m_auStorArea[6u][20u]  == 0x00u ) && ( m_auStorArea[6u][21u]  == 0x02u ) && ( m_auStorArea[6u][22u]  == 0x01u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
+                ( m_auStorArea[6u][24u]  == 0x0Eu ) && ( m_auStorArea[6u][25u]  == 0x00u ) && ( m_auStorArea[6u][26u]  == 0x00u ) && ( m_auStorArea[6u][27u]  == 0x00u ) &&
+                ( m_auStorArea[6u][28u]  == 0xA5u ) && ( m_auStorArea[6u][29u]  == 0xA5u ) && ( m_auStorArea[6u][30u]  == 0xA5u ) && ( m_auStorArea[6u][31u]  == 0xA5u ) &&
+                ( m_auStorArea[6u][32u]  == 0xADu ) && ( m_auStorArea[6u][33u]  == 0x02u ) && ( m_auStorArea[6u][34u]  == 0x00u ) && ( m_auStorArea[6u][35u]  == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x04u ) && ( m_auStorArea[13u][13u] == 0x0Du ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
-                ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x02u ) && ( m_auStorArea[13u][18u] == 0x01u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
-                ( m_auStorArea[13u][20u] == 0x0Eu ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
-                ( m_auStorArea[13u][24u] == 0xA5u ) && ( m_auStorArea[13u][25u] == 0xA5u ) && ( m_auStorArea[13u][26u] == 0xA5u ) && ( m_auStorArea[13u][27u] == 0xA5u ) &&
-                ( m_auStorArea[13u][28u] == 0xB5u ) && ( m_auStorArea[13u][29u] == 0x02u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][16u] == 0x04u ) && ( m_auStorArea[13u][17u] == 0x0Du ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
+                ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x02u ) && ( m_auStorArea[13u][22u] == 0x01u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
+                ( m_auStorArea[13u][24u] == 0x0Eu ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
+                ( m_auStorArea[13u][28u] == 0xA5u ) && ( m_auStorArea[13u][29u] == 0xA5u ) && ( m_auStorArea[13u][30u] == 0xA5u ) && ( m_auStorArea[13u][31u] == 0xA5u ) &&
+                ( m_auStorArea[13u][32u] == 0xB5u ) && ( m_auStorArea[13u][33u] == 0x02u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_FlushTest 4  -- OK \n");
               }
@@ -9065,7 +9429,7 @@ static void eFSS_LOGCTST_FlushTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* Setup storage area */
     (void)memset(m_auStorArea[6u], 0, sizeof(m_auStorArea[6u]));
@@ -9081,7 +9445,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, 0u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, 0u, 0u) )
     {
         if( ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] )  && ( 0x00u == l_ltUseBuff.puBuf[2u] ) &&
             ( 0x00u == l_ltUseBuff.puBuf[3u] ) && ( 0x00u == l_ltUseBuff.puBuf[4u] )  && ( 0x00u == l_ltUseBuff.puBuf[5u] ) &&
@@ -9091,19 +9455,19 @@ static void eFSS_LOGCTST_FlushTest(void)
             if( ( m_auStorArea[6u][0u]   == 0x00u ) && ( m_auStorArea[6u][1u]   == 0x00u ) && ( m_auStorArea[6u][2u]   == 0x00u ) && ( m_auStorArea[6u][3u]   == 0x00u ) &&
                 ( m_auStorArea[6u][4u]   == 0x00u ) && ( m_auStorArea[6u][5u]   == 0x00u ) && ( m_auStorArea[6u][6u]   == 0x00u ) && ( m_auStorArea[6u][7u]   == 0x00u ) &&
                 ( m_auStorArea[6u][8u]   == 0x00u ) && ( m_auStorArea[6u][9u]   == 0x00u ) && ( m_auStorArea[6u][10u]  == 0x00u ) && ( m_auStorArea[6u][11u]  == 0x00u ) &&
-                ( m_auStorArea[6u][12u]  == 0x05u ) && ( m_auStorArea[6u][13u]  == 0x06u ) && ( m_auStorArea[6u][14u]  == 0x00u ) && ( m_auStorArea[6u][15u]  == 0x00u ) &&
-                ( m_auStorArea[6u][16u]  == 0x00u ) && ( m_auStorArea[6u][17u]  == 0x02u ) && ( m_auStorArea[6u][18u]  == 0x01u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
-                ( m_auStorArea[6u][20u]  == 0x0Eu ) && ( m_auStorArea[6u][21u]  == 0x00u ) && ( m_auStorArea[6u][22u]  == 0x00u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
-                ( m_auStorArea[6u][24u]  == 0xA5u ) && ( m_auStorArea[6u][25u]  == 0xA5u ) && ( m_auStorArea[6u][26u]  == 0xA5u ) && ( m_auStorArea[6u][27u]  == 0xA5u ) &&
-                ( m_auStorArea[6u][28u]  == 0xAFu ) && ( m_auStorArea[6u][29u]  == 0x02u ) && ( m_auStorArea[6u][30u]  == 0x00u ) && ( m_auStorArea[6u][31u]  == 0x00u ) &&
+                ( m_auStorArea[6u][16u]  == 0x05u ) && ( m_auStorArea[6u][17u]  == 0x06u ) && ( m_auStorArea[6u][18u]  == 0x00u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
+                ( m_auStorArea[6u][20u]  == 0x00u ) && ( m_auStorArea[6u][21u]  == 0x02u ) && ( m_auStorArea[6u][22u]  == 0x01u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
+                ( m_auStorArea[6u][24u]  == 0x0Eu ) && ( m_auStorArea[6u][25u]  == 0x00u ) && ( m_auStorArea[6u][26u]  == 0x00u ) && ( m_auStorArea[6u][27u]  == 0x00u ) &&
+                ( m_auStorArea[6u][28u]  == 0xA5u ) && ( m_auStorArea[6u][29u]  == 0xA5u ) && ( m_auStorArea[6u][30u]  == 0xA5u ) && ( m_auStorArea[6u][31u]  == 0xA5u ) &&
+                ( m_auStorArea[6u][32u]  == 0xAFu ) && ( m_auStorArea[6u][33u]  == 0x02u ) && ( m_auStorArea[6u][34u]  == 0x00u ) && ( m_auStorArea[6u][35u]  == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x06u ) && ( m_auStorArea[13u][13u] == 0x0Du ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
-                ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x02u ) && ( m_auStorArea[13u][18u] == 0x01u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
-                ( m_auStorArea[13u][20u] == 0x0Eu ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
-                ( m_auStorArea[13u][24u] == 0xA5u ) && ( m_auStorArea[13u][25u] == 0xA5u ) && ( m_auStorArea[13u][26u] == 0xA5u ) && ( m_auStorArea[13u][27u] == 0xA5u ) &&
-                ( m_auStorArea[13u][28u] == 0xB7u ) && ( m_auStorArea[13u][29u] == 0x02u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][16u] == 0x06u ) && ( m_auStorArea[13u][17u] == 0x0Du ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
+                ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x02u ) && ( m_auStorArea[13u][22u] == 0x01u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
+                ( m_auStorArea[13u][24u] == 0x0Eu ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
+                ( m_auStorArea[13u][28u] == 0xA5u ) && ( m_auStorArea[13u][29u] == 0xA5u ) && ( m_auStorArea[13u][30u] == 0xA5u ) && ( m_auStorArea[13u][31u] == 0xA5u ) &&
+                ( m_auStorArea[13u][32u] == 0xB7u ) && ( m_auStorArea[13u][33u] == 0x02u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_FlushTest 5  -- OK \n");
               }
@@ -9136,7 +9500,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x01u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 2u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 2u, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] )  && ( 0x00u == l_ltUseBuff.puBuf[2u] ) &&
             ( 0x00u == l_ltUseBuff.puBuf[3u] ) && ( 0x00u == l_ltUseBuff.puBuf[4u] )  && ( 0x00u == l_ltUseBuff.puBuf[5u] ) &&
@@ -9146,19 +9510,19 @@ static void eFSS_LOGCTST_FlushTest(void)
             if( ( m_auStorArea[6u][0u]   == 0x01u ) && ( m_auStorArea[6u][1u]   == 0x00u ) && ( m_auStorArea[6u][2u]   == 0x00u ) && ( m_auStorArea[6u][3u]   == 0x00u ) &&
                 ( m_auStorArea[6u][4u]   == 0x00u ) && ( m_auStorArea[6u][5u]   == 0x00u ) && ( m_auStorArea[6u][6u]   == 0x00u ) && ( m_auStorArea[6u][7u]   == 0x01u ) &&
                 ( m_auStorArea[6u][8u]   == 0x02u ) && ( m_auStorArea[6u][9u]   == 0x00u ) && ( m_auStorArea[6u][10u]  == 0x00u ) && ( m_auStorArea[6u][11u]  == 0x00u ) &&
-                ( m_auStorArea[6u][12u]  == 0x01u ) && ( m_auStorArea[6u][13u]  == 0x06u ) && ( m_auStorArea[6u][14u]  == 0x00u ) && ( m_auStorArea[6u][15u]  == 0x00u ) &&
-                ( m_auStorArea[6u][16u]  == 0x00u ) && ( m_auStorArea[6u][17u]  == 0x02u ) && ( m_auStorArea[6u][18u]  == 0x01u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
-                ( m_auStorArea[6u][20u]  == 0x0Eu ) && ( m_auStorArea[6u][21u]  == 0x00u ) && ( m_auStorArea[6u][22u]  == 0x00u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
-                ( m_auStorArea[6u][24u]  == 0xA5u ) && ( m_auStorArea[6u][25u]  == 0xA5u ) && ( m_auStorArea[6u][26u]  == 0xA5u ) && ( m_auStorArea[6u][27u]  == 0xA5u ) &&
-                ( m_auStorArea[6u][28u]  == 0xAFu ) && ( m_auStorArea[6u][29u]  == 0x02u ) && ( m_auStorArea[6u][30u]  == 0x00u ) && ( m_auStorArea[6u][31u]  == 0x00u ) &&
+                ( m_auStorArea[6u][16u]  == 0x01u ) && ( m_auStorArea[6u][17u]  == 0x06u ) && ( m_auStorArea[6u][18u]  == 0x00u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
+                ( m_auStorArea[6u][20u]  == 0x00u ) && ( m_auStorArea[6u][21u]  == 0x02u ) && ( m_auStorArea[6u][22u]  == 0x01u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
+                ( m_auStorArea[6u][24u]  == 0x0Eu ) && ( m_auStorArea[6u][25u]  == 0x00u ) && ( m_auStorArea[6u][26u]  == 0x00u ) && ( m_auStorArea[6u][27u]  == 0x00u ) &&
+                ( m_auStorArea[6u][28u]  == 0xA5u ) && ( m_auStorArea[6u][29u]  == 0xA5u ) && ( m_auStorArea[6u][30u]  == 0xA5u ) && ( m_auStorArea[6u][31u]  == 0xA5u ) &&
+                ( m_auStorArea[6u][32u]  == 0xAFu ) && ( m_auStorArea[6u][33u]  == 0x02u ) && ( m_auStorArea[6u][34u]  == 0x00u ) && ( m_auStorArea[6u][35u]  == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x01u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x01u ) &&
                 ( m_auStorArea[13u][8u]  == 0x02u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x02u ) && ( m_auStorArea[13u][13u] == 0x0Du ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
-                ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x02u ) && ( m_auStorArea[13u][18u] == 0x01u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
-                ( m_auStorArea[13u][20u] == 0x0Eu ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
-                ( m_auStorArea[13u][24u] == 0xA5u ) && ( m_auStorArea[13u][25u] == 0xA5u ) && ( m_auStorArea[13u][26u] == 0xA5u ) && ( m_auStorArea[13u][27u] == 0xA5u ) &&
-                ( m_auStorArea[13u][28u] == 0xB7u ) && ( m_auStorArea[13u][29u] == 0x02u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][16u] == 0x02u ) && ( m_auStorArea[13u][17u] == 0x0Du ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
+                ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x02u ) && ( m_auStorArea[13u][22u] == 0x01u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
+                ( m_auStorArea[13u][24u] == 0x0Eu ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
+                ( m_auStorArea[13u][28u] == 0xA5u ) && ( m_auStorArea[13u][29u] == 0xA5u ) && ( m_auStorArea[13u][30u] == 0xA5u ) && ( m_auStorArea[13u][31u] == 0xA5u ) &&
+                ( m_auStorArea[13u][32u] == 0xB7u ) && ( m_auStorArea[13u][33u] == 0x02u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_FlushTest 6  -- OK \n");
               }
@@ -9191,7 +9555,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x01u;
 
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 9u) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 9u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_FlushTest 7  -- OK \n");
     }
@@ -9237,7 +9601,7 @@ static void eFSS_LOGCTST_FlushTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* Setup storage area */
     (void)memset(m_auStorArea[6u], 0, sizeof(m_auStorArea[6u]));
@@ -9253,7 +9617,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 0u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 0u, 0u) )
     {
         if( ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] )  && ( 0x00u == l_ltUseBuff.puBuf[2u] ) &&
             ( 0x00u == l_ltUseBuff.puBuf[3u] ) && ( 0x00u == l_ltUseBuff.puBuf[4u] )  && ( 0x00u == l_ltUseBuff.puBuf[5u] ) &&
@@ -9263,19 +9627,19 @@ static void eFSS_LOGCTST_FlushTest(void)
             if( ( m_auStorArea[6u][0u]   == 0x00u ) && ( m_auStorArea[6u][1u]   == 0x00u ) && ( m_auStorArea[6u][2u]   == 0x00u ) && ( m_auStorArea[6u][3u]   == 0x00u ) &&
                 ( m_auStorArea[6u][4u]   == 0x00u ) && ( m_auStorArea[6u][5u]   == 0x00u ) && ( m_auStorArea[6u][6u]   == 0x00u ) && ( m_auStorArea[6u][7u]   == 0x00u ) &&
                 ( m_auStorArea[6u][8u]   == 0x00u ) && ( m_auStorArea[6u][9u]   == 0x00u ) && ( m_auStorArea[6u][10u]  == 0x00u ) && ( m_auStorArea[6u][11u]  == 0x00u ) &&
-                ( m_auStorArea[6u][12u]  == 0x01u ) && ( m_auStorArea[6u][13u]  == 0x06u ) && ( m_auStorArea[6u][14u]  == 0x00u ) && ( m_auStorArea[6u][15u]  == 0x00u ) &&
-                ( m_auStorArea[6u][16u]  == 0x00u ) && ( m_auStorArea[6u][17u]  == 0x02u ) && ( m_auStorArea[6u][18u]  == 0x01u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
-                ( m_auStorArea[6u][20u]  == 0x0Eu ) && ( m_auStorArea[6u][21u]  == 0x00u ) && ( m_auStorArea[6u][22u]  == 0x00u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
-                ( m_auStorArea[6u][24u]  == 0xA5u ) && ( m_auStorArea[6u][25u]  == 0xA5u ) && ( m_auStorArea[6u][26u]  == 0xA5u ) && ( m_auStorArea[6u][27u]  == 0xA5u ) &&
-                ( m_auStorArea[6u][28u]  == 0xABu ) && ( m_auStorArea[6u][29u]  == 0x02u ) && ( m_auStorArea[6u][30u]  == 0x00u ) && ( m_auStorArea[6u][31u]  == 0x00u ) &&
+                ( m_auStorArea[6u][16u]  == 0x01u ) && ( m_auStorArea[6u][17u]  == 0x06u ) && ( m_auStorArea[6u][18u]  == 0x00u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
+                ( m_auStorArea[6u][20u]  == 0x00u ) && ( m_auStorArea[6u][21u]  == 0x02u ) && ( m_auStorArea[6u][22u]  == 0x01u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
+                ( m_auStorArea[6u][24u]  == 0x0Eu ) && ( m_auStorArea[6u][25u]  == 0x00u ) && ( m_auStorArea[6u][26u]  == 0x00u ) && ( m_auStorArea[6u][27u]  == 0x00u ) &&
+                ( m_auStorArea[6u][28u]  == 0xA5u ) && ( m_auStorArea[6u][29u]  == 0xA5u ) && ( m_auStorArea[6u][30u]  == 0xA5u ) && ( m_auStorArea[6u][31u]  == 0xA5u ) &&
+                ( m_auStorArea[6u][32u]  == 0xABu ) && ( m_auStorArea[6u][33u]  == 0x02u ) && ( m_auStorArea[6u][34u]  == 0x00u ) && ( m_auStorArea[6u][35u]  == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x00u ) && ( m_auStorArea[13u][13u] == 0x00u ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
                 ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x00u ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
                 ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
                 ( m_auStorArea[13u][24u] == 0x00u ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
-                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) &&
+                ( m_auStorArea[13u][32u] == 0x00u ) && ( m_auStorArea[13u][33u] == 0x00u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_FlushTest 10 -- OK \n");
               }
@@ -9296,7 +9660,7 @@ static void eFSS_LOGCTST_FlushTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* Setup storage area */
     (void)memset(m_auStorArea[6u], 0, sizeof(m_auStorArea[6u]));
@@ -9312,7 +9676,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, 0u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 6u, 0u, 0u) )
     {
         if( ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] )  && ( 0x00u == l_ltUseBuff.puBuf[2u] ) &&
             ( 0x00u == l_ltUseBuff.puBuf[3u] ) && ( 0x00u == l_ltUseBuff.puBuf[4u] )  && ( 0x00u == l_ltUseBuff.puBuf[5u] ) &&
@@ -9322,19 +9686,19 @@ static void eFSS_LOGCTST_FlushTest(void)
             if( ( m_auStorArea[6u][0u]   == 0x00u ) && ( m_auStorArea[6u][1u]   == 0x00u ) && ( m_auStorArea[6u][2u]   == 0x00u ) && ( m_auStorArea[6u][3u]   == 0x00u ) &&
                 ( m_auStorArea[6u][4u]   == 0x00u ) && ( m_auStorArea[6u][5u]   == 0x00u ) && ( m_auStorArea[6u][6u]   == 0x00u ) && ( m_auStorArea[6u][7u]   == 0x00u ) &&
                 ( m_auStorArea[6u][8u]   == 0x00u ) && ( m_auStorArea[6u][9u]   == 0x00u ) && ( m_auStorArea[6u][10u]  == 0x00u ) && ( m_auStorArea[6u][11u]  == 0x00u ) &&
-                ( m_auStorArea[6u][12u]  == 0x03u ) && ( m_auStorArea[6u][13u]  == 0x06u ) && ( m_auStorArea[6u][14u]  == 0x00u ) && ( m_auStorArea[6u][15u]  == 0x00u ) &&
-                ( m_auStorArea[6u][16u]  == 0x00u ) && ( m_auStorArea[6u][17u]  == 0x02u ) && ( m_auStorArea[6u][18u]  == 0x01u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
-                ( m_auStorArea[6u][20u]  == 0x0Eu ) && ( m_auStorArea[6u][21u]  == 0x00u ) && ( m_auStorArea[6u][22u]  == 0x00u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
-                ( m_auStorArea[6u][24u]  == 0xA5u ) && ( m_auStorArea[6u][25u]  == 0xA5u ) && ( m_auStorArea[6u][26u]  == 0xA5u ) && ( m_auStorArea[6u][27u]  == 0xA5u ) &&
-                ( m_auStorArea[6u][28u]  == 0xADu ) && ( m_auStorArea[6u][29u]  == 0x02u ) && ( m_auStorArea[6u][30u]  == 0x00u ) && ( m_auStorArea[6u][31u]  == 0x00u ) &&
+                ( m_auStorArea[6u][16u]  == 0x03u ) && ( m_auStorArea[6u][17u]  == 0x06u ) && ( m_auStorArea[6u][18u]  == 0x00u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
+                ( m_auStorArea[6u][20u]  == 0x00u ) && ( m_auStorArea[6u][21u]  == 0x02u ) && ( m_auStorArea[6u][22u]  == 0x01u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
+                ( m_auStorArea[6u][24u]  == 0x0Eu ) && ( m_auStorArea[6u][25u]  == 0x00u ) && ( m_auStorArea[6u][26u]  == 0x00u ) && ( m_auStorArea[6u][27u]  == 0x00u ) &&
+                ( m_auStorArea[6u][28u]  == 0xA5u ) && ( m_auStorArea[6u][29u]  == 0xA5u ) && ( m_auStorArea[6u][30u]  == 0xA5u ) && ( m_auStorArea[6u][31u]  == 0xA5u ) &&
+                ( m_auStorArea[6u][32u]  == 0xADu ) && ( m_auStorArea[6u][33u]  == 0x02u ) && ( m_auStorArea[6u][34u]  == 0x00u ) && ( m_auStorArea[6u][35u]  == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x00u ) && ( m_auStorArea[13u][13u] == 0x00u ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
                 ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x00u ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
                 ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
                 ( m_auStorArea[13u][24u] == 0x00u ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
-                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) &&
+                ( m_auStorArea[13u][32u] == 0x00u ) && ( m_auStorArea[13u][33u] == 0x00u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_FlushTest 11 -- OK \n");
               }
@@ -9355,7 +9719,7 @@ static void eFSS_LOGCTST_FlushTest(void)
 
     /* Setup storage area */
     l_ltUseBuff2.uBufL = l_ltUseBuff.uBufL  + 1u;
-    l_ltUseBuff2.puBuf = &l_auStor[32];
+    l_ltUseBuff2.puBuf = &l_auStor[36];
 
     /* Setup storage area */
     (void)memset(m_auStorArea[6u], 0, sizeof(m_auStorArea[6u]));
@@ -9371,7 +9735,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, 0u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 6u, 0u, 0u) )
     {
         if( ( 0x00u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] )  && ( 0x00u == l_ltUseBuff.puBuf[2u] ) &&
             ( 0x00u == l_ltUseBuff.puBuf[3u] ) && ( 0x00u == l_ltUseBuff.puBuf[4u] )  && ( 0x00u == l_ltUseBuff.puBuf[5u] ) &&
@@ -9381,19 +9745,19 @@ static void eFSS_LOGCTST_FlushTest(void)
             if( ( m_auStorArea[6u][0u]   == 0x00u ) && ( m_auStorArea[6u][1u]   == 0x00u ) && ( m_auStorArea[6u][2u]   == 0x00u ) && ( m_auStorArea[6u][3u]   == 0x00u ) &&
                 ( m_auStorArea[6u][4u]   == 0x00u ) && ( m_auStorArea[6u][5u]   == 0x00u ) && ( m_auStorArea[6u][6u]   == 0x00u ) && ( m_auStorArea[6u][7u]   == 0x00u ) &&
                 ( m_auStorArea[6u][8u]   == 0x00u ) && ( m_auStorArea[6u][9u]   == 0x00u ) && ( m_auStorArea[6u][10u]  == 0x00u ) && ( m_auStorArea[6u][11u]  == 0x00u ) &&
-                ( m_auStorArea[6u][12u]  == 0x05u ) && ( m_auStorArea[6u][13u]  == 0x06u ) && ( m_auStorArea[6u][14u]  == 0x00u ) && ( m_auStorArea[6u][15u]  == 0x00u ) &&
-                ( m_auStorArea[6u][16u]  == 0x00u ) && ( m_auStorArea[6u][17u]  == 0x02u ) && ( m_auStorArea[6u][18u]  == 0x01u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
-                ( m_auStorArea[6u][20u]  == 0x0Eu ) && ( m_auStorArea[6u][21u]  == 0x00u ) && ( m_auStorArea[6u][22u]  == 0x00u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
-                ( m_auStorArea[6u][24u]  == 0xA5u ) && ( m_auStorArea[6u][25u]  == 0xA5u ) && ( m_auStorArea[6u][26u]  == 0xA5u ) && ( m_auStorArea[6u][27u]  == 0xA5u ) &&
-                ( m_auStorArea[6u][28u]  == 0xAFu ) && ( m_auStorArea[6u][29u]  == 0x02u ) && ( m_auStorArea[6u][30u]  == 0x00u ) && ( m_auStorArea[6u][31u]  == 0x00u ) &&
+                ( m_auStorArea[6u][16u]  == 0x05u ) && ( m_auStorArea[6u][17u]  == 0x06u ) && ( m_auStorArea[6u][18u]  == 0x00u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
+                ( m_auStorArea[6u][20u]  == 0x00u ) && ( m_auStorArea[6u][21u]  == 0x02u ) && ( m_auStorArea[6u][22u]  == 0x01u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
+                ( m_auStorArea[6u][24u]  == 0x0Eu ) && ( m_auStorArea[6u][25u]  == 0x00u ) && ( m_auStorArea[6u][26u]  == 0x00u ) && ( m_auStorArea[6u][27u]  == 0x00u ) &&
+                ( m_auStorArea[6u][28u]  == 0xA5u ) && ( m_auStorArea[6u][29u]  == 0xA5u ) && ( m_auStorArea[6u][30u]  == 0xA5u ) && ( m_auStorArea[6u][31u]  == 0xA5u ) &&
+                ( m_auStorArea[6u][32u]  == 0xAFu ) && ( m_auStorArea[6u][33u]  == 0x02u ) && ( m_auStorArea[6u][34u]  == 0x00u ) && ( m_auStorArea[6u][35u]  == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x00u ) && ( m_auStorArea[13u][13u] == 0x00u ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
                 ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x00u ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
                 ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
                 ( m_auStorArea[13u][24u] == 0x00u ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
-                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) &&
+                ( m_auStorArea[13u][32u] == 0x00u ) && ( m_auStorArea[13u][33u] == 0x00u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_FlushTest 12 -- OK \n");
               }
@@ -9426,7 +9790,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x01u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 2u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 2u, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x00u == l_ltUseBuff.puBuf[1u] )  && ( 0x00u == l_ltUseBuff.puBuf[2u] ) &&
             ( 0x00u == l_ltUseBuff.puBuf[3u] ) && ( 0x00u == l_ltUseBuff.puBuf[4u] )  && ( 0x00u == l_ltUseBuff.puBuf[5u] ) &&
@@ -9436,19 +9800,19 @@ static void eFSS_LOGCTST_FlushTest(void)
             if( ( m_auStorArea[6u][0u]   == 0x01u ) && ( m_auStorArea[6u][1u]   == 0x00u ) && ( m_auStorArea[6u][2u]   == 0x00u ) && ( m_auStorArea[6u][3u]   == 0x00u ) &&
                 ( m_auStorArea[6u][4u]   == 0x00u ) && ( m_auStorArea[6u][5u]   == 0x00u ) && ( m_auStorArea[6u][6u]   == 0x00u ) && ( m_auStorArea[6u][7u]   == 0x01u ) &&
                 ( m_auStorArea[6u][8u]   == 0x02u ) && ( m_auStorArea[6u][9u]   == 0x00u ) && ( m_auStorArea[6u][10u]  == 0x00u ) && ( m_auStorArea[6u][11u]  == 0x00u ) &&
-                ( m_auStorArea[6u][12u]  == 0x01u ) && ( m_auStorArea[6u][13u]  == 0x06u ) && ( m_auStorArea[6u][14u]  == 0x00u ) && ( m_auStorArea[6u][15u]  == 0x00u ) &&
-                ( m_auStorArea[6u][16u]  == 0x00u ) && ( m_auStorArea[6u][17u]  == 0x02u ) && ( m_auStorArea[6u][18u]  == 0x01u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
-                ( m_auStorArea[6u][20u]  == 0x0Eu ) && ( m_auStorArea[6u][21u]  == 0x00u ) && ( m_auStorArea[6u][22u]  == 0x00u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
-                ( m_auStorArea[6u][24u]  == 0xA5u ) && ( m_auStorArea[6u][25u]  == 0xA5u ) && ( m_auStorArea[6u][26u]  == 0xA5u ) && ( m_auStorArea[6u][27u]  == 0xA5u ) &&
-                ( m_auStorArea[6u][28u]  == 0xAFu ) && ( m_auStorArea[6u][29u]  == 0x02u ) && ( m_auStorArea[6u][30u]  == 0x00u ) && ( m_auStorArea[6u][31u]  == 0x00u ) &&
+                ( m_auStorArea[6u][16u]  == 0x01u ) && ( m_auStorArea[6u][17u]  == 0x06u ) && ( m_auStorArea[6u][18u]  == 0x00u ) && ( m_auStorArea[6u][19u]  == 0x00u ) &&
+                ( m_auStorArea[6u][20u]  == 0x00u ) && ( m_auStorArea[6u][21u]  == 0x02u ) && ( m_auStorArea[6u][22u]  == 0x01u ) && ( m_auStorArea[6u][23u]  == 0x00u ) &&
+                ( m_auStorArea[6u][24u]  == 0x0Eu ) && ( m_auStorArea[6u][25u]  == 0x00u ) && ( m_auStorArea[6u][26u]  == 0x00u ) && ( m_auStorArea[6u][27u]  == 0x00u ) &&
+                ( m_auStorArea[6u][28u]  == 0xA5u ) && ( m_auStorArea[6u][29u]  == 0xA5u ) && ( m_auStorArea[6u][30u]  == 0xA5u ) && ( m_auStorArea[6u][31u]  == 0xA5u ) &&
+                ( m_auStorArea[6u][32u]  == 0xAFu ) && ( m_auStorArea[6u][33u]  == 0x02u ) && ( m_auStorArea[6u][34u]  == 0x00u ) && ( m_auStorArea[6u][35u]  == 0x00u ) &&
                 ( m_auStorArea[13u][0u]  == 0x00u ) && ( m_auStorArea[13u][1u]  == 0x00u ) && ( m_auStorArea[13u][2u]  == 0x00u ) && ( m_auStorArea[13u][3u]  == 0x00u ) &&
                 ( m_auStorArea[13u][4u]  == 0x00u ) && ( m_auStorArea[13u][5u]  == 0x00u ) && ( m_auStorArea[13u][6u]  == 0x00u ) && ( m_auStorArea[13u][7u]  == 0x00u ) &&
                 ( m_auStorArea[13u][8u]  == 0x00u ) && ( m_auStorArea[13u][9u]  == 0x00u ) && ( m_auStorArea[13u][10u] == 0x00u ) && ( m_auStorArea[13u][11u] == 0x00u ) &&
-                ( m_auStorArea[13u][12u] == 0x00u ) && ( m_auStorArea[13u][13u] == 0x00u ) && ( m_auStorArea[13u][14u] == 0x00u ) && ( m_auStorArea[13u][15u] == 0x00u ) &&
                 ( m_auStorArea[13u][16u] == 0x00u ) && ( m_auStorArea[13u][17u] == 0x00u ) && ( m_auStorArea[13u][18u] == 0x00u ) && ( m_auStorArea[13u][19u] == 0x00u ) &&
                 ( m_auStorArea[13u][20u] == 0x00u ) && ( m_auStorArea[13u][21u] == 0x00u ) && ( m_auStorArea[13u][22u] == 0x00u ) && ( m_auStorArea[13u][23u] == 0x00u ) &&
                 ( m_auStorArea[13u][24u] == 0x00u ) && ( m_auStorArea[13u][25u] == 0x00u ) && ( m_auStorArea[13u][26u] == 0x00u ) && ( m_auStorArea[13u][27u] == 0x00u ) &&
-                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) )
+                ( m_auStorArea[13u][28u] == 0x00u ) && ( m_auStorArea[13u][29u] == 0x00u ) && ( m_auStorArea[13u][30u] == 0x00u ) && ( m_auStorArea[13u][31u] == 0x00u ) &&
+                ( m_auStorArea[13u][32u] == 0x00u ) && ( m_auStorArea[13u][33u] == 0x00u ) && ( m_auStorArea[13u][34u] == 0x00u ) && ( m_auStorArea[13u][35u] == 0x00u ) )
               {
                   (void)printf("eFSS_LOGCTST_FlushTest 13 -- OK \n");
               }
@@ -9481,7 +9845,7 @@ static void eFSS_LOGCTST_FlushTest(void)
     l_ltUseBuff.puBuf[6u] = 0x00u;
     l_ltUseBuff.puBuf[7u] = 0x01u;
 
-    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 9u) )
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 6u, 9u, 0u) )
     {
         (void)printf("eFSS_LOGCTST_FlushTest 14 -- OK \n");
     }
@@ -9509,7 +9873,7 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -9527,12 +9891,24 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uPageUsable = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -9587,26 +9963,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -9652,26 +10032,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -9717,26 +10101,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -9782,26 +10170,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -9847,26 +10239,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -9912,26 +10308,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x03u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x03u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -9977,26 +10377,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x02u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x02u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10042,26 +10446,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE4u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE4u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10141,26 +10549,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xD9u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xD9u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -10174,26 +10586,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10240,26 +10656,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xD9u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xD9u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -10273,26 +10693,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10358,26 +10782,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][35u] = 0xCCu; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -10391,26 +10819,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10509,26 +10941,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -10542,26 +10978,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10608,26 +11048,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -10641,26 +11085,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10726,26 +11174,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][35u] = 0xCCu; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -10759,26 +11211,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10877,26 +11333,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][35u] = 0xCCu; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -10910,26 +11370,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -10977,26 +11441,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xDAu; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xDAu; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -11010,26 +11478,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -11096,26 +11568,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -11129,26 +11605,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -11215,26 +11695,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xD7u; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xD7u; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -11248,26 +11732,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -11334,26 +11822,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xDAu; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xDAu; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -11367,26 +11859,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -11452,26 +11948,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[6u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[6u][35u] = 0xCCu; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -11485,26 +11985,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -11551,26 +12055,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -11584,26 +12092,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x02u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE4u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x02u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE4u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -11669,26 +12181,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[6u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u] = 0x06u; /* Page index */
-    m_auStorArea[6u][14u] = 0x00u; /* Page index */
-    m_auStorArea[6u][15u] = 0x00u; /* Page index */
-    m_auStorArea[6u][16u] = 0x00u; /* Page index */
-    m_auStorArea[6u][17u] = 0x02u; /* Page type */
-    m_auStorArea[6u][18u] = 0x01u; /* Page version */
-    m_auStorArea[6u][19u] = 0x00u; /* Page version */
-    m_auStorArea[6u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u] = 0x00u; /* Total page */
-    m_auStorArea[6u][22u] = 0x00u; /* Total page */
-    m_auStorArea[6u][23u] = 0x00u; /* Total page */
-    m_auStorArea[6u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u] = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u] = 0x02u; /* CRC */
-    m_auStorArea[6u][30u] = 0x00u; /* CRC */
-    m_auStorArea[6u][31u] = 0x00u; /* CRC */
+    m_auStorArea[6u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u] = 0x06u; /* Page index */
+    m_auStorArea[6u][18u] = 0x00u; /* Page index */
+    m_auStorArea[6u][19u] = 0x00u; /* Page index */
+    m_auStorArea[6u][20u] = 0x00u; /* Page index */
+    m_auStorArea[6u][21u] = 0x02u; /* Page type */
+    m_auStorArea[6u][22u] = 0x01u; /* Page version */
+    m_auStorArea[6u][23u] = 0x00u; /* Page version */
+    m_auStorArea[6u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u] = 0x00u; /* Total page */
+    m_auStorArea[6u][26u] = 0x00u; /* Total page */
+    m_auStorArea[6u][27u] = 0x00u; /* Total page */
+    m_auStorArea[6u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u] = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u] = 0x02u; /* CRC */
+    m_auStorArea[6u][34u] = 0x00u; /* CRC */
+    m_auStorArea[6u][35u] = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -11702,26 +12218,30 @@ static void eFSS_LOGCTST_IsPageNewOrBkup(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x00u;
@@ -11789,7 +12309,7 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
@@ -11806,12 +12326,24 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uPageUsable = 0u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -11866,26 +12398,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDEu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDEu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -11897,11 +12433,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDEu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xDEu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 3  -- OK \n");
         }
@@ -11930,26 +12466,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -11961,11 +12501,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE0u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE0u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 4  -- OK \n");
         }
@@ -11994,26 +12534,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12025,11 +12569,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE2u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE2u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 5  -- OK \n");
         }
@@ -12058,26 +12602,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDEu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDEu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12089,11 +12637,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDDu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xDDu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 6  -- OK \n");
         }
@@ -12107,11 +12655,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 6  -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDDu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xDDu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 7  -- OK \n");
         }
@@ -12140,26 +12688,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12171,11 +12723,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 8  -- OK \n");
         }
@@ -12189,11 +12741,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 8  -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 9  -- OK \n");
         }
@@ -12222,26 +12774,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12253,11 +12809,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 10 -- OK \n");
         }
@@ -12271,11 +12827,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 10 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 7u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 11 -- OK \n");
         }
@@ -12304,26 +12860,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDEu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDEu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12335,11 +12895,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE0u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE0u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 12 -- OK \n");
         }
@@ -12368,26 +12928,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12399,11 +12963,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE2u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE2u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 13 -- OK \n");
         }
@@ -12432,26 +12996,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12463,11 +13031,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDEu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xDEu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 14 -- OK \n");
         }
@@ -12496,26 +13064,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12527,11 +13099,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDEu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xDEu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 15 -- OK \n");
         }
@@ -12560,26 +13132,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12591,11 +13167,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE0u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE0u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 16 -- OK \n");
         }
@@ -12624,26 +13200,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12655,11 +13235,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE2u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE2u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 17 -- OK \n");
         }
@@ -12688,26 +13268,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12719,11 +13303,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDEu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xDEu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 18 -- OK \n");
         }
@@ -12752,26 +13336,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12783,11 +13371,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE0u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE0u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 19 -- OK \n");
         }
@@ -12816,26 +13404,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12847,11 +13439,11 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 13u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xE2u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xE2u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 20 -- OK \n");
         }
@@ -12921,26 +13513,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD7u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD7u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -12954,26 +13550,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -12985,12 +13585,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 23 -- OK \n");
         }
@@ -13021,26 +13621,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD9u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD9u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13054,26 +13658,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13085,12 +13693,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 24 -- OK \n");
         }
@@ -13121,26 +13729,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13154,26 +13766,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13185,12 +13801,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 25 -- OK \n");
         }
@@ -13221,26 +13837,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD7u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD7u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13254,26 +13874,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13285,12 +13909,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 26 -- OK \n");
         }
@@ -13304,12 +13928,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 26 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 27 -- OK \n");
         }
@@ -13340,26 +13964,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD9u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD9u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13373,26 +14001,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13404,12 +14036,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 28 -- OK \n");
         }
@@ -13423,12 +14055,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 28 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 29 -- OK \n");
         }
@@ -13459,26 +14091,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13492,26 +14128,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][29u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][30u] = 0xCCu; /* CRC */
-    m_auStorArea[13u][31u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][33u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][34u] = 0xCCu; /* CRC */
+    m_auStorArea[13u][35u] = 0xCCu; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13523,12 +14163,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 30 -- OK \n");
         }
@@ -13542,12 +14182,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 30 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 31 -- OK \n");
         }
@@ -13578,26 +14218,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][29u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][30u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][31u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][33u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][34u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][35u]  = 0xCCu; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13611,26 +14255,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13642,12 +14290,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 32 -- OK \n");
         }
@@ -13661,12 +14309,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 32 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 33 -- OK \n");
         }
@@ -13697,26 +14345,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][29u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][30u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][31u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][33u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][34u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][35u]  = 0xCCu; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13730,26 +14382,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13761,12 +14417,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 34 -- OK \n");
         }
@@ -13780,12 +14436,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 34 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 35 -- OK \n");
         }
@@ -13816,26 +14472,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][29u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][30u]  = 0xCCu; /* CRC */
-    m_auStorArea[6u][31u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][33u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][34u]  = 0xCCu; /* CRC */
+    m_auStorArea[6u][35u]  = 0xCCu; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13849,26 +14509,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13880,12 +14544,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 36 -- OK \n");
         }
@@ -13899,12 +14563,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 36 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 37 -- OK \n");
         }
@@ -13935,26 +14599,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD7u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD7u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -13968,26 +14636,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDEu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDEu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -13999,12 +14671,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 38 -- OK \n");
         }
@@ -14018,12 +14690,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 38 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 39 -- OK \n");
         }
@@ -14054,26 +14726,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD9u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD9u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14087,26 +14763,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14118,12 +14798,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 40 -- OK \n");
         }
@@ -14137,12 +14817,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 40 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 41 -- OK \n");
         }
@@ -14173,26 +14853,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14206,26 +14890,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14237,12 +14925,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 42 -- OK \n");
         }
@@ -14256,12 +14944,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
         (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 42 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 43 -- OK \n");
         }
@@ -14291,26 +14979,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD7u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD7u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14324,26 +15016,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDEu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDEu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14355,12 +15051,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 44 -- OK \n");
         }
@@ -14391,26 +15087,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD9u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD9u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14424,26 +15124,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14455,12 +15159,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 45 -- OK \n");
         }
@@ -14491,26 +15195,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14524,26 +15232,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14555,12 +15267,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 46 -- OK \n");
         }
@@ -14591,26 +15303,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD7u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD7u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14624,26 +15340,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x02u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x02u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14655,12 +15375,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 47 -- OK \n");
         }
@@ -14691,26 +15411,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD9u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD9u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14724,26 +15448,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x02u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x02u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14755,12 +15483,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 48 -- OK \n");
         }
@@ -14791,26 +15519,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14824,26 +15556,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x02u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE4u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x02u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE4u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14855,12 +15591,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 49 -- OK \n");
         }
@@ -14891,26 +15627,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD7u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD7u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x02u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -14924,26 +15664,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE0u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE0u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -14955,12 +15699,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 50 -- OK \n");
         }
@@ -14991,26 +15735,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD9u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD9u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x02u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -15024,26 +15772,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE2u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE2u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -15055,12 +15807,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 51 -- OK \n");
         }
@@ -15091,26 +15843,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDBu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDBu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x02u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -15124,26 +15880,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE4u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE4u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -15155,12 +15915,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 52 -- OK \n");
         }
@@ -15191,26 +15951,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x02u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD8u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x02u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD8u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -15224,26 +15988,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -15255,12 +16023,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 53 -- OK \n");
         }
@@ -15291,26 +16059,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x02u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDAu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x02u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDAu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -15324,26 +16096,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -15355,12 +16131,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 54 -- OK \n");
         }
@@ -15391,26 +16167,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x02u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDCu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x02u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDCu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -15424,26 +16204,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -15455,12 +16239,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 55 -- OK \n");
         }
@@ -15491,26 +16275,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x01u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xD8u; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x01u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xD8u; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -15524,26 +16312,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x02u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xDFu; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x02u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xDFu; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -15555,12 +16347,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD7u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xDFu == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD7u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xDFu == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 56 -- OK \n");
         }
@@ -15591,26 +16383,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x03u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDAu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x03u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDAu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -15624,26 +16420,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x04u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE1u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x04u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE1u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -15655,12 +16455,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xD9u == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE1u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ) )
+            ( 0xD9u == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE1u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ) )
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 57 -- OK \n");
         }
@@ -15691,26 +16491,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[6u][9u]   = 0x00u; /* Byte In Page */
     m_auStorArea[6u][10u]  = 0x00u; /* Byte In Page */
     m_auStorArea[6u][11u]  = 0x00u; /* Byte In Page */
-    m_auStorArea[6u][12u]  = 0x05u; /* Page SUBTYPE */
-    m_auStorArea[6u][13u]  = 0x06u; /* Page index */
-    m_auStorArea[6u][14u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][15u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][16u]  = 0x00u; /* Page index */
-    m_auStorArea[6u][17u]  = 0x02u; /* Page type */
-    m_auStorArea[6u][18u]  = 0x01u; /* Page version */
-    m_auStorArea[6u][19u]  = 0x00u; /* Page version */
-    m_auStorArea[6u][20u]  = 0x0Eu; /* Total page */
-    m_auStorArea[6u][21u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][22u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][23u]  = 0x00u; /* Total page */
-    m_auStorArea[6u][24u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][25u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][26u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][27u]  = 0xA5u; /* Magic number */
-    m_auStorArea[6u][28u]  = 0xDCu; /* CRC */
-    m_auStorArea[6u][29u]  = 0x02u; /* CRC */
-    m_auStorArea[6u][30u]  = 0x00u; /* CRC */
-    m_auStorArea[6u][31u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][12u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][13u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][14u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][15u]  = 0x00u; /* Page seq number */
+    m_auStorArea[6u][16u]  = 0x05u; /* Page SUBTYPE */
+    m_auStorArea[6u][17u]  = 0x06u; /* Page index */
+    m_auStorArea[6u][18u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][19u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][20u]  = 0x00u; /* Page index */
+    m_auStorArea[6u][21u]  = 0x02u; /* Page type */
+    m_auStorArea[6u][22u]  = 0x01u; /* Page version */
+    m_auStorArea[6u][23u]  = 0x00u; /* Page version */
+    m_auStorArea[6u][24u]  = 0x0Eu; /* Total page */
+    m_auStorArea[6u][25u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][26u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][27u]  = 0x00u; /* Total page */
+    m_auStorArea[6u][28u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][29u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][30u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][31u]  = 0xA5u; /* Magic number */
+    m_auStorArea[6u][32u]  = 0xDCu; /* CRC */
+    m_auStorArea[6u][33u]  = 0x02u; /* CRC */
+    m_auStorArea[6u][34u]  = 0x00u; /* CRC */
+    m_auStorArea[6u][35u]  = 0x00u; /* CRC */
 
     m_auStorArea[13u][0u]  = 0x01u; /* User data */
     m_auStorArea[13u][1u]  = 0x02u; /* User data */
@@ -15724,26 +16528,30 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     m_auStorArea[13u][9u]  = 0x00u; /* Byte In Page */
     m_auStorArea[13u][10u] = 0x00u; /* Byte In Page */
     m_auStorArea[13u][11u] = 0x00u; /* Byte In Page */
-    m_auStorArea[13u][12u] = 0x06u; /* Page SUBTYPE */
-    m_auStorArea[13u][13u] = 0x0Du; /* Page index */
-    m_auStorArea[13u][14u] = 0x00u; /* Page index */
-    m_auStorArea[13u][15u] = 0x00u; /* Page index */
-    m_auStorArea[13u][16u] = 0x00u; /* Page index */
-    m_auStorArea[13u][17u] = 0x02u; /* Page type */
-    m_auStorArea[13u][18u] = 0x01u; /* Page version */
-    m_auStorArea[13u][19u] = 0x00u; /* Page version */
-    m_auStorArea[13u][20u] = 0x0Eu; /* Total page */
-    m_auStorArea[13u][21u] = 0x00u; /* Total page */
-    m_auStorArea[13u][22u] = 0x00u; /* Total page */
-    m_auStorArea[13u][23u] = 0x00u; /* Total page */
-    m_auStorArea[13u][24u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][25u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][26u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][27u] = 0xA5u; /* Magic number */
-    m_auStorArea[13u][28u] = 0xE3u; /* CRC */
-    m_auStorArea[13u][29u] = 0x02u; /* CRC */
-    m_auStorArea[13u][30u] = 0x00u; /* CRC */
-    m_auStorArea[13u][31u] = 0x00u; /* CRC */
+    m_auStorArea[13u][12u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][13u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][14u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][15u] = 0x00u; /* Page seq number */
+    m_auStorArea[13u][16u] = 0x06u; /* Page SUBTYPE */
+    m_auStorArea[13u][17u] = 0x0Du; /* Page index */
+    m_auStorArea[13u][18u] = 0x00u; /* Page index */
+    m_auStorArea[13u][19u] = 0x00u; /* Page index */
+    m_auStorArea[13u][20u] = 0x00u; /* Page index */
+    m_auStorArea[13u][21u] = 0x02u; /* Page type */
+    m_auStorArea[13u][22u] = 0x01u; /* Page version */
+    m_auStorArea[13u][23u] = 0x00u; /* Page version */
+    m_auStorArea[13u][24u] = 0x0Eu; /* Total page */
+    m_auStorArea[13u][25u] = 0x00u; /* Total page */
+    m_auStorArea[13u][26u] = 0x00u; /* Total page */
+    m_auStorArea[13u][27u] = 0x00u; /* Total page */
+    m_auStorArea[13u][28u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][29u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][30u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][31u] = 0xA5u; /* Magic number */
+    m_auStorArea[13u][32u] = 0xE3u; /* CRC */
+    m_auStorArea[13u][33u] = 0x02u; /* CRC */
+    m_auStorArea[13u][34u] = 0x00u; /* CRC */
+    m_auStorArea[13u][35u] = 0x00u; /* CRC */
 
     /* Setup buffer */
     l_ltUseBuff.puBuf[0u] = 0x01u;
@@ -15755,12 +16563,12 @@ static void eFSS_LOGCTST_FlushBuffIfNotEquals(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 6u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
             ( 0x05u == l_ltUseBuff.puBuf[4u] ) && ( 0x06u == l_ltUseBuff.puBuf[5u] ) && ( 0x07u == l_ltUseBuff.puBuf[6u] ) && ( 0x08u == l_ltUseBuff.puBuf[7u] ) &&
-            ( 0xDBu == m_auStorArea[6u][28u] ) && ( 0x02u == m_auStorArea[6u][29u] ) && ( 0x00u == m_auStorArea[6u][30u] ) && ( 0x00u == m_auStorArea[6u][31u] ) &&
-            ( 0xE3u == m_auStorArea[13u][28u] ) && ( 0x02u == m_auStorArea[13u][29u] ) && ( 0x00u == m_auStorArea[13u][30u] ) && ( 0x00u == m_auStorArea[13u][31u] ))
+            ( 0xDBu == m_auStorArea[6u][32u] ) && ( 0x02u == m_auStorArea[6u][33u] ) && ( 0x00u == m_auStorArea[6u][34u] ) && ( 0x00u == m_auStorArea[6u][35u] ) &&
+            ( 0xE3u == m_auStorArea[13u][32u] ) && ( 0x02u == m_auStorArea[13u][33u] ) && ( 0x00u == m_auStorArea[13u][34u] ) && ( 0x00u == m_auStorArea[13u][35u] ))
         {
             (void)printf("eFSS_LOGCTST_FlushBuffIfNotEquals 58 -- OK \n");
         }
@@ -15797,13 +16605,14 @@ static void eFSS_LOGCTST_GenTest(void)
     t_eFSS_LOGC_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_auStor[64u];
+    uint8_t l_auStor[72u];
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
 	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
     t_eFSS_LOGC_StorBuf l_ltUseBuff;
     uint32_t l_uByteInPage;
+    uint32_t l_uSeqN;
     uint32_t l_uPageUsable;
     uint32_t l_uNewPIx;
     uint32_t l_uFillPIdx;
@@ -15820,12 +16629,24 @@ static void eFSS_LOGCTST_GenTest(void)
     l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 14u;
-    l_tStorSet.uPagesLen = 32u;
+    l_tStorSet.uPagesLen = 36u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uPageUsable = 0u;
     l_uNewPIx = 0u;
     l_uFillPIdx = 0u;
@@ -15948,7 +16769,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 0u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -15966,7 +16787,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 1u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 1u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -15984,7 +16805,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16002,7 +16823,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 3u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 3u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16020,7 +16841,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 4u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 4u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16038,7 +16859,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 5u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 5u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16056,7 +16877,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16074,7 +16895,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 1u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 1u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16092,7 +16913,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 2u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 2u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16110,7 +16931,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 3u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 3u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16128,7 +16949,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 4u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 4u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16146,7 +16967,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 5u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 5u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16164,7 +16985,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16182,7 +17003,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 1u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 1u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16200,7 +17021,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 2u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 2u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16218,7 +17039,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 3u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 3u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16236,7 +17057,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 4u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 4u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16254,7 +17075,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 5u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 5u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16281,7 +17102,7 @@ static void eFSS_LOGCTST_GenTest(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u, 8u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u, 8u, 0u) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16298,7 +17119,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 26 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 1u, 8u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 1u, 8u, 0u) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16315,7 +17136,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 27 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, 8u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, 8u, 0u) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16332,7 +17153,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 28 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 3u, 8u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 3u, 8u, 0u) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16349,7 +17170,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 29 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 4u, 8u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 4u, 8u, 0u) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16366,7 +17187,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 30 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 5u, 8u) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 5u, 8u, 0u) )
     {
         /* Function */
         if( 0u == l_uByteInPage)
@@ -16394,7 +17215,7 @@ static void eFSS_LOGCTST_GenTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16414,7 +17235,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 1u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 1u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16434,7 +17255,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16454,7 +17275,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 3u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 3u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16474,7 +17295,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 4u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 4u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16494,7 +17315,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 5u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 5u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x02u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16523,7 +17344,7 @@ static void eFSS_LOGCTST_GenTest(void)
     l_ltUseBuff.puBuf[6u] = 0x07u;
     l_ltUseBuff.puBuf[7u] = 0x08u;
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 0u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u) )
     {
         /* Function */
         if( 0x08u == l_uByteInPage)
@@ -16540,7 +17361,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 38 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 1u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 1u, 8u, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 0u) )
     {
         /* Function */
         if( 0x08u == l_uByteInPage)
@@ -16557,7 +17378,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 39 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 2u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 2u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         /* Function */
         if( 0x08u == l_uByteInPage)
@@ -16574,7 +17395,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 40 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 3u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 3u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         /* Function */
         if( 0x08u == l_uByteInPage)
@@ -16591,7 +17412,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 41 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 4u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 4u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         /* Function */
         if( 0x08u == l_uByteInPage)
@@ -16608,7 +17429,7 @@ static void eFSS_LOGCTST_GenTest(void)
         (void)printf("eFSS_LOGCTST_GenTest 42 -- FAIL \n");
     }
 
-    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 5u, 8u, e_eFSS_LOGC_PAGETYPE_LOG) )
+    if( e_eFSS_LOGC_RES_OK_BKP_RCVRD == eFSS_LOGC_FlushBuffIfNotEquals(&l_tCtx, 5u, 8u, e_eFSS_LOGC_PAGETYPE_LOG, 0u) )
     {
         /* Function */
         if( 0x08u == l_uByteInPage)
@@ -16636,7 +17457,7 @@ static void eFSS_LOGCTST_GenTest(void)
     l_ltUseBuff.puBuf[7u] = 0x00u;
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 0u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x01u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16656,7 +17477,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 1u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 1u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x01u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16676,7 +17497,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x01u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16696,7 +17517,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 3u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 3u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x01u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16716,7 +17537,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 4u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 4u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x01u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16736,7 +17557,7 @@ static void eFSS_LOGCTST_GenTest(void)
     }
 
     l_uByteInPage = 0u;
-    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 5u, &l_uByteInPage) )
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_LoadBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 5u, &l_uByteInPage, &l_uSeqN) )
     {
         /* Function */
         if( ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0x01u == l_ltUseBuff.puBuf[1u] ) && ( 0x03u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
@@ -16875,6 +17696,301 @@ static void eFSS_LOGCTST_GenTest(void)
     (void)l_ltUseBuff.puBuf;
 }
 
+static void eFSS_LOGCTST_GetPageSeqNTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOGC_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[72u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    t_eFSS_LOGC_StorBuf l_ltUseBuff;
+    uint32_t l_uPageUsable;
+    uint32_t l_uSeqN;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGCTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGCTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGCTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGCTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOGC_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOGC_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOGC_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOGC_RES_OK;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 36u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uPageUsable = 0u;
+    l_uSeqN = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_NOINITLIB == eFSS_LOGC_GetPageSeqN(&l_tCtx, 0u, &l_uSeqN) )
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false, true ) )
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetBuffNUsable(&l_tCtx, &l_ltUseBuff, &l_uPageUsable) )
+    {
+        if( ( 8u == l_ltUseBuff.uBufL ) && ( 7u == l_uPageUsable ) )
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 3  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_GetPageSeqN(NULL, 0u, &l_uSeqN) ) &&
+        ( e_eFSS_LOGC_RES_BADPOINTER == eFSS_LOGC_GetPageSeqN(&l_tCtx, 0u, NULL) ) )
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 4  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_BADPARAM == eFSS_LOGC_GetPageSeqN(&l_tCtx, 7u, &l_uSeqN) )
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 5  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_GetPageSeqN(&l_tCtx, 2u, &l_uSeqN) )
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 6  -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------- Sequence number stored in the page meta */
+    /* Setup buffer */
+    l_ltUseBuff.puBuf[0u] = 0x01u;
+    l_ltUseBuff.puBuf[1u] = 0x02u;
+    l_ltUseBuff.puBuf[2u] = 0x03u;
+    l_ltUseBuff.puBuf[3u] = 0x04u;
+    l_ltUseBuff.puBuf[4u] = 0x05u;
+    l_ltUseBuff.puBuf[5u] = 0x06u;
+    l_ltUseBuff.puBuf[6u] = 0x07u;
+    l_ltUseBuff.puBuf[7u] = 0x08u;
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_LOG, 2u, 8u, 0x12345678u) )
+    {
+        if( ( 0x08u == m_auStorArea[2u][8u]  ) && ( 0x00u == m_auStorArea[2u][9u]  ) &&
+            ( 0x00u == m_auStorArea[2u][10u] ) && ( 0x00u == m_auStorArea[2u][11u] ) &&
+            ( 0x78u == m_auStorArea[2u][12u] ) && ( 0x56u == m_auStorArea[2u][13u] ) &&
+            ( 0x34u == m_auStorArea[2u][14u] ) && ( 0x12u == m_auStorArea[2u][15u] ) &&
+            ( 0x01u == m_auStorArea[2u][16u] ) &&
+            ( 0x78u == m_auStorArea[9u][12u] ) && ( 0x56u == m_auStorArea[9u][13u] ) &&
+            ( 0x34u == m_auStorArea[9u][14u] ) && ( 0x12u == m_auStorArea[9u][15u] ) &&
+            ( 0x02u == m_auStorArea[9u][16u] ) )
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 7  -- FAIL \n");
+    }
+
+    /* Function */
+    l_uSeqN = 0u;
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetPageSeqN(&l_tCtx, 2u, &l_uSeqN) )
+    {
+        if( 0x12345678u == l_uSeqN )
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 8  -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------ Origin corrupted, backup is used but kept */
+    m_auStorArea[2u][0u] = 0xFFu;
+
+    /* Function */
+    l_uSeqN = 0u;
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetPageSeqN(&l_tCtx, 2u, &l_uSeqN) )
+    {
+        if( ( 0x12345678u == l_uSeqN ) && ( 0xFFu == m_auStorArea[2u][0u] ) )
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 9  -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------------- Origin and backup both corrupted */
+    m_auStorArea[9u][0u] = 0xFFu;
+
+    /* Function */
+    if( e_eFSS_LOGC_RES_NOTVALIDLOG == eFSS_LOGC_GetPageSeqN(&l_tCtx, 2u, &l_uSeqN) )
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 10 -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------ Every log subtype carries the sequence */
+    /* Function */
+    if( ( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST, 4u, 3u, 0x00000009u) ) &&
+        ( e_eFSS_LOGC_RES_OK == eFSS_LOGC_FlushBufferAs(&l_tCtx, e_eFSS_LOGC_PAGETYPE_NEWEST_BKUP, 5u, 3u, 0x0000000Au) ) )
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 11 -- FAIL \n");
+    }
+
+    /* Function */
+    l_uSeqN = 0u;
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetPageSeqN(&l_tCtx, 4u, &l_uSeqN) )
+    {
+        if( 0x00000009u == l_uSeqN )
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 12 -- FAIL \n");
+    }
+
+    /* Function */
+    l_uSeqN = 0u;
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetPageSeqN(&l_tCtx, 5u, &l_uSeqN) )
+    {
+        if( 0x0000000Au == l_uSeqN )
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 13 -- FAIL \n");
+    }
+
+    /* ------------------------------------------------ Corrupted newest page, the sequence is read from the backup */
+    l_ltUseBuff.puBuf[0u] = 0x00u;
+    m_auStorArea[4u][0u] = 0xAAu;
+
+    /* Function */
+    l_uSeqN = 0u;
+    if( e_eFSS_LOGC_RES_OK == eFSS_LOGC_GetPageSeqN(&l_tCtx, 4u, &l_uSeqN) )
+    {
+        /* The origin is corrupted now, so the sequence number comes from the backup */
+        if( ( 0x00000009u == l_uSeqN ) && ( 0xAAu == m_auStorArea[4u][0u] ) )
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGCTST_GetPageSeqNTest 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGCTST_GetPageSeqNTest 14 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+    (void)l_ltUseBuff.puBuf;
+}
+
 
 #ifdef __IAR_SYSTEMS_ICC__
     #pragma cstat_restore = "MISRAC2012-Rule-8.13", "MISRAC2012-Rule-10.5"
@@ -12,6 +12,7 @@
  **********************************************************************************************************************/
 #include "eFSS_COREHLTST.h"
 #include "eFSS_COREHL.h"
+#include "eFSS_Utils.h"
 #include <stdio.h>
 
 
@@ -119,6 +120,7 @@ static void eFSS_COREHLTST_Compare(void);
 static void eFSS_COREHLTST_LoadBkupTest(void);
 static void eFSS_COREHLTST_FlushBkupTest(void);
 static void eFSS_COREHLTST_GenTest(void);
+static void eFSS_COREHLTST_UpdCrcTest(void);
 
 
 
@@ -142,6 +144,7 @@ void eFSS_COREHLTST_ExeTest(void)
     eFSS_COREHLTST_LoadBkupTest();
     eFSS_COREHLTST_FlushBkupTest();
     eFSS_COREHLTST_GenTest();
+    eFSS_COREHLTST_UpdCrcTest();
 
     (void)printf("\n\nCORE HIGH LEVEL TEST END \n\n");
 }
@@ -850,12 +853,24 @@ void eFSS_COREHLTST_BadPointer(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 1u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     l_uStorType = 1u;
     l_uSubTypeRead = 0u;
@@ -1396,6 +1411,14 @@ void eFSS_COREHLTST_BadParamEntr(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -1412,6 +1435,10 @@ void eFSS_COREHLTST_BadParamEntr(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     l_uStorType = 1u;
     l_uSubTypeRead = 0u;
@@ -1731,12 +1758,24 @@ void eFSS_COREHLTST_CorruptedCtx(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 1u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
     l_uSubTypeRead = 0u;
     l_uSubTypeWrite = 0u;
@@ -2331,6 +2370,14 @@ void eFSS_COREHLTST_Basic(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -2347,6 +2394,10 @@ void eFSS_COREHLTST_Basic(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* Function */
@@ -2492,6 +2543,14 @@ void eFSS_COREHLTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -2508,6 +2567,10 @@ void eFSS_COREHLTST_BadClBckNRetry(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
     l_uSubTypeRead = 0u;
     l_uSubTypeWrite = 0u;
@@ -3720,12 +3783,24 @@ static void eFSS_COREHLTST_CrcTest(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 1u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -4076,12 +4151,24 @@ static void eFSS_COREHLTST_LoadTest(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -4913,12 +5000,24 @@ static void eFSS_COREHLTST_FlushTest(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -5210,12 +5309,24 @@ static void eFSS_COREHLTST_Compare(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
     l_bIsEquals = false;
 
@@ -5736,12 +5847,24 @@ static void eFSS_COREHLTST_LoadBkupTest(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -6788,12 +6911,24 @@ static void eFSS_COREHLTST_FlushBkupTest(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -6969,12 +7104,24 @@ static void eFSS_COREHLTST_GenTest(void)
     l_tCtxCb.fRead = &eFSS_COREHLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
     l_uSubTypeRead = 0u;
 
@@ -7213,3 +7360,200 @@ static void eFSS_COREHLTST_GenTest(void)
     (void)l_tCtxCrc32.uTimeUsed;
 }
 
+static void eFSS_COREHLTST_UpdCrcTest(void)
+{
+    /* Local variable */
+    t_eFSS_COREHL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_COREHL_StorBuf l_ltUseBuff;
+    t_eFSS_TYPE_Stats l_tStats;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[48u];
+    uint8_t l_uSubTypeRead;
+    uint32_t l_uCrcCalc;
+    uint32_t l_uCrcStored;
+    uint32_t l_uCrcCalcBkp;
+    uint32_t l_uCrcStoredBkp;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Init callback var, the CRC is the built-in one */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_COREHLTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_COREHLTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_COREHLTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_Utils_Crc32Cb;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 2u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uStorType = 1u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_COREHL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_COREHL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_COREHL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_COREHL_RES_OK;
+
+    /* Function */
+    l_tCtx.tCORELLCtx.bIsInit = false;
+    if( ( e_eFSS_COREHL_RES_BADPOINTER == eFSS_COREHL_UpdCrcInBuff(NULL, 0u, 1u, true) ) &&
+        ( e_eFSS_COREHL_RES_NOINITLIB == eFSS_COREHL_UpdCrcInBuff(&l_tCtx, 0u, 1u, true) ) )
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 1  -- FAIL \n");
+    }
+
+    /* The range cannot be empty or include the sub type */
+    if( ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_GetBuff(&l_tCtx, &l_ltUseBuff) ) && ( 4u == l_ltUseBuff.uBufL ) &&
+        ( e_eFSS_COREHL_RES_BADPARAM == eFSS_COREHL_UpdCrcInBuff(&l_tCtx, 0u, 0u, true) ) &&
+        ( e_eFSS_COREHL_RES_BADPARAM == eFSS_COREHL_UpdCrcInBuff(&l_tCtx, 4u, 1u, true) ) &&
+        ( e_eFSS_COREHL_RES_BADPARAM == eFSS_COREHL_UpdCrcInBuff(&l_tCtx, 2u, 3u, true) ) )
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 2  -- FAIL \n");
+    }
+
+    /* Flush a page and his backup, the stored CRC are the one of the whole pages */
+    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
+    (void)memset(m_auStorArea2, 0, sizeof(m_auStorArea2));
+    l_ltUseBuff.puBuf[0u] = 0x01u;
+    l_ltUseBuff.puBuf[1u] = 0x02u;
+    l_ltUseBuff.puBuf[2u] = 0x03u;
+    l_ltUseBuff.puBuf[3u] = 0x04u;
+    l_uCrcCalc = 0u;
+    l_uCrcStored = 0u;
+    l_uCrcCalcBkp = 0u;
+    l_uCrcStoredBkp = 0u;
+    if( ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_FlushBuffInPageNBkp(&l_tCtx, 0u, 1u, 0x03u, 0x04u) ) &&
+        ( true == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, m_auStorArea1, 20u, &l_uCrcCalc) ) &&
+        ( true == eFSS_Utils_RetriveU32(&m_auStorArea1[20u], &l_uCrcStored) ) && ( l_uCrcCalc == l_uCrcStored ) &&
+        ( true == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, m_auStorArea2, 20u, &l_uCrcCalcBkp) ) &&
+        ( true == eFSS_Utils_RetriveU32(&m_auStorArea2[20u], &l_uCrcStoredBkp) ) &&
+        ( l_uCrcCalcBkp == l_uCrcStoredBkp ) )
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 3  -- FAIL \n");
+    }
+
+    /* Patch a range of the flushed buffer, the CRC of both pages is updated and not calculated again */
+    if( ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_UpdCrcInBuff(&l_tCtx, 1u, 2u, true) ) &&
+        ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_ResetStats(&l_tCtx) ) )
+    {
+        l_ltUseBuff.puBuf[1u] = 0xA1u;
+        l_ltUseBuff.puBuf[2u] = 0xA2u;
+        l_uCrcCalc = 0u;
+        l_uCrcStored = 0u;
+        l_uCrcCalcBkp = 0u;
+        l_uCrcStoredBkp = 0u;
+        if( ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_UpdCrcInBuff(&l_tCtx, 1u, 2u, false) ) &&
+            ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_FlushBuffInPageNBkp(&l_tCtx, 0u, 1u, 0x03u, 0x04u) ) &&
+            ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_GetStats(&l_tCtx, &l_tStats) ) && ( 68u == l_tStats.uCrcByte ) &&
+            ( 0xA1u == m_auStorArea1[1u] ) && ( 0xA2u == m_auStorArea1[2u] ) && ( 0x03u == m_auStorArea1[4u] ) &&
+            ( 0xA1u == m_auStorArea2[1u] ) && ( 0xA2u == m_auStorArea2[2u] ) && ( 0x04u == m_auStorArea2[4u] ) &&
+            ( true == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, m_auStorArea1, 20u, &l_uCrcCalc) ) &&
+            ( true == eFSS_Utils_RetriveU32(&m_auStorArea1[20u], &l_uCrcStored) ) && ( l_uCrcCalc == l_uCrcStored ) &&
+            ( true == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, m_auStorArea2, 20u, &l_uCrcCalcBkp) ) &&
+            ( true == eFSS_Utils_RetriveU32(&m_auStorArea2[20u], &l_uCrcStoredBkp) ) &&
+            ( l_uCrcCalcBkp == l_uCrcStoredBkp ) )
+        {
+            (void)printf("eFSS_COREHLTST_UpdCrcTest 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_COREHLTST_UpdCrcTest 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 4  -- FAIL \n");
+    }
+
+    /* Both the pages can be loaded back and are equals */
+    if( ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_LoadPageInBuffNRipBkp(&l_tCtx, 0u, 1u, 0x03u, 0x04u) ) &&
+        ( 0x01u == l_ltUseBuff.puBuf[0u] ) && ( 0xA1u == l_ltUseBuff.puBuf[1u] ) &&
+        ( 0xA2u == l_ltUseBuff.puBuf[2u] ) && ( 0x04u == l_ltUseBuff.puBuf[3u] ) &&
+        ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_LoadPageInBuff(&l_tCtx, 1u, &l_uSubTypeRead) ) &&
+        ( 0x04u == l_uSubTypeRead ) )
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 5  -- FAIL \n");
+    }
+
+    /* With a different CRC callback the polynomial is unknown: the callback is not used to update the CRC, and the
+       flush calculate it as usual */
+    l_tCtxCb.fCrc32 = &eFSS_COREHLTST_CrcTst1Adapt;
+    if( ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_GetBuff(&l_tCtx, &l_ltUseBuff) ) &&
+        ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_FlushBuffInPageNBkp(&l_tCtx, 0u, 1u, 0x03u, 0x04u) ) &&
+        ( 2u == l_tCtxCrc32.uTimeUsed ) &&
+        ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_UpdCrcInBuff(&l_tCtx, 1u, 2u, true) ) )
+    {
+        l_ltUseBuff.puBuf[1u] = 0x44u;
+        l_ltUseBuff.puBuf[2u] = 0x44u;
+        if( ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_UpdCrcInBuff(&l_tCtx, 1u, 2u, false) ) &&
+            ( 2u == l_tCtxCrc32.uTimeUsed ) &&
+            ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_FlushBuffInPageNBkp(&l_tCtx, 0u, 1u, 0x03u, 0x04u) ) &&
+            ( 4u == l_tCtxCrc32.uTimeUsed ) &&
+            ( e_eFSS_COREHL_RES_OK == eFSS_COREHL_LoadPageInBuffNRipBkp(&l_tCtx, 0u, 1u, 0x03u, 0x04u) ) &&
+            ( 0x44u == l_ltUseBuff.puBuf[1u] ) && ( 0x44u == l_ltUseBuff.puBuf[2u] ) )
+        {
+            (void)printf("eFSS_COREHLTST_UpdCrcTest 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_COREHLTST_UpdCrcTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_COREHLTST_UpdCrcTest 6  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+}
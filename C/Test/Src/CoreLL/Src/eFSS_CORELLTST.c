@@ -12,6 +12,7 @@
  **********************************************************************************************************************/
 #include "eFSS_CORELLTST.h"
 #include "eFSS_CORELL.h"
+#include "eFSS_Utils.h"
 #include <stdio.h>
 
 
@@ -43,6 +44,24 @@ struct t_eFSS_TYPE_CrcCtxUser
     uint32_t uTimeUsed;
 };
 
+struct t_eFSS_TYPE_IsErasedCtxUser
+{
+    e_eFSS_CORELL_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_ReadRangeCtxUser
+{
+    e_eFSS_CORELL_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_WriteRangeCtxUser
+{
+    e_eFSS_CORELL_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
 
 
 /***********************************************************************************************************************
@@ -95,6 +114,54 @@ static bool_t eFSS_CORELLTST_CrcTst1Adapt(t_eFSS_TYPE_CrcCtx* const p_ptCtx, con
                                           const uint8_t* p_puData, const uint32_t p_uDataL,
                                           uint32_t* const p_puCrc32Val );
 
+static bool_t eFSS_CORELLTST_IsErasedAdapt(t_eFSS_TYPE_IsErasedCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToCheck, bool_t* const p_pbIsErased);
+
+static bool_t eFSS_CORELLTST_IsErasedErrAdapt(t_eFSS_TYPE_IsErasedCtx* const p_ptCtx,
+                                              const uint32_t p_uPageToCheck, bool_t* const p_pbIsErased);
+
+static bool_t eFSS_CORELLTST_EraseNorAdapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase);
+
+static bool_t eFSS_CORELLTST_WriteNorAdapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                           const uint32_t p_uDataToWriteL );
+
+static bool_t eFSS_CORELLTST_ReadRangeAdapt(t_eFSS_TYPE_ReadRangeCtx* const p_ptCtx,
+                                            const uint32_t p_uPageToRead, const uint32_t p_uOffset,
+                                            uint8_t* const p_puReadBuffer, const uint32_t p_uReadBufferL );
+
+static bool_t eFSS_CORELLTST_WriteRangeNorAdapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                                const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                                const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL );
+
+static bool_t eFSS_CORELLTST_EraseBlkAdapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase);
+
+static bool_t eFSS_CORELLTST_WriteBlkAdapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                           const uint32_t p_uDataToWriteL );
+
+static bool_t eFSS_CORELLTST_ReadBlkAdapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                          const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                          const uint32_t p_uReadBufferL );
+
+static bool_t eFSS_CORELLTST_WriteRangeBlkAdapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                                const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                                const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL );
+
+static bool_t eFSS_CORELLTST_EraseProgAdapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase);
+
+static bool_t eFSS_CORELLTST_WriteProgAdapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                            const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                            const uint32_t p_uDataToWriteL );
+
+static bool_t eFSS_CORELLTST_ReadProgAdapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                           const uint32_t p_uReadBufferL );
+
+static bool_t eFSS_CORELLTST_WriteRangeProgAdapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                                 const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                                 const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL );
+
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION DECLARATION
  **********************************************************************************************************************/
@@ -108,6 +175,14 @@ static void eFSS_CORELLTST_CrcTest(void);
 static void eFSS_CORELLTST_LoadTest(void);
 static void eFSS_CORELLTST_FlushTest(void);
 static void eFSS_CORELLTST_GenTest(void);
+static void eFSS_CORELLTST_BlankCheckTest(void);
+static void eFSS_CORELLTST_RangeTest(void);
+static void eFSS_CORELLTST_SingleBufTest(void);
+static void eFSS_CORELLTST_StatsTest(void);
+static void eFSS_CORELLTST_CompactTest(void);
+static void eFSS_CORELLTST_BlockTest(void);
+static void eFSS_CORELLTST_UpdCrcTest(void);
+static void eFSS_CORELLTST_ProgTest(void);
 
 
 
@@ -128,6 +203,14 @@ void eFSS_CORELLTST_ExeTest(void)
     eFSS_CORELLTST_LoadTest();
     eFSS_CORELLTST_FlushTest();
     eFSS_CORELLTST_GenTest();
+    eFSS_CORELLTST_BlankCheckTest();
+    eFSS_CORELLTST_RangeTest();
+    eFSS_CORELLTST_SingleBufTest();
+    eFSS_CORELLTST_StatsTest();
+    eFSS_CORELLTST_CompactTest();
+    eFSS_CORELLTST_BlockTest();
+    eFSS_CORELLTST_UpdCrcTest();
+    eFSS_CORELLTST_ProgTest();
 
     (void)printf("\n\nCORE LOW LEVEL TEST END \n\n");
 }
@@ -140,6 +223,9 @@ static bool_t  m_bIsErased1 = false;
 static bool_t  m_bIsErased2 = false;
 static uint8_t m_auStorArea1[24u];
 static uint8_t m_auStorArea2[24u];
+static uint8_t m_auStorBlk[4u][24u];
+static uint32_t m_uBlkWriteLeft = MAX_UINT32VAL;
+static uint8_t m_auStorProg[2u][40u];
 
 
 /***********************************************************************************************************************
@@ -644,307 +730,723 @@ static bool_t eFSS_CORELLTST_CrcTst1Adapt(t_eFSS_TYPE_CrcCtx* const p_ptCtx, con
     return l_bRes;
 }
 
-#ifdef __IAR_SYSTEMS_ICC__
-    #pragma cstat_restore = "MISRAC2012-Rule-8.13"
-#endif
-
-/***********************************************************************************************************************
- *   PRIVATE FUNCTION
- **********************************************************************************************************************/
-
-#ifdef __IAR_SYSTEMS_ICC__
-    #pragma cstat_disable = "MISRAC2012-Rule-2.2_b"
-    /* Suppressed for code clarity in test execution*/
-#endif
-
-void eFSS_CORELLTST_BadPointer(void)
+static bool_t eFSS_CORELLTST_IsErasedAdapt(t_eFSS_TYPE_IsErasedCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToCheck, bool_t* const p_pbIsErased)
 {
-    /* Local variable */
-    t_eFSS_CORELL_Ctx l_tCtx;
-    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
-    t_eFSS_TYPE_StorSet l_tStorSet;
-    uint8_t l_uStorType;
-    uint8_t l_auStor[24u];
-    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
-	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
-	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
-	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
-    bool_t l_bIsInit;
-    t_eFSS_TYPE_StorSet l_tGetStorSet;
-    t_eFSS_CORELL_StorBuf l_ltUseBuff1;
-    t_eFSS_CORELL_StorBuf l_ltUseBuff2;
-    uint32_t l_uCrcGetted;
-
-    /* Misra complaiant */
-    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
-    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
-    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
-    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
-    l_tCtxErase.uTimeUsed = 0u;
-    l_tCtxWrite.uTimeUsed = 0u;
-    l_tCtxRead.uTimeUsed = 0u;
-    l_tCtxCrc32.uTimeUsed = 0u;
-
-    /* Init callback var */
-    l_tCtxCb.ptCtxErase = &l_tCtxErase;
-    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseAdapt;
-	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
-    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteAdapt;
-	l_tCtxCb.ptCtxRead = &l_tCtxRead;
-    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadAdapt;
-	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
-    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
-
-    /* Init storage settings */
-    l_tStorSet.uTotPages = 1u;
-    l_tStorSet.uPagesLen = 24u;
-    l_tStorSet.uRWERetry = 2u;
-    l_tStorSet.uPageVersion = 1u;
-
-    l_uStorType = 1u;
+    bool_t l_bRes;
+    (void)p_uPageToCheck;
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(NULL, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    if( ( NULL == p_ptCtx ) || ( NULL == p_pbIsErased ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 1  -- OK \n");
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 1  -- FAIL \n");
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        *p_pbIsErased = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
     }
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, NULL, sizeof(l_auStor) ) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_IsErasedErrAdapt(t_eFSS_TYPE_IsErasedCtx* const p_ptCtx,
+                                              const uint32_t p_uPageToCheck, bool_t* const p_pbIsErased)
+{
+    bool_t l_bRes;
+    (void)p_uPageToCheck;
+    (void)p_pbIsErased;
+
+    if( NULL == p_ptCtx )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 2  -- OK \n");
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 2  -- FAIL \n");
+        p_ptCtx->uTimeUsed++;
+        l_bRes = false;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_BADPOINTER;
     }
 
-    /* Function */
-    l_tCtxCb.ptCtxErase = NULL;
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_EraseNorAdapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( p_uPageToErase >= 2u ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 3  -- OK \n");
-        l_tCtxCb.ptCtxErase = &l_tCtxErase;
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 3  -- FAIL \n");
-        l_tCtxCb.ptCtxErase = &l_tCtxErase;
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        if( 0u == p_uPageToErase )
+        {
+            (void)memset(m_auStorArea1, 0xFF, sizeof(m_auStorArea1));
+        }
+        else
+        {
+            (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+        }
     }
 
-    /* Function */
-    l_tCtxCb.fErase = NULL;
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_WriteNorAdapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                           const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+    uint8_t* l_puArea;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToWrite ) || ( p_uPageToWrite >= 2u ) || ( 24u != p_uDataToWriteL ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 4  -- OK \n");
-        l_tCtxCb.fErase = &eFSS_CORELLTST_EraseAdapt;
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 4  -- FAIL \n");
-        l_tCtxCb.fErase = &eFSS_CORELLTST_EraseAdapt;
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        if( 0u == p_uPageToWrite )
+        {
+            l_puArea = m_auStorArea1;
+        }
+        else
+        {
+            l_puArea = m_auStorArea2;
+        }
+
+        /* A NOR flash can only clear bits */
+        for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+        {
+            l_puArea[l_uCnt] &= p_puDataToWrite[l_uCnt];
+        }
     }
 
-    /* Function */
-    l_tCtxCb.ptCtxWrite = NULL;
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_ReadRangeAdapt(t_eFSS_TYPE_ReadRangeCtx* const p_ptCtx,
+                                            const uint32_t p_uPageToRead, const uint32_t p_uOffset,
+                                            uint8_t* const p_puReadBuffer, const uint32_t p_uReadBufferL )
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puReadBuffer ) || ( p_uPageToRead >= 2u ) ||
+        ( ( p_uOffset + p_uReadBufferL ) > 24u ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 5  -- OK \n");
-        l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 5  -- FAIL \n");
-        l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        if( 0u == p_uPageToRead )
+        {
+            (void)memcpy(p_puReadBuffer, &m_auStorArea1[p_uOffset], p_uReadBufferL);
+        }
+        else
+        {
+            (void)memcpy(p_puReadBuffer, &m_auStorArea2[p_uOffset], p_uReadBufferL);
+        }
     }
 
-    /* Function */
-    l_tCtxCb.fWrite = NULL;
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_WriteRangeNorAdapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                                const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                                const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+    uint8_t* l_puArea;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToWrite ) || ( p_uPageToWrite >= 2u ) ||
+        ( ( p_uOffset + p_uDataToWriteL ) > 24u ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 6  -- OK \n");
-        l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteAdapt;
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 6  -- FAIL \n");
-        l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteAdapt;
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        if( 0u == p_uPageToWrite )
+        {
+            l_puArea = m_auStorArea1;
+        }
+        else
+        {
+            l_puArea = m_auStorArea2;
+        }
+
+        /* A NOR flash can only clear bits */
+        for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+        {
+            l_puArea[p_uOffset + l_uCnt] &= p_puDataToWrite[l_uCnt];
+        }
     }
 
-    /* Function */
-    l_tCtxCb.ptCtxRead = NULL;
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_EraseBlkAdapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase)
+{
+    bool_t l_bRes;
+
+    /* Two pages for every erase block, only the first page of a block can be passed */
+    if( ( NULL == p_ptCtx ) || ( p_uPageToErase >= 4u ) || ( 0u != ( p_uPageToErase % 2u ) ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 7  -- OK \n");
-        l_tCtxCb.ptCtxRead = &l_tCtxRead;
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 7  -- FAIL \n");
-        l_tCtxCb.ptCtxRead = &l_tCtxRead;
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        (void)memset(m_auStorBlk[p_uPageToErase], 0xFF, sizeof(m_auStorBlk[p_uPageToErase]));
+        (void)memset(m_auStorBlk[p_uPageToErase + 1u], 0xFF, sizeof(m_auStorBlk[p_uPageToErase + 1u]));
     }
 
-    /* Function */
-    l_tCtxCb.fRead = NULL;
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_WriteBlkAdapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                           const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToWrite ) || ( p_uPageToWrite >= 4u ) || ( 24u != p_uDataToWriteL ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 8  -- OK \n");
-        l_tCtxCb.fRead = &eFSS_CORELLTST_ReadAdapt;
+        l_bRes = false;
     }
-    else
+    else if( 0u == m_uBlkWriteLeft )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 8  -- FAIL \n");
-        l_tCtxCb.fRead = &eFSS_CORELLTST_ReadAdapt;
-    }
-
-    /* Function */
-    l_tCtxCb.ptCtxCrc32 = NULL;
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
-    {
-        (void)printf("eFSS_CORELLTST_BadPointer 9  -- OK \n");
-        l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+        /* Simulate a power loss, nothing can be written anymore */
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 9  -- FAIL \n");
-        l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        if( MAX_UINT32VAL != m_uBlkWriteLeft )
+        {
+            m_uBlkWriteLeft--;
+        }
+
+        /* A page can be programmed only when erased */
+        for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+        {
+            if( 0xFFu != m_auStorBlk[p_uPageToWrite][l_uCnt] )
+            {
+                l_bRes = false;
+            }
+        }
+
+        if( true == l_bRes )
+        {
+            (void)memcpy(m_auStorBlk[p_uPageToWrite], p_puDataToWrite, p_uDataToWriteL);
+        }
     }
 
-    /* Function */
-    l_tCtxCb.fCrc32 = NULL;
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_ReadBlkAdapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                          const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                          const uint32_t p_uReadBufferL )
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puReadBuffer ) || ( p_uPageToRead >= 4u ) || ( 24u != p_uReadBufferL ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 10 -- OK \n");
-        l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 10 -- FAIL \n");
-        l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        (void)memcpy(p_puReadBuffer, m_auStorBlk[p_uPageToRead], p_uReadBufferL);
     }
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_IsInit(NULL, &l_bIsInit) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_WriteRangeBlkAdapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                                const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                                const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToWrite ) || ( p_uPageToWrite >= 4u ) ||
+        ( ( p_uOffset + p_uDataToWriteL ) > 24u ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 11 -- OK \n");
+        l_bRes = false;
+    }
+    else if( 0u == m_uBlkWriteLeft )
+    {
+        /* Simulate a power loss, nothing can be written anymore */
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 11 -- FAIL \n");
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        if( MAX_UINT32VAL != m_uBlkWriteLeft )
+        {
+            m_uBlkWriteLeft--;
+        }
+
+        /* Only the erased byte can be programmed */
+        for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+        {
+            if( 0xFFu != m_auStorBlk[p_uPageToWrite][p_uOffset + l_uCnt] )
+            {
+                l_bRes = false;
+            }
+        }
+
+        if( true == l_bRes )
+        {
+            (void)memcpy(&m_auStorBlk[p_uPageToWrite][p_uOffset], p_puDataToWrite, p_uDataToWriteL);
+        }
     }
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_IsInit(&l_tCtx, NULL) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_EraseProgAdapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( p_uPageToErase >= 2u ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 12 -- OK \n");
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 12 -- FAIL \n");
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+        (void)memset(m_auStorProg[p_uPageToErase], 0xFF, sizeof(m_auStorProg[p_uPageToErase]));
     }
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetStorSett(NULL, &l_tGetStorSet) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_WriteProgAdapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                            const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                            const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToWrite ) || ( p_uPageToWrite >= 2u ) || ( 40u != p_uDataToWriteL ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 13 -- OK \n");
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 13 -- FAIL \n");
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        /* A NOR flash can only clear bits */
+        for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+        {
+            m_auStorProg[p_uPageToWrite][l_uCnt] &= p_puDataToWrite[l_uCnt];
+        }
     }
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetStorSett(&l_tCtx, NULL) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_ReadProgAdapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                           const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                           const uint32_t p_uReadBufferL )
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puReadBuffer ) || ( p_uPageToRead >= 2u ) || ( 40u != p_uReadBufferL ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 14 -- OK \n");
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 14 -- FAIL \n");
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+        (void)memcpy(p_puReadBuffer, m_auStorProg[p_uPageToRead], p_uReadBufferL);
     }
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuff(NULL, &l_ltUseBuff1, &l_ltUseBuff2) )
+    return l_bRes;
+}
+
+static bool_t eFSS_CORELLTST_WriteRangeProgAdapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                                 const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                                 const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToWrite ) || ( p_uPageToWrite >= 2u ) ||
+        ( ( p_uOffset + p_uDataToWriteL ) > 40u ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 15 -- OK \n");
+        l_bRes = false;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 15 -- FAIL \n");
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_CORELL_RES_OK;
+
+        /* A NOR flash can only clear bits */
+        for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+        {
+            m_auStorProg[p_uPageToWrite][p_uOffset + l_uCnt] &= p_puDataToWrite[l_uCnt];
+        }
     }
 
+    return l_bRes;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "MISRAC2012-Rule-8.13"
+#endif
+
+/***********************************************************************************************************************
+ *   PRIVATE FUNCTION
+ **********************************************************************************************************************/
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "MISRAC2012-Rule-2.2_b"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+void eFSS_CORELLTST_BadPointer(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[24u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    bool_t l_bIsInit;
+    t_eFSS_TYPE_StorSet l_tGetStorSet;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff1;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff2;
+    uint32_t l_uCrcGetted;
+
+    /* Misra complaiant */
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxCrc32.uTimeUsed = 0u;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadAdapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 1u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 2u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+
+    l_uStorType = 1u;
+
     /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuff(&l_tCtx, NULL, &l_ltUseBuff2) )
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(NULL, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 16 -- OK \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 1  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 16 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 1  -- FAIL \n");
     }
 
     /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, NULL) )
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, NULL, sizeof(l_auStor) ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 17 -- OK \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 2  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 17 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 2  -- FAIL \n");
     }
 
     /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuffNStor(NULL, &l_ltUseBuff1, &l_ltUseBuff2, &l_tGetStorSet) )
+    l_tCtxCb.ptCtxErase = NULL;
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 18 -- OK \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 3  -- OK \n");
+        l_tCtxCb.ptCtxErase = &l_tCtxErase;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 18 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 3  -- FAIL \n");
+        l_tCtxCb.ptCtxErase = &l_tCtxErase;
     }
 
     /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuffNStor(&l_tCtx, NULL, &l_ltUseBuff2, &l_tGetStorSet) )
+    l_tCtxCb.fErase = NULL;
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 19 -- OK \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 4  -- OK \n");
+        l_tCtxCb.fErase = &eFSS_CORELLTST_EraseAdapt;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 19 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 4  -- FAIL \n");
+        l_tCtxCb.fErase = &eFSS_CORELLTST_EraseAdapt;
     }
 
     /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuffNStor(&l_tCtx, &l_ltUseBuff1, NULL, &l_tGetStorSet) )
+    l_tCtxCb.ptCtxWrite = NULL;
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 20 -- OK \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 5  -- OK \n");
+        l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 20 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 5  -- FAIL \n");
+        l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
     }
 
     /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuffNStor(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2, NULL) )
+    l_tCtxCb.fWrite = NULL;
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 21 -- OK \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 6  -- OK \n");
+        l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteAdapt;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 21 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 6  -- FAIL \n");
+        l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteAdapt;
     }
 
     /* Function */
-    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_LoadPageInBuff(NULL, e_eFSS_CORELL_BUFFTYPE_1, 0u) )
+    l_tCtxCb.ptCtxRead = NULL;
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 22 -- OK \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 7  -- OK \n");
+        l_tCtxCb.ptCtxRead = &l_tCtxRead;
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_BadPointer 22 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_BadPointer 7  -- FAIL \n");
+        l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    }
+
+    /* Function */
+    l_tCtxCb.fRead = NULL;
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 8  -- OK \n");
+        l_tCtxCb.fRead = &eFSS_CORELLTST_ReadAdapt;
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 8  -- FAIL \n");
+        l_tCtxCb.fRead = &eFSS_CORELLTST_ReadAdapt;
+    }
+
+    /* Function */
+    l_tCtxCb.ptCtxCrc32 = NULL;
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 9  -- OK \n");
+        l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 9  -- FAIL \n");
+        l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    }
+
+    /* Function */
+    l_tCtxCb.fCrc32 = NULL;
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 10 -- OK \n");
+        l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 10 -- FAIL \n");
+        l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_IsInit(NULL, &l_bIsInit) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 11 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_IsInit(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 12 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetStorSett(NULL, &l_tGetStorSet) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 13 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetStorSett(&l_tCtx, NULL) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 14 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuff(NULL, &l_ltUseBuff1, &l_ltUseBuff2) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 15 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuff(&l_tCtx, NULL, &l_ltUseBuff2) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 16 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, NULL) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 17 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 17 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuffNStor(NULL, &l_ltUseBuff1, &l_ltUseBuff2, &l_tGetStorSet) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 18 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 18 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuffNStor(&l_tCtx, NULL, &l_ltUseBuff2, &l_tGetStorSet) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 19 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 19 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuffNStor(&l_tCtx, &l_ltUseBuff1, NULL, &l_tGetStorSet) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 20 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 20 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetBuffNStor(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2, NULL) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 21 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 21 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_LoadPageInBuff(NULL, e_eFSS_CORELL_BUFFTYPE_1, 0u) )
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 22 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BadPointer 22 -- FAIL \n");
     }
 
     /* Function */
@@ -1111,6 +1613,14 @@ void eFSS_CORELLTST_BadParamEntr(void)
     l_tCtxCb.fRead = &eFSS_CORELLTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -1127,6 +1637,10 @@ void eFSS_CORELLTST_BadParamEntr(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
 
     l_uStorType = 1u;
 
@@ -1318,12 +1832,24 @@ void eFSS_CORELLTST_CorruptedCtx(void)
     l_tCtxCb.fRead = &eFSS_CORELLTST_ReadAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 1u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 2u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* Function */
@@ -1831,6 +2357,14 @@ void eFSS_CORELLTST_Basic(void)
     l_tCtxCb.fRead = &eFSS_CORELLTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -1847,6 +2381,10 @@ void eFSS_CORELLTST_Basic(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* Function */
@@ -1997,6 +2535,14 @@ void eFSS_CORELLTST_BadClBckNRetry(void)
     l_tCtxCb.fRead = &eFSS_CORELLTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
@@ -2013,6 +2559,10 @@ void eFSS_CORELLTST_BadClBckNRetry(void)
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------ TEST READ CALL BACK */
@@ -2596,12 +3146,24 @@ static void eFSS_CORELLTST_CrcTest(void)
     l_tCtxCb.fRead = &eFSS_CORELLTST_ReadErrAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcAdapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 1u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -3056,12 +3618,24 @@ static void eFSS_CORELLTST_LoadTest(void)
     l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -3805,12 +4379,24 @@ static void eFSS_CORELLTST_FlushTest(void)
     l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
     l_tStorSet.uPagesLen = 24u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
     /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
@@ -4088,11 +4674,1632 @@ static void eFSS_CORELLTST_FlushTest(void)
         (void)printf("eFSS_CORELLTST_FlushTest 6  -- FAIL \n");
     }
 
-    /* Function */
-    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseTst1Adapt;
-    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteTst1Adapt;
-    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst2Adapt;
-    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+    /* Function */
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseTst1Adapt;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteTst1Adapt;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst2Adapt;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 7  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2) )
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 8  -- FAIL \n");
+    }
+
+    /* Setup storage area */
+    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
+    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+
+    /* Setup buffer */
+    l_ltUseBuff1.puBuf[0u] = 0x01u;
+    l_ltUseBuff1.puBuf[1u] = 0x02u;
+    l_ltUseBuff1.puBuf[2u] = 0x03u;
+    l_ltUseBuff1.puBuf[3u] = 0x04u;
+    l_ltUseBuff1.puBuf[4u] = 0x05u;
+
+    l_ltUseBuff2.puBuf[0u] = 0x11u;
+    l_ltUseBuff2.puBuf[1u] = 0x12u;
+    l_ltUseBuff2.puBuf[2u] = 0x13u;
+    l_ltUseBuff2.puBuf[3u] = 0x14u;
+    l_ltUseBuff2.puBuf[4u] = 0x15u;
+
+    if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) )
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 9  -- FAIL \n");
+    }
+
+    /* Setup storage area */
+    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
+    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+
+    /* Setup buffer */
+    l_ltUseBuff1.puBuf[0u] = 0x01u;
+    l_ltUseBuff1.puBuf[1u] = 0x02u;
+    l_ltUseBuff1.puBuf[2u] = 0x03u;
+    l_ltUseBuff1.puBuf[3u] = 0x04u;
+    l_ltUseBuff1.puBuf[4u] = 0x05u;
+
+    l_ltUseBuff2.puBuf[0u] = 0x11u;
+    l_ltUseBuff2.puBuf[1u] = 0x12u;
+    l_ltUseBuff2.puBuf[2u] = 0x13u;
+    l_ltUseBuff2.puBuf[3u] = 0x14u;
+    l_ltUseBuff2.puBuf[4u] = 0x15u;
+
+    if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) )
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 10 -- FAIL \n");
+    }
+
+    /* Setup storage area */
+    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
+    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+
+    /* Setup buffer */
+    l_ltUseBuff1.puBuf[0u] = 0x01u;
+    l_ltUseBuff1.puBuf[1u] = 0x02u;
+    l_ltUseBuff1.puBuf[2u] = 0x03u;
+    l_ltUseBuff1.puBuf[3u] = 0x04u;
+    l_ltUseBuff1.puBuf[4u] = 0x05u;
+
+    l_ltUseBuff2.puBuf[0u] = 0x11u;
+    l_ltUseBuff2.puBuf[1u] = 0x12u;
+    l_ltUseBuff2.puBuf[2u] = 0x13u;
+    l_ltUseBuff2.puBuf[3u] = 0x14u;
+    l_ltUseBuff2.puBuf[4u] = 0x15u;
+
+    if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) )
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 11 -- FAIL \n");
+    }
+
+    /* Setup storage area */
+    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
+    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+
+    /* Setup buffer */
+    l_ltUseBuff1.puBuf[0u] = 0x01u;
+    l_ltUseBuff1.puBuf[1u] = 0x02u;
+    l_ltUseBuff1.puBuf[2u] = 0x03u;
+    l_ltUseBuff1.puBuf[3u] = 0x04u;
+    l_ltUseBuff1.puBuf[4u] = 0x05u;
+
+    l_ltUseBuff2.puBuf[0u] = 0x11u;
+    l_ltUseBuff2.puBuf[1u] = 0x12u;
+    l_ltUseBuff2.puBuf[2u] = 0x13u;
+    l_ltUseBuff2.puBuf[3u] = 0x14u;
+    l_ltUseBuff2.puBuf[4u] = 0x15u;
+
+    if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) )
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_FlushTest 12 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+    (void)l_ltUseBuff1.puBuf;
+    (void)l_ltUseBuff2.puBuf;
+}
+
+static void eFSS_CORELLTST_GenTest(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[48u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff1;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff2;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 2u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uStorType = 1u;
+
+    /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
+    /* Function */
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseTst1Adapt;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteTst1Adapt;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2) )
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 2  -- FAIL \n");
+    }
+
+    /* Setup storage area */
+    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
+    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+
+    /* Setup buffer */
+    l_ltUseBuff1.puBuf[0u] = 0x01u;
+    l_ltUseBuff1.puBuf[1u] = 0x02u;
+    l_ltUseBuff1.puBuf[2u] = 0x03u;
+    l_ltUseBuff1.puBuf[3u] = 0x04u;
+    l_ltUseBuff1.puBuf[4u] = 0x05u;
+
+    l_ltUseBuff2.puBuf[0u] = 0x11u;
+    l_ltUseBuff2.puBuf[1u] = 0x12u;
+    l_ltUseBuff2.puBuf[2u] = 0x13u;
+    l_ltUseBuff2.puBuf[3u] = 0x14u;
+    l_ltUseBuff2.puBuf[4u] = 0x15u;
+
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) )
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 3  -- FAIL \n");
+    }
+
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) )
+    {
+        if( ( 0x01u== l_ltUseBuff2.puBuf[0u] ) && ( 0x02u== l_ltUseBuff2.puBuf[1u] ) && ( 0x03u== l_ltUseBuff2.puBuf[2u] ) &&
+             ( 0x04u== l_ltUseBuff2.puBuf[3u] ) && ( 0x05u== l_ltUseBuff2.puBuf[4u] ))
+        {
+            (void)printf("eFSS_CORELLTST_GenTest 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_CORELLTST_GenTest 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 4  -- FAIL \n");
+    }
+
+    /* Setup storage area */
+    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
+    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+
+    /* Setup buffer */
+    l_ltUseBuff1.puBuf[0u] = 0x01u;
+    l_ltUseBuff1.puBuf[1u] = 0x02u;
+    l_ltUseBuff1.puBuf[2u] = 0x03u;
+    l_ltUseBuff1.puBuf[3u] = 0x04u;
+    l_ltUseBuff1.puBuf[4u] = 0x05u;
+
+    l_ltUseBuff2.puBuf[0u] = 0x11u;
+    l_ltUseBuff2.puBuf[1u] = 0x12u;
+    l_ltUseBuff2.puBuf[2u] = 0x13u;
+    l_ltUseBuff2.puBuf[3u] = 0x14u;
+    l_ltUseBuff2.puBuf[4u] = 0x15u;
+
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) )
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 5  -- FAIL \n");
+    }
+
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) )
+    {
+        if( ( 0x11u== l_ltUseBuff1.puBuf[0u] ) && ( 0x12u== l_ltUseBuff1.puBuf[1u] ) && ( 0x13u== l_ltUseBuff1.puBuf[2u] ) &&
+            ( 0x14u== l_ltUseBuff1.puBuf[3u] ) && ( 0x15u== l_ltUseBuff1.puBuf[4u] ))
+        {
+            (void)printf("eFSS_CORELLTST_GenTest 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_CORELLTST_GenTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_GenTest 6  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+    (void)l_ltUseBuff2.puBuf;
+}
+
+static void eFSS_CORELLTST_BlankCheckTest(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[48u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+	t_eFSS_TYPE_IsErasedCtx l_tCtxIsErased;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff1;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff2;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = &eFSS_CORELLTST_IsErasedAdapt;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings, the test erase callback set the page to zero */
+    l_tStorSet.uTotPages = 2u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = true;
+    l_tStorSet.uErasedVal = 0x00u;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uStorType = 1u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxIsErased.uTimeUsed = 0u;
+    l_tCtxIsErased.eLastEr = e_eFSS_CORELL_RES_OK;
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 1  -- FAIL \n");
+    }
+
+    /* ---------------------------------------------------------------------------------- TEST BLANK CHECK WITH READ */
+    l_tCtxCb.fIsErased = NULL;
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 3  -- FAIL \n");
+    }
+
+    /* Setup storage area, already blank */
+    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
+    m_bIsErased1 = true;
+    l_ltUseBuff1.puBuf[0u] = 0x01u;
+
+    /* Function */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 0u == l_tCtxErase.uTimeUsed ) && ( 1u == l_tCtxWrite.uTimeUsed ) && ( 2u == l_tCtxRead.uTimeUsed ) &&
+        ( 0x01u == m_auStorArea1[0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 4  -- FAIL \n");
+    }
+
+    /* Storage area is not blank anymore */
+    l_ltUseBuff1.puBuf[0u] = 0x02u;
+
+    /* Function */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 1u == l_tCtxErase.uTimeUsed ) && ( 2u == l_tCtxWrite.uTimeUsed ) && ( 4u == l_tCtxRead.uTimeUsed ) &&
+        ( 0x02u == m_auStorArea1[0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 5  -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------------------ TEST BLANK CHECK WITH CALLBACK */
+    l_tCtxCb.ptCtxIsErased = &l_tCtxIsErased;
+    l_tCtxCb.fIsErased = &eFSS_CORELLTST_IsErasedAdapt;
+    l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+    l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+    l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 6  -- FAIL \n");
+    }
+
+    /* Setup storage area, the callback always report a blank page */
+    (void)memset(m_auStorArea2, 0, sizeof(m_auStorArea2));
+    m_bIsErased2 = true;
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_ltUseBuff1.puBuf[0u] = 0x03u;
+
+    /* Function */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( 0u == l_tCtxErase.uTimeUsed ) && ( 1u == l_tCtxRead.uTimeUsed ) && ( 1u == l_tCtxIsErased.uTimeUsed ) &&
+        ( 0x03u == m_auStorArea2[0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 7  -- FAIL \n");
+    }
+
+    /* An error in the blank check consume a try, and the next one will erase the page */
+    l_tCtxCb.fIsErased = &eFSS_CORELLTST_IsErasedErrAdapt;
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 8  -- FAIL \n");
+    }
+
+    /* Function */
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxIsErased.uTimeUsed = 0u;
+    l_ltUseBuff1.puBuf[0u] = 0x04u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( 1u == l_tCtxErase.uTimeUsed ) && ( 1u == l_tCtxIsErased.uTimeUsed ) && ( 0x04u == m_auStorArea2[0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 9  -- FAIL \n");
+    }
+
+    /* With a single try the error is reported */
+    l_tStorSet.uRWERetry = 1u;
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 10 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_CLBCKREADERR == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) )
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlankCheckTest 11 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+    (void)l_tCtxIsErased.eLastEr;
+    (void)l_ltUseBuff2.puBuf;
+}
+
+static void eFSS_CORELLTST_RangeTest(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[48u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+	t_eFSS_TYPE_ReadRangeCtx  l_tCtxReadRange;
+	t_eFSS_TYPE_WriteRangeCtx l_tCtxWriteRange;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff1;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff2;
+    bool_t l_bCanBeEquals;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseNorAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteNorAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = &eFSS_CORELLTST_ReadRangeAdapt;
+	l_tCtxCb.ptCtxWriteRange = &l_tCtxWriteRange;
+    l_tCtxCb.fWriteRange = &eFSS_CORELLTST_WriteRangeNorAdapt;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 2u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uStorType = 1u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxReadRange.uTimeUsed = 0u;
+    l_tCtxReadRange.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWriteRange.uTimeUsed = 0u;
+    l_tCtxWriteRange.eLastEr = e_eFSS_CORELL_RES_OK;
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    l_tCtxCb.ptCtxReadRange = &l_tCtxReadRange;
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 3  -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------------------------- TEST RANGED READ BACK */
+    (void)memset(m_auStorArea1, 0xFF, sizeof(m_auStorArea1));
+    l_ltUseBuff1.puBuf[0u] = 0xF7u;
+    l_ltUseBuff1.puBuf[1u] = 0x02u;
+    l_ltUseBuff1.puBuf[2u] = 0x03u;
+    l_ltUseBuff1.puBuf[3u] = 0x04u;
+    l_ltUseBuff1.puBuf[4u] = 0x05u;
+
+    /* A page is always erased and written whole, the ranged write is not used for the page data */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 1u == l_tCtxErase.uTimeUsed ) && ( 1u == l_tCtxWrite.uTimeUsed ) && ( 0u == l_tCtxWriteRange.uTimeUsed ) &&
+        ( 1u == l_tCtxRead.uTimeUsed ) && ( 0u == l_tCtxReadRange.uTimeUsed ) && ( 0xF7u == m_auStorArea1[0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 4  -- FAIL \n");
+    }
+
+    /* Only the not compared part of the page is readed by the CRC pre comparison */
+    l_bCanBeEquals = false;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_CmpPageCrcWithBuff(&l_tCtx, 0u, 5u, &l_bCanBeEquals) ) &&
+        ( true == l_bCanBeEquals ) && ( 1u == l_tCtxRead.uTimeUsed ) && ( 1u == l_tCtxReadRange.uTimeUsed ) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 5  -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------------------------------- TEST PAGE PROBE */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_ProbePageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u, 2u) ) &&
+        ( 1u == l_tCtxRead.uTimeUsed ) && ( 2u == l_tCtxReadRange.uTimeUsed ) && ( 0x04u == l_ltUseBuff2.puBuf[3u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 6  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_ProbePageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u, 6u) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 7  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_ProbePageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 2u, 2u) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 8  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_ProbePageInBuff(NULL, e_eFSS_CORELL_BUFFTYPE_2, 0u, 2u) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 9  -- FAIL \n");
+    }
+
+    /* The CRC is not verified by the probe, only the metadata */
+    m_auStorArea1[0u] = 0x00u;
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_ProbePageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u, 2u) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 10 -- FAIL \n");
+    }
+
+    /* Function */
+    m_auStorArea1[16u] = 0x00u;
+    if( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_ProbePageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u, 2u) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 11 -- FAIL \n");
+    }
+
+    /* Without the ranged read the whole page is loaded and verified */
+    l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 12 -- FAIL \n");
+    }
+
+    /* Function */
+    m_auStorArea1[16u] = 0xA5u;
+    if( ( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_ProbePageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u, 2u) ) &&
+        ( 2u == l_tCtxRead.uTimeUsed ) )
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_RangeTest 13 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+    (void)l_tCtxReadRange.eLastEr;
+    (void)l_tCtxWriteRange.eLastEr;
+}
+
+static void eFSS_CORELLTST_SingleBufTest(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[44u];
+    bool_t l_bIsEquals;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+	t_eFSS_TYPE_ReadRangeCtx  l_tCtxReadRange;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff1;
+    t_eFSS_CORELL_StorBuf l_ltUseBuff2;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseNorAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteNorAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 2u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uStorType = 1u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxReadRange.uTimeUsed = 0u;
+    l_tCtxReadRange.eLastEr = e_eFSS_CORELL_RES_OK;
+
+    /* Without the ranged read the page cannot be streamed */
+    if( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 1  -- FAIL \n");
+    }
+
+    /* The scratch area must be bigger than the private metadata */
+    l_tCtxCb.ptCtxReadRange = &l_tCtxReadRange;
+    l_tCtxCb.fReadRange = &eFSS_CORELLTST_ReadRangeAdapt;
+    if( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, 43u ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 3  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2) ) &&
+        ( 5u == l_ltUseBuff1.uBufL ) && ( 1u == l_ltUseBuff2.uBufL ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 4  -- FAIL \n");
+    }
+
+    /* The second buffer is only a scratch area */
+    if( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 5  -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------------------- TEST STREAMED VERIFICATION */
+    (void)memset(m_auStorArea1, 0x00, sizeof(m_auStorArea1));
+    l_ltUseBuff1.puBuf[0u] = 0x01u;
+    l_ltUseBuff1.puBuf[1u] = 0x02u;
+    l_ltUseBuff1.puBuf[2u] = 0x03u;
+    l_ltUseBuff1.puBuf[3u] = 0x04u;
+    l_ltUseBuff1.puBuf[4u] = 0x05u;
+
+    /* The page is read back in two chunk, the short one first */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 1u == l_tCtxErase.uTimeUsed ) && ( 1u == l_tCtxWrite.uTimeUsed ) && ( 0u == l_tCtxRead.uTimeUsed ) &&
+        ( 2u == l_tCtxReadRange.uTimeUsed ) && ( 0x03u == m_auStorArea1[2u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 6  -- FAIL \n");
+    }
+
+    /* Function */
+    l_bIsEquals = false;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_CmpPageWithBuff(&l_tCtx, 0u, 5u, &l_bIsEquals) ) &&
+        ( true == l_bIsEquals ) && ( 4u == l_tCtxReadRange.uTimeUsed ) && ( 0x05u == l_ltUseBuff2.puBuf[0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 7  -- FAIL \n");
+    }
+
+    /* Function */
+    l_ltUseBuff1.puBuf[2u] = 0x00u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_CmpPageWithBuff(&l_tCtx, 0u, 5u, &l_bIsEquals) ) &&
+        ( false == l_bIsEquals ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 8  -- FAIL \n");
+    }
+
+    /* Only the first two byte are compared */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_CmpPageWithBuff(&l_tCtx, 0u, 2u, &l_bIsEquals) ) &&
+        ( true == l_bIsEquals ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 9  -- FAIL \n");
+    }
+
+    /* The CRC is verified even on the chunk already compared */
+    m_auStorArea1[0u] = 0x00u;
+    if( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_CmpPageWithBuff(&l_tCtx, 0u, 2u, &l_bIsEquals) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 10 -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_CmpPageWithBuff(&l_tCtx, 0u, 25u, &l_bIsEquals) ) &&
+        ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_CmpPageWithBuff(&l_tCtx, 2u, 2u, &l_bIsEquals) ) &&
+        ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_CmpPageWithBuff(&l_tCtx, 0u, 2u, NULL) ) &&
+        ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_CmpPageWithBuff(NULL, 0u, 2u, &l_bIsEquals) ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 11 -- FAIL \n");
+    }
+
+    /* A page is flushed and streamed back in chunk, without any whole page read */
+    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( 2u == l_tCtxErase.uTimeUsed ) && ( 2u == l_tCtxWrite.uTimeUsed ) && ( 0u == l_tCtxRead.uTimeUsed ) &&
+        ( 0x00u == m_auStorArea2[2u] ) && ( 0x01u == m_auStorArea2[5u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 12 -- FAIL \n");
+    }
+
+    /* ------------------------------------------------------------------------------- TEST CRC PRE COMPARSION */
+    /* Only the not compared part of the page is readed, the CRC match */
+    l_bIsEquals = false;
+    l_tCtxReadRange.uTimeUsed = 0u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_CmpPageCrcWithBuff(&l_tCtx, 1u, 5u, &l_bIsEquals) ) &&
+        ( true == l_bIsEquals ) && ( 1u == l_tCtxReadRange.uTimeUsed ) && ( 0u == l_tCtxRead.uTimeUsed ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 13 -- FAIL \n");
+    }
+
+    /* Different data, the CRC is enough */
+    l_ltUseBuff1.puBuf[0u] = 0x09u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_CmpPageCrcWithBuff(&l_tCtx, 1u, 5u, &l_bIsEquals) ) &&
+        ( false == l_bIsEquals ) && ( 2u == l_tCtxReadRange.uTimeUsed ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 14 -- FAIL \n");
+    }
+
+    /* The not compared part does not fit the scratch area, nothing is readed */
+    l_bIsEquals = false;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_CmpPageCrcWithBuff(&l_tCtx, 1u, 2u, &l_bIsEquals) ) &&
+        ( true == l_bIsEquals ) && ( 2u == l_tCtxReadRange.uTimeUsed ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 15 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 15 -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_CmpPageCrcWithBuff(&l_tCtx, 0u, 25u, &l_bIsEquals) ) &&
+        ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_CmpPageCrcWithBuff(&l_tCtx, 2u, 5u, &l_bIsEquals) ) &&
+        ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_CmpPageCrcWithBuff(&l_tCtx, 1u, 5u, NULL) ) &&
+        ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_CmpPageCrcWithBuff(NULL, 1u, 5u, &l_bIsEquals) ) )
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 16 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_SingleBufTest 16 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+    (void)l_tCtxReadRange.eLastEr;
+}
+
+static void eFSS_CORELLTST_StatsTest(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_TYPE_Stats l_tStats;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[48u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseNorAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteNorAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 2u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uStorType = 1u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+
+    /* Function */
+    l_tCtx.bIsInit = false;
+    if( ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetStats(NULL, &l_tStats) ) &&
+        ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_GetStats(&l_tCtx, NULL) ) &&
+        ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_ResetStats(NULL) ) &&
+        ( e_eFSS_CORELL_RES_NOINITLIB == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( e_eFSS_CORELL_RES_NOINITLIB == eFSS_CORELL_ResetStats(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( 0u == l_tStats.uReadCnt ) && ( 0u == l_tStats.uWriteCnt ) && ( 0u == l_tStats.uEraseCnt ) &&
+        ( 0u == l_tStats.uCrcByte ) && ( 0u == l_tStats.uRetryCnt ) && ( 0u == l_tStats.uRbMismatchCnt ) )
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 2  -- FAIL \n");
+    }
+
+    /* A flush erase, write and read back the page */
+    (void)memset(l_auStor, 0x00, sizeof(l_auStor));
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( 1u == l_tStats.uEraseCnt ) && ( 1u == l_tStats.uWriteCnt ) && ( 24u == l_tStats.uWriteByte ) &&
+        ( 1u == l_tStats.uReadCnt ) && ( 24u == l_tStats.uReadByte ) && ( 20u == l_tStats.uCrcByte ) &&
+        ( 0u == l_tStats.uRetryCnt ) && ( 0u == l_tStats.uRbMismatchCnt ) )
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 3  -- FAIL \n");
+    }
+
+    /* A load read the page and verify his CRC */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( 1u == l_tStats.uEraseCnt ) && ( 1u == l_tStats.uWriteCnt ) && ( 2u == l_tStats.uReadCnt ) &&
+        ( 48u == l_tStats.uReadByte ) && ( 40u == l_tStats.uCrcByte ) && ( 0u == l_tStats.uBkpRcvrdCnt ) )
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 4  -- FAIL \n");
+    }
+
+    /* Every failed read is retried */
+    l_tCtx.tCtxCb.fRead = &eFSS_CORELLTST_ReadErrAdapt;
+    if( ( e_eFSS_CORELL_RES_CLBCKREADERR == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( 5u == l_tStats.uReadCnt ) && ( 2u == l_tStats.uRetryCnt ) )
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 5  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_ResetStats(&l_tCtx) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( 0u == l_tStats.uReadCnt ) && ( 0u == l_tStats.uReadByte ) && ( 0u == l_tStats.uWriteCnt ) &&
+        ( 0u == l_tStats.uWriteByte ) && ( 0u == l_tStats.uEraseCnt ) && ( 0u == l_tStats.uRetryCnt ) &&
+        ( 0u == l_tStats.uCrcByte ) && ( 0u == l_tStats.uBkpRcvrdCnt ) && ( 0u == l_tStats.uRbMismatchCnt ) )
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_StatsTest 6  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+}
+
+static void eFSS_CORELLTST_CompactTest(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_CORELL_StorBuf l_tBuff1;
+    t_eFSS_CORELL_StorBuf l_tBuff2;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[48u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseNorAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteNorAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 2u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 16u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_COMPACT;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uStorType = 1u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+
+    /* Version and storage type must fit a nibble when using a compact trailer */
+    l_tCtx.bIsInit = false;
+    if( ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                            sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, 16u, l_auStor,
+                                                            sizeof(l_auStor) ) ) )
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 1  -- FAIL \n");
+    }
+
+    /* A compact trailer leave more space to the user */
+    l_tStorSet.uPageVersion = 15u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( 16u == l_tBuff1.uBufL ) && ( 16u == l_tBuff2.uBufL ) )
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 2  -- FAIL \n");
+    }
+
+    /* Flush and load back a compact page */
+    (void)memset(l_auStor, 0x00, sizeof(l_auStor));
+    (void)memset(l_tBuff1.puBuf, 0xA5, l_tBuff1.uBufL);
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 3  -- FAIL \n");
+    }
+
+    /* The same page is not valid when seen with a different trailer format */
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_COMPACT_CRC16;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( 18u == l_tBuff1.uBufL ) && ( 18u == l_tBuff2.uBufL ) &&
+        ( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) )
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 4  -- FAIL \n");
+    }
+
+    /* Flush and load back a compact page with a 16 bit CRC */
+    (void)memset(l_tBuff1.puBuf, 0x5A, l_tBuff1.uBufL);
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 5  -- FAIL \n");
+    }
+
+    /* Function */
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( 5u == l_tBuff1.uBufL ) &&
+        ( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) ) )
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_CompactTest 6  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+}
+
+static void eFSS_CORELLTST_BlockTest(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_CORELL_StorBuf l_tBuff1;
+    t_eFSS_CORELL_StorBuf l_tBuff2;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[48u];
+    uint8_t l_auPage1[5u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+	t_eFSS_TYPE_WriteRangeCtx l_tCtxWriteRange;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseBlkAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteBlkAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadBlkAdapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings, two pages for every erase block plus the spare block */
+    l_tStorSet.uTotPages = 3u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 2u;
+    l_uStorType = 1u;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWriteRange.uTimeUsed = 0u;
+    l_tCtxWriteRange.eLastEr = e_eFSS_CORELL_RES_OK;
+
+    (void)memset(m_auStorBlk, 0xFF, sizeof(m_auStorBlk));
+
+    /* The area must be made of whole blocks, and the two page buffer is needed */
+    l_tCtx.bIsInit = false;
+    if( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                          sizeof(l_auStor) ) )
+    {
+        l_tStorSet.uTotPages = 2u;
+        if( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                              24u ) )
+        {
+            (void)printf("eFSS_CORELLTST_BlockTest 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_CORELLTST_BlockTest 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 1  -- FAIL \n");
+    }
+
+    /* Bad pointer and page index */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_EraseBlk(NULL, 0u) ) &&
+        ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_EraseBlk(&l_tCtx, 2u) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 2  -- FAIL \n");
+    }
+
+    /* A blank page is written without erasing the block */
+    (void)memset(l_tBuff1.puBuf, 0xA1, l_tBuff1.uBufL);
+    (void)memcpy(l_auPage1, l_tBuff1.puBuf, sizeof(l_auPage1));
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 0u == l_tCtxErase.uTimeUsed ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 3  -- FAIL \n");
+    }
+
+    /* Rewriting a page keep the other page of the block, using the spare block */
+    (void)memset(l_tBuff1.puBuf, 0xB2, l_tBuff1.uBufL);
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 3u == l_tCtxErase.uTimeUsed ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) ) &&
+        ( 0 == memcmp(l_auPage1, l_tBuff2.puBuf, sizeof(l_auPage1)) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 4  -- FAIL \n");
+    }
+
+    /* Erase the whole block passing any of its pages */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_EraseBlk(&l_tCtx, 1u) ) &&
+        ( 4u == l_tCtxErase.uTimeUsed ) &&
+        ( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 5  -- FAIL \n");
+    }
+
+    /* Power loss after the other page is saved in the spare block and the block is erased */
+    (void)memset(l_tBuff1.puBuf, 0xA1, l_tBuff1.uBufL);
+    (void)memcpy(l_auPage1, l_tBuff1.puBuf, sizeof(l_auPage1));
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) )
+    {
+        (void)memset(l_tBuff1.puBuf, 0xC3, l_tBuff1.uBufL);
+        m_uBlkWriteLeft = 2u;
+        if( ( e_eFSS_CORELL_RES_CLBCKWRITEERR == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1,
+                                                                               0u) ) &&
+            ( 0xFFu == m_auStorBlk[0u][0u] ) && ( 0xFFu == m_auStorBlk[1u][0u] ) &&
+            ( 0xA1u == m_auStorBlk[3u][0u] ) )
+        {
+            (void)printf("eFSS_CORELLTST_BlockTest 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_CORELLTST_BlockTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 6  -- FAIL \n");
+    }
+
+    /* The interrupted rewrite is completed before the first access, only the flushed page is lost */
+    m_uBlkWriteLeft = MAX_UINT32VAL;
+    l_tCtxCb.ptCtxWriteRange = &l_tCtxWriteRange;
+    l_tCtxCb.fWriteRange = &eFSS_CORELLTST_WriteRangeBlkAdapt;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) ) &&
+        ( 0 == memcmp(l_auPage1, l_tBuff2.puBuf, sizeof(l_auPage1)) ) &&
+        ( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0xFFu == m_auStorBlk[2u][0u] ) && ( 0xFFu == m_auStorBlk[3u][0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 7  -- FAIL \n");
+    }
+
+    /* The lost page can be flushed again */
+    (void)memset(l_tBuff1.puBuf, 0xC3, l_tBuff1.uBufL);
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) ) &&
+        ( 0 == memcmp(l_auPage1, l_tBuff2.puBuf, sizeof(l_auPage1)) ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 8  -- FAIL \n");
+    }
+
+    /* With the ranged write only the marker is programmed in the free slot of the spare block */
+    (void)memset(l_tBuff1.puBuf, 0xD4, l_tBuff1.uBufL);
+    (void)memcpy(l_auPage1, l_tBuff1.puBuf, sizeof(l_auPage1));
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( 1u == l_tCtxWriteRange.uTimeUsed ) && ( 0xFFu == m_auStorBlk[2u][0u] ) &&
+        ( 0xFFu == m_auStorBlk[3u][0u] ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) ) &&
+        ( 0 == memcmp(l_auPage1, l_tBuff2.puBuf, sizeof(l_auPage1)) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0xC3u == l_tBuff2.puBuf[0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 9  -- FAIL \n");
+    }
+
+    /* After erasing the block its pages are programmed in order without the blank check, only the read back of
+       each page is done */
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxErase.uTimeUsed = 0u;
+    (void)memset(l_tBuff1.puBuf, 0xE5, l_tBuff1.uBufL);
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_EraseBlk(&l_tCtx, 0u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( 2u == l_tCtxRead.uTimeUsed ) && ( 1u == l_tCtxErase.uTimeUsed ) &&
+        ( 0xE5u == m_auStorBlk[0u][0u] ) && ( 0xE5u == m_auStorBlk[1u][0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 10 -- FAIL \n");
+    }
+
+    /* A page already flushed after the erase is checked again, and the block is rewritten */
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxErase.uTimeUsed = 0u;
+    (void)memset(l_tBuff1.puBuf, 0xF6, l_tBuff1.uBufL);
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( l_tCtxRead.uTimeUsed > 2u ) && ( 3u == l_tCtxErase.uTimeUsed ) &&
+        ( 0xF6u == m_auStorBlk[0u][0u] ) && ( 0xE5u == m_auStorBlk[1u][0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 11 -- FAIL \n");
+    }
+
+    /* Flushing a page before the last flushed one forget the erased block, the next pages are checked again */
+    l_tCtxRead.uTimeUsed = 0u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_EraseBlk(&l_tCtx, 0u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+        ( 1u == l_tCtxRead.uTimeUsed ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 3u == l_tCtxRead.uTimeUsed ) && ( 0xF6u == m_auStorBlk[0u][0u] ) && ( 0xF6u == m_auStorBlk[1u][0u] ) )
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_BlockTest 12 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxWriteRange.eLastEr;
+}
+
+static void eFSS_CORELLTST_UpdCrcTest(void)
+{
+    /* Local variable */
+    t_eFSS_CORELL_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_CORELL_StorBuf l_tBuff1;
+    t_eFSS_CORELL_StorBuf l_tBuff2;
+    t_eFSS_TYPE_Stats l_tStats;
+    uint8_t l_uStorType;
+    uint8_t l_auStor[48u];
+    uint32_t l_uCrcCalc;
+    uint32_t l_uCrcStored;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Init callback var, the CRC is the built-in one */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseNorAdapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteNorAdapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_Utils_Crc32Cb;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    /* Init storage settings */
+    l_tStorSet.uTotPages = 2u;
+    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uStorType = 1u;
 
     l_tCtxErase.uTimeUsed = 0u;
     l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
@@ -4103,181 +6310,233 @@ static void eFSS_CORELLTST_FlushTest(void)
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
 
-    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    /* Function */
+    l_tCtx.bIsInit = false;
+    if( ( e_eFSS_CORELL_RES_BADPOINTER == eFSS_CORELL_UpdCrcInBuff(NULL, e_eFSS_CORELL_BUFFTYPE_1, 0u, 1u, true) ) &&
+        ( e_eFSS_CORELL_RES_NOINITLIB == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u, 1u, true) ) )
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 7  -- OK \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 1  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 7  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 1  -- FAIL \n");
     }
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2) )
+    /* The range cannot be empty or exceed the user data */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) && ( 5u == l_tBuff1.uBufL ) &&
+        ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u, 0u, true) ) &&
+        ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 5u, 1u, true) ) &&
+        ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 3u, 3u, true) ) &&
+        ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, (e_eFSS_CORELL_BUFFTYPE)2u, 0u, 1u,
+                                                                 true) ) )
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 8  -- OK \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 2  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 8  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 2  -- FAIL \n");
     }
 
-    /* Setup storage area */
-    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
-    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
-
-    /* Setup buffer */
-    l_ltUseBuff1.puBuf[0u] = 0x01u;
-    l_ltUseBuff1.puBuf[1u] = 0x02u;
-    l_ltUseBuff1.puBuf[2u] = 0x03u;
-    l_ltUseBuff1.puBuf[3u] = 0x04u;
-    l_ltUseBuff1.puBuf[4u] = 0x05u;
-
-    l_ltUseBuff2.puBuf[0u] = 0x11u;
-    l_ltUseBuff2.puBuf[1u] = 0x12u;
-    l_ltUseBuff2.puBuf[2u] = 0x13u;
-    l_ltUseBuff2.puBuf[3u] = 0x14u;
-    l_ltUseBuff2.puBuf[4u] = 0x15u;
-
-    if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) )
+    /* Flush a page, the stored CRC is the one of the whole page */
+    (void)memset(m_auStorArea1, 0xFF, sizeof(m_auStorArea1));
+    l_tBuff1.puBuf[0u] = 0x01u;
+    l_tBuff1.puBuf[1u] = 0x02u;
+    l_tBuff1.puBuf[2u] = 0x03u;
+    l_tBuff1.puBuf[3u] = 0x04u;
+    l_tBuff1.puBuf[4u] = 0x05u;
+    l_uCrcCalc = 0u;
+    l_uCrcStored = 0u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( true == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, m_auStorArea1, 20u, &l_uCrcCalc) ) &&
+        ( true == eFSS_Utils_RetriveU32(&m_auStorArea1[20u], &l_uCrcStored) ) && ( l_uCrcCalc == l_uCrcStored ) )
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 9  -- OK \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 3  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 9  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 3  -- FAIL \n");
     }
 
-    /* Setup storage area */
-    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
-    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
-
-    /* Setup buffer */
-    l_ltUseBuff1.puBuf[0u] = 0x01u;
-    l_ltUseBuff1.puBuf[1u] = 0x02u;
-    l_ltUseBuff1.puBuf[2u] = 0x03u;
-    l_ltUseBuff1.puBuf[3u] = 0x04u;
-    l_ltUseBuff1.puBuf[4u] = 0x05u;
-
-    l_ltUseBuff2.puBuf[0u] = 0x11u;
-    l_ltUseBuff2.puBuf[1u] = 0x12u;
-    l_ltUseBuff2.puBuf[2u] = 0x13u;
-    l_ltUseBuff2.puBuf[3u] = 0x14u;
-    l_ltUseBuff2.puBuf[4u] = 0x15u;
-
-    if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) )
+    /* Patch a range of the flushed buffer, the flush only adds the metadata to the updated CRC */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u, 2u, true) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_ResetStats(&l_tCtx) ) )
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 10 -- OK \n");
+        l_tBuff1.puBuf[1u] = 0xA1u;
+        l_tBuff1.puBuf[2u] = 0xA2u;
+        if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u, 2u, false) ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) && ( 32u == l_tStats.uCrcByte ) &&
+            ( 0xA1u == m_auStorArea1[1u] ) && ( 0xA2u == m_auStorArea1[2u] ) )
+        {
+            (void)printf("eFSS_CORELLTST_UpdCrcTest 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_CORELLTST_UpdCrcTest 4  -- FAIL \n");
+        }
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 10 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 4  -- FAIL \n");
     }
 
-    /* Setup storage area */
-    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
-    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
-
-    /* Setup buffer */
-    l_ltUseBuff1.puBuf[0u] = 0x01u;
-    l_ltUseBuff1.puBuf[1u] = 0x02u;
-    l_ltUseBuff1.puBuf[2u] = 0x03u;
-    l_ltUseBuff1.puBuf[3u] = 0x04u;
-    l_ltUseBuff1.puBuf[4u] = 0x05u;
-
-    l_ltUseBuff2.puBuf[0u] = 0x11u;
-    l_ltUseBuff2.puBuf[1u] = 0x12u;
-    l_ltUseBuff2.puBuf[2u] = 0x13u;
-    l_ltUseBuff2.puBuf[3u] = 0x14u;
-    l_ltUseBuff2.puBuf[4u] = 0x15u;
-
-    if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) )
+    /* The updated CRC is the one of a full calculation, and the page can be loaded back */
+    l_uCrcCalc = 0u;
+    l_uCrcStored = 0u;
+    if( ( true == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, m_auStorArea1, 20u, &l_uCrcCalc) ) &&
+        ( true == eFSS_Utils_RetriveU32(&m_auStorArea1[20u], &l_uCrcStored) ) && ( l_uCrcCalc == l_uCrcStored ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 11 -- OK \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 5  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 11 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 5  -- FAIL \n");
     }
 
-    /* Setup storage area */
-    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
-    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
-
-    /* Setup buffer */
-    l_ltUseBuff1.puBuf[0u] = 0x01u;
-    l_ltUseBuff1.puBuf[1u] = 0x02u;
-    l_ltUseBuff1.puBuf[2u] = 0x03u;
-    l_ltUseBuff1.puBuf[3u] = 0x04u;
-    l_ltUseBuff1.puBuf[4u] = 0x05u;
-
-    l_ltUseBuff2.puBuf[0u] = 0x11u;
-    l_ltUseBuff2.puBuf[1u] = 0x12u;
-    l_ltUseBuff2.puBuf[2u] = 0x13u;
-    l_ltUseBuff2.puBuf[3u] = 0x14u;
-    l_ltUseBuff2.puBuf[4u] = 0x15u;
+    /* A loaded buffer can be patched too */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 4u, 1u, true) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_ResetStats(&l_tCtx) ) )
+    {
+        l_tBuff2.puBuf[4u] = 0x55u;
+        l_uCrcCalc = 0u;
+        l_uCrcStored = 0u;
+        if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 4u, 1u, false) ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) && ( 31u == l_tStats.uCrcByte ) &&
+            ( true == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, m_auStorArea2, 20u, &l_uCrcCalc) ) &&
+            ( true == eFSS_Utils_RetriveU32(&m_auStorArea2[20u], &l_uCrcStored) ) && ( l_uCrcCalc == l_uCrcStored ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) ) &&
+            ( 0x55u == l_tBuff1.puBuf[4u] ) )
+        {
+            (void)printf("eFSS_CORELLTST_UpdCrcTest 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_CORELLTST_UpdCrcTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 6  -- FAIL \n");
+    }
 
-    if( e_eFSS_CORELL_RES_WRITENOMATCHREAD == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) )
+    /* A buffer not loaded or flushed has no stored CRC to update, the flush calculate it */
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u, 5u, true) ) )
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 12 -- OK \n");
+        (void)memset(l_tBuff1.puBuf, 0x33, l_tBuff1.uBufL);
+        l_uCrcCalc = 0u;
+        l_uCrcStored = 0u;
+        if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u, 5u, false) ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetStats(&l_tCtx, &l_tStats) ) && ( 20u == l_tStats.uCrcByte ) &&
+            ( true == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, m_auStorArea1, 20u, &l_uCrcCalc) ) &&
+            ( true == eFSS_Utils_RetriveU32(&m_auStorArea1[20u], &l_uCrcStored) ) && ( l_uCrcCalc == l_uCrcStored ) )
+        {
+            (void)printf("eFSS_CORELLTST_UpdCrcTest 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_CORELLTST_UpdCrcTest 7  -- FAIL \n");
+        }
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_FlushTest 12 -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 7  -- FAIL \n");
+    }
+
+    /* With a different CRC callback the polynomial is unknown: the callback is not used to update the CRC, and the
+       flush calculate it as usual */
+    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 1u == l_tCtxCrc32.uTimeUsed ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u, 2u, true) ) )
+    {
+        l_tBuff1.puBuf[1u] = 0x44u;
+        l_tBuff1.puBuf[2u] = 0x44u;
+        if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_UpdCrcInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u, 2u, false) ) &&
+            ( 1u == l_tCtxCrc32.uTimeUsed ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+            ( 2u == l_tCtxCrc32.uTimeUsed ) &&
+            ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+            ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
+        {
+            (void)printf("eFSS_CORELLTST_UpdCrcTest 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_CORELLTST_UpdCrcTest 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_UpdCrcTest 8  -- FAIL \n");
     }
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
-    (void)l_tCtxErase.uTimeUsed;
     (void)l_tCtxWrite.eLastEr;
-    (void)l_tCtxWrite.uTimeUsed;
     (void)l_tCtxRead.eLastEr;
-    (void)l_tCtxRead.uTimeUsed;
     (void)l_tCtxCrc32.eLastEr;
-    (void)l_tCtxCrc32.uTimeUsed;
-    (void)l_ltUseBuff1.puBuf;
-    (void)l_ltUseBuff2.puBuf;
 }
 
-static void eFSS_CORELLTST_GenTest(void)
+static void eFSS_CORELLTST_ProgTest(void)
 {
     /* Local variable */
     t_eFSS_CORELL_Ctx l_tCtx;
     t_eFSS_TYPE_CbStorCtx l_tCtxCb;
     t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_CORELL_StorBuf l_tBuff1;
+    t_eFSS_CORELL_StorBuf l_tBuff2;
     uint8_t l_uStorType;
-    uint8_t l_auStor[48u];
+    uint8_t l_auStor[80u];
+    uint8_t l_auSlotFree[16u];
+    uint32_t l_uIndex;
+    bool_t l_bIsOk;
     t_eFSS_TYPE_EraseCtx  l_tCtxErase;
 	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
 	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
 	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
-    t_eFSS_CORELL_StorBuf l_ltUseBuff1;
-    t_eFSS_CORELL_StorBuf l_ltUseBuff2;
+	t_eFSS_TYPE_WriteRangeCtx l_tCtxWriteRange;
 
     /* Init callback var */
     l_tCtxCb.ptCtxErase = &l_tCtxErase;
-    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseTst1Adapt;
+    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseProgAdapt;
 	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
-    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteTst1Adapt;
+    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteProgAdapt;
 	l_tCtxCb.ptCtxRead = &l_tCtxRead;
-    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
+    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadProgAdapt;
 	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
     l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = &l_tCtxWriteRange;
+    l_tCtxCb.fWriteRange = &eFSS_CORELLTST_WriteRangeProgAdapt;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
 
     /* Init storage settings */
     l_tStorSet.uTotPages = 2u;
-    l_tStorSet.uPagesLen = 24u;
+    l_tStorSet.uPagesLen = 40u;
     l_tStorSet.uRWERetry = 3u;
     l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_PROG;
+    l_tStorSet.uPagesPerBlk = 1u;
     l_uStorType = 1u;
 
-    /* ------------------------------------------------------------------------------------------- TEST CRC CALL BACK */
-    /* Function */
-    l_tCtxCb.fErase = &eFSS_CORELLTST_EraseTst1Adapt;
-    l_tCtxCb.fWrite = &eFSS_CORELLTST_WriteTst1Adapt;
-    l_tCtxCb.fRead = &eFSS_CORELLTST_ReadTst1Adapt;
-    l_tCtxCb.fCrc32 = &eFSS_CORELLTST_CrcTst1Adapt;
-
     l_tCtxErase.uTimeUsed = 0u;
     l_tCtxErase.eLastEr = e_eFSS_CORELL_RES_OK;
     l_tCtxWrite.uTimeUsed = 0u;
@@ -4286,120 +6545,153 @@ static void eFSS_CORELLTST_GenTest(void)
     l_tCtxRead.eLastEr = e_eFSS_CORELL_RES_OK;
     l_tCtxCrc32.uTimeUsed = 0u;
     l_tCtxCrc32.eLastEr = e_eFSS_CORELL_RES_OK;
+    l_tCtxWriteRange.uTimeUsed = 0u;
+    l_tCtxWriteRange.eLastEr = e_eFSS_CORELL_RES_OK;
 
-    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor, sizeof(l_auStor) ) )
+    (void)memset(m_auStorProg, 0xFF, sizeof(m_auStorProg));
+    (void)memset(l_auSlotFree, 0xFF, sizeof(l_auSlotFree));
+
+    /* The programmable trailer use 31 byte */
+    l_tCtx.bIsInit = false;
+    if( ( e_eFSS_CORELL_RES_BADPARAM == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                            62u ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( 9u == l_tBuff1.uBufL ) && ( 9u == l_tBuff2.uBufL ) )
     {
-        (void)printf("eFSS_CORELLTST_GenTest 1  -- OK \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 1  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_GenTest 1  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 1  -- FAIL \n");
     }
 
-    /* Function */
-    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_ltUseBuff1, &l_ltUseBuff2) )
+    /* A blank page is programmed in place, the CRC goes in the first slot */
+    (void)memset(l_tBuff1.puBuf, 0xFF, l_tBuff1.uBufL);
+    (void)memset(l_tBuff1.puBuf, 0x11, 4u);
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 0u == l_tCtxErase.uTimeUsed ) && ( 0u == l_tCtxWrite.uTimeUsed ) &&
+        ( 2u == l_tCtxWriteRange.uTimeUsed ) &&
+        ( 0 != memcmp(&m_auStorProg[0u][24u], l_auSlotFree, 4u) ) &&
+        ( 0 == memcmp(&m_auStorProg[0u][28u], l_auSlotFree, 12u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
     {
-        (void)printf("eFSS_CORELLTST_GenTest 2  -- OK \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 2  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_GenTest 2  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 2  -- FAIL \n");
     }
 
-    /* Setup storage area */
-    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
-    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
-
-    /* Setup buffer */
-    l_ltUseBuff1.puBuf[0u] = 0x01u;
-    l_ltUseBuff1.puBuf[1u] = 0x02u;
-    l_ltUseBuff1.puBuf[2u] = 0x03u;
-    l_ltUseBuff1.puBuf[3u] = 0x04u;
-    l_ltUseBuff1.puBuf[4u] = 0x05u;
-
-    l_ltUseBuff2.puBuf[0u] = 0x11u;
-    l_ltUseBuff2.puBuf[1u] = 0x12u;
-    l_ltUseBuff2.puBuf[2u] = 0x13u;
-    l_ltUseBuff2.puBuf[3u] = 0x14u;
-    l_ltUseBuff2.puBuf[4u] = 0x15u;
-
-    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) )
+    /* Data appended in the erased byte are programmed in place, the new CRC goes in the next slot and is the one
+       used when loading the page */
+    (void)memset(&l_tBuff1.puBuf[4u], 0x22, 2u);
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 0u == l_tCtxErase.uTimeUsed ) && ( 0u == l_tCtxWrite.uTimeUsed ) &&
+        ( 4u == l_tCtxWriteRange.uTimeUsed ) &&
+        ( 0 != memcmp(&m_auStorProg[0u][28u], l_auSlotFree, 4u) ) &&
+        ( 0 == memcmp(&m_auStorProg[0u][32u], l_auSlotFree, 8u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
     {
-        (void)printf("eFSS_CORELLTST_GenTest 3  -- OK \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 3  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_GenTest 3  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 3  -- FAIL \n");
     }
 
-    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) )
+    /* Data programmed without the new CRC, like after a power loss, leave a page that is not valid */
+    m_auStorProg[0u][6u] = 0x33u;
+    if( e_eFSS_CORELL_RES_NOTVALIDPAGE == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) )
     {
-        if( ( 0x01u== l_ltUseBuff2.puBuf[0u] ) && ( 0x02u== l_ltUseBuff2.puBuf[1u] ) && ( 0x03u== l_ltUseBuff2.puBuf[2u] ) &&
-             ( 0x04u== l_ltUseBuff2.puBuf[3u] ) && ( 0x05u== l_ltUseBuff2.puBuf[4u] ))
-        {
-            (void)printf("eFSS_CORELLTST_GenTest 4  -- OK \n");
-        }
-        else
-        {
-            (void)printf("eFSS_CORELLTST_GenTest 4  -- FAIL \n");
-        }
+        (void)printf("eFSS_CORELLTST_ProgTest 4  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_GenTest 4  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 4  -- FAIL \n");
     }
 
-    /* Setup storage area */
-    (void)memset(m_auStorArea1, 0, sizeof(m_auStorArea1));
-    (void)memset(m_auStorArea2, 0xFF, sizeof(m_auStorArea2));
+    /* A bit that must go back to the erased value need an erase */
+    l_tBuff1.puBuf[0u] = 0xFFu;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 1u == l_tCtxErase.uTimeUsed ) && ( 1u == l_tCtxWrite.uTimeUsed ) &&
+        ( 0 == memcmp(&m_auStorProg[0u][28u], l_auSlotFree, 12u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
+    {
+        (void)printf("eFSS_CORELLTST_ProgTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_ProgTest 5  -- FAIL \n");
+    }
 
-    /* Setup buffer */
-    l_ltUseBuff1.puBuf[0u] = 0x01u;
-    l_ltUseBuff1.puBuf[1u] = 0x02u;
-    l_ltUseBuff1.puBuf[2u] = 0x03u;
-    l_ltUseBuff1.puBuf[3u] = 0x04u;
-    l_ltUseBuff1.puBuf[4u] = 0x05u;
+    /* Flushing again the same data does not touch the page */
+    l_tCtxWriteRange.uTimeUsed = 0u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 1u == l_tCtxErase.uTimeUsed ) && ( 1u == l_tCtxWrite.uTimeUsed ) && ( 0u == l_tCtxWriteRange.uTimeUsed ) )
+    {
+        (void)printf("eFSS_CORELLTST_ProgTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_CORELLTST_ProgTest 6  -- FAIL \n");
+    }
 
-    l_ltUseBuff2.puBuf[0u] = 0x11u;
-    l_ltUseBuff2.puBuf[1u] = 0x12u;
-    l_ltUseBuff2.puBuf[2u] = 0x13u;
-    l_ltUseBuff2.puBuf[3u] = 0x14u;
-    l_ltUseBuff2.puBuf[4u] = 0x15u;
+    /* Every one of the other three slots is used once, then the page is erased */
+    l_bIsOk = true;
+    l_uIndex = 0u;
+    while( ( true == l_bIsOk ) && ( l_uIndex < 3u ) )
+    {
+        l_tBuff1.puBuf[6u + l_uIndex] = 0x44u;
+        l_bIsOk = ( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+                    ( 1u == l_tCtxErase.uTimeUsed ) &&
+                    ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+                    ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) );
+        l_uIndex++;
+    }
 
-    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 1u) )
+    l_tBuff1.puBuf[0u] = 0x00u;
+    if( ( true == l_bIsOk ) && ( 0 != memcmp(&m_auStorProg[0u][36u], l_auSlotFree, 4u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 2u == l_tCtxErase.uTimeUsed ) &&
+        ( 0 == memcmp(&m_auStorProg[0u][28u], l_auSlotFree, 12u) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
     {
-        (void)printf("eFSS_CORELLTST_GenTest 5  -- OK \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 7  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_GenTest 5  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 7  -- FAIL \n");
     }
 
-    if( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 1u) )
+    /* Without the ranged write callback the page is always erased */
+    l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+    l_tBuff1.puBuf[8u] = 0x55u;
+    if( ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_uStorType, l_auStor,
+                                                      sizeof(l_auStor) ) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_GetBuff(&l_tCtx, &l_tBuff1, &l_tBuff2) ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_FlushBuffInPage(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_1, 0u) ) &&
+        ( 3u == l_tCtxErase.uTimeUsed ) &&
+        ( e_eFSS_CORELL_RES_OK == eFSS_CORELL_LoadPageInBuff(&l_tCtx, e_eFSS_CORELL_BUFFTYPE_2, 0u) ) &&
+        ( 0 == memcmp(l_tBuff1.puBuf, l_tBuff2.puBuf, l_tBuff1.uBufL) ) )
     {
-        if( ( 0x11u== l_ltUseBuff1.puBuf[0u] ) && ( 0x12u== l_ltUseBuff1.puBuf[1u] ) && ( 0x13u== l_ltUseBuff1.puBuf[2u] ) &&
-            ( 0x14u== l_ltUseBuff1.puBuf[3u] ) && ( 0x15u== l_ltUseBuff1.puBuf[4u] ))
-        {
-            (void)printf("eFSS_CORELLTST_GenTest 6  -- OK \n");
-        }
-        else
-        {
-            (void)printf("eFSS_CORELLTST_GenTest 6  -- FAIL \n");
-        }
+        (void)printf("eFSS_CORELLTST_ProgTest 8  -- OK \n");
     }
     else
     {
-        (void)printf("eFSS_CORELLTST_GenTest 6  -- FAIL \n");
+        (void)printf("eFSS_CORELLTST_ProgTest 8  -- FAIL \n");
     }
 
     /* Misra complaiant */
     (void)l_tCtxErase.eLastEr;
-    (void)l_tCtxErase.uTimeUsed;
     (void)l_tCtxWrite.eLastEr;
-    (void)l_tCtxWrite.uTimeUsed;
     (void)l_tCtxRead.eLastEr;
-    (void)l_tCtxRead.uTimeUsed;
     (void)l_tCtxCrc32.eLastEr;
-    (void)l_tCtxCrc32.uTimeUsed;
-    (void)l_ltUseBuff2.puBuf;
-}
\ No newline at end of file
+    (void)l_tCtxWriteRange.eLastEr;
+}
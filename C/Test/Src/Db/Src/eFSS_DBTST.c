@@ -11,31 +11,106 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eFSS_DBTST.h"
+#include "eFSS_DB.h"
 #include <stdio.h>
 
 
 
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+#define EFSS_DBTST_NPAGE                                                                ( ( uint32_t )         0x0Au )
+#define EFSS_DBTST_NELE                                                                 ( ( uint32_t )         0x06u )
+#define EFSS_DBTST_ELEL                                                                 ( ( uint32_t )         0x04u )
+#define EFSS_DBTST_PAGEL                                                                ( ( uint32_t )         0x40u )
+
+
+
 /***********************************************************************************************************************
  *   PRIVATE TEST VARIABLE DECLARATION
  **********************************************************************************************************************/
+static uint8_t m_auStorArea[EFSS_DBTST_NPAGE][EFSS_DBTST_PAGEL];
+static uint32_t m_uWriteLeft = MAX_UINT32VAL;
+static uint32_t m_uPageL = EFSS_DBTST_PAGEL;
+static uint8_t m_auDefVal[EFSS_DBTST_NELE][EFSS_DBTST_ELEL];
+static t_eFSS_DB_DbElement m_atDefEle[EFSS_DBTST_NELE];
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE TEST STRUCT DECLARATION
  **********************************************************************************************************************/
+struct t_eFSS_TYPE_EraseCtxUser
+{
+    e_eFSS_DB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_WriteCtxUser
+{
+    e_eFSS_DB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_ReadCtxUser
+{
+    e_eFSS_DB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_CrcCtxUser
+{
+    e_eFSS_DB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_WriteRangeCtxUser
+{
+    e_eFSS_DB_RES eLastEr;
+    uint32_t uTimeUsed;
+};
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE TEST FUNCTION DECLARATION
  **********************************************************************************************************************/
+static bool_t eFSS_DBTST_EraseTst1Adapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase);
+
+static bool_t eFSS_DBTST_WriteTst1Adapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                          const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                          const uint32_t p_uDataToWriteL );
+
+static bool_t eFSS_DBTST_ReadTst1Adapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                         const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                         const uint32_t p_uReadBufferL );
+
+static bool_t eFSS_DBTST_CrcTst1Adapt(t_eFSS_TYPE_CrcCtx* const p_ptCtx, const uint32_t p_uUseed,
+                                        const uint8_t* p_puData, const uint32_t p_uDataL,
+                                        uint32_t* const p_puCrc32Val );
+
+static bool_t eFSS_DBTST_WriteRangeTst1Adapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                               const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                               const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL );
+
+static void eFSS_DBTST_InitCb(t_eFSS_TYPE_CbStorCtx* const p_ptCtxCb, t_eFSS_TYPE_EraseCtx* const p_ptCtxErase,
+                                t_eFSS_TYPE_WriteCtx* const p_ptCtxWrite, t_eFSS_TYPE_ReadCtx* const p_ptCtxRead,
+                                t_eFSS_TYPE_CrcCtx* const p_ptCtxCrc32,
+                                t_eFSS_TYPE_WriteRangeCtx* const p_ptCtxWriteRange);
+
+static void eFSS_DBTST_InitStorSet(t_eFSS_TYPE_StorSet* const p_ptStorSet, const uint32_t p_uTotPages,
+                                   const uint32_t p_uPagesLen, const e_eFSS_TYPE_TRAIL p_eTrailer);
+
+static t_eFSS_DB_DbStruct eFSS_DBTST_InitDbStruct(t_eFSS_DB_DbEleLoc* const p_ptEleLoc, const uint32_t p_uJrnPages);
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION DECLARATION
  **********************************************************************************************************************/
+static void eFSS_DBTST_TxTest(void);
+static void eFSS_DBTST_JournalTest(void);
+static void eFSS_DBTST_EleLocTest(void);
 
 
 
@@ -46,6 +121,9 @@ void eFSS_DBTST_ExeTest(void)
 {
 	(void)printf("\n\nDATABASE TEST START \n\n");
 
+    eFSS_DBTST_TxTest();
+    eFSS_DBTST_JournalTest();
+    eFSS_DBTST_EleLocTest();
 
     (void)printf("\n\nDATABASE TEST END \n\n");
 }
@@ -55,11 +133,854 @@ void eFSS_DBTST_ExeTest(void)
 /***********************************************************************************************************************
  *   PRIVATE TEST FUNCTION IMPLEMENTATION
  **********************************************************************************************************************/
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "MISRAC2012-Rule-8.13", "MISRAC2012-Rule-10.5"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+static bool_t eFSS_DBTST_EraseTst1Adapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase)
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( p_uPageToErase >= EFSS_DBTST_NPAGE )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_DB_RES_BADPARAM;
+        }
+        else
+        {
+            p_ptCtx->uTimeUsed++;
+            (void)memset(m_auStorArea[p_uPageToErase], 0xFF, sizeof(m_auStorArea[p_uPageToErase]));
+            l_bRes = true;
+            p_ptCtx->eLastEr = e_eFSS_DB_RES_OK;
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_DBTST_WriteTst1Adapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                          const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                          const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( NULL == p_puDataToWrite )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_DB_RES_BADPOINTER;
+        }
+        else
+        {
+            if( ( p_uPageToWrite >= EFSS_DBTST_NPAGE ) || ( m_uPageL != p_uDataToWriteL ) )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_DB_RES_BADPARAM;
+            }
+            else if( 0u == m_uWriteLeft )
+            {
+                /* Simulate a power loss, nothing can be written anymore */
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_DB_RES_CLBCKWRITEERR;
+            }
+            else
+            {
+                p_ptCtx->uTimeUsed++;
+                l_bRes = true;
+                p_ptCtx->eLastEr = e_eFSS_DB_RES_OK;
+
+                if( MAX_UINT32VAL != m_uWriteLeft )
+                {
+                    m_uWriteLeft--;
+                }
+
+                /* A NOR flash can only clear bits */
+                for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+                {
+                    m_auStorArea[p_uPageToWrite][l_uCnt] &= p_puDataToWrite[l_uCnt];
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_DBTST_ReadTst1Adapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                         const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                         const uint32_t p_uReadBufferL )
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( NULL == p_puReadBuffer )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_DB_RES_BADPOINTER;
+        }
+        else
+        {
+            if( ( p_uPageToRead >= EFSS_DBTST_NPAGE ) || ( m_uPageL != p_uReadBufferL ) )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_DB_RES_BADPARAM;
+            }
+            else
+            {
+                p_ptCtx->uTimeUsed++;
+                l_bRes = true;
+                p_ptCtx->eLastEr = e_eFSS_DB_RES_OK;
+                (void)memcpy(p_puReadBuffer, m_auStorArea[p_uPageToRead], p_uReadBufferL);
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_DBTST_CrcTst1Adapt(t_eFSS_TYPE_CrcCtx* const p_ptCtx, const uint32_t p_uUseed,
+                                        const uint8_t* p_puData, const uint32_t p_uDataL,
+                                        uint32_t* const p_puCrc32Val )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTimeUsed++;
+
+        if( ( NULL == p_puData ) || ( NULL == p_puCrc32Val ) )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_DB_RES_BADPOINTER;
+        }
+        else
+        {
+            if( 0u == p_uDataL )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_DB_RES_BADPARAM;
+            }
+            else
+            {
+                l_bRes = true;
+                p_ptCtx->eLastEr = e_eFSS_DB_RES_OK;
+                *p_puCrc32Val = p_uUseed;
+
+                for(l_uCnt = 0u; l_uCnt < p_uDataL; l_uCnt++ )
+                {
+                    *p_puCrc32Val = ( (*p_puCrc32Val) + (p_puData[l_uCnt]) );
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_DBTST_WriteRangeTst1Adapt(t_eFSS_TYPE_WriteRangeCtx* const p_ptCtx,
+                                               const uint32_t p_uPageToWrite, const uint32_t p_uOffset,
+                                               const uint8_t* p_puDataToWrite, const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puDataToWrite ) || ( p_uPageToWrite >= EFSS_DBTST_NPAGE ) ||
+        ( ( p_uOffset + p_uDataToWriteL ) > m_uPageL ) )
+    {
+        l_bRes = false;
+    }
+    else if( 0u == m_uWriteLeft )
+    {
+        /* Simulate a power loss, nothing can be written anymore */
+        l_bRes = false;
+        p_ptCtx->eLastEr = e_eFSS_DB_RES_CLBCKWRITEERR;
+    }
+    else
+    {
+        p_ptCtx->uTimeUsed++;
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_DB_RES_OK;
+
+        if( MAX_UINT32VAL != m_uWriteLeft )
+        {
+            m_uWriteLeft--;
+        }
+
+        /* A NOR flash can only clear bits */
+        for(l_uCnt = 0u; l_uCnt < p_uDataToWriteL; l_uCnt++ )
+        {
+            m_auStorArea[p_uPageToWrite][p_uOffset + l_uCnt] &= p_puDataToWrite[l_uCnt];
+        }
+    }
+
+    return l_bRes;
+}
+
+static void eFSS_DBTST_InitCb(t_eFSS_TYPE_CbStorCtx* const p_ptCtxCb, t_eFSS_TYPE_EraseCtx* const p_ptCtxErase,
+                                t_eFSS_TYPE_WriteCtx* const p_ptCtxWrite, t_eFSS_TYPE_ReadCtx* const p_ptCtxRead,
+                                t_eFSS_TYPE_CrcCtx* const p_ptCtxCrc32,
+                                t_eFSS_TYPE_WriteRangeCtx* const p_ptCtxWriteRange)
+{
+    /* Init callback var, the ranged write is used only when its context is present */
+    p_ptCtxCb->ptCtxErase = p_ptCtxErase;
+    p_ptCtxCb->fErase = &eFSS_DBTST_EraseTst1Adapt;
+	p_ptCtxCb->ptCtxWrite = p_ptCtxWrite;
+    p_ptCtxCb->fWrite = &eFSS_DBTST_WriteTst1Adapt;
+	p_ptCtxCb->ptCtxRead = p_ptCtxRead;
+    p_ptCtxCb->fRead = &eFSS_DBTST_ReadTst1Adapt;
+	p_ptCtxCb->ptCtxCrc32 = p_ptCtxCrc32;
+    p_ptCtxCb->fCrc32 = &eFSS_DBTST_CrcTst1Adapt;
+	p_ptCtxCb->ptCtxIsErased = NULL;
+    p_ptCtxCb->fIsErased = NULL;
+	p_ptCtxCb->ptCtxReadRange = NULL;
+    p_ptCtxCb->fReadRange = NULL;
+	p_ptCtxCb->ptCtxWriteRange = p_ptCtxWriteRange;
+    p_ptCtxCb->fWriteRange = NULL;
+	p_ptCtxCb->ptCtxTime = NULL;
+    p_ptCtxCb->fTime = NULL;
+
+    if( NULL != p_ptCtxWriteRange )
+    {
+        p_ptCtxCb->fWriteRange = &eFSS_DBTST_WriteRangeTst1Adapt;
+        p_ptCtxWriteRange->uTimeUsed = 0u;
+        p_ptCtxWriteRange->eLastEr = e_eFSS_DB_RES_OK;
+    }
+
+    p_ptCtxErase->uTimeUsed = 0u;
+    p_ptCtxErase->eLastEr = e_eFSS_DB_RES_OK;
+    p_ptCtxWrite->uTimeUsed = 0u;
+    p_ptCtxWrite->eLastEr = e_eFSS_DB_RES_OK;
+    p_ptCtxRead->uTimeUsed = 0u;
+    p_ptCtxRead->eLastEr = e_eFSS_DB_RES_OK;
+    p_ptCtxCrc32->uTimeUsed = 0u;
+    p_ptCtxCrc32->eLastEr = e_eFSS_DB_RES_OK;
+}
+
+static void eFSS_DBTST_InitStorSet(t_eFSS_TYPE_StorSet* const p_ptStorSet, const uint32_t p_uTotPages,
+                                   const uint32_t p_uPagesLen, const e_eFSS_TYPE_TRAIL p_eTrailer)
+{
+    p_ptStorSet->uTotPages = p_uTotPages;
+    p_ptStorSet->uPagesLen = p_uPagesLen;
+    p_ptStorSet->uRWERetry = 3u;
+    p_ptStorSet->uPageVersion = 1u;
+    p_ptStorSet->bBlankCheck = false;
+    p_ptStorSet->uErasedVal = 0xFFu;
+    p_ptStorSet->eTrailer = p_eTrailer;
+    p_ptStorSet->uPagesPerBlk = 1u;
+
+    /* Every test start from an erased storage and without power loss */
+    (void)memset(m_auStorArea, 0xFF, sizeof(m_auStorArea));
+    m_uWriteLeft = MAX_UINT32VAL;
+    m_uPageL = p_uPagesLen;
+}
+
+static t_eFSS_DB_DbStruct eFSS_DBTST_InitDbStruct(t_eFSS_DB_DbEleLoc* const p_ptEleLoc, const uint32_t p_uJrnPages)
+{
+    t_eFSS_DB_DbStruct l_tDbStruct;
+    uint32_t l_uEle;
+
+    /* Six element of four byte, three of them fit in a page, so they are stored in two pages */
+    for(l_uEle = 0u; l_uEle < EFSS_DBTST_NELE; l_uEle++ )
+    {
+        (void)memset(m_auDefVal[l_uEle], (int)l_uEle, sizeof(m_auDefVal[l_uEle]));
+        m_atDefEle[l_uEle].uEleV = 1u;
+        m_atDefEle[l_uEle].uEleL = (uint16_t)EFSS_DBTST_ELEL;
+        m_atDefEle[l_uEle].puEleRaw = m_auDefVal[l_uEle];
+    }
+
+    l_tDbStruct.uNEle = EFSS_DBTST_NELE;
+    l_tDbStruct.ptDefEle = m_atDefEle;
+    l_tDbStruct.ptEleLoc = p_ptEleLoc;
+    l_tDbStruct.uEleLocL = EFSS_DBTST_NELE;
+    l_tDbStruct.uJournalPages = p_uJrnPages;
+    l_tDbStruct.bTrustOri = false;
+
+    return l_tDbStruct;
+}
+
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "MISRAC2012-Rule-8.13", "MISRAC2012-Rule-10.5"
+#endif
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION
  **********************************************************************************************************************/
+static void eFSS_DBTST_TxTest(void)
+{
+    /* Local variable */
+    t_eFSS_DB_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_DB_DbStruct l_tDbStruct;
+    t_eFSS_DB_DbTxEle l_atTxBuf[3u];
+    t_eFSS_DB_DbTxEle l_atTxEle[2u];
+    uint8_t l_auStor[96u];
+    uint8_t l_auNewVal0[EFSS_DBTST_ELEL];
+    uint8_t l_auNewVal4[EFSS_DBTST_ELEL];
+    uint8_t l_auRead0[EFSS_DBTST_ELEL];
+    uint8_t l_auRead4[EFSS_DBTST_ELEL];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Element 0 is in the first page and element 4 in the second one */
+    eFSS_DBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, NULL);
+    eFSS_DBTST_InitStorSet(&l_tStorSet, 8u, 48u, e_eFSS_TYPE_TRAIL_FULL);
+    l_tDbStruct = eFSS_DBTST_InitDbStruct(NULL, 0u);
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auNewVal0, 0xA0, sizeof(l_auNewVal0));
+    (void)memset(l_auNewVal4, 0xA4, sizeof(l_auNewVal4));
+    l_atTxEle[0u].uPos = 0u;
+    l_atTxEle[0u].uRawValL = (uint16_t)EFSS_DBTST_ELEL;
+    l_atTxEle[0u].puRawVal = l_auNewVal0;
+    l_atTxEle[1u].uPos = 4u;
+    l_atTxEle[1u].uRawValL = (uint16_t)EFSS_DBTST_ELEL;
+    l_atTxEle[1u].puRawVal = l_auNewVal4;
+
+    /* An erased storage is not valid, after the format the default value are returned */
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                              l_tDbStruct) ) &&
+        ( e_eFSS_DB_RES_NOTVALIDDB == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_FormatToDefault(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 4u, (uint16_t)EFSS_DBTST_ELEL, l_auRead4) ) &&
+        ( 0 == memcmp(m_auDefVal[4u], l_auRead4, EFSS_DBTST_ELEL) ) )
+    {
+        (void)printf("eFSS_DBTST_TxTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_TxTest 1  -- FAIL \n");
+    }
+
+    /* Element of two different pages are committed together, and are found after a new init */
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_BeginTx(&l_tCtx, l_atTxBuf, 3u) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_SetManyTx(&l_tCtx, l_atTxEle, 2u) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_CommitTx(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                              l_tDbStruct) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auRead0) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 4u, (uint16_t)EFSS_DBTST_ELEL, l_auRead4) ) &&
+        ( 0 == memcmp(l_auNewVal0, l_auRead0, EFSS_DBTST_ELEL) ) &&
+        ( 0 == memcmp(l_auNewVal4, l_auRead4, EFSS_DBTST_ELEL) ) )
+    {
+        (void)printf("eFSS_DBTST_TxTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_TxTest 2  -- FAIL \n");
+    }
+
+    /* A second begin is rejected, an aborted transaction write nothing and cannot be committed */
+    (void)memset(l_auNewVal0, 0xB0, sizeof(l_auNewVal0));
+    l_tCtxWrite.uTimeUsed = 0u;
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_BeginTx(&l_tCtx, l_atTxBuf, 3u) ) &&
+        ( e_eFSS_DB_RES_TXONGOING == eFSS_DB_BeginTx(&l_tCtx, l_atTxBuf, 3u) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_SetManyTx(&l_tCtx, l_atTxEle, 1u) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_AbortTx(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_TXNOTSTARTED == eFSS_DB_CommitTx(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_TXNOTSTARTED == eFSS_DB_AbortTx(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_TXNOTSTARTED == eFSS_DB_SetManyTx(&l_tCtx, l_atTxEle, 1u) ) &&
+        ( 0u == l_tCtxWrite.uTimeUsed ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auRead0) ) &&
+        ( 0xA0u == l_auRead0[0u] ) )
+    {
+        (void)printf("eFSS_DBTST_TxTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_TxTest 3  -- FAIL \n");
+    }
+
+    /* An element out of range or with a wrong size reject the whole group, nothing is staged */
+    l_atTxEle[1u].uPos = EFSS_DBTST_NELE;
+    l_tCtxWrite.uTimeUsed = 0u;
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_BeginTx(&l_tCtx, l_atTxBuf, 3u) ) &&
+        ( e_eFSS_DB_RES_BADPARAM == eFSS_DB_SetManyTx(&l_tCtx, l_atTxEle, 2u) ) )
+    {
+        l_atTxEle[1u].uPos = 4u;
+        l_atTxEle[1u].uRawValL = (uint16_t)( EFSS_DBTST_ELEL - 1u );
+        if( ( e_eFSS_DB_RES_BADPARAM == eFSS_DB_SetManyTx(&l_tCtx, l_atTxEle, 2u) ) &&
+            ( e_eFSS_DB_RES_BADPARAM == eFSS_DB_SetManyTx(&l_tCtx, l_atTxEle, 0u) ) &&
+            ( e_eFSS_DB_RES_OK == eFSS_DB_CommitTx(&l_tCtx) ) && ( 0u == l_tCtxWrite.uTimeUsed ) &&
+            ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auRead0) ) &&
+            ( 0xA0u == l_auRead0[0u] ) )
+        {
+            (void)printf("eFSS_DBTST_TxTest 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_DBTST_TxTest 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_TxTest 4  -- FAIL \n");
+    }
+
+    /* Power loss after staging only the first page, no commit marker, the old value are kept */
+    l_atTxEle[1u].uRawValL = (uint16_t)EFSS_DBTST_ELEL;
+    (void)memset(l_auNewVal4, 0xB4, sizeof(l_auNewVal4));
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_BeginTx(&l_tCtx, l_atTxBuf, 3u) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_SetManyTx(&l_tCtx, l_atTxEle, 2u) ) )
+    {
+        m_uWriteLeft = 1u;
+        if( ( e_eFSS_DB_RES_CLBCKWRITEERR == eFSS_DB_CommitTx(&l_tCtx) ) &&
+            ( e_eFSS_DB_RES_DBNOTCHECKED == eFSS_DB_GetElement(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL,
+                                                                l_auRead0) ) )
+        {
+            m_uWriteLeft = MAX_UINT32VAL;
+            if( ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                      l_tDbStruct) ) &&
+                ( e_eFSS_DB_RES_OK_BKP_RCVRD == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auRead0) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 4u, (uint16_t)EFSS_DBTST_ELEL, l_auRead4) ) &&
+                ( 0xA0u == l_auRead0[0u] ) && ( 0xA4u == l_auRead4[0u] ) )
+            {
+                (void)printf("eFSS_DBTST_TxTest 5  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_DBTST_TxTest 5  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_DBTST_TxTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_TxTest 5  -- FAIL \n");
+    }
 
+    /* Power loss between the commit marker and the copy in the origin pages, the new value are restored */
+    m_uWriteLeft = MAX_UINT32VAL;
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_BeginTx(&l_tCtx, l_atTxBuf, 3u) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_SetManyTx(&l_tCtx, l_atTxEle, 2u) ) )
+    {
+        /* The copy of the first staged page is interrupted after its origin page is erased */
+        m_uWriteLeft = 2u;
+        if( ( e_eFSS_DB_RES_CLBCKWRITEERR == eFSS_DB_CommitTx(&l_tCtx) ) && ( 0xFFu == m_auStorArea[0u][4u] ) )
+        {
+            m_uWriteLeft = MAX_UINT32VAL;
+            if( ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                      l_tDbStruct) ) &&
+                ( e_eFSS_DB_RES_OK_BKP_RCVRD == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auRead0) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 4u, (uint16_t)EFSS_DBTST_ELEL, l_auRead4) ) &&
+                ( 0xB0u == l_auRead0[0u] ) && ( 0xB4u == l_auRead4[0u] ) )
+            {
+                (void)printf("eFSS_DBTST_TxTest 6  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_DBTST_TxTest 6  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_DBTST_TxTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_TxTest 6  -- FAIL \n");
+    }
 
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+}
+
+static void eFSS_DBTST_JournalTest(void)
+{
+    /* Local variable */
+    t_eFSS_DB_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_DB_DbStruct l_tDbStruct;
+    t_eFSS_DB_DbEleLoc l_atEleLoc[EFSS_DBTST_NELE];
+    t_eFSS_TYPE_Stats l_tStats;
+    uint8_t l_auStor[192u];
+    uint8_t l_auVal[EFSS_DBTST_ELEL];
+    uint8_t l_auRead[EFSS_DBTST_ELEL];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+    t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+    t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+    t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    t_eFSS_TYPE_WriteRangeCtx l_tCtxWriteRange;
+
+    eFSS_DBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, &l_tCtxWriteRange);
+    eFSS_DBTST_InitStorSet(&l_tStorSet, 10u, 64u, e_eFSS_TYPE_TRAIL_PROG);
+    l_tDbStruct = eFSS_DBTST_InitDbStruct(l_atEleLoc, 2u);
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tStats, 0, sizeof(l_tStats));
+    (void)memset(l_auVal, 0xC1, sizeof(l_auVal));
+    /* Element raw value is after his version and length, every page of 32 usable byte hold four element and the
+       journal page two record */
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                              l_tDbStruct) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_FormatToDefault(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_DBTST_JournalTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_JournalTest 1  -- FAIL \n");
+    }
+
+    /* A saved element is appended in place to the journal page and to his mirror, his page is not touched */
+    l_auVal[0u] = 0xC0u;
+    l_tCtxWriteRange.uTimeUsed = 0u;
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_ResetStats(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_SaveElemen(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetStats(&l_tCtx, &l_tStats) ) && ( 0u == l_tStats.uEraseCnt ) &&
+        ( 4u == l_tCtxWriteRange.uTimeUsed ) && ( 0x00u == m_auStorArea[0u][4u] ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+        ( 0xC0u == l_auRead[0u] ) )
+    {
+        (void)printf("eFSS_DBTST_JournalTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_JournalTest 2  -- FAIL \n");
+    }
+
+    /* After a new init the journal is loaded and applied to the element pages */
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                              l_tDbStruct) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) && ( 0xC0u == m_auStorArea[0u][4u] ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+        ( 0xC0u == l_auRead[0u] ) )
+    {
+        (void)printf("eFSS_DBTST_JournalTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_JournalTest 3  -- FAIL \n");
+    }
+
+    /* The last record of an element is his value, the journal is copied in the pages only when full */
+    l_auVal[0u] = 0xC1u;
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_SaveElemen(&l_tCtx, 1u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) ) )
+    {
+        l_auVal[0u] = 0xC2u;
+        if( ( e_eFSS_DB_RES_OK == eFSS_DB_ResetStats(&l_tCtx) ) &&
+            ( e_eFSS_DB_RES_OK == eFSS_DB_SaveElemen(&l_tCtx, 1u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) ) &&
+            ( e_eFSS_DB_RES_OK == eFSS_DB_GetStats(&l_tCtx, &l_tStats) ) && ( 0u == l_tStats.uEraseCnt ) &&
+            ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 1u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+            ( 0xC2u == l_auRead[0u] ) && ( 0x01u == m_auStorArea[0u][12u] ) )
+        {
+            l_auVal[0u] = 0xC3u;
+            if( ( e_eFSS_DB_RES_OK == eFSS_DB_SaveElemen(&l_tCtx, 2u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) ) &&
+                ( 0xC2u == m_auStorArea[0u][12u] ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                      l_tDbStruct) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 1u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+                ( 0xC2u == l_auRead[0u] ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 2u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+                ( 0xC3u == l_auRead[0u] ) )
+            {
+                (void)printf("eFSS_DBTST_JournalTest 4  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_DBTST_JournalTest 4  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_DBTST_JournalTest 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_JournalTest 4  -- FAIL \n");
+    }
+
+    /* A power loss while appending to the journal page lose only the element being saved, his mirror still has
+       the previous records */
+    l_auVal[0u] = 0xC4u;
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_CompactJournal(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_SaveElemen(&l_tCtx, 4u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) ) )
+    {
+        l_auVal[0u] = 0xC5u;
+        m_uWriteLeft = 1u;
+        if( e_eFSS_DB_RES_OK != eFSS_DB_SaveElemen(&l_tCtx, 5u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) )
+        {
+            m_uWriteLeft = MAX_UINT32VAL;
+            if( ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                      l_tDbStruct) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 4u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+                ( 0xC4u == l_auRead[0u] ) &&
+                ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 5u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+                ( 0x05u == l_auRead[0u] ) )
+            {
+                (void)printf("eFSS_DBTST_JournalTest 5  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_DBTST_JournalTest 5  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_DBTST_JournalTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_JournalTest 5  -- FAIL \n");
+    }
+
+    /* A power loss while appending to the mirror keep the saved element */
+    m_uWriteLeft = 2u;
+    if( e_eFSS_DB_RES_OK != eFSS_DB_SaveElemen(&l_tCtx, 5u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) )
+    {
+        m_uWriteLeft = MAX_UINT32VAL;
+        if( ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                                  l_tDbStruct) ) &&
+            ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+            ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 5u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+            ( 0xC5u == l_auRead[0u] ) )
+        {
+            (void)printf("eFSS_DBTST_JournalTest 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_DBTST_JournalTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_JournalTest 6  -- FAIL \n");
+    }
+
+    /* Without the ranged write every save write a new journal page, the value is kept anyway */
+    eFSS_DBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, NULL);
+    eFSS_DBTST_InitStorSet(&l_tStorSet, 10u, 64u, e_eFSS_TYPE_TRAIL_FULL);
+    l_auVal[0u] = 0xC6u;
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                              l_tDbStruct) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_FormatToDefault(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_ResetStats(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_SaveElemen(&l_tCtx, 3u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetStats(&l_tCtx, &l_tStats) ) && ( 1u == l_tStats.uEraseCnt ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor),
+                                              l_tDbStruct) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtx) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtx, 3u, (uint16_t)EFSS_DBTST_ELEL, l_auRead) ) &&
+        ( 0xC6u == l_auRead[0u] ) )
+    {
+        (void)printf("eFSS_DBTST_JournalTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_JournalTest 7  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxWriteRange.eLastEr;
+}
+
+static void eFSS_DBTST_EleLocTest(void)
+{
+    /* Local variable */
+    t_eFSS_DB_Ctx l_tCtxScan;
+    t_eFSS_DB_Ctx l_tCtxLoc;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_DB_DbStruct l_tDbScan;
+    t_eFSS_DB_DbStruct l_tDbLoc;
+    t_eFSS_DB_DbEleLoc l_atEleLoc[EFSS_DBTST_NELE];
+    uint8_t l_auStorScan[96u];
+    uint8_t l_auStorLoc[96u];
+    uint8_t l_auVal[EFSS_DBTST_ELEL];
+    uint8_t l_auReadScan[EFSS_DBTST_ELEL];
+    uint8_t l_auReadLoc[EFSS_DBTST_ELEL];
+    uint32_t l_uEle;
+    bool_t l_bIsOk;
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+
+    /* Both context use the same storage, one calculate the element position and the other use the location index */
+    eFSS_DBTST_InitCb(&l_tCtxCb, &l_tCtxErase, &l_tCtxWrite, &l_tCtxRead, &l_tCtxCrc32, NULL);
+    eFSS_DBTST_InitStorSet(&l_tStorSet, 8u, 48u, e_eFSS_TYPE_TRAIL_FULL);
+    l_tDbScan = eFSS_DBTST_InitDbStruct(NULL, 0u);
+    l_tDbLoc = eFSS_DBTST_InitDbStruct(l_atEleLoc, 0u);
+    (void)memset(&l_tCtxScan, 0, sizeof(l_tCtxScan));
+    (void)memset(&l_tCtxLoc, 0, sizeof(l_tCtxLoc));
+    (void)memset(l_atEleLoc, 0, sizeof(l_atEleLoc));
+
+    /* A location index with less element than the database is rejected, without it the size is not used */
+    l_tDbLoc.uEleLocL = EFSS_DBTST_NELE - 1u;
+    l_tDbScan.uEleLocL = 0u;
+    if( ( e_eFSS_DB_RES_BADPARAM == eFSS_DB_InitCtx(&l_tCtxLoc, l_tCtxCb, l_tStorSet, l_auStorLoc,
+                                                    sizeof(l_auStorLoc), l_tDbLoc) ) &&
+        ( e_eFSS_DB_RES_NOINITLIB == eFSS_DB_GetDBStatus(&l_tCtxLoc) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtxScan, l_tCtxCb, l_tStorSet, l_auStorScan,
+                                              sizeof(l_auStorScan), l_tDbScan) ) )
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 1  -- FAIL \n");
+    }
+
+    /* The index is filled during the init, three element of eight byte are stored in every page */
+    l_tDbLoc.uEleLocL = EFSS_DBTST_NELE;
+    if( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtxLoc, l_tCtxCb, l_tStorSet, l_auStorLoc, sizeof(l_auStorLoc),
+                                            l_tDbLoc) )
+    {
+        l_bIsOk = true;
+        for( l_uEle = 0u; l_uEle < EFSS_DBTST_NELE; l_uEle++ )
+        {
+            if( ( ( l_uEle / 3u ) != l_atEleLoc[l_uEle].uPageIdx ) ||
+                ( ( ( l_uEle % 3u ) * 8u ) != l_atEleLoc[l_uEle].uPageOff ) )
+            {
+                l_bIsOk = false;
+            }
+        }
+
+        if( true == l_bIsOk )
+        {
+            (void)printf("eFSS_DBTST_EleLocTest 2  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_DBTST_EleLocTest 2  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 2  -- FAIL \n");
+    }
+
+    /* The format clear the buffer, so the unused bytes after the third element are zero and not the old buffer
+       content */
+    (void)memset(l_auStorScan, 0xA5, sizeof(l_auStorScan));
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_FormatToDefault(&l_tCtxScan) ) &&
+        ( 0x00u == m_auStorArea[0u][24u] ) && ( 0x00u == m_auStorArea[0u][27u] ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtxScan) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtxLoc) ) )
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 3  -- FAIL \n");
+    }
+
+    /* Element saved with one context are readed equal with the other one */
+    l_bIsOk = true;
+    for( l_uEle = 0u; l_uEle < EFSS_DBTST_NELE; l_uEle++ )
+    {
+        (void)memset(l_auVal, (int)( 0xB0u + l_uEle ), sizeof(l_auVal));
+        if( 0u == ( l_uEle % 2u ) )
+        {
+            if( e_eFSS_DB_RES_OK != eFSS_DB_SaveElemen(&l_tCtxScan, l_uEle, (uint16_t)EFSS_DBTST_ELEL, l_auVal) )
+            {
+                l_bIsOk = false;
+            }
+        }
+        else
+        {
+            if( e_eFSS_DB_RES_OK != eFSS_DB_SaveElemen(&l_tCtxLoc, l_uEle, (uint16_t)EFSS_DBTST_ELEL, l_auVal) )
+            {
+                l_bIsOk = false;
+            }
+        }
+    }
+
+    for( l_uEle = 0u; l_uEle < EFSS_DBTST_NELE; l_uEle++ )
+    {
+        (void)memset(l_auVal, (int)( 0xB0u + l_uEle ), sizeof(l_auVal));
+        if( ( e_eFSS_DB_RES_OK != eFSS_DB_GetElement(&l_tCtxScan, l_uEle, (uint16_t)EFSS_DBTST_ELEL,
+                                                     l_auReadScan) ) ||
+            ( e_eFSS_DB_RES_OK != eFSS_DB_GetElement(&l_tCtxLoc, l_uEle, (uint16_t)EFSS_DBTST_ELEL, l_auReadLoc) ) ||
+            ( 0 != memcmp(l_auVal, l_auReadScan, EFSS_DBTST_ELEL) ) ||
+            ( 0 != memcmp(l_auVal, l_auReadLoc, EFSS_DBTST_ELEL) ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+
+    if( true == l_bIsOk )
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 4  -- FAIL \n");
+    }
+
+    /* An element at the start of the second page is saved in the second page and not in the page indexed by his
+       offset, so the element of the first page are not touched */
+    (void)memset(l_auVal, 0xC3, sizeof(l_auVal));
+    if( ( e_eFSS_DB_RES_OK == eFSS_DB_FormatToDefault(&l_tCtxLoc) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtxLoc) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_SaveElemen(&l_tCtxLoc, 3u, (uint16_t)EFSS_DBTST_ELEL, l_auVal) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_InitCtx(&l_tCtxLoc, l_tCtxCb, l_tStorSet, l_auStorLoc, sizeof(l_auStorLoc),
+                                              l_tDbLoc) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetDBStatus(&l_tCtxLoc) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtxLoc, 0u, (uint16_t)EFSS_DBTST_ELEL, l_auReadLoc) ) &&
+        ( 0 == memcmp(m_auDefVal[0u], l_auReadLoc, EFSS_DBTST_ELEL) ) &&
+        ( e_eFSS_DB_RES_OK == eFSS_DB_GetElement(&l_tCtxLoc, 3u, (uint16_t)EFSS_DBTST_ELEL, l_auReadLoc) ) &&
+        ( 0 == memcmp(l_auVal, l_auReadLoc, EFSS_DBTST_ELEL) ) )
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_DBTST_EleLocTest 5  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+}
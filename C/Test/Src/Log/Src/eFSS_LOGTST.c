@@ -11,31 +11,96 @@
  *      INCLUDES
  **********************************************************************************************************************/
 #include "eFSS_LOGTST.h"
+#include "eFSS_LOG.h"
 #include <stdio.h>
 
 
 
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+#define EFSS_LOGTST_RECHEADL                                                              ( ( uint32_t )         0x04u )
+
+
+
 /***********************************************************************************************************************
  *   PRIVATE TEST VARIABLE DECLARATION
  **********************************************************************************************************************/
+static bool_t  m_bIsErased[14u] = {false};
+static uint8_t m_auStorArea[14u][48u];
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE TEST STRUCT DECLARATION
  **********************************************************************************************************************/
+struct t_eFSS_TYPE_EraseCtxUser
+{
+    e_eFSS_LOG_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_WriteCtxUser
+{
+    e_eFSS_LOG_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_ReadCtxUser
+{
+    e_eFSS_LOG_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_CrcCtxUser
+{
+    e_eFSS_LOG_RES eLastEr;
+    uint32_t uTimeUsed;
+};
+
+struct t_eFSS_TYPE_TimeCtxUser
+{
+    uint32_t uTime;
+};
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE TEST FUNCTION DECLARATION
  **********************************************************************************************************************/
+static bool_t eFSS_LOGTST_EraseTst1Adapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase);
+
+static bool_t eFSS_LOGTST_WriteTst1Adapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                         const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                         const uint32_t p_uDataToWriteL );
+
+static bool_t eFSS_LOGTST_ReadTst1Adapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                        const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                        const uint32_t p_uReadBufferL );
+
+static bool_t eFSS_LOGTST_CrcTst1Adapt(t_eFSS_TYPE_CrcCtx* const p_ptCtx, const uint32_t p_uUseed,
+                                       const uint8_t* p_puData, const uint32_t p_uDataL,
+                                       uint32_t* const p_puCrc32Val );
+
+static bool_t eFSS_LOGTST_TimeTst1Adapt(t_eFSS_TYPE_TimeCtx* const p_ptCtx, uint32_t* const p_puTime);
+static bool_t eFSS_LOGTST_EraseBlkTst1Adapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase);
+
+static uint32_t eFSS_LOGTST_HistTot(const t_eFSS_TYPE_LatHist* p_ptHist);
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION DECLARATION
  **********************************************************************************************************************/
+static void eFSS_LOGTST_AddLogTest(void);
+static void eFSS_LOGTST_AddLogsTest(void);
+static void eFSS_LOGTST_SyncTest(void);
+static void eFSS_LOGTST_CacheNBkupTest(void);
+static void eFSS_LOGTST_RecoveryTest(void);
+static void eFSS_LOGTST_GuessNewestTest(void);
+static void eFSS_LOGTST_IteratorTest(void);
+static void eFSS_LOGTST_FormatLatTest(void);
+static void eFSS_LOGTST_BlockFormatTest(void);
 
 
 
@@ -46,6 +111,15 @@ void eFSS_LOGTST_ExeTest(void)
 {
 	(void)printf("\n\nLOG TEST START \n\n");
 
+    eFSS_LOGTST_AddLogTest();
+    eFSS_LOGTST_AddLogsTest();
+    eFSS_LOGTST_SyncTest();
+    eFSS_LOGTST_CacheNBkupTest();
+    eFSS_LOGTST_RecoveryTest();
+    eFSS_LOGTST_GuessNewestTest();
+    eFSS_LOGTST_IteratorTest();
+    eFSS_LOGTST_FormatLatTest();
+    eFSS_LOGTST_BlockFormatTest();
 
     (void)printf("\n\nLOG TEST END \n\n");
 }
@@ -55,11 +129,2334 @@ void eFSS_LOGTST_ExeTest(void)
 /***********************************************************************************************************************
  *   PRIVATE TEST FUNCTION IMPLEMENTATION
  **********************************************************************************************************************/
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_disable = "MISRAC2012-Rule-8.13", "MISRAC2012-Rule-10.5"
+    /* Suppressed for code clarity in test execution*/
+#endif
+
+static bool_t eFSS_LOGTST_EraseTst1Adapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase)
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( p_uPageToErase >= 14u )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_LOG_RES_BADPARAM;
+        }
+        else
+        {
+            p_ptCtx->uTimeUsed++;
+            (void)memset(m_auStorArea[p_uPageToErase], 0, sizeof(m_auStorArea[p_uPageToErase]));
+            l_bRes = true;
+            p_ptCtx->eLastEr = e_eFSS_LOG_RES_OK;
+            m_bIsErased[p_uPageToErase] = true;
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_LOGTST_WriteTst1Adapt(t_eFSS_TYPE_WriteCtx* const p_ptCtx,
+                                         const uint32_t p_uPageToWrite, const uint8_t* p_puDataToWrite,
+                                         const uint32_t p_uDataToWriteL )
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( NULL == p_puDataToWrite )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_LOG_RES_BADPOINTER;
+        }
+        else
+        {
+            if( ( p_uPageToWrite >= 14u ) || ( 48u != p_uDataToWriteL ) )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_LOG_RES_BADPARAM;
+            }
+            else
+            {
+                p_ptCtx->uTimeUsed++;
+
+                if( false == m_bIsErased[p_uPageToWrite] )
+                {
+                    l_bRes = false;
+                    p_ptCtx->eLastEr = e_eFSS_LOG_RES_CORRUPTCTX;
+                }
+                else
+                {
+                    l_bRes = true;
+                    p_ptCtx->eLastEr = e_eFSS_LOG_RES_OK;
+                    m_bIsErased[p_uPageToWrite] = false;
+                    (void)memcpy(m_auStorArea[p_uPageToWrite], p_puDataToWrite, p_uDataToWriteL);
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_LOGTST_ReadTst1Adapt(t_eFSS_TYPE_ReadCtx* const p_ptCtx,
+                                        const uint32_t p_uPageToRead, uint8_t* const p_puReadBuffer,
+                                        const uint32_t p_uReadBufferL )
+{
+    bool_t l_bRes;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        if( NULL == p_puReadBuffer )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_LOG_RES_BADPOINTER;
+        }
+        else
+        {
+            if( ( p_uPageToRead >= 14u ) || ( 48u != p_uReadBufferL ) )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_LOG_RES_BADPARAM;
+            }
+            else
+            {
+                p_ptCtx->uTimeUsed++;
+
+                l_bRes = true;
+                p_ptCtx->eLastEr = e_eFSS_LOG_RES_OK;
+                (void)memcpy(p_puReadBuffer, m_auStorArea[p_uPageToRead], p_uReadBufferL);
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_LOGTST_CrcTst1Adapt(t_eFSS_TYPE_CrcCtx* const p_ptCtx, const uint32_t p_uUseed,
+                                       const uint8_t* p_puData, const uint32_t p_uDataL,
+                                       uint32_t* const p_puCrc32Val )
+{
+    bool_t l_bRes;
+    uint32_t l_uCnt;
+
+    if( NULL == p_ptCtx )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTimeUsed++;
+
+        if( ( NULL == p_puData ) || ( NULL == p_puCrc32Val ) )
+        {
+            l_bRes = false;
+            p_ptCtx->eLastEr = e_eFSS_LOG_RES_BADPOINTER;
+        }
+        else
+        {
+            if( 0u == p_uDataL )
+            {
+                l_bRes = false;
+                p_ptCtx->eLastEr = e_eFSS_LOG_RES_BADPARAM;
+            }
+            else
+            {
+                l_bRes = true;
+                p_ptCtx->eLastEr = e_eFSS_LOG_RES_OK;
+                *p_puCrc32Val = p_uUseed;
+
+                for(l_uCnt = 0u; l_uCnt < p_uDataL; l_uCnt++ )
+                {
+                    *p_puCrc32Val = ( (*p_puCrc32Val) + (p_puData[l_uCnt]) );
+                }
+            }
+        }
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_LOGTST_TimeTst1Adapt(t_eFSS_TYPE_TimeCtx* const p_ptCtx, uint32_t* const p_puTime)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puTime ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTime += 5u;
+        *p_puTime = p_ptCtx->uTime;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+static bool_t eFSS_LOGTST_EraseBlkTst1Adapt(t_eFSS_TYPE_EraseCtx* const p_ptCtx, const uint32_t p_uPageToErase)
+{
+    bool_t l_bRes;
+
+    /* Two pages for every erase block, only the first page of a block can be passed */
+    if( ( NULL == p_ptCtx ) || ( p_uPageToErase >= 14u ) || ( 0u != ( p_uPageToErase % 2u ) ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTimeUsed++;
+        (void)memset(m_auStorArea[p_uPageToErase], 0, sizeof(m_auStorArea[p_uPageToErase]));
+        (void)memset(m_auStorArea[p_uPageToErase + 1u], 0, sizeof(m_auStorArea[p_uPageToErase + 1u]));
+        l_bRes = true;
+        p_ptCtx->eLastEr = e_eFSS_LOG_RES_OK;
+        m_bIsErased[p_uPageToErase] = true;
+        m_bIsErased[p_uPageToErase + 1u] = true;
+    }
+
+    return l_bRes;
+}
+
+static uint32_t eFSS_LOGTST_HistTot(const t_eFSS_TYPE_LatHist* p_ptHist)
+{
+    uint32_t l_uTot;
+    uint32_t l_uCnt;
+
+    l_uTot = 0u;
+    for( l_uCnt = 0u; l_uCnt < EFSS_TYPE_LATBUCKET; l_uCnt++ )
+    {
+        l_uTot += p_ptHist->auBucket[l_uCnt];
+    }
+
+    return l_uTot;
+}
 
 
 
 /***********************************************************************************************************************
  *   PRIVATE FUNCTION
  **********************************************************************************************************************/
+static void eFSS_LOGTST_AddLogTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    uint8_t l_auLog[16u];
+    uint8_t l_auPage[20u];
+    uint32_t l_uValorByte;
+    uint32_t l_uNewLogI;
+    uint32_t l_uOldLogI;
+    uint32_t l_uNpageUsed;
+    uint32_t l_uNpageTot;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+
+    /* Init storage settings, every log page can contain 16 byte of log */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uValorByte = 0u;
+    l_uNewLogI = 0u;
+    l_uOldLogI = 0u;
+    l_uNpageUsed = 0u;
+    l_uNpageTot = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auLog, 0xA5, sizeof(l_auLog));
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false, false) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_NOTVALIDLOG == eFSS_LOG_GetLogStatus(&l_tCtx) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) && ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 3  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed, &l_uNpageTot) )
+    {
+        if( ( 0u == l_uNewLogI ) && ( 0u == l_uOldLogI ) && ( 0u == l_uNpageUsed ) && ( 14u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 4  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_AddLog(NULL, l_auLog, 5u) ) &&
+        ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_AddLog(&l_tCtx, NULL, 5u) ) &&
+        ( e_eFSS_LOG_RES_BADPARAM == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 0u) ) &&
+        ( e_eFSS_LOG_RES_BADPARAM == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 16u) ) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 5  -- FAIL \n");
+    }
+
+    /* Log stored in the newest page */
+    l_auLog[0u] = 0x01u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 5u) )
+    {
+        if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+        {
+            if( ( 5u == l_uValorByte ) && ( 0x01u == l_auPage[0u] ) && ( 0xA5u == l_auPage[4u] ) )
+            {
+                (void)printf("eFSS_LOGTST_AddLogTest 6  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_LOGTST_AddLogTest 6  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 6  -- FAIL \n");
+    }
+
+    /* The newest page and his backup are equals */
+    if( 0 == memcmp(m_auStorArea[0u], m_auStorArea[1u], 20u) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 7  -- FAIL \n");
+    }
+
+    /* Fill the page, the fourth log fits only in the place of the number of filled page, so the page is closed */
+    l_auLog[0u] = 0x02u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 5u) )
+    {
+        l_auLog[0u] = 0x03u;
+        if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 5u) )
+        {
+            l_auLog[0u] = 0x04u;
+            if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 5u) )
+            {
+                (void)printf("eFSS_LOGTST_AddLogTest 8  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_LOGTST_AddLogTest 8  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 8  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed, &l_uNpageTot) )
+    {
+        if( ( 1u == l_uNewLogI ) && ( 0u == l_uOldLogI ) && ( 1u == l_uNpageUsed ) && ( 14u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 9  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 20u == l_uValorByte ) && ( 0x01u == l_auPage[0u] ) && ( 0x02u == l_auPage[5u] ) &&
+            ( 0x03u == l_auPage[10u] ) && ( 0x04u == l_auPage[15u] ) && ( 0xA5u == l_auPage[19u] ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 10 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 1u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( 0u == l_uValorByte )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 11 -- FAIL \n");
+    }
+
+    /* The second log does not fit in the newest page, so it is saved alone on the next one */
+    l_auLog[0u] = 0x05u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 15u) )
+    {
+        l_auLog[0u] = 0x06u;
+        if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 15u) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 12 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 12 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 12 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 1u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 15u == l_uValorByte ) && ( 0x05u == l_auPage[0u] ) && ( 0xA5u == l_auPage[14u] ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 13 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 13 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 13 -- FAIL \n");
+    }
+
+    /* Reload everything from the storage using a new context */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false, false) )
+    {
+        if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 14 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 14 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 14 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed, &l_uNpageTot) )
+    {
+        if( ( 2u == l_uNewLogI ) && ( 0u == l_uOldLogI ) && ( 2u == l_uNpageUsed ) && ( 14u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 15 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 15 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 15 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 2u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 15u == l_uValorByte ) && ( 0x06u == l_auPage[0u] ) && ( 0xA5u == l_auPage[14u] ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 16 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 16 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 16 -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 20u == l_uValorByte ) && ( 0x01u == l_auPage[0u] ) && ( 0x04u == l_auPage[15u] ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 17 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogTest 17 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogTest 17 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_LOGTST_AddLogsTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    uint8_t l_auLog1[16u];
+    uint8_t l_auLog2[16u];
+    uint8_t l_auLog3[16u];
+    uint8_t l_auPage[20u];
+    uint8_t l_auPend[16u];
+    t_eFSS_LOG_LogEle l_atLogs[5u];
+    uint32_t l_uValorByte;
+    uint32_t l_uPendByte;
+    uint32_t l_uWriteUsed;
+    uint32_t l_uNewLogI;
+    uint32_t l_uOldLogI;
+    uint32_t l_uNpageUsed;
+    uint32_t l_uNpageTot;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+
+    /* Init storage settings, every log page can contain 16 byte of log */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uValorByte = 0u;
+    l_uPendByte = 0u;
+    l_uNewLogI = 0u;
+    l_uOldLogI = 0u;
+    l_uNpageUsed = 0u;
+    l_uNpageTot = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auLog1, 0x01, sizeof(l_auLog1));
+    (void)memset(l_auLog2, 0x02, sizeof(l_auLog2));
+    (void)memset(l_auLog3, 0x03, sizeof(l_auLog3));
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    l_atLogs[0u].puLogRaw = l_auLog1;
+    l_atLogs[0u].uLogL = 4u;
+    l_atLogs[1u].puLogRaw = NULL;
+    l_atLogs[1u].uLogL = 4u;
+    if( ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_AddLogs(NULL, l_atLogs, 1u) ) &&
+        ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_AddLogs(&l_tCtx, NULL, 1u) ) &&
+        ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_AddLogs(&l_tCtx, l_atLogs, 2u) ) &&
+        ( e_eFSS_LOG_RES_BADPARAM == eFSS_LOG_AddLogs(&l_tCtx, l_atLogs, 0u) ) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 2  -- FAIL \n");
+    }
+
+    /* A not valid log is found before saving anything */
+    l_uWriteUsed = l_tCtxWrite.uTimeUsed;
+    l_atLogs[1u].puLogRaw = l_auLog2;
+    l_atLogs[1u].uLogL = 16u;
+    if( ( e_eFSS_LOG_RES_BADPARAM == eFSS_LOG_AddLogs(&l_tCtx, l_atLogs, 2u) ) &&
+        ( l_uWriteUsed == l_tCtxWrite.uTimeUsed ) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 3  -- FAIL \n");
+    }
+
+    /* Log that fit in the newest page are stored with a single flush of the newest page and of his backup */
+    l_uWriteUsed = l_tCtxWrite.uTimeUsed;
+    l_atLogs[1u].uLogL = 4u;
+    l_atLogs[2u].puLogRaw = l_auLog3;
+    l_atLogs[2u].uLogL = 4u;
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLogs(&l_tCtx, l_atLogs, 3u) ) &&
+        ( ( l_uWriteUsed + 2u ) == l_tCtxWrite.uTimeUsed ) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 4  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 12u == l_uValorByte ) && ( 0x01u == l_auPage[3u] ) && ( 0x02u == l_auPage[4u] ) &&
+            ( 0x02u == l_auPage[7u] ) && ( 0x03u == l_auPage[8u] ) && ( 0x03u == l_auPage[11u] ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 5  -- FAIL \n");
+    }
+
+    /* The first log close the newest page, the other two are saved in the new newest page with a single flush. Closing
+     * a page needs three write, the closed page, the new backup and the new newest page */
+    l_uWriteUsed = l_tCtxWrite.uTimeUsed;
+    l_atLogs[0u].puLogRaw = l_auLog3;
+    l_atLogs[1u].puLogRaw = l_auLog2;
+    l_atLogs[2u].puLogRaw = l_auLog1;
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLogs(&l_tCtx, l_atLogs, 3u) ) &&
+        ( ( l_uWriteUsed + 5u ) == l_tCtxWrite.uTimeUsed ) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 6  -- FAIL \n");
+    }
+
+    /* Pending log are stored before the passed one */
+    l_atLogs[0u].puLogRaw = l_auLog2;
+    l_atLogs[0u].uLogL = 15u;
+    l_atLogs[1u].puLogRaw = l_auLog3;
+    l_atLogs[1u].uLogL = 15u;
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitPendingBuff(&l_tCtx, l_auPend, sizeof(l_auPend), 12u, 4u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog1, 4u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLogs(&l_tCtx, l_atLogs, 2u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetPendingByte(&l_tCtx, &l_uPendByte) ) && ( 0u == l_uPendByte ) )
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 7  -- FAIL \n");
+    }
+
+    /* Reload everything from the storage using a new context */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed,
+                                                   &l_uNpageTot) ) )
+    {
+        if( ( 3u == l_uNewLogI ) && ( 0u == l_uOldLogI ) && ( 3u == l_uNpageUsed ) && ( 14u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 8  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 16u == l_uValorByte ) && ( 0x03u == l_auPage[12u] ) && ( 0x03u == l_auPage[15u] ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 9  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 1u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 12u == l_uValorByte ) && ( 0x02u == l_auPage[0u] ) && ( 0x01u == l_auPage[4u] ) &&
+            ( 0x01u == l_auPage[8u] ) && ( 0x01u == l_auPage[11u] ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 10 -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 2u, l_auPage, sizeof(l_auPage), &l_uValorByte) ) &&
+        ( 15u == l_uValorByte ) && ( 0x02u == l_auPage[0u] ) && ( 0x02u == l_auPage[14u] ) )
+    {
+        if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 3u, l_auPage, sizeof(l_auPage),
+                                                          &l_uValorByte) ) &&
+            ( 15u == l_uValorByte ) && ( 0x03u == l_auPage[0u] ) && ( 0x03u == l_auPage[14u] ) )
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_AddLogsTest 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_AddLogsTest 11 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_LOGTST_SyncTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    uint8_t l_auLog[16u];
+    uint8_t l_auPage[20u];
+    uint8_t l_auPend[16u];
+    uint32_t l_uValorByte;
+    uint32_t l_uPendByte;
+    uint32_t l_uWriteUsed;
+    uint32_t l_uNewLogI;
+    uint32_t l_uOldLogI;
+    uint32_t l_uNpageUsed;
+    uint32_t l_uNpageTot;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+
+    /* Init storage settings, every log page can contain 16 byte of log */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uValorByte = 0u;
+    l_uPendByte = 0u;
+    l_uNewLogI = 0u;
+    l_uOldLogI = 0u;
+    l_uNpageUsed = 0u;
+    l_uNpageTot = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auLog, 0x5A, sizeof(l_auLog));
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_Sync(NULL) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_Sync(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_BADPARAM == eFSS_LOG_InitPendingBuff(&l_tCtx, l_auPend, sizeof(l_auPend), 17u, 4u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitPendingBuff(&l_tCtx, l_auPend, sizeof(l_auPend), 12u, 4u) ) )
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 2  -- FAIL \n");
+    }
+
+    /* The log stay in the pending buffer, nothing is written */
+    l_uWriteUsed = l_tCtxWrite.uTimeUsed;
+    l_auLog[0u] = 0x01u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 4u) )
+    {
+        if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetPendingByte(&l_tCtx, &l_uPendByte) ) && ( 4u == l_uPendByte ) &&
+            ( l_uWriteUsed == l_tCtxWrite.uTimeUsed ) )
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 3  -- FAIL \n");
+    }
+
+    /* Pending log are part of the newest page */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 4u == l_uValorByte ) && ( 0x01u == l_auPage[0u] ) && ( 0x5Au == l_auPage[3u] ) )
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 4  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 4  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 4  -- FAIL \n");
+    }
+
+    /* Sync store the pending log */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_Sync(&l_tCtx) )
+    {
+        if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetPendingByte(&l_tCtx, &l_uPendByte) ) && ( 0u == l_uPendByte ) &&
+            ( l_uWriteUsed < l_tCtxWrite.uTimeUsed ) )
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 5  -- FAIL \n");
+    }
+
+    /* Nothing more to store */
+    l_uWriteUsed = l_tCtxWrite.uTimeUsed;
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_Sync(&l_tCtx) ) && ( l_uWriteUsed == l_tCtxWrite.uTimeUsed ) )
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 6  -- FAIL \n");
+    }
+
+    /* Two more log stay pending */
+    l_auLog[0u] = 0x02u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 4u) )
+    {
+        l_auLog[0u] = 0x03u;
+        if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 4u) )
+        {
+            if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetPendingByte(&l_tCtx, &l_uPendByte) ) && ( 8u == l_uPendByte ) &&
+                ( l_uWriteUsed == l_tCtxWrite.uTimeUsed ) )
+            {
+                (void)printf("eFSS_LOGTST_SyncTest 7  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_LOGTST_SyncTest 7  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 7  -- FAIL \n");
+    }
 
+    /* This log does not fit in the newest page, the pending one are stored before it and the page is closed */
+    l_auLog[0u] = 0x04u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 4u) )
+    {
+        if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetPendingByte(&l_tCtx, &l_uPendByte) ) && ( 0u == l_uPendByte ) )
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 8  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 8  -- FAIL \n");
+    }
+
+    /* Reload everything from the storage using a new context */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 9  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed, &l_uNpageTot) )
+    {
+        if( ( 1u == l_uNewLogI ) && ( 0u == l_uOldLogI ) && ( 1u == l_uNpageUsed ) && ( 14u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 10 -- FAIL \n");
+    }
+
+    /* Log are stored in the passed order */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 16u == l_uValorByte ) && ( 0x01u == l_auPage[0u] ) && ( 0x02u == l_auPage[4u] ) &&
+            ( 0x03u == l_auPage[8u] ) && ( 0x04u == l_auPage[12u] ) && ( 0x5Au == l_auPage[15u] ) )
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 11 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_SyncTest 11 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_SyncTest 11 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_LOGTST_CacheNBkupTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    uint8_t l_auLog[16u];
+    uint8_t l_auPage[20u];
+    uint32_t l_uValorByte;
+    uint32_t l_uNewLogI;
+    uint32_t l_uOldLogI;
+    uint32_t l_uNpageUsed;
+    uint32_t l_uNpageTot;
+    uint32_t l_uCnt;
+    e_eFSS_LOG_RES l_eRes;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+
+    /* Init storage settings, with flash cache and full backup only 6 log page are usable */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uValorByte = 0u;
+    l_uNewLogI = 0u;
+    l_uOldLogI = 0u;
+    l_uNpageUsed = 0u;
+    l_uNpageTot = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auLog, 0x3C, sizeof(l_auLog));
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), true,
+                                                true) ) &&
+        ( e_eFSS_LOG_RES_NOTVALIDLOG == eFSS_LOG_GetLogStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) && ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed, &l_uNpageTot) )
+    {
+        if( ( 0u == l_uNewLogI ) && ( 0u == l_uOldLogI ) && ( 0u == l_uNpageUsed ) && ( 6u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 3  -- FAIL \n");
+    }
+
+    /* Every log need a whole page */
+    l_eRes = e_eFSS_LOG_RES_OK;
+    for( l_uCnt = 0u; ( l_uCnt < 6u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt++ )
+    {
+        l_auLog[0u] = (uint8_t)l_uCnt;
+        l_eRes = eFSS_LOG_AddLog(&l_tCtx, l_auLog, 15u);
+    }
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 4  -- FAIL \n");
+    }
+
+    /* The number of filled page does not count the newest, his backup and the page that will be overwritten */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed, &l_uNpageTot) )
+    {
+        if( ( 5u == l_uNewLogI ) && ( 2u == l_uOldLogI ) && ( 3u == l_uNpageUsed ) && ( 6u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 5  -- FAIL \n");
+    }
+
+    /* Reload everything from the storage using a new context */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), true,
+                                                true) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 6  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 5u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 15u == l_uValorByte ) && ( 0x05u == l_auPage[0u] ) && ( 0x3Cu == l_auPage[14u] ) )
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 7  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 7  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 7  -- FAIL \n");
+    }
+
+    /* The newest page wrap around */
+    l_auLog[0u] = 0x06u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 15u) )
+    {
+        if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed,
+                                                     &l_uNpageTot) )
+        {
+            if( ( 0u == l_uNewLogI ) && ( 3u == l_uOldLogI ) && ( 3u == l_uNpageUsed ) && ( 6u == l_uNpageTot ) )
+            {
+                (void)printf("eFSS_LOGTST_CacheNBkupTest 8  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_LOGTST_CacheNBkupTest 8  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 8  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 8  -- FAIL \n");
+    }
+
+    /* Reload everything from the storage using a new context */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), true,
+                                                true) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) ) )
+    {
+        if( ( 15u == l_uValorByte ) && ( 0x06u == l_auPage[0u] ) )
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 9  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 9  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 9  -- FAIL \n");
+    }
+
+    /* Format again, the newest page is moved at index zero */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 15u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed,
+                                                   &l_uNpageTot) ) )
+    {
+        if( ( 0u == l_uNewLogI ) && ( 0u == l_uOldLogI ) && ( 0u == l_uNpageUsed ) && ( 6u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 10 -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_CacheNBkupTest 10 -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_CacheNBkupTest 10 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_LOGTST_RecoveryTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    uint8_t l_auLog[16u];
+    uint8_t l_auPage[20u];
+    uint8_t l_auOldPage[48u];
+    uint32_t l_uValorByte;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+
+    /* Init storage settings, every log page can contain 16 byte of log */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uValorByte = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auLog, 0x77, sizeof(l_auLog));
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 5u) ) )
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 1  -- FAIL \n");
+    }
+
+    /* Corrupted newest page, restored from the backup */
+    m_auStorArea[0u][2u] ^= 0xFFu;
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK_BKP_RCVRD == eFSS_LOG_GetLogStatus(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage), &l_uValorByte) )
+    {
+        if( ( 5u == l_uValorByte ) && ( 0x77u == l_auPage[2u] ) )
+        {
+            (void)printf("eFSS_LOGTST_RecoveryTest 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_RecoveryTest 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 3  -- FAIL \n");
+    }
+
+    /* Corrupted backup page, restored from the newest one */
+    m_auStorArea[1u][2u] ^= 0xFFu;
+    if( ( e_eFSS_LOG_RES_OK_BKP_RCVRD == eFSS_LOG_GetLogStatus(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) && ( 0x77u == m_auStorArea[1u][2u] ) )
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 4  -- FAIL \n");
+    }
+
+    /* Power loss after the newest page is flushed but before the backup one is: the newest page is kept */
+    (void)memcpy(l_auOldPage, m_auStorArea[1u], sizeof(l_auOldPage));
+    l_auLog[0u] = 0x01u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 5u) )
+    {
+        (void)memcpy(m_auStorArea[1u], l_auOldPage, sizeof(l_auOldPage));
+        if( ( e_eFSS_LOG_RES_OK_BKP_RCVRD == eFSS_LOG_GetLogStatus(&l_tCtx) ) &&
+            ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage),
+                                                          &l_uValorByte) ) )
+        {
+            if( ( 10u == l_uValorByte ) && ( 0x01u == l_auPage[5u] ) && ( 0 == memcmp(m_auStorArea[0u],
+                                                                                      m_auStorArea[1u], 20u) ) )
+            {
+                (void)printf("eFSS_LOGTST_RecoveryTest 5  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_LOGTST_RecoveryTest 5  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_RecoveryTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 5  -- FAIL \n");
+    }
+
+    /* Power loss while the newest page is flushed: the backup page is restored */
+    (void)memcpy(l_auOldPage, m_auStorArea[1u], sizeof(l_auOldPage));
+    l_auLog[0u] = 0x02u;
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 5u) )
+    {
+        (void)memcpy(m_auStorArea[1u], l_auOldPage, sizeof(l_auOldPage));
+        m_auStorArea[0u][12u] ^= 0xFFu;
+        if( ( e_eFSS_LOG_RES_OK_BKP_RCVRD == eFSS_LOG_GetLogStatus(&l_tCtx) ) &&
+            ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogOfAPage(&l_tCtx, 0u, l_auPage, sizeof(l_auPage),
+                                                          &l_uValorByte) ) )
+        {
+            if( ( 10u == l_uValorByte ) && ( 0x01u == l_auPage[5u] ) )
+            {
+                (void)printf("eFSS_LOGTST_RecoveryTest 6  -- OK \n");
+            }
+            else
+            {
+                (void)printf("eFSS_LOGTST_RecoveryTest 6  -- FAIL \n");
+            }
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_RecoveryTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 6  -- FAIL \n");
+    }
+
+    /* Both pages corrupted */
+    m_auStorArea[0u][2u] ^= 0xFFu;
+    m_auStorArea[1u][2u] ^= 0xFFu;
+    if( ( e_eFSS_LOG_RES_NOTVALIDLOG == eFSS_LOG_GetLogStatus(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_NOTVALIDLOG == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 5u) ) )
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 7  -- FAIL \n");
+    }
+
+    /* A not valid log can be formatted */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) && ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_RecoveryTest 8  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_LOGTST_GuessNewestTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    uint8_t l_auLog[16u];
+    uint32_t l_uNewLogI;
+    uint32_t l_uOldLogI;
+    uint32_t l_uNpageUsed;
+    uint32_t l_uNpageTot;
+    uint32_t l_uCnt;
+    e_eFSS_LOG_RES l_eRes;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+
+    /* Init storage settings, every log page can contain 16 byte of log */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uNewLogI = 0u;
+    l_uOldLogI = 0u;
+    l_uNpageUsed = 0u;
+    l_uNpageTot = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auLog, 0x11, sizeof(l_auLog));
+
+    /* Move the newest page at index nine */
+    l_eRes = eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false, false);
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_LOG_Format(&l_tCtx);
+    }
+
+    for( l_uCnt = 0u; ( l_uCnt < 10u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt++ )
+    {
+        l_eRes = eFSS_LOG_AddLog(&l_tCtx, l_auLog, 15u);
+    }
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 1  -- FAIL \n");
+    }
+
+    /* Reload using a new context, the sequence number guess need less read than a search starting from zero */
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    l_tCtxRead.uTimeUsed = 0u;
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) && ( l_tCtxRead.uTimeUsed <= 8u ) )
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 2  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed, &l_uNpageTot) )
+    {
+        if( ( 9u == l_uNewLogI ) && ( 0u == l_uOldLogI ) && ( 9u == l_uNpageUsed ) && ( 14u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_GuessNewestTest 3  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_GuessNewestTest 3  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 3  -- FAIL \n");
+    }
+
+    /* Wrap around, page after the newest backup are older than the first one */
+    l_eRes = e_eFSS_LOG_RES_OK;
+    for( l_uCnt = 0u; ( l_uCnt < 6u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt++ )
+    {
+        l_eRes = eFSS_LOG_AddLog(&l_tCtx, l_auLog, 15u);
+    }
+
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    l_tCtxRead.uTimeUsed = 0u;
+    if( ( e_eFSS_LOG_RES_OK == l_eRes ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) && ( l_tCtxRead.uTimeUsed <= 8u ) )
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 4  -- FAIL \n");
+    }
+
+    /* Function */
+    if( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed, &l_uNpageTot) )
+    {
+        if( ( 1u == l_uNewLogI ) && ( 4u == l_uOldLogI ) && ( 11u == l_uNpageUsed ) && ( 14u == l_uNpageTot ) )
+        {
+            (void)printf("eFSS_LOGTST_GuessNewestTest 5  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_GuessNewestTest 5  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 5  -- FAIL \n");
+    }
+
+    /* Corrupted first page, no guess can be done but the newest page is found anyway */
+    m_auStorArea[0u][0u] ^= 0xFFu;
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed,
+                                                   &l_uNpageTot) ) )
+    {
+        if( 1u == l_uNewLogI )
+        {
+            (void)printf("eFSS_LOGTST_GuessNewestTest 6  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSS_LOGTST_GuessNewestTest 6  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_GuessNewestTest 6  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_LOGTST_IteratorTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    t_eFSS_LOG_Iter l_tIter;
+    uint8_t l_auLog[1u];
+    uint8_t l_auPage[40u];
+    uint8_t l_auPend[16u];
+    uint8_t* l_puLog;
+    uint32_t l_uLogL;
+    uint32_t l_uCnt;
+    bool_t l_bIsOk;
+    e_eFSS_LOG_RES l_eRes;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+
+    /* Init storage settings, every log page can contain 16 byte of log, so two framed log of one byte with CRC */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_puLog = NULL;
+    l_uLogL = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(&l_tIter, 0, sizeof(l_tIter));
+
+    /* Not framed log cannot be iterated */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_BADPARAM == eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, l_auPage, sizeof(l_auPage), false) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 1  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_InitFramedLog(NULL, true) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitFramedLog(&l_tCtx, true) ) &&
+        ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_IterOpen(NULL, &l_tIter, l_auPage, sizeof(l_auPage), false) ) &&
+        ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_IterOpen(&l_tCtx, NULL, l_auPage, sizeof(l_auPage), false) ) &&
+        ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, NULL, sizeof(l_auPage), false) ) &&
+        ( e_eFSS_LOG_RES_BADPARAM == eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, l_auPage, 19u, false) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 2  -- FAIL \n");
+    }
+
+    /* Empty storage area */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, l_auPage, sizeof(l_auPage), false) ) &&
+        ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 3  -- FAIL \n");
+    }
+
+    /* Seven log of one byte, from page zero to page three */
+    l_eRes = e_eFSS_LOG_RES_OK;
+    for( l_uCnt = 0u; ( l_uCnt < 7u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt++ )
+    {
+        l_auLog[0u] = (uint8_t)( 0x10u + l_uCnt );
+        l_eRes = eFSS_LOG_AddLog(&l_tCtx, l_auLog, 1u);
+    }
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 4  -- FAIL \n");
+    }
+
+    /* Walk from the oldest log to the newest one */
+    l_eRes = eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, l_auPage, sizeof(l_auPage), false);
+    l_bIsOk = true;
+    for( l_uCnt = 0u; ( l_uCnt < 7u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt++ )
+    {
+        l_eRes = eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL);
+        if( ( e_eFSS_LOG_RES_OK != l_eRes ) || ( 1u != l_uLogL ) || ( ( 0x10u + l_uCnt ) != l_puLog[0u] ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+
+    if( ( true == l_bIsOk ) && ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog,
+                                                                               &l_uLogL) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 5  -- FAIL \n");
+    }
+
+    /* Walk back to the oldest log */
+    l_eRes = e_eFSS_LOG_RES_OK;
+    l_bIsOk = true;
+    for( l_uCnt = 7u; ( l_uCnt > 0u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt-- )
+    {
+        l_eRes = eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL);
+        if( ( e_eFSS_LOG_RES_OK != l_eRes ) || ( 1u != l_uLogL ) || ( ( 0x0Fu + l_uCnt ) != l_puLog[0u] ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+
+    if( ( true == l_bIsOk ) && ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog,
+                                                                               &l_uLogL) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 6  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 6  -- FAIL \n");
+    }
+
+    /* Open after the newest log */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, l_auPage, sizeof(l_auPage), true) ) &&
+        ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( 0x16u == l_puLog[0u] ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( 0x15u == l_puLog[0u] ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 7  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 7  -- FAIL \n");
+    }
+
+    /* Seek a log of a different page */
+    if( ( e_eFSS_LOG_RES_BADPOINTER == eFSS_LOG_IterSeek(NULL, &l_tIter, 4u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterSeek(&l_tCtx, &l_tIter, 4u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( 0x14u == l_puLog[0u] ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterSeek(&l_tCtx, &l_tIter, 3u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( 0x12u == l_puLog[0u] ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 8  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 8  -- FAIL \n");
+    }
+
+    /* Function */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterSeek(&l_tCtx, &l_tIter, 7u) ) &&
+        ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterSeek(&l_tCtx, &l_tIter, 8u) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 9  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 9  -- FAIL \n");
+    }
+
+    /* The first log close the newest page, the second one is pending. Pending log are part of the newest page, and
+     * the format cannot be changed while they are pending */
+    l_auLog[0u] = 0x17u;
+    l_eRes = eFSS_LOG_InitPendingBuff(&l_tCtx, l_auPend, sizeof(l_auPend), 12u, 4u);
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_LOG_AddLog(&l_tCtx, l_auLog, 1u);
+    }
+
+    l_auLog[0u] = 0x18u;
+    if( ( e_eFSS_LOG_RES_OK == l_eRes ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, 1u) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetPendingByte(&l_tCtx, &l_uLogL) ) && ( 9u == l_uLogL ) &&
+        ( e_eFSS_LOG_RES_BADPARAM == eFSS_LOG_InitFramedLog(&l_tCtx, true) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, l_auPage, sizeof(l_auPage), true) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( 1u == l_uLogL ) && ( 0x18u == l_puLog[0u] ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( 0x17u == l_puLog[0u] ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 10 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 10 -- FAIL \n");
+    }
+
+    /* Wrap around, only the last twentythree log are still stored */
+    l_eRes = eFSS_LOG_Sync(&l_tCtx);
+    for( l_uCnt = 9u; ( l_uCnt < 31u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt++ )
+    {
+        l_auLog[0u] = (uint8_t)( 0x10u + l_uCnt );
+        l_eRes = eFSS_LOG_AddLog(&l_tCtx, l_auLog, 1u);
+    }
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_LOG_Sync(&l_tCtx);
+    }
+
+    if( e_eFSS_LOG_RES_OK == l_eRes )
+    {
+        l_eRes = eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, l_auPage, sizeof(l_auPage), false);
+    }
+
+    l_bIsOk = true;
+    for( l_uCnt = 8u; ( l_uCnt < 31u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt++ )
+    {
+        l_eRes = eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL);
+        if( ( e_eFSS_LOG_RES_OK != l_eRes ) || ( 1u != l_uLogL ) || ( ( 0x10u + l_uCnt ) != l_puLog[0u] ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+
+    if( ( true == l_bIsOk ) && ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog,
+                                                                               &l_uLogL) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 11 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 11 -- FAIL \n");
+    }
+
+    /* Walk back across the wrap */
+    l_eRes = e_eFSS_LOG_RES_OK;
+    l_bIsOk = true;
+    for( l_uCnt = 31u; ( l_uCnt > 8u ) && ( e_eFSS_LOG_RES_OK == l_eRes ); l_uCnt-- )
+    {
+        l_eRes = eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL);
+        if( ( e_eFSS_LOG_RES_OK != l_eRes ) || ( ( 0x0Fu + l_uCnt ) != l_puLog[0u] ) )
+        {
+            l_bIsOk = false;
+        }
+    }
+
+    if( ( true == l_bIsOk ) && ( e_eFSS_LOG_RES_NOMORELOG == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog,
+                                                                               &l_uLogL) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 12 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 12 -- FAIL \n");
+    }
+
+    /* Corrupt the CRC of the oldest log keeping the page valid: the CRC of the test is the sum of the byte, so add one
+     * to the log and remove one from the low byte of his CRC */
+    m_auStorArea[l_tIter.uOldPageIdx][EFSS_LOGTST_RECHEADL] =
+        (uint8_t)( m_auStorArea[l_tIter.uOldPageIdx][EFSS_LOGTST_RECHEADL] + 1u );
+    m_auStorArea[l_tIter.uOldPageIdx][EFSS_LOGTST_RECHEADL + 1u] =
+        (uint8_t)( m_auStorArea[l_tIter.uOldPageIdx][EFSS_LOGTST_RECHEADL + 1u] - 1u );
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterOpen(&l_tCtx, &l_tIter, l_auPage, sizeof(l_auPage), false) ) &&
+        ( e_eFSS_LOG_RES_NOTVALIDLOG == eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 13 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 13 -- FAIL \n");
+    }
+
+    /* Seek does not verify CRC, so the corrupted log can be skipped */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterSeek(&l_tCtx, &l_tIter, 1u) ) &&
+        ( e_eFSS_LOG_RES_NOTVALIDLOG == eFSS_LOG_IterPrev(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_IterNext(&l_tCtx, &l_tIter, &l_puLog, &l_uLogL) ) &&
+        ( 0x19u == l_puLog[0u] ) )
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 14 -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_IteratorTest 14 -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_LOGTST_FormatLatTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    t_eFSS_TYPE_Stats l_tStats;
+    uint8_t l_auStor[96u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+	t_eFSS_TYPE_TimeCtx   l_tCtxTime;
+    e_eFSS_LOG_RES l_eRes;
+    uint32_t l_uNStep;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = &l_tCtxTime;
+    l_tCtxCb.fTime = &eFSS_LOGTST_TimeTst1Adapt;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxTime.uTime = 0u;
+
+    /* Init storage settings, every log page can contain 16 byte of log */
+    l_tStorSet.uTotPages = 14u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0xFFu;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 1u;
+    l_uNStep = 0u;
+
+    (void)memset(m_auStorArea, 0, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+
+    /* The blocking format is recorded as a single measure */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( 1u == eFSS_LOGTST_HistTot(&l_tStats.tLatFormat) ) && ( 0u == eFSS_LOGTST_HistTot(&l_tStats.tLatStatus) ) &&
+        ( 0u == eFSS_LOGTST_HistTot(&l_tStats.tLatAdd) ) )
+    {
+        (void)printf("eFSS_LOGTST_FormatLatTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_FormatLatTest 1  -- FAIL \n");
+    }
+
+    /* Every step is recorded as a single measure in the same histogram */
+    l_eRes = e_eFSS_LOG_RES_INPROGRESS;
+    while( ( e_eFSS_LOG_RES_INPROGRESS == l_eRes ) && ( l_uNStep < 100u ) )
+    {
+        l_eRes = eFSS_LOG_FormatStep(&l_tCtx);
+        l_uNStep++;
+    }
+
+    if( ( e_eFSS_LOG_RES_OK == l_eRes ) && ( l_uNStep >= 1u ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( ( 1u + l_uNStep ) == eFSS_LOGTST_HistTot(&l_tStats.tLatFormat) ) &&
+        ( 0u == eFSS_LOGTST_HistTot(&l_tStats.tLatStatus) ) )
+    {
+        (void)printf("eFSS_LOGTST_FormatLatTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_FormatLatTest 2  -- FAIL \n");
+    }
+
+    /* Reset clear the format histogram too */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_ResetStats(&l_tCtx) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetStats(&l_tCtx, &l_tStats) ) &&
+        ( 0u == eFSS_LOGTST_HistTot(&l_tStats.tLatFormat) ) )
+    {
+        (void)printf("eFSS_LOGTST_FormatLatTest 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_FormatLatTest 3  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxErase.uTimeUsed;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
+
+static void eFSS_LOGTST_BlockFormatTest(void)
+{
+    /* Local variable */
+    t_eFSS_LOG_Ctx l_tCtx;
+    t_eFSS_TYPE_CbStorCtx l_tCtxCb;
+    t_eFSS_TYPE_StorSet l_tStorSet;
+    uint8_t l_auStor[96u];
+    uint8_t l_auLog[8u];
+    t_eFSS_TYPE_EraseCtx  l_tCtxErase;
+	t_eFSS_TYPE_WriteCtx  l_tCtxWrite;
+	t_eFSS_TYPE_ReadCtx   l_tCtxRead;
+	t_eFSS_TYPE_CrcCtx    l_tCtxCrc32;
+    uint32_t l_uNewLogI;
+    uint32_t l_uOldLogI;
+    uint32_t l_uNpageUsed;
+    uint32_t l_uNpageTot;
+    uint32_t l_uNLog;
+
+    /* Init callback var */
+    l_tCtxCb.ptCtxErase = &l_tCtxErase;
+    l_tCtxCb.fErase = &eFSS_LOGTST_EraseBlkTst1Adapt;
+	l_tCtxCb.ptCtxWrite = &l_tCtxWrite;
+    l_tCtxCb.fWrite = &eFSS_LOGTST_WriteTst1Adapt;
+	l_tCtxCb.ptCtxRead = &l_tCtxRead;
+    l_tCtxCb.fRead = &eFSS_LOGTST_ReadTst1Adapt;
+	l_tCtxCb.ptCtxCrc32 = &l_tCtxCrc32;
+    l_tCtxCb.fCrc32 = &eFSS_LOGTST_CrcTst1Adapt;
+	l_tCtxCb.ptCtxIsErased = NULL;
+    l_tCtxCb.fIsErased = NULL;
+	l_tCtxCb.ptCtxReadRange = NULL;
+    l_tCtxCb.fReadRange = NULL;
+	l_tCtxCb.ptCtxWriteRange = NULL;
+    l_tCtxCb.fWriteRange = NULL;
+	l_tCtxCb.ptCtxTime = NULL;
+    l_tCtxCb.fTime = NULL;
+
+    l_tCtxErase.uTimeUsed = 0u;
+    l_tCtxErase.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxWrite.uTimeUsed = 0u;
+    l_tCtxWrite.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxRead.uTimeUsed = 0u;
+    l_tCtxRead.eLastEr = e_eFSS_LOG_RES_OK;
+    l_tCtxCrc32.uTimeUsed = 0u;
+    l_tCtxCrc32.eLastEr = e_eFSS_LOG_RES_OK;
+
+    /* Init storage settings, two pages for every erase block and the spare block in the last two pages */
+    l_tStorSet.uTotPages = 12u;
+    l_tStorSet.uPagesLen = 48u;
+    l_tStorSet.uRWERetry = 3u;
+    l_tStorSet.uPageVersion = 1u;
+    l_tStorSet.bBlankCheck = false;
+    l_tStorSet.uErasedVal = 0x00u;
+    l_tStorSet.eTrailer = e_eFSS_TYPE_TRAIL_FULL;
+    l_tStorSet.uPagesPerBlk = 2u;
+    l_uNewLogI = 0u;
+    l_uOldLogI = 0u;
+    l_uNpageUsed = 0u;
+    l_uNpageTot = 0u;
+    l_uNLog = 0u;
+
+    /* Nothing stored is blank */
+    (void)memset(m_auStorArea, 0xAA, sizeof(m_auStorArea));
+    (void)memset(m_bIsErased, 0, sizeof(m_bIsErased));
+    (void)memset(&l_tCtx, 0, sizeof(l_tCtx));
+    (void)memset(l_auLog, 0x5A, sizeof(l_auLog));
+
+    /* The format erase the first block once and program the newest page and its backup in it, instead of
+       rewriting the block through the spare block for each of them */
+    if( ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_Format(&l_tCtx) ) &&
+        ( 1u == l_tCtxErase.uTimeUsed ) && ( false == m_bIsErased[0u] ) && ( false == m_bIsErased[1u] ) &&
+        ( false == m_bIsErased[12u] ) && ( 0xAAu == m_auStorArea[2u][0u] ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogStatus(&l_tCtx) ) )
+    {
+        (void)printf("eFSS_LOGTST_BlockFormatTest 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_BlockFormatTest 1  -- FAIL \n");
+    }
+
+    /* The log keep working on the rest of the area */
+    while( ( l_uNLog < 10u ) && ( 0u == l_uNewLogI ) &&
+           ( e_eFSS_LOG_RES_OK == eFSS_LOG_AddLog(&l_tCtx, l_auLog, sizeof(l_auLog)) ) &&
+           ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed,
+                                                      &l_uNpageTot) ) )
+    {
+        l_uNLog++;
+    }
+
+    if( ( 1u == l_uNewLogI ) && ( 0u == l_uOldLogI ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_InitCtx(&l_tCtx, l_tCtxCb, l_tStorSet, l_auStor, sizeof(l_auStor), false,
+                                                false) ) &&
+        ( e_eFSS_LOG_RES_OK == eFSS_LOG_GetLogInfo(&l_tCtx, &l_uNewLogI, &l_uOldLogI, &l_uNpageUsed,
+                                                   &l_uNpageTot) ) &&
+        ( 1u == l_uNewLogI ) && ( 0u == l_uOldLogI ) )
+    {
+        (void)printf("eFSS_LOGTST_BlockFormatTest 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSS_LOGTST_BlockFormatTest 2  -- FAIL \n");
+    }
+
+    /* Misra complaiant */
+    (void)l_tCtxErase.eLastEr;
+    (void)l_tCtxWrite.eLastEr;
+    (void)l_tCtxWrite.uTimeUsed;
+    (void)l_tCtxRead.eLastEr;
+    (void)l_tCtxRead.uTimeUsed;
+    (void)l_tCtxCrc32.eLastEr;
+    (void)l_tCtxCrc32.uTimeUsed;
+}
 
+#ifdef __IAR_SYSTEMS_ICC__
+    #pragma cstat_restore = "MISRAC2012-Rule-8.13", "MISRAC2012-Rule-10.5"
+#endif
@@ -37,6 +37,15 @@ extern "C" {
  */
 void eFSS_UtilsTST_ExeTest(void);
 
+/**
+ * @brief       Measure the throughput of every CRC32 engine of the Utils module, and of a bitwise loop
+ *
+ * @param[in]   none
+ *
+ * @return      none
+ */
+void eFSS_UtilsTST_ExeCrc32Bench(void);
+
 
 
 #ifdef __cplusplus
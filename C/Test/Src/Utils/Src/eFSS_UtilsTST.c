@@ -13,6 +13,25 @@
 #include "eFSS_UtilsTST.h"
 #include "eFSS_Utils.h"
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+
+
+/***********************************************************************************************************************
+ *      PRIVATE DEFINE
+ **********************************************************************************************************************/
+#define EFSS_UTILSTST_BENCHLOOP                                                                ( ( uint32_t )  20000u )
+
+
+
+/***********************************************************************************************************************
+ *   PRIVATE TEST STRUCT DECLARATION
+ **********************************************************************************************************************/
+struct t_eFSS_TYPE_TimeCtxUser
+{
+    uint32_t uTime;
+};
 
 
 
@@ -23,6 +42,11 @@ static void eFSP_UtilsTST_BadPointer(void);
 static void eFSP_UtilsTST_Insert(void);
 static void eFSP_UtilsTST_Retrive(void);
 static void eFSP_UtilsTST_InsRetr(void);
+static void eFSP_UtilsTST_Crc32(void);
+static void eFSP_UtilsTST_Latency(void);
+static void eFSP_UtilsTST_Budget(void);
+static bool_t eFSS_UtilsTST_TimeAdapt(t_eFSS_TYPE_TimeCtx* const p_ptCtx, uint32_t* const p_puTime);
+static double eFSS_UtilsTST_MBs(const clock_t p_tStart, const uint32_t p_uLoop, const uint32_t p_uLen);
 
 
 
@@ -37,10 +61,82 @@ void eFSS_UtilsTST_ExeTest(void)
     eFSP_UtilsTST_Insert();
     eFSP_UtilsTST_Retrive();
     eFSP_UtilsTST_InsRetr();
+    eFSP_UtilsTST_Crc32();
+    eFSP_UtilsTST_Latency();
+    eFSP_UtilsTST_Budget();
 
     (void)printf("\n\nUTIL TEST END \n\n");
 }
 
+void eFSS_UtilsTST_ExeCrc32Bench(void)
+{
+    /* Local variable */
+    static uint8_t l_auMemArea[4096u];
+    uint32_t l_uCrc;
+    uint32_t l_uIndx;
+    uint32_t l_uBit;
+    clock_t  l_tStart;
+    double   l_dMBs;
+
+    (void)printf("\n\nUTILS CRC32 BENCHMARK START \n\n");
+
+    for( l_uIndx = 0u; l_uIndx < sizeof(l_auMemArea); l_uIndx++ )
+    {
+        l_auMemArea[l_uIndx] = (uint8_t)( ( l_uIndx * 73u ) + 11u );
+    }
+
+    /* Bitwise loop, like the one usually plugged in the callback */
+    l_uCrc = MAX_UINT32VAL;
+    l_tStart = clock();
+    for( l_uIndx = 0u; l_uIndx < ( EFSS_UTILSTST_BENCHLOOP / 8u ); l_uIndx++ )
+    {
+        for( l_uBit = 0u; l_uBit < ( sizeof(l_auMemArea) * 8u ); l_uBit++ )
+        {
+            if( 0u == ( l_uBit & 0x07u ) )
+            {
+                l_uCrc ^= l_auMemArea[l_uBit >> 3u];
+            }
+            l_uCrc = ( l_uCrc >> 1u ) ^ ( 0xEDB88320u & ( 0u - ( l_uCrc & 1u ) ) );
+        }
+    }
+    l_dMBs = eFSS_UtilsTST_MBs(l_tStart, ( EFSS_UTILSTST_BENCHLOOP / 8u ), sizeof(l_auMemArea) );
+    (void)printf("CRC32 bitwise  : %10.1f MB/s ( 0x%08X )\n", l_dMBs, (unsigned)l_uCrc);
+
+    /* Table */
+    l_uCrc = MAX_UINT32VAL;
+    l_tStart = clock();
+    for( l_uIndx = 0u; l_uIndx < EFSS_UTILSTST_BENCHLOOP; l_uIndx++ )
+    {
+        (void)eFSS_Utils_Crc32Table(l_uCrc, l_auMemArea, sizeof(l_auMemArea), &l_uCrc);
+    }
+    l_dMBs = eFSS_UtilsTST_MBs(l_tStart, EFSS_UTILSTST_BENCHLOOP, sizeof(l_auMemArea) );
+    (void)printf("CRC32 table    : %10.1f MB/s ( 0x%08X )\n", l_dMBs, (unsigned)l_uCrc);
+
+    /* Slicing-by-8 */
+    l_uCrc = MAX_UINT32VAL;
+    l_tStart = clock();
+    for( l_uIndx = 0u; l_uIndx < EFSS_UTILSTST_BENCHLOOP; l_uIndx++ )
+    {
+        (void)eFSS_Utils_Crc32Slice8(l_uCrc, l_auMemArea, sizeof(l_auMemArea), &l_uCrc);
+    }
+    l_dMBs = eFSS_UtilsTST_MBs(l_tStart, EFSS_UTILSTST_BENCHLOOP, sizeof(l_auMemArea) );
+    (void)printf("CRC32 slice8   : %10.1f MB/s ( 0x%08X )\n", l_dMBs, (unsigned)l_uCrc);
+
+    #ifdef EFSS_UTILS_CRC32_HASCLMUL
+    /* Carry-less multiplication */
+    l_uCrc = MAX_UINT32VAL;
+    l_tStart = clock();
+    for( l_uIndx = 0u; l_uIndx < EFSS_UTILSTST_BENCHLOOP; l_uIndx++ )
+    {
+        (void)eFSS_Utils_Crc32Clmul(l_uCrc, l_auMemArea, sizeof(l_auMemArea), &l_uCrc);
+    }
+    l_dMBs = eFSS_UtilsTST_MBs(l_tStart, EFSS_UTILSTST_BENCHLOOP, sizeof(l_auMemArea) );
+    (void)printf("CRC32 clmul    : %10.1f MB/s ( 0x%08X )\n", l_dMBs, (unsigned)l_uCrc);
+    #endif
+
+    (void)printf("\n\nUTILS CRC32 BENCHMARK END \n\n");
+}
+
 
 
 /***********************************************************************************************************************
@@ -375,3 +471,252 @@ static void eFSP_UtilsTST_InsRetr(void)
         (void)printf("eFSP_UtilsTST_InsRetr 3  -- FAIL \n");
     }
 }
+
+static void eFSP_UtilsTST_Crc32(void)
+{
+    /* Local variable */
+    uint8_t  l_auMemArea[300u];
+    uint8_t  l_auCheck[9u] = { 0x31u, 0x32u, 0x33u, 0x34u, 0x35u, 0x36u, 0x37u, 0x38u, 0x39u };
+    uint32_t l_uCrcTab;
+    uint32_t l_uCrcSlice;
+    uint32_t l_uCrcClmul;
+    uint32_t l_uCrcChain;
+    uint32_t l_uOff;
+    uint32_t l_uLen;
+    bool_t   l_bAllOk;
+
+    /* Init var */
+    for( l_uLen = 0u; l_uLen < sizeof(l_auMemArea); l_uLen++ )
+    {
+        l_auMemArea[l_uLen] = (uint8_t)( ( l_uLen * 73u ) + 11u );
+    }
+
+    /* Function */
+    if( ( false == eFSS_Utils_Crc32Table(MAX_UINT32VAL, NULL, 1u, &l_uCrcTab) ) &&
+        ( false == eFSS_Utils_Crc32Table(MAX_UINT32VAL, l_auCheck, 1u, NULL) ) &&
+        ( false == eFSS_Utils_Crc32Slice8(MAX_UINT32VAL, NULL, 1u, &l_uCrcTab) ) &&
+        ( false == eFSS_Utils_Crc32Slice8(MAX_UINT32VAL, l_auCheck, 1u, NULL) ) &&
+        ( false == eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, NULL, 1u, &l_uCrcTab) ) )
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 1  -- FAIL \n");
+    }
+
+    /* Standard check value 0xCBF43926, without the final xor */
+    l_uCrcTab = 0u;
+    l_uCrcSlice = 0u;
+    if( ( true == eFSS_Utils_Crc32Table(MAX_UINT32VAL, l_auCheck, sizeof(l_auCheck), &l_uCrcTab) ) &&
+        ( true == eFSS_Utils_Crc32Slice8(MAX_UINT32VAL, l_auCheck, sizeof(l_auCheck), &l_uCrcSlice) ) &&
+        ( 0x340BC6D9u == l_uCrcTab ) && ( 0x340BC6D9u == l_uCrcSlice ) )
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 2  -- FAIL \n");
+    }
+
+    /* Every engine must give the same result with any length and alignment */
+    l_bAllOk = true;
+    for( l_uOff = 0u; l_uOff < 8u; l_uOff++ )
+    {
+        for( l_uLen = 0u; l_uLen <= ( sizeof(l_auMemArea) - 8u ); l_uLen++ )
+        {
+            (void)eFSS_Utils_Crc32Table(MAX_UINT32VAL, &l_auMemArea[l_uOff], l_uLen, &l_uCrcTab);
+            (void)eFSS_Utils_Crc32Slice8(MAX_UINT32VAL, &l_auMemArea[l_uOff], l_uLen, &l_uCrcSlice);
+            l_uCrcClmul = l_uCrcTab;
+            #ifdef EFSS_UTILS_CRC32_HASCLMUL
+            (void)eFSS_Utils_Crc32Clmul(MAX_UINT32VAL, &l_auMemArea[l_uOff], l_uLen, &l_uCrcClmul);
+            #endif
+
+            if( ( l_uCrcTab != l_uCrcSlice ) || ( l_uCrcTab != l_uCrcClmul ) )
+            {
+                l_bAllOk = false;
+            }
+        }
+    }
+
+    if( true == l_bAllOk )
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 3  -- FAIL \n");
+    }
+
+    /* The result can be used as seed to continue the calculation */
+    (void)eFSS_Utils_Crc32Table(MAX_UINT32VAL, l_auMemArea, sizeof(l_auMemArea), &l_uCrcTab);
+    (void)eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, l_auMemArea, 101u, &l_uCrcChain);
+    if( ( true == eFSS_Utils_Crc32Cb(NULL, l_uCrcChain, &l_auMemArea[101u], ( sizeof(l_auMemArea) - 101u ),
+                                     &l_uCrcChain) ) &&
+        ( l_uCrcTab == l_uCrcChain ) )
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 4  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 4  -- FAIL \n");
+    }
+
+    /* Two separated CRC can be combined, the second one must be calculated with a zero seed */
+    l_bAllOk = ( false == eFSS_Utils_Crc32Combine(0u, 0u, 1u, NULL) );
+    for( l_uOff = 0u; l_uOff <= sizeof(l_auMemArea); l_uOff += 13u )
+    {
+        (void)eFSS_Utils_Crc32Cb(NULL, MAX_UINT32VAL, l_auMemArea, l_uOff, &l_uCrcChain);
+        (void)eFSS_Utils_Crc32Cb(NULL, 0u, &l_auMemArea[l_uOff], ( sizeof(l_auMemArea) - l_uOff ), &l_uCrcSlice);
+        if( ( false == eFSS_Utils_Crc32Combine(l_uCrcChain, l_uCrcSlice, ( sizeof(l_auMemArea) - l_uOff ),
+                                               &l_uCrcChain) ) ||
+            ( l_uCrcTab != l_uCrcChain ) )
+        {
+            l_bAllOk = false;
+        }
+    }
+
+    if( true == l_bAllOk )
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 5  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Crc32 5  -- FAIL \n");
+    }
+}
+
+static void eFSP_UtilsTST_Latency(void)
+{
+    /* Local variable */
+    t_eFSS_TYPE_LatHist l_tHist;
+    t_eFSS_TYPE_TimeCtx l_tTime;
+    uint32_t l_uStart;
+
+    /* Init */
+    (void)memset(&l_tHist, 0, sizeof(l_tHist));
+    l_tTime.uTime = 0u;
+
+    /* Function */
+    if( ( false == eFSS_Utils_GetTime(NULL, NULL, &l_uStart) ) &&
+        ( false == eFSS_Utils_GetTime(&l_tTime, eFSS_UtilsTST_TimeAdapt, NULL) ) &&
+        ( false == eFSS_Utils_AddLatency(&l_tTime, NULL, 0u, &l_tHist) ) &&
+        ( false == eFSS_Utils_AddLatency(&l_tTime, eFSS_UtilsTST_TimeAdapt, 0u, NULL) ) )
+    {
+        (void)printf("eFSP_UtilsTST_Latency 1  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Latency 1  -- FAIL \n");
+    }
+
+    /* Every read of the time advance it by 5, so a latency of 5 is in the bucket of its bit length */
+    l_tTime.uTime = 0u;
+    if( ( true == eFSS_Utils_GetTime(&l_tTime, eFSS_UtilsTST_TimeAdapt, &l_uStart) ) &&
+        ( true == eFSS_Utils_AddLatency(&l_tTime, eFSS_UtilsTST_TimeAdapt, l_uStart, &l_tHist) ) &&
+        ( 1u == l_tHist.auBucket[3u] ) && ( 0u == l_tHist.auBucket[2u] ) )
+    {
+        (void)printf("eFSP_UtilsTST_Latency 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Latency 2  -- FAIL \n");
+    }
+
+    /* A wrap around of the timestamp is handled, 15 - MAX_UINT32VAL is a latency of 16 */
+    if( ( true == eFSS_Utils_AddLatency(&l_tTime, eFSS_UtilsTST_TimeAdapt, MAX_UINT32VAL, &l_tHist) ) &&
+        ( 1u == l_tHist.auBucket[5u] ) )
+    {
+        (void)printf("eFSP_UtilsTST_Latency 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Latency 3  -- FAIL \n");
+    }
+}
+
+static void eFSP_UtilsTST_Budget(void)
+{
+    /* Local variable */
+    t_eFSS_TYPE_ScrubBudget l_tBudget;
+    t_eFSS_TYPE_TimeCtx l_tTime;
+
+    /* No limit at all, and a page limit only */
+    l_tBudget.uMaxPage = 0u;
+    l_tBudget.uMaxTime = 0u;
+    if( false == eFSS_Utils_IsBudgetEnded(NULL, NULL, l_tBudget, 0u, MAX_UINT32VAL) )
+    {
+        l_tBudget.uMaxPage = 2u;
+        if( ( false == eFSS_Utils_IsBudgetEnded(NULL, NULL, l_tBudget, 0u, 1u) ) &&
+            ( true == eFSS_Utils_IsBudgetEnded(NULL, NULL, l_tBudget, 0u, 2u) ) )
+        {
+            (void)printf("eFSP_UtilsTST_Budget 1  -- OK \n");
+        }
+        else
+        {
+            (void)printf("eFSP_UtilsTST_Budget 1  -- FAIL \n");
+        }
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Budget 1  -- FAIL \n");
+    }
+
+    /* Time limit is ignored without the callback */
+    l_tBudget.uMaxPage = 0u;
+    l_tBudget.uMaxTime = 1u;
+    if( false == eFSS_Utils_IsBudgetEnded(NULL, NULL, l_tBudget, 0u, 1u) )
+    {
+        (void)printf("eFSP_UtilsTST_Budget 2  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Budget 2  -- FAIL \n");
+    }
+
+    /* Every read of the time advance it by 5, 15 - MAX_UINT32VAL is an elapsed time of 16 */
+    l_tTime.uTime = 0u;
+    l_tBudget.uMaxTime = 10u;
+    if( ( false == eFSS_Utils_IsBudgetEnded(&l_tTime, eFSS_UtilsTST_TimeAdapt, l_tBudget, 0u, 1u) ) &&
+        ( true == eFSS_Utils_IsBudgetEnded(&l_tTime, eFSS_UtilsTST_TimeAdapt, l_tBudget, 0u, 1u) ) &&
+        ( true == eFSS_Utils_IsBudgetEnded(&l_tTime, eFSS_UtilsTST_TimeAdapt, l_tBudget, MAX_UINT32VAL, 1u) ) )
+    {
+        (void)printf("eFSP_UtilsTST_Budget 3  -- OK \n");
+    }
+    else
+    {
+        (void)printf("eFSP_UtilsTST_Budget 3  -- FAIL \n");
+    }
+}
+
+static bool_t eFSS_UtilsTST_TimeAdapt(t_eFSS_TYPE_TimeCtx* const p_ptCtx, uint32_t* const p_puTime)
+{
+    bool_t l_bRes;
+
+    if( ( NULL == p_ptCtx ) || ( NULL == p_puTime ) )
+    {
+        l_bRes = false;
+    }
+    else
+    {
+        p_ptCtx->uTime += 5u;
+        *p_puTime = p_ptCtx->uTime;
+        l_bRes = true;
+    }
+
+    return l_bRes;
+}
+
+static double eFSS_UtilsTST_MBs(const clock_t p_tStart, const uint32_t p_uLoop, const uint32_t p_uLen)
+{
+    double l_dSec;
+
+    l_dSec = (double)( clock() - p_tStart ) / (double)CLOCKS_PER_SEC;
+
+    if( l_dSec <= 0.0 )
+    {
+        l_dSec = 1.0 / (double)CLOCKS_PER_SEC;
+    }
+
+    return ( (double)p_uLoop * (double)p_uLen ) / ( l_dSec * 1000000.0 );
+}
\ No newline at end of file